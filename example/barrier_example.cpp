@@ -0,0 +1,92 @@
+/*!
+  \file barrier_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <thread>
+#include <vector>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/barrier.hpp"
+
+namespace {
+
+/*!
+  \details Measure the average phase turnaround time of the given barrier
+  */
+template <typename Func>
+double measurePhaseTurnaround(const std::size_t num_of_threads,
+                              const std::size_t num_of_phases,
+                              Func arrive_and_wait)
+{
+  auto job = [num_of_phases, &arrive_and_wait]()
+  {
+    for (std::size_t phase = 0; phase < num_of_phases; ++phase)
+      arrive_and_wait();
+  };
+
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  {
+    std::vector<std::thread> worker_list;
+    worker_list.reserve(num_of_threads);
+    for (std::size_t i = 0; i < num_of_threads; ++i)
+      worker_list.emplace_back(job);
+    for (std::thread& worker : worker_list)
+      worker.join();
+  }
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Nano = std::chrono::duration<double, std::nano>;
+  const double t = std::chrono::duration_cast<Nano>(elapsed_time).count();
+  return t / static_cast<double>(num_of_phases);
+}
+
+} // namespace
+
+int main()
+{
+  // Barrier example
+  std::cout << "## Barrier example" << std::endl;
+  constexpr std::size_t num_of_phases = 100'000;
+  const std::size_t num_of_threads = (std::max)(2u, std::thread::hardware_concurrency());
+  std::cout << "  Threads: " << num_of_threads << ", phases: " << num_of_phases << std::endl;
+
+  // zisc::Barrier
+  {
+    zisc::Barrier barrier{static_cast<int>(num_of_threads)};
+    const double t = ::measurePhaseTurnaround(num_of_threads, num_of_phases, [&barrier]()
+    {
+      barrier.arriveAndWait();
+    });
+    std::cout << "  zisc::Barrier phase turnaround: " << t << " ns" << std::endl;
+  }
+  // std::barrier
+  {
+    std::barrier barrier{static_cast<std::ptrdiff_t>(num_of_threads)};
+    const double t = ::measurePhaseTurnaround(num_of_threads, num_of_phases, [&barrier]()
+    {
+      barrier.arrive_and_wait();
+    });
+    std::cout << "  std::barrier  phase turnaround: " << t << " ns" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+/*!
+  \file binary_serializer_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <sstream>
+#include <string_view>
+#include <vector>
+// Zisc
+#include "zisc/binary_reader.hpp"
+#include "zisc/binary_serializer.hpp"
+#include "zisc/binary_writer.hpp"
+#include "zisc/stopwatch.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in seconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Seconds = std::chrono::duration<double>;
+  return std::chrono::duration_cast<Seconds>(elapsed_time).count();
+}
+
+/*!
+  \details Print the throughput of the given function
+  */
+template <typename Func>
+void printThroughput(const std::string_view name, const std::size_t size, Func func)
+{
+  const double t = ::measure(func);
+  const double mb = static_cast<double>(size) / (1024.0 * 1024.0);
+  std::cout << "    " << name << ": " << t << " s, " << (mb / t) << " MB/s" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  // Binary serializer example
+  std::cout << "## Binary serializer example" << std::endl;
+
+  const std::size_t n = (1 < argc) ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+  std::vector<double> value_list(n);
+  std::iota(value_list.begin(), value_list.end(), 0.5);
+  std::vector<double> result_list(n);
+  const std::size_t size = n * sizeof(double);
+
+  std::cout << "  Write " << n << " doubles" << std::endl;
+  std::stringstream data_stream{std::ios_base::in |
+                                std::ios_base::out |
+                                std::ios_base::binary};
+  ::printThroughput("stream per value", size, [&]()
+  {
+    for (const double& value : value_list)
+      zisc::BSerializer::write(&value, &data_stream);
+  });
+  std::pmr::memory_resource* mem_resource = std::pmr::get_default_resource();
+  zisc::BinaryWriter<std::endian::little> writer{mem_resource};
+  ::printThroughput("buffer per value", size, [&]()
+  {
+    for (const double& value : value_list)
+      writer.write(value);
+  });
+  writer.clear();
+  ::printThroughput("buffer span", size, [&]()
+  {
+    writer.write(std::span{value_list});
+  });
+  zisc::BinaryWriter<std::endian::big> swapped_writer{mem_resource};
+  ::printThroughput("buffer span (byte swap)", size, [&]()
+  {
+    swapped_writer.write(std::span{value_list});
+  });
+
+  std::cout << "  Read " << n << " doubles" << std::endl;
+  ::printThroughput("stream per value", size, [&]()
+  {
+    for (double& value : result_list)
+      zisc::BSerializer::read(&value, &data_stream);
+  });
+  zisc::BinaryReader<std::endian::little> reader{writer.data()};
+  ::printThroughput("buffer per value", size, [&]()
+  {
+    for (double& value : result_list)
+      reader.read(&value);
+  });
+  reader.seek(0);
+  ::printThroughput("buffer span", size, [&]()
+  {
+    reader.read(std::span{result_list});
+  });
+  zisc::BinaryReader<std::endian::big> swapped_reader{swapped_writer.data()};
+  ::printThroughput("buffer span (byte swap)", size, [&]()
+  {
+    swapped_reader.read(std::span{result_list});
+  });
+
+  const bool is_same = value_list == result_list;
+  std::cout << "  Round trip: " << (is_same ? "ok" : "failed") << std::endl;
+
+  return is_same ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,118 @@
+/*!
+  \file columnar_csv_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/columnar_csv.hpp"
+#include "zisc/string/csv.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in seconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Seconds = std::chrono::duration<double>;
+  return std::chrono::duration_cast<Seconds>(elapsed_time).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  using Csv = zisc::Csv<int, std::string_view, double, bool>;
+  using ColumnarCsv = zisc::ColumnarCsv<int, std::string_view, double, bool>;
+  // Columnar CSV example
+  std::cout << "## Columnar CSV example" << std::endl;
+
+  const std::size_t num_of_records = (1 < argc) ? std::strtoull(argv[1], nullptr, 10)
+                                                : 1'000'000;
+  std::string text;
+  for (std::size_t i = 0; i < num_of_records; ++i) {
+    text += std::to_string(i % 100'000) + R"(, "record name )" + std::to_string(i) +
+            R"(", )" + std::to_string(0.5 * static_cast<double>(i % 1000)) + ", " +
+            (((i % 2) == 0) ? "true" : "false") + "\n";
+  }
+
+  zisc::AllocFreeResource mem_resource;
+  Csv csv{&mem_resource};
+  csv.append(text);
+  ColumnarCsv columnar_csv{&mem_resource};
+  columnar_csv.append(text);
+  std::cout << "  Records: " << csv.rowSize() << std::endl;
+
+  // Scan a float column
+  constexpr std::size_t num_of_scans = 20;
+  double sum1 = 0.0;
+  const double t1 = ::measure([&csv, &sum1]()
+  {
+    for (std::size_t n = 0; n < num_of_scans; ++n) {
+      for (std::size_t row = 0; row < csv.rowSize(); ++row)
+        sum1 += csv.get<2>(row);
+    }
+  });
+  double sum2 = 0.0;
+  const double t2 = ::measure([&columnar_csv, &sum2]()
+  {
+    for (std::size_t n = 0; n < num_of_scans; ++n) {
+      const std::span<const double> column = columnar_csv.column<2>();
+      for (const double value : column)
+        sum2 += value;
+    }
+  });
+  std::cout << "  Scan a float column (" << num_of_scans << " times):" << std::endl;
+  std::cout << "    Csv (records)      : " << t1 << " s, sum=" << sum1 << std::endl;
+  std::cout << "    ColumnarCsv (span) : " << t2 << " s, sum=" << sum2 << std::endl;
+
+  // Scan a bool column
+  std::size_t count1 = 0;
+  const double t3 = ::measure([&csv, &count1]()
+  {
+    for (std::size_t n = 0; n < num_of_scans; ++n) {
+      for (std::size_t row = 0; row < csv.rowSize(); ++row)
+        count1 += csv.get<3>(row) ? 1 : 0;
+    }
+  });
+  std::size_t count2 = 0;
+  const double t4 = ::measure([&columnar_csv, &count2]()
+  {
+    for (std::size_t n = 0; n < num_of_scans; ++n) {
+      const std::span<const zisc::uint8b> column = columnar_csv.column<3>();
+      for (const zisc::uint8b value : column)
+        count2 += value;
+    }
+  });
+  std::cout << "  Scan a bool column (" << num_of_scans << " times):" << std::endl;
+  std::cout << "    Csv (records)      : " << t3 << " s, count=" << count1 << std::endl;
+  std::cout << "    ColumnarCsv (span) : " << t4 << " s, count=" << count2 << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*!
+  \file csv_load_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/csv.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in seconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Seconds = std::chrono::duration<double>;
+  return std::chrono::duration_cast<Seconds>(elapsed_time).count();
+}
+
+/*!
+  \details Print the resident memory of the process
+  */
+void printResidentMemory()
+{
+#if defined(Z_LINUX)
+  std::ifstream status{"/proc/self/status"};
+  for (std::string line; std::getline(status, line);) {
+    const std::string_view l = line;
+    if (l.starts_with("RssAnon:") || l.starts_with("RssFile:"))
+      std::cout << "    " << l << std::endl;
+  }
+#else // Z_LINUX
+  std::cout << "    Resident memory isn't available on this platform." << std::endl;
+#endif // Z_LINUX
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  using Csv = zisc::Csv<int, std::string_view, double, bool>;
+  // CSV load example
+  std::cout << "## CSV load example" << std::endl;
+
+  // Generate a CSV file of the given size in MB
+  const std::size_t file_size = ((1 < argc) ? std::strtoull(argv[1], nullptr, 10) : 1024) *
+                                1024 * 1024;
+  const std::filesystem::path file_path = std::filesystem::temp_directory_path() /
+                                          "zisc_csv_load_example.csv";
+  std::size_t num_of_records = 0;
+  {
+    std::ofstream file{file_path, std::ios_base::binary};
+    std::string record;
+    for (std::size_t size = 0; size < file_size; size += record.size(), ++num_of_records) {
+      const std::size_t i = num_of_records;
+      record = std::to_string(i % 100'000) + R"(, "record name )" + std::to_string(i) +
+               R"(", )" + std::to_string(0.5 * static_cast<double>(i % 1000)) + ", " +
+               (((i % 2) == 0) ? "true" : "false") + "\n";
+      file << record;
+    }
+  }
+  const double mb = static_cast<double>(std::filesystem::file_size(file_path)) /
+                    (1024.0 * 1024.0);
+  std::cout << "  Records: " << num_of_records << ", size: " << mb << " MB" << std::endl;
+  std::cout << "  Before loading:" << std::endl;
+  ::printResidentMemory();
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    Csv csv{&mem_resource};
+    csv.setCapacity(num_of_records);
+    const double t = ::measure([&csv, &file_path]()
+    {
+      csv.appendFile(file_path);
+    });
+    std::cout << "  appendFile (mapped, zero-copy): " << t << " s, "
+              << (mb / t) << " MB/s" << std::endl;
+    ::printResidentMemory();
+  }
+  {
+    zisc::ThreadManager thread_manager{&mem_resource};
+    Csv csv{&mem_resource};
+    csv.setCapacity(num_of_records);
+    const double t = ::measure([&csv, &file_path, &thread_manager]()
+    {
+      csv.appendFileParallel(file_path, thread_manager);
+    });
+    std::cout << "  appendFileParallel (" << thread_manager.numOfThreads() << " threads): "
+              << t << " s, " << (mb / t) << " MB/s" << std::endl;
+    ::printResidentMemory();
+  }
+  {
+    Csv csv{&mem_resource};
+    csv.setCapacity(num_of_records);
+    const double t = ::measure([&csv, &file_path]()
+    {
+      std::ifstream file{file_path, std::ios_base::binary};
+      csv.append(file);
+    });
+    std::cout << "  append(std::istream&) (copy): " << t << " s, "
+              << (mb / t) << " MB/s" << std::endl;
+    ::printResidentMemory();
+  }
+  std::filesystem::remove(file_path);
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+/*!
+  \file csv_parse_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/csv.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in seconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Seconds = std::chrono::duration<double>;
+  return std::chrono::duration_cast<Seconds>(elapsed_time).count();
+}
+
+} // namespace
+
+int main()
+{
+  using Csv = zisc::Csv<int, std::string_view, double, bool>;
+  // CSV parse example
+  std::cout << "## CSV parse example" << std::endl;
+
+  constexpr std::size_t num_of_records = 200'000;
+  std::string csv_text;
+  for (std::size_t i = 0; i < num_of_records; ++i) {
+    csv_text += std::to_string(i) + R"(, "record )" + std::to_string(i) + R"(", )" +
+                std::to_string(0.5 * static_cast<double>(i)) + ", " +
+                (((i % 2) == 0) ? "true" : "false") + "\n";
+  }
+  const double mb = static_cast<double>(csv_text.size()) / (1024.0 * 1024.0);
+  std::cout << "  Records: " << num_of_records << ", size: " << mb << " MB" << std::endl;
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    Csv csv{&mem_resource};
+    csv.setCapacity(num_of_records);
+    std::istringstream csv_stream{csv_text};
+    const double t = ::measure([&csv, &csv_stream]()
+    {
+      csv.append(csv_stream);
+    });
+    std::cout << "  append(std::istream&): " << (mb / t) << " MB/s" << std::endl;
+  }
+  {
+    Csv csv{&mem_resource};
+    csv.setCapacity(num_of_records);
+    const double t = ::measure([&csv, &csv_text]()
+    {
+      csv.append(csv_text);
+    });
+    std::cout << "  append(std::string_view): " << (mb / t) << " MB/s" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,246 @@
+/*!
+  \file hash_engine_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/hash/fnv_1a_hash_engine.hpp"
+#include "zisc/hash/tree_hash.hpp"
+#include "zisc/hash/wy_hash_engine.hpp"
+#include "zisc/hash/xxh3_hash_engine.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in seconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Seconds = std::chrono::duration<double>;
+  return std::chrono::duration_cast<Seconds>(elapsed_time).count();
+}
+
+/*!
+  \details Print the throughput of the given hash for keys of the given size
+  */
+template <typename Hash>
+void printThroughput(const std::vector<zisc::uint8b>& data, const std::size_t key_size)
+{
+  constexpr std::size_t total_size = 256 * 1024 * 1024;
+  const std::size_t n = total_size / key_size;
+  const std::size_t num_of_keys = data.size() / key_size;
+  zisc::uint64b sum = 0;
+  const double t = ::measure([&]()
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      sum += Hash::hash(data.data() + (i % num_of_keys) * key_size, key_size);
+  });
+  const double mb = static_cast<double>(n * key_size) / (1024.0 * 1024.0);
+  std::cout << std::setw(12) << (mb / t) << " MB/s"
+            << " (" << std::setw(10) << (static_cast<double>(n) / t) << " keys/s, sum "
+            << (sum >> 56) << ")" << std::endl;
+}
+
+/*!
+  \details Print the worst bias of the avalanche test.
+  Each input bit is flipped and the probability that each output bit flips
+  is measured. The bias is |2p - 1|, which is 0 for an ideal hash
+  */
+template <typename Hash, std::size_t kKeySize>
+void printAvalanche(std::mt19937_64& engine)
+{
+  constexpr std::size_t num_of_trials = 20'000;
+  constexpr std::size_t num_of_input_bits = 8 * kKeySize;
+  constexpr std::size_t num_of_output_bits = 64;
+  std::vector<std::size_t> counts(num_of_input_bits * num_of_output_bits, 0);
+  std::array<zisc::uint8b, kKeySize> key{};
+  for (std::size_t trial = 0; trial < num_of_trials; ++trial) {
+    std::generate(key.begin(), key.end(), [&engine]() {return static_cast<zisc::uint8b>(engine());});
+    const zisc::uint64b h = Hash::hash(key.data(), key.size());
+    for (std::size_t i = 0; i < num_of_input_bits; ++i) {
+      key[i / 8] ^= static_cast<zisc::uint8b>(1u << (i % 8));
+      const zisc::uint64b d = h ^ Hash::hash(key.data(), key.size());
+      key[i / 8] ^= static_cast<zisc::uint8b>(1u << (i % 8));
+      for (std::size_t o = 0; o < num_of_output_bits; ++o)
+        counts[i * num_of_output_bits + o] += (d >> o) & 1u;
+    }
+  }
+  double worst_bias = 0.0;
+  for (const std::size_t count : counts) {
+    const double p = static_cast<double>(count) / static_cast<double>(num_of_trials);
+    worst_bias = (std::max)(worst_bias, std::abs(2.0 * p - 1.0));
+  }
+  std::cout << "    " << std::setw(3) << kKeySize << " bytes key: worst bias "
+            << (100.0 * worst_bias) << " %" << std::endl;
+}
+
+/*!
+  \details No detailed description
+  */
+template <typename Hash>
+void testHash(const std::string_view name,
+              const std::vector<zisc::uint8b>& data,
+              std::mt19937_64& engine)
+{
+  std::cout << "  " << name << std::endl;
+  std::cout << "    throughput" << std::endl;
+  for (const std::size_t key_size : {8, 16, 64, 256, 4096, 65536}) {
+    std::cout << "    " << std::setw(6) << key_size << " bytes: ";
+    ::printThroughput<Hash>(data, key_size);
+  }
+  std::cout << "    avalanche (1 sigma of the sampling noise is about 0.7 %)" << std::endl;
+  ::printAvalanche<Hash, 4>(engine);
+  ::printAvalanche<Hash, 16>(engine);
+  ::printAvalanche<Hash, 64>(engine);
+  ::printAvalanche<Hash, 256>(engine);
+}
+
+/*!
+  \details Compare hashing many small keys one by one with the batch hash
+  */
+template <typename Hash>
+void testBatchHash(const std::string_view name, const std::vector<zisc::uint8b>& data)
+{
+  using ValueT = typename Hash::ValueT;
+  constexpr std::size_t num_of_keys = 1 << 20;
+  constexpr std::size_t num_of_rounds = 8;
+  std::cout << "  batch hash (" << name << ", " << num_of_keys << " keys)" << std::endl;
+  std::vector<ValueT> values(num_of_keys);
+  auto print = [](const std::string& label, const double t1, const double t2)
+  {
+    const double keys = static_cast<double>(num_of_keys * num_of_rounds);
+    std::cout << "    " << std::setw(8) << label << ": "
+              << std::setw(12) << (keys / t1) << " keys/s (one by one), "
+              << std::setw(12) << (keys / t2) << " keys/s (batch)" << std::endl;
+  };
+  for (const std::size_t key_size : {8, 16, 32}) {
+    std::vector<std::string_view> keys(num_of_keys);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      const auto* p = reinterpret_cast<const char*>(data.data()) + (i * key_size) % (data.size() - key_size);
+      keys[i] = std::string_view{p, key_size};
+    }
+    const double t1 = ::measure([&]()
+    {
+      for (std::size_t r = 0; r < num_of_rounds; ++r)
+        for (std::size_t i = 0; i < keys.size(); ++i)
+          values[i] = Hash::hash(keys[i]);
+    });
+    const double t2 = ::measure([&]()
+    {
+      for (std::size_t r = 0; r < num_of_rounds; ++r)
+        Hash::hashBatch(keys, values);
+    });
+    print(std::to_string(key_size) + " bytes", t1, t2);
+  }
+  {
+    std::vector<zisc::uint64b> keys(num_of_keys);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      keys[i] = i * 0x9e37'79b9'7f4a'7c15ull;
+    const double t1 = ::measure([&]()
+    {
+      for (std::size_t r = 0; r < num_of_rounds; ++r)
+        for (std::size_t i = 0; i < keys.size(); ++i)
+          values[i] = Hash::hash(keys[i]);
+    });
+    const double t2 = ::measure([&]()
+    {
+      for (std::size_t r = 0; r < num_of_rounds; ++r)
+        Hash::hashBatch(std::span<const zisc::uint64b>{keys}, values);
+    });
+    print("uint64", t1, t2);
+  }
+}
+
+/*!
+  \details Print the throughput of the tree hash for each number of threads
+  */
+template <typename Hash>
+void testTreeHash(const std::string_view name)
+{
+  using TreeHash = zisc::TreeHash<Hash>;
+  std::cout << "  tree hash (" << name << ", 256 MB)" << std::endl;
+  std::vector<zisc::uint8b> data(256 * 1024 * 1024);
+  for (std::size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<zisc::uint8b>(i * 0x9e37'79b1u >> 24);
+  const double mb = static_cast<double>(data.size()) / (1024.0 * 1024.0);
+
+  zisc::uint64b expected = 0;
+  const double t = ::measure([&]()
+  {
+    expected = TreeHash::hash(std::span{data});
+  });
+  std::cout << "    sequential: " << std::setw(12) << (mb / t) << " MB/s" << std::endl;
+
+  zisc::AllocFreeResource mem_resource;
+  const auto max_threads = static_cast<zisc::int64b>(std::thread::hardware_concurrency());
+  for (zisc::int64b num_of_threads = 1; num_of_threads <= max_threads; num_of_threads *= 2) {
+    zisc::ThreadManager thread_manager{num_of_threads, &mem_resource};
+    zisc::uint64b result = 0;
+    const double tp = ::measure([&]()
+    {
+      result = TreeHash::hash(std::span{data}, thread_manager, &mem_resource);
+    });
+    std::cout << "    " << std::setw(3) << num_of_threads << " threads: "
+              << std::setw(12) << (mb / tp) << " MB/s"
+              << ((result == expected) ? "" : " (mismatch)") << std::endl;
+  }
+}
+
+} // namespace
+
+int main(int /* argc */, char** /* argv */)
+{
+  // Hash engine example
+  std::cout << "## Hash engine example" << std::endl;
+
+  std::mt19937_64 engine{123'456'789};
+  std::vector<zisc::uint8b> data(1024 * 1024);
+  std::generate(data.begin(), data.end(), [&engine]() {return static_cast<zisc::uint8b>(engine());});
+
+  // The hash values are also available at compile time
+  static_assert(zisc::Xxh3Hash64::hash("zisc") != zisc::WyHash64::hash("zisc"));
+
+  ::testHash<zisc::Fnv1aHash64>("FNV-1a 64", data, engine);
+  ::testHash<zisc::Xxh3Hash64>("XXH3 64", data, engine);
+  ::testHash<zisc::WyHash64>("wyhash 64", data, engine);
+  ::testBatchHash<zisc::Fnv1aHash64>("FNV-1a 64", data);
+  ::testBatchHash<zisc::Xxh3Hash64>("XXH3 64", data);
+  ::testTreeHash<zisc::Xxh3Hash64>("XXH3 64");
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/*!
+  \file json_document_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <string_view>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/string/json_document.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in seconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Seconds = std::chrono::duration<double>;
+  return std::chrono::duration_cast<Seconds>(elapsed_time).count();
+}
+
+/*!
+  \details Make a telemetry log which has the given number of records
+  */
+std::string makeTelemetry(const std::size_t n)
+{
+  std::mt19937_64 engine{123'456'789};
+  std::uniform_real_distribution<double> dist{-1.0e3, 1.0e3};
+  std::string json = "{\"device\": \"sensor-array\", \"records\": [\n";
+  for (std::size_t i = 0; i < n; ++i) {
+    json += "  {\"id\": " + std::to_string(i) +
+            ", \"time\": " + std::to_string(1'600'000'000'000 + i * 10) +
+            ", \"position\": [" + std::to_string(dist(engine)) + ", " +
+            std::to_string(dist(engine)) + ", " + std::to_string(dist(engine)) + "]" +
+            ", \"status\": \"" + (((i % 5) == 0) ? "warn\\tretry" : "ok") + "\"" +
+            ", \"valid\": " + (((i % 2) == 0) ? "true" : "false") + "}" +
+            (((i + 1) < n) ? ",\n" : "\n");
+  }
+  json += "]}\n";
+  return json;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  // JSON document example
+  std::cout << "## JSON document example" << std::endl;
+
+  const std::size_t n = (1 < argc) ? std::strtoull(argv[1], nullptr, 10) : 500'000;
+  const std::string json = ::makeTelemetry(n);
+  const double mb = static_cast<double>(json.size()) / (1024.0 * 1024.0);
+  std::cout << "  Document: " << mb << " MB" << std::endl;
+
+  zisc::JsonDocument document{std::pmr::get_default_resource()};
+  // The storage of the first parse is reused by the second
+  document.parse(json);
+  const double parse_time = ::measure([&document, &json]()
+  {
+    document.parse(json);
+  });
+  std::cout << "  Parse          : " << parse_time << " s, " << (mb / parse_time) << " MB/s, "
+            << document.tape().size() << " tape words" << std::endl;
+
+  // Values are converted only when they are accessed
+  volatile double sum = 0.0;
+  volatile std::int64_t num_of_valid = 0;
+  const double access_time = ::measure([&document, &sum, &num_of_valid]()
+  {
+    double s = 0.0;
+    std::int64_t v = 0;
+    for (const zisc::JsonDocument::Value record : document.root()["records"]) {
+      for (const zisc::JsonDocument::Value p : record["position"])
+        s += p.toFloat<double>();
+      s += static_cast<double>(record["id"].toInteger<std::int64_t>());
+      v += record["valid"].toBool() ? 1 : 0;
+    }
+    sum = s;
+    num_of_valid = v;
+  });
+  std::cout << "  Access all     : " << access_time << " s, " << (mb / access_time) << " MB/s"
+            << std::endl;
+  std::cout << "  Valid records  : " << num_of_valid << " / "
+            << document.root()["records"].size() << std::endl;
+
+  return 0;
+}
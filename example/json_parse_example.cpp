@@ -0,0 +1,187 @@
+/*!
+  \file json_parse_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/string/json_value_parser.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in seconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Seconds = std::chrono::duration<double>;
+  return std::chrono::duration_cast<Seconds>(elapsed_time).count();
+}
+
+/*!
+  \details Split the given text into values separated by ','
+  */
+std::vector<std::string_view> split(const std::string& text)
+{
+  std::vector<std::string_view> value_list;
+  for (std::size_t begin = 0; begin < text.size();) {
+    const std::size_t end = text.find(',', begin);
+    value_list.emplace_back(text.data() + begin, end - begin);
+    begin = end + 1;
+  }
+  return value_list;
+}
+
+/*!
+  \details Print the throughput of the given function
+  */
+template <typename Func>
+void printThroughput(const std::string_view name, const double mb, Func func)
+{
+  const double t = ::measure(func);
+  std::cout << "    " << name << ": " << t << " s, " << (mb / t) << " MB/s" << std::endl;
+}
+
+//! The regex of JSON integer which the previous parser used
+constexpr char kIntegerPattern[] = R"(-?(?:[1-9][0-9]*|0))";
+
+//! The regex of JSON float which the previous parser used
+constexpr char kFloatPattern[] = R"(-?(?:[1-9][0-9]*|0)(?:\.[0-9]+)?(?:[eE][+-]?[0-9]+)?)";
+
+//! The regex options which the previous parser used
+constexpr std::regex::flag_type kRegexOptions = std::regex_constants::nosubs |
+                                                std::regex_constants::optimize |
+                                                std::regex_constants::ECMAScript;
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  using zisc::JsonValueParser;
+  // JSON value parse example
+  std::cout << "## JSON value parse example" << std::endl;
+
+  const std::size_t n = (1 < argc) ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+  std::mt19937_64 engine{123'456'789};
+  std::string int_text;
+  std::string float_text;
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto v = static_cast<std::int64_t>(engine() >> (engine() % 60));
+    int_text += std::to_string(((i % 2) == 0) ? v : -v) + ",";
+    const double f = std::uniform_real_distribution<double>{-1.0e3, 1.0e3}(engine);
+    float_text += std::to_string(f) + (((i % 3) == 0) ? "e-12," : ",");
+  }
+  const std::vector<std::string_view> int_list = ::split(int_text);
+  const std::vector<std::string_view> float_list = ::split(float_text);
+  const double int_mb = static_cast<double>(int_text.size()) / (1024.0 * 1024.0);
+  const double float_mb = static_cast<double>(float_text.size()) / (1024.0 * 1024.0);
+  std::cout << "  Integers: " << int_mb << " MB, floats: " << float_mb << " MB" << std::endl;
+
+  // The previous path: validation by std::regex and conversion by strto*.
+  // strto* works only because a value is followed by ',' in the text
+  const std::regex int_regex{::kIntegerPattern, ::kRegexOptions};
+  const std::regex float_regex{::kFloatPattern, ::kRegexOptions};
+  volatile std::int64_t int_sum = 0;
+  volatile double float_sum = 0.0;
+
+  std::cout << "  Integer conversion:" << std::endl;
+  ::printThroughput("strtoll              ", int_mb, [&int_list, &int_sum]()
+  {
+    std::int64_t sum = 0;
+    for (const std::string_view value : int_list)
+      sum += std::strtoll(value.data(), nullptr, 10);
+    int_sum = sum;
+  });
+  ::printThroughput("toCxxInteger         ", int_mb, [&int_list, &int_sum]()
+  {
+    std::int64_t sum = 0;
+    for (const std::string_view value : int_list)
+      sum += JsonValueParser::toCxxInteger<std::int64_t>(value);
+    int_sum = sum;
+  });
+  std::cout << "  Integer validation and conversion:" << std::endl;
+  ::printThroughput("std::regex + strtoll ", int_mb, [&int_list, &int_sum, &int_regex]()
+  {
+    std::int64_t sum = 0;
+    for (const std::string_view value : int_list) {
+      if (std::regex_match(value.begin(), value.end(), int_regex))
+        sum += std::strtoll(value.data(), nullptr, 10);
+    }
+    int_sum = sum;
+  });
+  ::printThroughput("toCxxInteger(checked)", int_mb, [&int_list, &int_sum]()
+  {
+    std::int64_t sum = 0;
+    for (const std::string_view value : int_list) {
+      std::int64_t v = 0;
+      if (JsonValueParser::toCxxInteger(value, &v))
+        sum += v;
+    }
+    int_sum = sum;
+  });
+
+  std::cout << "  Float conversion:" << std::endl;
+  ::printThroughput("strtod               ", float_mb, [&float_list, &float_sum]()
+  {
+    double sum = 0.0;
+    for (const std::string_view value : float_list)
+      sum += std::strtod(value.data(), nullptr);
+    float_sum = sum;
+  });
+  ::printThroughput("toCxxFloat           ", float_mb, [&float_list, &float_sum]()
+  {
+    double sum = 0.0;
+    for (const std::string_view value : float_list)
+      sum += JsonValueParser::toCxxFloat<double>(value);
+    float_sum = sum;
+  });
+  std::cout << "  Float validation and conversion:" << std::endl;
+  ::printThroughput("std::regex + strtod  ", float_mb, [&float_list, &float_sum, &float_regex]()
+  {
+    double sum = 0.0;
+    for (const std::string_view value : float_list) {
+      if (std::regex_match(value.begin(), value.end(), float_regex))
+        sum += std::strtod(value.data(), nullptr);
+    }
+    float_sum = sum;
+  });
+  ::printThroughput("toCxxFloat(checked)  ", float_mb, [&float_list, &float_sum]()
+  {
+    double sum = 0.0;
+    for (const std::string_view value : float_list) {
+      double v = 0.0;
+      if (JsonValueParser::toCxxFloat(value, &v))
+        sum += v;
+    }
+    float_sum = sum;
+  });
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+/*!
+  \file task_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+#include <numeric>
+#include <utility>
+#include <vector>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/task.hpp"
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+
+namespace {
+
+zisc::Task<zisc::int64b> handleRequest([[maybe_unused]] std::pmr::memory_resource* mem_resource,
+                                       zisc::ThreadManager& thread_manager,
+                                       const zisc::int64b request)
+{
+  // Move to a worker thread
+  [[maybe_unused]] const zisc::int64b thread_id = co_await thread_manager.schedule();
+  co_return request * request;
+}
+
+} // namespace
+
+int main()
+{
+  // Task example
+  std::cout << "## Task example" << std::endl;
+  zisc::AllocFreeResource mem_resource;
+  zisc::ThreadManager thread_manager{&mem_resource};
+  thread_manager.setCapacity(1 << 16);
+
+  constexpr zisc::int64b num_of_requests = 10'000;
+  std::pmr::vector<zisc::Task<zisc::int64b>> task_list{&mem_resource};
+  task_list.reserve(num_of_requests);
+  for (zisc::int64b request = 0; request < num_of_requests; ++request)
+    task_list.emplace_back(::handleRequest(&mem_resource, thread_manager, request));
+
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  const std::pmr::vector<zisc::int64b> result_list = zisc::syncWait(
+      &mem_resource,
+      zisc::whenAll(&mem_resource, std::move(task_list)));
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  const zisc::int64b sum = std::accumulate(result_list.begin(), result_list.end(),
+                                           zisc::int64b{0});
+  using Micro = std::chrono::duration<double, std::micro>;
+  const double t = std::chrono::duration_cast<Micro>(elapsed_time).count();
+  std::cout << "  Requests: " << num_of_requests << ", threads: "
+            << thread_manager.numOfThreads() << std::endl;
+  std::cout << "  Sum: " << sum << ", elapsed time: " << t << " us" << std::endl;
+
+  return 0;
+}
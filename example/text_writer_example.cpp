@@ -0,0 +1,154 @@
+/*!
+  \file text_writer_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <random>
+#include <sstream>
+#include <string_view>
+#include <vector>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/string/csv_writer.hpp"
+#include "zisc/string/json_writer.hpp"
+#include "zisc/string/write_buffer.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in seconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Seconds = std::chrono::duration<double>;
+  return std::chrono::duration_cast<Seconds>(elapsed_time).count();
+}
+
+/*!
+  \details Print the throughput of the given function
+  */
+template <typename Func>
+void printThroughput(const std::string_view name, const std::size_t n, Func func)
+{
+  std::size_t size = 0;
+  const double t = ::measure([&func, &size]()
+  {
+    size = func();
+  });
+  const double mb = static_cast<double>(size) / (1024.0 * 1024.0);
+  std::cout << "    " << name << ": " << t << " s, " << (mb / t) << " MB/s, "
+            << (static_cast<double>(n) / t) << " records/s" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  // Text writer example
+  std::cout << "## Text writer example" << std::endl;
+
+  const std::size_t n = (1 < argc) ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+  std::mt19937_64 engine{123'456'789};
+  std::uniform_real_distribution<double> dist{-1.0e3, 1.0e3};
+  std::vector<double> value_list;
+  value_list.reserve(3 * n);
+  for (std::size_t i = 0; i < 3 * n; ++i)
+    value_list.push_back(dist(engine));
+  std::pmr::memory_resource* mem_resource = std::pmr::get_default_resource();
+
+  std::cout << "  CSV records (id, x, y, z, label):" << std::endl;
+  ::printThroughput("std::ostream <<     ", n, [n, &value_list]()
+  {
+    std::ostringstream csv;
+    csv << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (std::size_t i = 0; i < n; ++i) {
+      csv << i << "," << value_list[3 * i] << "," << value_list[3 * i + 1] << ","
+          << value_list[3 * i + 2] << ",\"point\"\n";
+    }
+    return csv.str().size();
+  });
+  ::printThroughput("CsvWriter           ", n, [n, &value_list, mem_resource]()
+  {
+    zisc::WriteBuffer buffer{mem_resource};
+    zisc::CsvWriter<std::size_t, double, double, double, std::string_view> csv{buffer};
+    for (std::size_t i = 0; i < n; ++i)
+      csv.write(i, value_list[3 * i], value_list[3 * i + 1], value_list[3 * i + 2], "point");
+    return buffer.size();
+  });
+  ::printThroughput("CsvWriter (file)    ", n, [n, &value_list, mem_resource]()
+  {
+    std::FILE* file = std::tmpfile();
+    std::size_t size = 0;
+    {
+      zisc::WriteBuffer buffer{fileno(file), mem_resource};
+      zisc::CsvWriter<std::size_t, double, double, double, std::string_view> csv{buffer};
+      for (std::size_t i = 0; i < n; ++i)
+        csv.write(i, value_list[3 * i], value_list[3 * i + 1], value_list[3 * i + 2], "point");
+      buffer.flush();
+      size = buffer.totalFlushedSize();
+    }
+    std::fclose(file);
+    return size;
+  });
+
+  std::cout << "  JSON records:" << std::endl;
+  ::printThroughput("std::ostream <<     ", n, [n, &value_list]()
+  {
+    std::ostringstream json;
+    json << std::setprecision(std::numeric_limits<double>::max_digits10);
+    json << "[";
+    for (std::size_t i = 0; i < n; ++i) {
+      json << ((i == 0) ? "" : ",") << "{\"id\":" << i << ",\"position\":["
+           << value_list[3 * i] << "," << value_list[3 * i + 1] << ","
+           << value_list[3 * i + 2] << "]}";
+    }
+    json << "]";
+    return json.str().size();
+  });
+  ::printThroughput("JsonWriter          ", n, [n, &value_list, mem_resource]()
+  {
+    zisc::WriteBuffer buffer{mem_resource};
+    zisc::JsonWriter json{buffer};
+    json.beginArray();
+    for (std::size_t i = 0; i < n; ++i) {
+      json.beginObject();
+      json.key("id");
+      json.value(i);
+      json.key("position");
+      json.beginArray();
+      for (std::size_t j = 0; j < 3; ++j)
+        json.value(value_list[3 * i + j]);
+      json.endArray();
+      json.endObject();
+    }
+    json.endArray();
+    return buffer.size();
+  });
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*!
+  \file thread_manager_startup_example.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <thread>
+#include <vector>
+// Zisc
+#include "zisc/stopwatch.hpp"
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+
+namespace {
+
+/*!
+  \details Measure the elapsed time of the given function in microseconds
+  */
+template <typename Func>
+double measure(Func func)
+{
+  zisc::Stopwatch stopwatch;
+  stopwatch.start();
+  func();
+  const auto elapsed_time = stopwatch.elapsedTime();
+  stopwatch.stop();
+
+  using Micro = std::chrono::duration<double, std::micro>;
+  return std::chrono::duration_cast<Micro>(elapsed_time).count();
+}
+
+} // namespace
+
+int main()
+{
+  // ThreadManager startup example
+  std::cout << "## ThreadManager startup example" << std::endl;
+  zisc::AllocFreeResource mem_resource;
+  const zisc::int64b num_of_threads = zisc::ThreadManager::logicalCores();
+  std::cout << "  Threads: " << num_of_threads << std::endl;
+
+  // Raw thread start cost
+  {
+    const double t = ::measure([num_of_threads]()
+    {
+      std::vector<std::thread> worker_list;
+      worker_list.reserve(static_cast<std::size_t>(num_of_threads));
+      for (zisc::int64b i = 0; i < num_of_threads; ++i)
+        worker_list.emplace_back([](){});
+      for (std::thread& worker : worker_list)
+        worker.join();
+    });
+    std::cout << "  std::thread start and join: " << t << " us" << std::endl;
+  }
+
+  auto task = [](const zisc::int64b thread_id)
+  {
+    return thread_id;
+  };
+  {
+    std::optional<zisc::ThreadManager> manager;
+    const double t0 = ::measure([&manager, num_of_threads, &mem_resource]()
+    {
+      manager.emplace(num_of_threads, &mem_resource);
+    });
+    std::cout << "  ThreadManager construction: " << t0 << " us, running threads: "
+              << manager->numOfRunningThreads() << std::endl;
+
+    // The first enqueue spawns the workers
+    const double t1 = ::measure([&manager, &task]()
+    {
+      std::future<zisc::int64b> result = manager->enqueue(task);
+      [[maybe_unused]] const zisc::int64b id = result.get();
+    });
+    std::cout << "  First enqueue (spawn): " << t1 << " us, running threads: "
+              << manager->numOfRunningThreads() << std::endl;
+
+    const double t2 = ::measure([&manager, &task]()
+    {
+      std::future<zisc::int64b> result = manager->enqueue(task);
+      [[maybe_unused]] const zisc::int64b id = result.get();
+    });
+    std::cout << "  Warm enqueue: " << t2 << " us" << std::endl;
+
+    // Retire all parked workers
+    const std::chrono::milliseconds timeout{1};
+    manager->setIdleTimeout(timeout);
+    {
+      std::future<zisc::int64b> result = manager->enqueue(task);
+      [[maybe_unused]] const zisc::int64b id = result.get();
+    }
+    while (0 < manager->numOfRunningThreads())
+      std::this_thread::sleep_for(timeout);
+    const double t3 = ::measure([&manager, &task]()
+    {
+      std::future<zisc::int64b> result = manager->enqueue(task);
+      [[maybe_unused]] const zisc::int64b id = result.get();
+    });
+    std::cout << "  Enqueue after idle retirement (respawn): " << t3 << " us" << std::endl;
+
+    const double t4 = ::measure([&manager]()
+    {
+      manager.reset();
+    });
+    std::cout << "  ThreadManager destruction: " << t4 << " us" << std::endl;
+  }
+
+  return 0;
+}
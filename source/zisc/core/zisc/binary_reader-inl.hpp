@@ -0,0 +1,278 @@
+/*!
+  \file binary_reader-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_BINARY_READER_INL_HPP
+#define ZISC_BINARY_READER_INL_HPP
+
+#include "binary_reader.hpp"
+// Standard C++ library
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+// Zisc
+#include "binary_serializer.hpp"
+#include "bit.hpp"
+#include "concepts.hpp"
+#include "error.hpp"
+#include "utility.hpp"
+#include "zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] region No description.
+  */
+template <std::endian kEndian> inline
+BinaryReader<kEndian>::BinaryReader(std::span<const std::byte> region) noexcept :
+    region_{region}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryReader<kEndian>::data() const noexcept -> std::span<const std::byte>
+{
+  return region_;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <std::endian kEndian>
+template <TriviallyCopyable Type> inline
+constexpr auto BinaryReader<kEndian>::isMemcpyReadable() noexcept -> bool
+{
+  const bool result = (wireEndian() == std::endian::native) || (sizeof(Type) == 1);
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryReader<kEndian>::isEnd() const noexcept -> bool
+{
+  return remaining() == 0;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryReader<kEndian>::position() const noexcept -> std::size_t
+{
+  return position_;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  \exception SystemError The region doesn't have enough bytes
+  */
+template <std::endian kEndian>
+template <TriviallyCopyable Type> inline
+auto BinaryReader<kEndian>::read() -> Type
+{
+  Type value;
+  read(&value);
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [out] value No description.
+  \exception SystemError The region doesn't have enough bytes
+  */
+template <std::endian kEndian>
+template <TriviallyCopyable Type> inline
+void BinaryReader<kEndian>::read(Type* value)
+{
+  ZISC_ASSERT(value != nullptr, "The given value is null.");
+  checkBounds(sizeof(Type));
+  std::memcpy(value, region_.data() + position_, sizeof(Type));
+  if constexpr (!isMemcpyReadable<Type>()) {
+    static_assert(Arithmetic<Type> || std::is_enum_v<Type>,
+                  "Only arithmetic and enum types can be byte-swapped.");
+    *value = byteswap(*value);
+  }
+  position_ += sizeof(Type);
+}
+
+/*!
+  \details The values are read with a single memcpy if no byte swapping
+  is required
+
+  \tparam Type No description.
+  \tparam kExtent No description.
+  \param [out] values No description.
+  \exception SystemError The region doesn't have enough bytes
+  */
+template <std::endian kEndian>
+template <TriviallyCopyable Type, std::size_t kExtent> inline
+void BinaryReader<kEndian>::read(const std::span<Type, kExtent> values)
+{
+  static_assert(!std::is_const_v<Type>, "The values must be writable.");
+  const std::size_t n = values.size_bytes();
+  if (n == 0)
+    return;
+  checkBounds(n);
+  std::memcpy(values.data(), region_.data() + position_, n);
+  if constexpr (!isMemcpyReadable<Type>()) {
+    static_assert(Arithmetic<Type> || std::is_enum_v<Type>,
+                  "Only arithmetic and enum types can be byte-swapped.");
+    for (Type& value : values)
+      value = byteswap(value);
+  }
+  position_ += n;
+}
+
+/*!
+  \details The buffer is sized at once if the stream can tell the distance to its end,
+  otherwise the stream is read in chunks until the end.
+  The buffer must outlive the returned reader
+
+  \param [in,out] data_stream No description.
+  \param [out] buffer No description.
+  \return No description
+  \exception SystemError The stream fails to be read
+  */
+template <std::endian kEndian> inline
+auto BinaryReader<kEndian>::readFrom(std::istream* data_stream,
+                                     std::pmr::vector<std::byte>* buffer) -> BinaryReader
+{
+  ZISC_ASSERT(data_stream != nullptr, "The given stream is null.");
+  ZISC_ASSERT(buffer != nullptr, "The given buffer is null.");
+  const auto distance = cast<std::size_t>(BinarySerializer::getDistance(data_stream));
+  std::size_t size = 0;
+  buffer->clear();
+  if (0 < distance) {
+    buffer->resize(distance);
+    BinarySerializer::read(buffer->data(), data_stream, cast<std::streamsize>(distance));
+    size = cast<std::size_t>(data_stream->gcount());
+  }
+  else {
+    constexpr std::size_t chunk_size = 4096;
+    while (data_stream->good()) {
+      buffer->resize(size + chunk_size);
+      BinarySerializer::read(buffer->data() + size, data_stream, cast<std::streamsize>(chunk_size));
+      size += cast<std::size_t>(data_stream->gcount());
+    }
+  }
+  buffer->resize(size);
+  if (data_stream->bad()) [[unlikely]]
+    throw SystemError{ErrorCode::kBinaryInvalidFormat, "The stream fails to be read."};
+  return BinaryReader{std::span<const std::byte>{*buffer}};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryReader<kEndian>::remaining() const noexcept -> std::size_t
+{
+  return size() - position_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] pos No description.
+  \exception SystemError The position is beyond the end of the region
+  */
+template <std::endian kEndian> inline
+void BinaryReader<kEndian>::seek(const std::size_t pos)
+{
+  if (size() < pos)
+    throw SystemError{ErrorCode::kBinaryOutOfRange,
+                      "The position is beyond the end of the region."};
+  position_ = pos;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryReader<kEndian>::size() const noexcept -> std::size_t
+{
+  return region_.size();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] n No description.
+  \exception SystemError The region doesn't have enough bytes
+  */
+template <std::endian kEndian> inline
+void BinaryReader<kEndian>::skip(const std::size_t n)
+{
+  checkBounds(n);
+  position_ += n;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+constexpr auto BinaryReader<kEndian>::wireEndian() noexcept -> std::endian
+{
+  return kEndian;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] n No description.
+  \exception SystemError The region doesn't have enough bytes
+  */
+template <std::endian kEndian> inline
+void BinaryReader<kEndian>::checkBounds(const std::size_t n) const
+{
+  if (remaining() < n)
+    throw SystemError{ErrorCode::kBinaryOutOfRange,
+                      "The region doesn't have enough bytes."};
+}
+
+} // namespace zisc
+
+#endif // ZISC_BINARY_READER_INL_HPP
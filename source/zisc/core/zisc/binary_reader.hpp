@@ -0,0 +1,114 @@
+/*!
+  \file binary_reader.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_BINARY_READER_HPP
+#define ZISC_BINARY_READER_HPP
+
+// Standard C++ library
+#include <bit>
+#include <cstddef>
+#include <istream>
+#include <memory_resource>
+#include <span>
+#include <vector>
+// Zisc
+#include "concepts.hpp"
+#include "zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Deserialize values from a contiguous byte region
+
+  The reader doesn't own the region, so a buffer written by BinaryWriter or
+  a mapped file can be read without copying it.
+  A stream is read into a buffer of the caller by readFrom().
+  Every read is bounds-checked before any byte is copied, so a truncated
+  region is reported as an exception instead of reading past its end.
+
+  \tparam kEndian The endianness of the serialized data
+  \note No notation.
+  \attention No attention.
+  */
+template <std::endian kEndian = std::endian::little>
+class BinaryReader
+{
+ public:
+  //! Create a reader of the given region
+  explicit BinaryReader(std::span<const std::byte> region) noexcept;
+
+
+  //! Return the whole region
+  [[nodiscard]]
+  auto data() const noexcept -> std::span<const std::byte>;
+
+  //! Check if the values of the given type are read without byte swapping
+  template <TriviallyCopyable Type>
+  static constexpr auto isMemcpyReadable() noexcept -> bool;
+
+  //! Check if the cursor reaches the end of the region
+  [[nodiscard]]
+  auto isEnd() const noexcept -> bool;
+
+  //! Return the current position of the cursor in bytes
+  [[nodiscard]]
+  auto position() const noexcept -> std::size_t;
+
+  //! Read a value at the cursor
+  template <TriviallyCopyable Type>
+  auto read() -> Type;
+
+  //! Read a value at the cursor
+  template <TriviallyCopyable Type>
+  void read(Type* value);
+
+  //! Read values at the cursor into the given span
+  template <TriviallyCopyable Type, std::size_t kExtent>
+  void read(const std::span<Type, kExtent> values);
+
+  //! Read the rest of the given stream into the buffer and return a reader of it
+  static auto readFrom(std::istream* data_stream, std::pmr::vector<std::byte>* buffer)
+      -> BinaryReader;
+
+  //! Return the number of bytes from the cursor to the end of the region
+  [[nodiscard]]
+  auto remaining() const noexcept -> std::size_t;
+
+  //! Move the cursor to the given position
+  void seek(const std::size_t pos);
+
+  //! Return the size of the region in bytes
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+  //! Skip the given number of bytes
+  void skip(const std::size_t n);
+
+  //! Return the endianness of the serialized data
+  static constexpr auto wireEndian() noexcept -> std::endian;
+
+ private:
+  //! Check if the given number of bytes can be read at the cursor
+  void checkBounds(const std::size_t n) const;
+
+
+  std::span<const std::byte> region_;
+  std::size_t position_ = 0;
+};
+
+} // namespace zisc
+
+#include "binary_reader-inl.hpp"
+
+#endif // ZISC_BINARY_READER_HPP
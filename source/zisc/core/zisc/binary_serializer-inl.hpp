@@ -15,11 +15,15 @@
 
 #include "binary_serializer.hpp"
 // Standard C++ library
+#include <bit>
 #include <ios>
 #include <istream>
 #include <memory>
 #include <ostream>
 // Zisc
+#include "binary_reader.hpp"
+#include "binary_writer.hpp"
+#include "concepts.hpp"
 #include "error.hpp"
 #include "utility.hpp"
 #include "zisc_config.hpp"
@@ -72,6 +76,25 @@ auto BinarySerializer::read(Type* data,
   return data_stream->read(reinterp<char*>(data), size);
 }
 
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kEndian No description.
+  \param [out] data No description.
+  \param [in,out] reader No description.
+  \return No description
+  \exception SystemError The reader doesn't have enough bytes
+  */
+template <TriviallyCopyable Type, std::endian kEndian> inline
+auto BinarySerializer::read(Type* data, BinaryReader<kEndian>* reader)
+    -> BinaryReader<kEndian>&
+{
+  ZISC_ASSERT(reader != nullptr, "The given reader is null.");
+  reader->read(data);
+  return *reader;
+}
+
 /*!
   \details No detailed description
 
@@ -93,6 +116,26 @@ auto BinarySerializer::write(const Type* data,
   return data_stream->write(reinterp<const char*>(data), size);
 }
 
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kEndian No description.
+  \param [in] data No description.
+  \param [in,out] writer No description.
+  \return No description
+  \exception SystemError The writer doesn't have enough space
+  */
+template <TriviallyCopyable Type, std::endian kEndian> inline
+auto BinarySerializer::write(const Type* data, BinaryWriter<kEndian>* writer)
+    -> BinaryWriter<kEndian>&
+{
+  ZISC_ASSERT(data != nullptr, "The given data is null.");
+  ZISC_ASSERT(writer != nullptr, "The given writer is null.");
+  writer->write(*data);
+  return *writer;
+}
+
 /*!
   \details No detailed description
 
@@ -14,12 +14,19 @@
 #define ZISC_BINARY_SERIALIZER_HPP
 
 // Standard C++ library
+#include <bit>
 #include <ios>
 #include <istream>
 #include <ostream>
+// Zisc
+#include "concepts.hpp"
 
 namespace zisc {
 
+// Forward declaration
+template <std::endian> class BinaryReader;
+template <std::endian> class BinaryWriter;
+
 /*!
   \brief No brief description
 
@@ -37,12 +44,20 @@ class BinarySerializer
                    std::istream* data_stream,
                    const std::streamsize size = sizeof(Type)) noexcept -> std::istream&;
 
+  //! Deserialize a data from the given reader
+  template <TriviallyCopyable Type, std::endian kEndian>
+  static auto read(Type* data, BinaryReader<kEndian>* reader) -> BinaryReader<kEndian>&;
+
   //! Serialize the given data into the stream
   template <typename Type>
   static auto write(const Type* data,
                     std::ostream* data_stream,
                     const std::streamsize size = sizeof(Type)) noexcept -> std::ostream&;
 
+  //! Serialize the given data into the writer
+  template <TriviallyCopyable Type, std::endian kEndian>
+  static auto write(const Type* data, BinaryWriter<kEndian>* writer) -> BinaryWriter<kEndian>&;
+
   //! Set the input position indicator to begin
   static void backToBegin(std::istream* data_stream) noexcept;
 };
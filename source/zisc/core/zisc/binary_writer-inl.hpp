@@ -0,0 +1,314 @@
+/*!
+  \file binary_writer-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_BINARY_WRITER_INL_HPP
+#define ZISC_BINARY_WRITER_INL_HPP
+
+#include "binary_writer.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Zisc
+#include "binary_serializer.hpp"
+#include "bit.hpp"
+#include "concepts.hpp"
+#include "error.hpp"
+#include "utility.hpp"
+#include "zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in,out] mem_resource No description.
+  */
+template <std::endian kEndian> inline
+BinaryWriter<kEndian>::BinaryWriter(std::pmr::memory_resource* mem_resource) noexcept :
+    buffer_{typename decltype(buffer_)::allocator_type{mem_resource}},
+    is_growable_{true}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [out] region No description.
+  */
+template <std::endian kEndian> inline
+BinaryWriter<kEndian>::BinaryWriter(std::span<std::byte> region) noexcept :
+    buffer_{typename decltype(buffer_)::allocator_type{std::pmr::null_memory_resource()}},
+    region_{region}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  */
+template <std::endian kEndian> inline
+BinaryWriter<kEndian>::BinaryWriter(BinaryWriter&& other) noexcept :
+    buffer_{std::move(other.buffer_)},
+    region_{std::exchange(other.region_, std::span<std::byte>{})},
+    position_{std::exchange(other.position_, 0)},
+    size_{std::exchange(other.size_, 0)},
+    is_growable_{other.is_growable_}
+{
+}
+
+/*!
+  \details The buffer is move-constructed so that it takes over
+  the memory resource of the other as the move constructor does.
+  Otherwise the data would be copied into the current resource
+  and the region would refer to the buffer of the other
+
+  \param [in,out] other No description.
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryWriter<kEndian>::operator=(BinaryWriter&& other) noexcept -> BinaryWriter&
+{
+  if (this == &other)
+    return *this;
+  std::destroy_at(&buffer_);
+  std::construct_at(&buffer_, std::move(other.buffer_));
+  region_ = std::exchange(other.region_, std::span<std::byte>{});
+  position_ = std::exchange(other.position_, 0);
+  size_ = std::exchange(other.size_, 0);
+  is_growable_ = other.is_growable_;
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryWriter<kEndian>::capacity() const noexcept -> std::size_t
+{
+  return region_.size();
+}
+
+/*!
+  \details No detailed description
+  */
+template <std::endian kEndian> inline
+void BinaryWriter<kEndian>::clear() noexcept
+{
+  position_ = 0;
+  size_ = 0;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryWriter<kEndian>::data() const noexcept -> std::span<const std::byte>
+{
+  return region_.first(size_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryWriter<kEndian>::isGrowable() const noexcept -> bool
+{
+  return is_growable_;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <std::endian kEndian>
+template <TriviallyCopyable Type> inline
+constexpr auto BinaryWriter<kEndian>::isMemcpyWritable() noexcept -> bool
+{
+  const bool result = (wireEndian() == std::endian::native) || (sizeof(Type) == 1);
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryWriter<kEndian>::position() const noexcept -> std::size_t
+{
+  return position_;
+}
+
+/*!
+  \details The cursor can be moved back to overwrite a header
+  after the following data is written
+
+  \param [in] pos No description.
+  \exception SystemError The position is beyond the written data
+  */
+template <std::endian kEndian> inline
+void BinaryWriter<kEndian>::seek(const std::size_t pos)
+{
+  if (size_ < pos)
+    throw SystemError{ErrorCode::kBinaryOutOfRange,
+                      "The position is beyond the written data."};
+  position_ = pos;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryWriter<kEndian>::size() const noexcept -> std::size_t
+{
+  return size_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::endian kEndian> inline
+constexpr auto BinaryWriter<kEndian>::wireEndian() noexcept -> std::endian
+{
+  return kEndian;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \exception SystemError The fixed region doesn't have enough space
+  */
+template <std::endian kEndian>
+template <TriviallyCopyable Type> inline
+void BinaryWriter<kEndian>::write(const Type& value)
+{
+  std::byte* dest = makeSpace(sizeof(Type));
+  if constexpr (isMemcpyWritable<Type>()) {
+    std::memcpy(dest, &value, sizeof(Type));
+  }
+  else {
+    static_assert(Arithmetic<Type> || std::is_enum_v<Type>,
+                  "Only arithmetic and enum types can be byte-swapped.");
+    const Type v = byteswap(value);
+    std::memcpy(dest, &v, sizeof(Type));
+  }
+  advance(sizeof(Type));
+}
+
+/*!
+  \details The values are written with a single memcpy if no byte swapping
+  is required
+
+  \tparam Type No description.
+  \tparam kExtent No description.
+  \param [in] values No description.
+  \exception SystemError The fixed region doesn't have enough space
+  */
+template <std::endian kEndian>
+template <TriviallyCopyable Type, std::size_t kExtent> inline
+void BinaryWriter<kEndian>::write(const std::span<Type, kExtent> values)
+{
+  using ValueT = std::remove_cv_t<Type>;
+  const std::size_t n = values.size_bytes();
+  if (n == 0)
+    return;
+  std::byte* dest = makeSpace(n);
+  if constexpr (isMemcpyWritable<ValueT>()) {
+    std::memcpy(dest, values.data(), n);
+  }
+  else {
+    static_assert(Arithmetic<ValueT> || std::is_enum_v<ValueT>,
+                  "Only arithmetic and enum types can be byte-swapped.");
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      const ValueT v = byteswap(cast<ValueT>(values[i]));
+      std::memcpy(dest + i * sizeof(ValueT), &v, sizeof(ValueT));
+    }
+  }
+  advance(n);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] data_stream No description.
+  \return No description
+  */
+template <std::endian kEndian> inline
+auto BinaryWriter<kEndian>::writeTo(std::ostream* data_stream) const -> std::ostream&
+{
+  const std::span<const std::byte> d = data();
+  return BinarySerializer::write(d.data(), data_stream, cast<std::streamsize>(d.size()));
+}
+
+/*!
+  \details The growable buffer grows geometrically,
+  so writing is amortized constant time
+
+  \param [in] n No description.
+  \return No description
+  \exception SystemError The fixed region doesn't have enough space
+  */
+template <std::endian kEndian> inline
+auto BinaryWriter<kEndian>::makeSpace(const std::size_t n) -> std::byte*
+{
+  const std::size_t required = position_ + n;
+  if (region_.size() < required) {
+    if (!isGrowable())
+      throw SystemError{ErrorCode::kBinaryOutOfRange,
+                        "The region doesn't have enough space."};
+    buffer_.resize((std::max)(required, 2 * buffer_.size()));
+    region_ = std::span{buffer_};
+  }
+  return region_.data() + position_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] n No description.
+  */
+template <std::endian kEndian> inline
+void BinaryWriter<kEndian>::advance(const std::size_t n) noexcept
+{
+  position_ += n;
+  size_ = (std::max)(size_, position_);
+}
+
+} // namespace zisc
+
+#endif // ZISC_BINARY_WRITER_INL_HPP
@@ -0,0 +1,127 @@
+/*!
+  \file binary_writer.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_BINARY_WRITER_HPP
+#define ZISC_BINARY_WRITER_HPP
+
+// Standard C++ library
+#include <bit>
+#include <cstddef>
+#include <memory_resource>
+#include <ostream>
+#include <span>
+#include <vector>
+// Zisc
+#include "concepts.hpp"
+#include "non_copyable.hpp"
+#include "zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Serialize values into a contiguous byte buffer
+
+  The writer writes values either into a growable buffer which is allocated
+  from a memory resource or into a fixed region, such as a mapped file.
+  Values are stored in the given wire endianness. If it matches the native
+  endianness, a span of values is written with a single memcpy.
+  Otherwise arithmetic and enum values are byte-swapped one by one.
+
+  \tparam kEndian The endianness of the serialized data
+  \note No notation.
+  \attention No attention.
+  */
+template <std::endian kEndian = std::endian::little>
+class BinaryWriter : private NonCopyable<BinaryWriter<kEndian>>
+{
+ public:
+  //! Create a writer which writes into a growable buffer
+  explicit BinaryWriter(std::pmr::memory_resource* mem_resource) noexcept;
+
+  //! Create a writer which writes into the given fixed region
+  explicit BinaryWriter(std::span<std::byte> region) noexcept;
+
+  //! Move a data
+  BinaryWriter(BinaryWriter&& other) noexcept;
+
+
+  //! Move a data
+  auto operator=(BinaryWriter&& other) noexcept -> BinaryWriter&;
+
+
+  //! Return the capacity of the current storage in bytes
+  [[nodiscard]]
+  auto capacity() const noexcept -> std::size_t;
+
+  //! Clear the written data. The storage is kept
+  void clear() noexcept;
+
+  //! Return the written data
+  [[nodiscard]]
+  auto data() const noexcept -> std::span<const std::byte>;
+
+  //! Check if the writer writes into a growable buffer
+  [[nodiscard]]
+  auto isGrowable() const noexcept -> bool;
+
+  //! Check if the values of the given type are written without byte swapping
+  template <TriviallyCopyable Type>
+  static constexpr auto isMemcpyWritable() noexcept -> bool;
+
+  //! Return the current position of the cursor in bytes
+  [[nodiscard]]
+  auto position() const noexcept -> std::size_t;
+
+  //! Move the cursor to the given position
+  void seek(const std::size_t pos);
+
+  //! Return the size of the written data in bytes
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+  //! Return the endianness of the serialized data
+  static constexpr auto wireEndian() noexcept -> std::endian;
+
+  //! Write a value at the cursor
+  template <TriviallyCopyable Type>
+  void write(const Type& value);
+
+  //! Write the given values at the cursor
+  template <TriviallyCopyable Type, std::size_t kExtent>
+  void write(const std::span<Type, kExtent> values);
+
+  //! Write the written data to the given stream
+  auto writeTo(std::ostream* data_stream) const -> std::ostream&;
+
+ private:
+  //! Return the space for the given number of bytes at the cursor
+  auto makeSpace(const std::size_t n) -> std::byte*;
+
+  //! Move the cursor forward by the given number of bytes
+  void advance(const std::size_t n) noexcept;
+
+
+  std::pmr::vector<std::byte> buffer_;
+  std::span<std::byte> region_;
+  std::size_t position_ = 0;
+  std::size_t size_ = 0;
+  bool is_growable_ = false;
+  [[maybe_unused]] Padding<7> pad_{};
+};
+
+} // namespace zisc
+
+#include "binary_writer-inl.hpp"
+
+#endif // ZISC_BINARY_WRITER_HPP
@@ -18,6 +18,8 @@
 #include "bit.hpp"
 // Standard C++ library
 #include <bit>
+#include <cstdint>
+#include <type_traits>
 // Zisc
 #include "concepts.hpp"
 #include "zisc_config.hpp"
@@ -44,6 +46,41 @@ constexpr auto Bit::castBit(const From& from) noexcept -> To
   return to;
 }
 
+/*!
+  \details The value is reversed as an unsigned integer of the same size,
+  which compilers turn into a single bswap instruction
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <TriviallyCopyable Type> inline
+constexpr auto Bit::swapBytes(const Type& value) noexcept -> Type
+{
+  static_assert((sizeof(Type) == 1) || (sizeof(Type) == 2) ||
+                (sizeof(Type) == 4) || (sizeof(Type) == 8),
+                "The size of the type must be 1, 2, 4 or 8 bytes.");
+  using UnsignedT = std::conditional_t<sizeof(Type) == 1, std::uint8_t,
+                    std::conditional_t<sizeof(Type) == 2, std::uint16_t,
+                    std::conditional_t<sizeof(Type) == 4, std::uint32_t,
+                                                          std::uint64_t>>>;
+  auto u = castBit<UnsignedT>(value);
+  if constexpr (sizeof(Type) == 2) {
+    u = static_cast<UnsignedT>((u << 8) | (u >> 8));
+  }
+  else if constexpr (sizeof(Type) == 4) {
+    u = ((u & 0x0000'ffffu) << 16) | ((u >> 16) & 0x0000'ffffu);
+    u = ((u & 0x00ff'00ffu) << 8) | ((u >> 8) & 0x00ff'00ffu);
+  }
+  else if constexpr (sizeof(Type) == 8) {
+    u = ((u & 0x0000'0000'ffff'ffffull) << 32) | ((u >> 32) & 0x0000'0000'ffff'ffffull);
+    u = ((u & 0x0000'ffff'0000'ffffull) << 16) | ((u >> 16) & 0x0000'ffff'0000'ffffull);
+    u = ((u & 0x00ff'00ff'00ff'00ffull) << 8) | ((u >> 8) & 0x00ff'00ff'00ff'00ffull);
+  }
+  const Type result = castBit<Type>(u);
+  return result;
+}
+
 // STL style function aliases
 
 /*!
@@ -61,6 +98,20 @@ constexpr auto bit_cast(const From& from) noexcept -> To
   return to;
 }
 
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <TriviallyCopyable Type> inline
+constexpr auto byteswap(const Type& value) noexcept -> Type
+{
+  const Type result = Bit::swapBytes(value);
+  return result;
+}
+
 } // namespace zisc
 
 #endif // ZISC_BIT_INL_HPP
@@ -32,6 +32,10 @@ class Bit
   //! Reinterpret the object representation of one type as that of another
   template <TriviallyCopyable To, TriviallyCopyable From>
   static constexpr auto castBit(const From& from) noexcept -> To;
+
+  //! Reverse the bytes of the given value
+  template <TriviallyCopyable Type>
+  static constexpr auto swapBytes(const Type& value) noexcept -> Type;
 };
 
 // STL style function aliases
@@ -40,6 +44,10 @@ class Bit
 template <TriviallyCopyable To, TriviallyCopyable From>
 constexpr auto bit_cast(const From& from) noexcept -> To;
 
+//! Reverse the bytes of the given value
+template <TriviallyCopyable Type>
+constexpr auto byteswap(const Type& value) noexcept -> Type;
+
 } // namespace zisc
 
 #include "bit-inl.hpp"
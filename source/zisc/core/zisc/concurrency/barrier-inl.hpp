@@ -0,0 +1,158 @@
+/*!
+  \file barrier-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_BARRIER_INL_HPP
+#define ZISC_BARRIER_INL_HPP
+
+#include "barrier.hpp"
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+// Zisc
+#include "atomic.hpp"
+#include "atomic_word.hpp"
+#include "zisc/error.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] expected No description.
+  */
+inline
+Barrier::Barrier(const ValueT expected) noexcept :
+    counter_{expected},
+    expected_{expected},
+    phase_{0}
+{
+  ZISC_ASSERT(0 < expected, "The expected count isn't positive.");
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] update No description.
+  \return No description
+  */
+inline
+auto Barrier::arrive(const ValueT update) noexcept -> PhaseT
+{
+  const PhaseT token = arriveImpl(update);
+  return token;
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void Barrier::arriveAndDrop() noexcept
+{
+  expected_.fetch_sub(1, std::memory_order::acq_rel);
+  [[maybe_unused]] const PhaseT token = arriveImpl(1);
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void Barrier::arriveAndWait() noexcept
+{
+  const PhaseT token = arriveImpl(1);
+  wait(token);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto Barrier::expected() const noexcept -> ValueT
+{
+  const ValueT e = expected_.load(std::memory_order::acquire);
+  return e;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto Barrier::phase() const noexcept -> PhaseT
+{
+  const PhaseT p = phase_.load(std::memory_order::acquire);
+  return p;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr auto Barrier::spinCount() noexcept -> std::size_t
+{
+  const std::size_t count = 64;
+  return count;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] token No description.
+  */
+inline
+void Barrier::wait(const PhaseT token) const noexcept
+{
+  // Spin for a short while since the phase turnaround is usually fast
+  for (std::size_t i = 0; i < spinCount(); ++i) {
+    if (phase() != token)
+      return;
+    std::this_thread::yield();
+  }
+  Atomic::wait(std::addressof(phase_), token, std::memory_order::acquire);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] update No description.
+  \return No description
+  */
+inline
+auto Barrier::arriveImpl(const ValueT update) noexcept -> PhaseT
+{
+  ZISC_ASSERT(0 < update, "The update isn't positive.");
+  // The phase can't be advanced until this thread arrives
+  const PhaseT token = phase();
+  const ValueT old = counter_.fetch_sub(update, std::memory_order::acq_rel);
+  ZISC_ASSERT(update <= old, "The arrival counter got negative.");
+  if (old == update) {
+    // The last thread completes the phase
+    counter_.store(expected(), std::memory_order::relaxed);
+    const auto next = static_cast<PhaseT>(static_cast<uint32b>(token) + 1u);
+    phase_.store(next, std::memory_order::release);
+    Atomic::notifyAll(std::addressof(phase_));
+  }
+  return token;
+}
+
+} // namespace zisc
+
+#endif // ZISC_BARRIER_INL_HPP
@@ -0,0 +1,92 @@
+/*!
+  \file barrier.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_BARRIER_HPP
+#define ZISC_BARRIER_HPP
+
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+// Zisc
+#include "atomic.hpp"
+#include "atomic_word.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Barrier class provides a reusable sense-reversing thread barrier
+
+  The last arriving thread of a phase resets the arrival counter and
+  flips the phase word (the sense). Other threads spin for a short while and
+  then block on the phase word with Atomic::wait,
+  so the OS specified wait-notification is used if it is enabled.
+  */
+class Barrier : private NonCopyable<Barrier>
+{
+ public:
+  // Type aliases
+  using ValueT = Atomic::WordValueType;
+  using WordT = AtomicWord<Config::isAtomicOsSpecifiedWaitUsed()>;
+  using PhaseT = ValueT;
+
+
+  //! Create a barrier with the given number of participating threads
+  explicit Barrier(const ValueT expected) noexcept;
+
+
+  //! Arrive at the barrier and return the token of the current phase
+  [[nodiscard]]
+  auto arrive(const ValueT update = 1) noexcept -> PhaseT;
+
+  //! Arrive at the barrier and remove the current thread from the participants
+  void arriveAndDrop() noexcept;
+
+  //! Arrive at the barrier and block until the current phase completes
+  void arriveAndWait() noexcept;
+
+  //! Return the number of participating threads in the next phase
+  [[nodiscard]]
+  auto expected() const noexcept -> ValueT;
+
+  //! Return the current phase
+  [[nodiscard]]
+  auto phase() const noexcept -> PhaseT;
+
+  //! Return the number of spins before a thread blocks
+  static constexpr auto spinCount() noexcept -> std::size_t;
+
+  //! Block until the phase of the given token completes
+  void wait(const PhaseT token) const noexcept;
+
+ private:
+  //! Decrement the arrival counter and complete the phase if it is the last
+  auto arriveImpl(const ValueT update) noexcept -> PhaseT;
+
+
+  static constexpr std::size_t kCacheLineSize = Config::l1CacheLineSize();
+
+
+  alignas(kCacheLineSize) std::atomic<ValueT> counter_;
+  std::atomic<ValueT> expected_;
+  alignas(kCacheLineSize) mutable WordT phase_;
+  [[maybe_unused]] Padding<kCacheLineSize - (sizeof(phase_) % kCacheLineSize)> pad_{};
+};
+
+} // namespace zisc
+
+#include "barrier-inl.hpp"
+
+#endif // ZISC_BARRIER_HPP
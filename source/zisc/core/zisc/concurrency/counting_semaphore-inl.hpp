@@ -0,0 +1,127 @@
+/*!
+  \file counting_semaphore-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_COUNTING_SEMAPHORE_INL_HPP
+#define ZISC_COUNTING_SEMAPHORE_INL_HPP
+
+#include "counting_semaphore.hpp"
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+// Zisc
+#include "atomic.hpp"
+#include "atomic_word.hpp"
+#include "zisc/error.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] desired No description.
+  */
+inline
+CountingSemaphore::CountingSemaphore(const ValueT desired) noexcept :
+    counter_{desired},
+    num_of_waiters_{0}
+{
+  ZISC_ASSERT(0 <= desired, "The initial count is negative.");
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void CountingSemaphore::acquire() noexcept
+{
+  while (!tryAcquire()) {
+    num_of_waiters_.fetch_add(1, std::memory_order::seq_cst);
+    Atomic::wait(std::addressof(counter_), 0, std::memory_order::acquire);
+    num_of_waiters_.fetch_sub(1, std::memory_order::release);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CountingSemaphore::count() const noexcept -> ValueT
+{
+  const ValueT c = counter_.load(std::memory_order::acquire);
+  return c;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr auto CountingSemaphore::max() noexcept -> ValueT
+{
+  return (std::numeric_limits<ValueT>::max)();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] update No description.
+  */
+inline
+void CountingSemaphore::release(const ValueT update) noexcept
+{
+  ZISC_ASSERT(0 <= update, "The update is negative.");
+  [[maybe_unused]] const ValueT old = Atomic::add(std::addressof(counter_.get()),
+                                                  update,
+                                                  std::memory_order::seq_cst);
+  ZISC_ASSERT(update <= (max() - old), "The counter overflowed.");
+  if (0 < num_of_waiters_.load(std::memory_order::seq_cst)) {
+    if (update == 1)
+      Atomic::notifyOne(std::addressof(counter_));
+    else
+      Atomic::notifyAll(std::addressof(counter_));
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CountingSemaphore::tryAcquire() noexcept -> bool
+{
+  ValueT* ptr = std::addressof(counter_.get());
+  ValueT expected = counter_.load(std::memory_order::acquire);
+  while (0 < expected) {
+    const ValueT old = Atomic::compareAndExchange(ptr,
+                                                  expected,
+                                                  expected - 1,
+                                                  std::memory_order::acq_rel,
+                                                  std::memory_order::acquire);
+    if (old == expected)
+      return true;
+    expected = old;
+  }
+  return false;
+}
+
+} // namespace zisc
+
+#endif // ZISC_COUNTING_SEMAPHORE_INL_HPP
@@ -0,0 +1,79 @@
+/*!
+  \file counting_semaphore.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_COUNTING_SEMAPHORE_HPP
+#define ZISC_COUNTING_SEMAPHORE_HPP
+
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+// Zisc
+#include "atomic.hpp"
+#include "atomic_word.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief CountingSemaphore class provides a lightweight counting semaphore
+
+  The counter is held in an AtomicWord and blocked threads are parked with
+  Atomic::wait, so the OS specified wait-notification (futex or WaitOnAddress)
+  is used if it is enabled.
+  Notification is skipped while no thread is blocked in acquire.
+  */
+class CountingSemaphore : private NonCopyable<CountingSemaphore>
+{
+ public:
+  // Type aliases
+  using ValueT = Atomic::WordValueType;
+  using WordT = AtomicWord<Config::isAtomicOsSpecifiedWaitUsed()>;
+
+
+  //! Create a semaphore with the given initial count
+  explicit CountingSemaphore(const ValueT desired) noexcept;
+
+
+  //! Decrement the counter or block the current thread until it is possible
+  void acquire() noexcept;
+
+  //! Return the current value of the counter
+  [[nodiscard]]
+  auto count() const noexcept -> ValueT;
+
+  //! Return the maximum possible value of the counter
+  static constexpr auto max() noexcept -> ValueT;
+
+  //! Increment the counter by the given value and unblock acquiring threads
+  void release(const ValueT update = 1) noexcept;
+
+  //! Try to decrement the counter without blocking
+  [[nodiscard]]
+  auto tryAcquire() noexcept -> bool;
+
+ private:
+  static constexpr std::size_t kCacheLineSize = Config::l1CacheLineSize();
+
+
+  alignas(kCacheLineSize) WordT counter_;
+  alignas(kCacheLineSize) std::atomic<ValueT> num_of_waiters_;
+  [[maybe_unused]] Padding<kCacheLineSize - sizeof(num_of_waiters_)> pad_{};
+};
+
+} // namespace zisc
+
+#include "counting_semaphore-inl.hpp"
+
+#endif // ZISC_COUNTING_SEMAPHORE_HPP
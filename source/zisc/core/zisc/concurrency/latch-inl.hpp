@@ -0,0 +1,116 @@
+/*!
+  \file latch-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_LATCH_INL_HPP
+#define ZISC_LATCH_INL_HPP
+
+#include "latch.hpp"
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+// Zisc
+#include "atomic.hpp"
+#include "atomic_word.hpp"
+#include "zisc/error.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] expected No description.
+  */
+inline
+Latch::Latch(const ValueT expected) noexcept :
+    counter_{(expected == 0) ? kReleased : expected}
+{
+  ZISC_ASSERT(0 <= expected, "The expected count is negative.");
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] update No description.
+  */
+inline
+void Latch::arriveAndWait(const ValueT update) noexcept
+{
+  countDown(update);
+  wait();
+}
+
+/*!
+  \details The last count down marks the latch released after notifying the waiters,
+  so the latch isn't touched after a waiter returns
+
+  \param [in] update No description.
+  */
+inline
+void Latch::countDown(const ValueT update) noexcept
+{
+  ZISC_ASSERT(0 <= update, "The update is negative.");
+  const ValueT old = Atomic::sub(std::addressof(counter_.get()),
+                                 update,
+                                 std::memory_order::acq_rel);
+  ZISC_ASSERT(update <= old, "The counter got negative.");
+  if (old == update) {
+    Atomic::notifyAll(std::addressof(counter_));
+    counter_.store(kReleased, std::memory_order::release);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto Latch::count() const noexcept -> ValueT
+{
+  const ValueT c = counter_.load(std::memory_order::acquire);
+  return (c == kReleased) ? 0 : c;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto Latch::tryWait() const noexcept -> bool
+{
+  const bool result = counter_.load(std::memory_order::acquire) == kReleased;
+  return result;
+}
+
+/*!
+  \details The wait doesn't return until the last count down finishes notifying
+  */
+inline
+void Latch::wait() const noexcept
+{
+  ValueT c = counter_.load(std::memory_order::acquire);
+  for (; 0 < c; c = counter_.load(std::memory_order::acquire))
+    Atomic::wait(std::addressof(counter_), c, std::memory_order::acquire);
+  // The counter is zero only while the last count down is notifying
+  for (; c != kReleased; c = counter_.load(std::memory_order::acquire))
+    std::this_thread::yield();
+}
+
+} // namespace zisc
+
+#endif // ZISC_LATCH_INL_HPP
@@ -0,0 +1,79 @@
+/*!
+  \file latch.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_LATCH_HPP
+#define ZISC_LATCH_HPP
+
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+// Zisc
+#include "atomic.hpp"
+#include "atomic_word.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Latch class provides a single use downward counter
+
+  Threads block in wait until the counter reaches zero.
+  The counter is held in an AtomicWord,
+  so the OS specified wait-notification is used if it is enabled.
+  wait() and tryWait() report the release only after the last countDown()
+  has finished, so the latch can be destroyed as soon as a wait returns.
+  */
+class Latch : private NonCopyable<Latch>
+{
+ public:
+  // Type aliases
+  using ValueT = Atomic::WordValueType;
+  using WordT = AtomicWord<Config::isAtomicOsSpecifiedWaitUsed()>;
+
+
+  //! Create a latch with the given initial count
+  explicit Latch(const ValueT expected) noexcept;
+
+
+  //! Decrement the counter and block until the counter reaches zero
+  void arriveAndWait(const ValueT update = 1) noexcept;
+
+  //! Decrement the counter without blocking
+  void countDown(const ValueT update = 1) noexcept;
+
+  //! Return the current value of the counter
+  [[nodiscard]]
+  auto count() const noexcept -> ValueT;
+
+  //! Check if the counter has reached zero
+  [[nodiscard]]
+  auto tryWait() const noexcept -> bool;
+
+  //! Block until the counter reaches zero
+  void wait() const noexcept;
+
+ private:
+  //! The counter value after the last count down finished
+  static constexpr ValueT kReleased = -1;
+
+
+  mutable WordT counter_;
+};
+
+} // namespace zisc
+
+#include "latch-inl.hpp"
+
+#endif // ZISC_LATCH_HPP
@@ -17,12 +17,14 @@
 
 #include "packaged_task.hpp"
 // Standard C++ library
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <memory>
 #include <utility>
 // Zisc
 #include "zisc/bit.hpp"
+#include "zisc/error.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 
@@ -94,6 +96,34 @@ auto PackagedTask::isValid() const noexcept -> bool
   return result;
 }
 
+/*!
+  \details The task is held by each queued iteration and by the enqueuer.
+  The holder which releases the last hold destroys the task,
+  so no shared ownership is needed
+
+  \param [in,out] task No description.
+  \param [in] n No description.
+  */
+inline
+void PackagedTask::release(PackagedTask* task, const DiffT n) noexcept
+{
+  const DiffT old = task->num_of_holds_.fetch_sub(n, std::memory_order::acq_rel);
+  ZISC_ASSERT(n <= old, "The holds of the task got negative.");
+  if (old == n)
+    task->destroy();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] n No description.
+  */
+inline
+void PackagedTask::setNumOfHolds(const DiffT n) noexcept
+{
+  num_of_holds_.store(n, std::memory_order::release);
+}
+
 /*!
   \details No detailed description
 
@@ -16,6 +16,7 @@
 #define ZISC_PACKAGED_TASK_HPP
 
 // Standard C++ library
+#include <atomic>
 #include <future>
 #include <memory>
 // Zisc
@@ -64,16 +65,26 @@ class PackagedTask : private NonCopyable<PackagedTask>
   [[nodiscard]]
   auto isValid() const noexcept -> bool;
 
+  //! Release the given number of holds on the task. The task is destroyed when no hold remains
+  static void release(PackagedTask* task, const DiffT n) noexcept;
+
   //! Run the underlying task
   virtual void run(const int64b thread_id, const DiffT offset) = 0;
 
+  //! Set the number of holds which keep the task alive
+  void setNumOfHolds(const DiffT n) noexcept;
+
  protected:
   //! Create a package with the given task id
   explicit PackagedTask(const int64b task_info) noexcept;
 
 
+  //! Destroy the task and deallocate the memory of the task
+  virtual void destroy() noexcept = 0;
+
  private:
   int64b info_ = invalidId();
+  std::atomic<DiffT> num_of_holds_ = 0;
 };
 
 /*!
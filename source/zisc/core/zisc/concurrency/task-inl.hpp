@@ -0,0 +1,980 @@
+/*!
+  \file task-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_TASK_INL_HPP
+#define ZISC_TASK_INL_HPP
+
+#include "task.hpp"
+// Standard C++ library
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory_resource>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+// Zisc
+#include "latch.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto TaskPromiseBase::FinalAwaiter::await_ready() const noexcept -> bool
+{
+  return false;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Promise No description.
+  \param [in] handle No description.
+  \return No description
+  */
+template <std::derived_from<TaskPromiseBase> Promise> inline
+auto TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+    -> std::coroutine_handle<>
+{
+  const std::coroutine_handle<> continuation = handle.promise().continuation();
+  return continuation ? continuation : std::noop_coroutine();
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void TaskPromiseBase::FinalAwaiter::await_resume() const noexcept
+{
+}
+
+/*!
+  \details The pointer to the memory resource is stored at the end of the frame
+
+  \tparam ArgTypes No description.
+  \param [in] size No description.
+  \param [in] args No description.
+  \return No description
+  */
+template <typename ...ArgTypes> inline
+auto TaskPromiseBase::operator new(const std::size_t size, const ArgTypes&... args) -> void*
+{
+  std::pmr::memory_resource* mem_resource = nullptr;
+  ((mem_resource = (mem_resource == nullptr) ? findResource(args) : mem_resource), ...);
+  if (mem_resource == nullptr)
+    mem_resource = std::pmr::get_default_resource();
+
+  const std::size_t offset = resourceOffset(size);
+  void* frame = mem_resource->allocate(offset + sizeof(mem_resource), kFrameAlignment);
+  std::memcpy(static_cast<std::byte*>(frame) + offset, &mem_resource, sizeof(mem_resource));
+  return frame;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] frame No description.
+  \param [in] size No description.
+  */
+inline
+void TaskPromiseBase::operator delete(void* frame, const std::size_t size) noexcept
+{
+  const std::size_t offset = resourceOffset(size);
+  std::pmr::memory_resource* mem_resource = nullptr;
+  std::memcpy(&mem_resource, static_cast<std::byte*>(frame) + offset, sizeof(mem_resource));
+  mem_resource->deallocate(frame, offset + sizeof(mem_resource), kFrameAlignment);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto TaskPromiseBase::continuation() const noexcept -> std::coroutine_handle<>
+{
+  return continuation_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto TaskPromiseBase::final_suspend() noexcept -> FinalAwaiter
+{
+  return FinalAwaiter{};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto TaskPromiseBase::initial_suspend() noexcept -> std::suspend_always
+{
+  return std::suspend_always{};
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void TaskPromiseBase::rethrowIfFailed() const
+{
+  if (exception_)
+    std::rethrow_exception(exception_);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] continuation No description.
+  */
+inline
+void TaskPromiseBase::setContinuation(const std::coroutine_handle<> continuation) noexcept
+{
+  continuation_ = continuation;
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void TaskPromiseBase::unhandled_exception() noexcept
+{
+  exception_ = std::current_exception();
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] arg No description.
+  \return No description
+  */
+template <typename Type> inline
+auto TaskPromiseBase::findResource([[maybe_unused]] const Type& arg) noexcept
+    -> std::pmr::memory_resource*
+{
+  if constexpr (std::is_convertible_v<const Type&, std::pmr::memory_resource*>)
+    return arg;
+  else
+    return nullptr;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] size No description.
+  \return No description
+  */
+inline
+constexpr auto TaskPromiseBase::resourceOffset(const std::size_t size) noexcept -> std::size_t
+{
+  constexpr std::size_t alignment = alignof(std::pmr::memory_resource*);
+  const std::size_t offset = ((size + alignment - 1) / alignment) * alignment;
+  return offset;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto TaskPromise<Type>::get_return_object() noexcept -> Task<Type>
+{
+  using HandleT = typename Task<Type>::HandleT;
+  return Task<Type>{HandleT::from_promise(*this)};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto TaskPromise<Type>::result() -> Type
+{
+  rethrowIfFailed();
+  ZISC_ASSERT(value_.has_value(), "The task has no value.");
+  return std::move(*value_);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam ValueT No description.
+  \param [in] value No description.
+  */
+template <typename Type>
+template <typename ValueT>
+requires std::constructible_from<Type, ValueT&&> inline
+void TaskPromise<Type>::return_value(ValueT&& value)
+    noexcept(std::is_nothrow_constructible_v<Type, ValueT&&>)
+{
+  value_.emplace(std::forward<ValueT>(value));
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto TaskPromise<void>::get_return_object() noexcept -> Task<void>
+{
+  using HandleT = typename Task<void>::HandleT;
+  return Task<void>{HandleT::from_promise(*this)};
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void TaskPromise<void>::result()
+{
+  rethrowIfFailed();
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void TaskPromise<void>::return_void() noexcept
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] handle No description.
+  */
+template <typename Type> inline
+Task<Type>::Awaiter::Awaiter(const HandleT handle) noexcept : handle_{handle}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto Task<Type>::Awaiter::await_ready() const noexcept -> bool
+{
+  return !handle_ || handle_.done();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] continuation No description.
+  \return No description
+  */
+template <typename Type> inline
+auto Task<Type>::Awaiter::await_suspend(const std::coroutine_handle<> continuation) noexcept
+    -> std::coroutine_handle<>
+{
+  handle_.promise().setContinuation(continuation);
+  return handle_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto Task<Type>::Awaiter::await_resume() -> Type
+{
+  ZISC_ASSERT(handle_, "The task has no coroutine.");
+  return handle_.promise().result();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] handle No description.
+  */
+template <typename Type> inline
+Task<Type>::Task(const HandleT handle) noexcept : handle_{handle}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  */
+template <typename Type> inline
+Task<Type>::Task(Task&& other) noexcept : handle_{std::exchange(other.handle_, nullptr)}
+{
+}
+
+/*!
+  \details No detailed description
+  */
+template <typename Type> inline
+Task<Type>::~Task() noexcept
+{
+  destroy();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  \return No description
+  */
+template <typename Type> inline
+auto Task<Type>::operator=(Task&& other) noexcept -> Task&
+{
+  destroy();
+  handle_ = std::exchange(other.handle_, nullptr);
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto Task<Type>::operator co_await() && noexcept -> Awaiter
+{
+  return Awaiter{handle_};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto Task<Type>::isReady() const noexcept -> bool
+{
+  return isValid() && handle_.done();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto Task<Type>::isValid() const noexcept -> bool
+{
+  return cast<bool>(handle_);
+}
+
+/*!
+  \details No detailed description
+  */
+template <typename Type> inline
+void Task<Type>::destroy() noexcept
+{
+  if (handle_) {
+    handle_.destroy();
+    handle_ = nullptr;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto TaskResult<Type>::get() -> ValueT
+{
+  if (exception_)
+    std::rethrow_exception(exception_);
+  ZISC_ASSERT(value_.has_value(), "The task result has no value.");
+  return std::move(*value_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto TaskResult<Type>::hasResult() const noexcept -> bool
+{
+  return value_.has_value() || cast<bool>(exception_);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] exception No description.
+  */
+template <typename Type> inline
+void TaskResult<Type>::setException(std::exception_ptr exception) noexcept
+{
+  exception_ = std::move(exception);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] value No description.
+  */
+template <typename Type> inline
+void TaskResult<Type>::setValue(ValueT&& value)
+    noexcept(std::is_nothrow_move_constructible_v<ValueT>)
+{
+  value_.emplace(std::move(value));
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] counter No description.
+  */
+inline
+TaskCounter::Awaiter::Awaiter(TaskCounter* counter) noexcept : counter_{counter}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto TaskCounter::Awaiter::await_ready() const noexcept -> bool
+{
+  return false;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] waiter No description.
+  \return No description
+  */
+inline
+auto TaskCounter::Awaiter::await_suspend(const std::coroutine_handle<> waiter) noexcept -> bool
+{
+  counter_->waiter_ = waiter;
+  // The waiter is resumed immediately if all tasks are already completed
+  const bool is_suspended = !counter_->arrive();
+  return is_suspended;
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void TaskCounter::Awaiter::await_resume() const noexcept
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] num_of_tasks No description.
+  */
+inline
+TaskCounter::TaskCounter(const std::size_t num_of_tasks) noexcept :
+    count_{num_of_tasks + 1}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto TaskCounter::operator co_await() noexcept -> Awaiter
+{
+  return Awaiter{this};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto TaskCounter::arrive() noexcept -> bool
+{
+  const std::size_t old = count_.fetch_sub(1, std::memory_order::acq_rel);
+  ZISC_ASSERT(0 < old, "The task counter got negative.");
+  return old == 1;
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void TaskCounter::resume() const
+{
+  waiter_.resume();
+}
+
+/*!
+  \details The state is held by the given number of tasks and the waiter
+
+  \tparam ArgTypes No description.
+  \param [in] num_of_tasks No description.
+  \param [in,out] mem_resource No description.
+  \param [in] args No description.
+  */
+template <typename ResultListT> template <typename ...ArgTypes> inline
+WhenAllState<ResultListT>::WhenAllState(const std::size_t num_of_tasks,
+                                        std::pmr::memory_resource* mem_resource,
+                                        ArgTypes&&... args) :
+    counter_{num_of_tasks},
+    num_of_holds_{num_of_tasks + 1},
+    results_{std::forward<ArgTypes>(args)...},
+    resource_{mem_resource}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \tparam ArgTypes No description.
+  \param [in] num_of_tasks No description.
+  \param [in,out] mem_resource No description.
+  \param [in] args No description.
+  \return No description
+  */
+template <typename ResultListT> template <typename ...ArgTypes> inline
+auto WhenAllState<ResultListT>::create(const std::size_t num_of_tasks,
+                                       std::pmr::memory_resource* mem_resource,
+                                       ArgTypes&&... args) -> WhenAllState*
+{
+  std::pmr::polymorphic_allocator<WhenAllState> alloc{mem_resource};
+  return alloc.template new_object<WhenAllState>(num_of_tasks,
+                                                 mem_resource,
+                                                 std::forward<ArgTypes>(args)...);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename ResultListT> inline
+auto WhenAllState<ResultListT>::counter() noexcept -> TaskCounter&
+{
+  return counter_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] state No description.
+  \param [in] num_of_holds No description.
+  */
+template <typename ResultListT> inline
+void WhenAllState<ResultListT>::release(WhenAllState* state,
+                                        const std::size_t num_of_holds) noexcept
+{
+  const std::size_t old = state->num_of_holds_.fetch_sub(num_of_holds,
+                                                         std::memory_order::acq_rel);
+  ZISC_ASSERT(num_of_holds <= old, "The holds of the state got negative.");
+  if (old == num_of_holds) {
+    std::pmr::polymorphic_allocator<WhenAllState> alloc{state->resource_};
+    alloc.delete_object(state);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename ResultListT> inline
+auto WhenAllState<ResultListT>::results() noexcept -> ResultListT&
+{
+  return results_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] num_of_holds No description.
+  \param [in,out] mem_resource No description.
+  */
+template <typename Type> inline
+WhenAnyState<Type>::WhenAnyState(const std::size_t num_of_holds,
+                                 std::pmr::memory_resource* mem_resource) noexcept :
+    num_of_holds_{num_of_holds},
+    resource_{mem_resource}
+{
+}
+
+/*!
+  \details The state is held by the given number of tasks and the waiter
+
+  \param [in] num_of_tasks No description.
+  \param [in,out] mem_resource No description.
+  \return No description
+  */
+template <typename Type> inline
+auto WhenAnyState<Type>::create(const std::size_t num_of_tasks,
+                                std::pmr::memory_resource* mem_resource) -> WhenAnyState*
+{
+  std::pmr::polymorphic_allocator<WhenAnyState> alloc{mem_resource};
+  return alloc.template new_object<WhenAnyState>(num_of_tasks + 1, mem_resource);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto WhenAnyState<Type>::counter() noexcept -> TaskCounter&
+{
+  return counter_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto WhenAnyState<Type>::index() const noexcept -> std::size_t
+{
+  return index_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] state No description.
+  \param [in] num_of_holds No description.
+  */
+template <typename Type> inline
+void WhenAnyState<Type>::release(WhenAnyState* state, const std::size_t num_of_holds) noexcept
+{
+  const std::size_t old = state->num_of_holds_.fetch_sub(num_of_holds,
+                                                         std::memory_order::acq_rel);
+  ZISC_ASSERT(num_of_holds <= old, "The holds of the state got negative.");
+  if (old == num_of_holds) {
+    std::pmr::polymorphic_allocator<WhenAnyState> alloc{state->resource_};
+    alloc.delete_object(state);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type> inline
+auto WhenAnyState<Type>::result() noexcept -> TaskResult<Type>&
+{
+  return result_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \param [in,out] result No description.
+  \return No description
+  */
+template <typename Type> inline
+auto WhenAnyState<Type>::tryComplete(const std::size_t index, TaskResult<Type>&& result) -> bool
+{
+  const bool is_first = !is_completed_.exchange(true, std::memory_order::acq_rel);
+  if (is_first) {
+    index_ = index;
+    result_ = std::move(result);
+  }
+  return is_first;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto DetachedTask::promise_type::get_return_object() noexcept -> DetachedTask
+{
+  return DetachedTask{};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto DetachedTask::promise_type::final_suspend() noexcept -> std::suspend_never
+{
+  return std::suspend_never{};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto DetachedTask::promise_type::initial_suspend() noexcept -> std::suspend_never
+{
+  return std::suspend_never{};
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void DetachedTask::promise_type::return_void() noexcept
+{
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void DetachedTask::promise_type::unhandled_exception() noexcept
+{
+  std::terminate();
+}
+
+/*!
+  \details The coroutine frame is allocated from the given memory resource
+
+  \tparam Type No description.
+  \tparam Callback No description.
+  \param [in,out] mem_resource No description.
+  \param [in] task No description.
+  \param [in] callback No description.
+  \return No description
+  */
+template <typename Type, typename Callback>
+requires std::invocable<Callback, TaskResult<Type>&&> inline
+auto detachTask([[maybe_unused]] std::pmr::memory_resource* mem_resource,
+                Task<Type> task,
+                Callback callback) -> DetachedTask
+{
+  TaskResult<Type> result;
+  try {
+    if constexpr (std::is_void_v<Type>) {
+      co_await std::move(task);
+      result.setValue(std::monostate{});
+    }
+    else {
+      result.setValue(co_await std::move(task));
+    }
+  }
+  catch (...) {
+    result.setException(std::current_exception());
+  }
+  std::invoke(callback, std::move(result));
+}
+
+/*!
+  \details The latch and the result can be on the stack,
+  since Latch::wait() doesn't return until the callback finishes the count down
+
+  \tparam Type No description.
+  \param [in,out] mem_resource No description.
+  \param [in] task No description.
+  \return No description
+  */
+template <typename Type> inline
+auto syncWait(std::pmr::memory_resource* mem_resource, Task<Type> task) -> Type
+{
+  Latch latch{1};
+  TaskResult<Type> result;
+  detachTask(mem_resource, std::move(task), [&latch, &result](TaskResult<Type>&& r)
+  {
+    result = std::move(r);
+    latch.countDown();
+  });
+  latch.wait();
+  if constexpr (std::is_void_v<Type>)
+    result.get();
+  else
+    return result.get();
+}
+
+/*!
+  \details The given tasks run concurrently if they are scheduled on
+  worker threads. The exception of the first failed task is rethrown
+
+  \tparam Types No description.
+  \param [in,out] mem_resource No description.
+  \param [in] tasks No description.
+  \return No description
+  */
+template <typename ...Types> inline
+auto whenAll(std::pmr::memory_resource* mem_resource, Task<Types>... tasks)
+    -> Task<std::tuple<TaskValueT<Types>...>>
+{
+  using ResultListT = std::tuple<TaskResult<Types>...>;
+  using StateT = WhenAllState<ResultListT>;
+  StateT* state = StateT::create(sizeof...(Types), mem_resource);
+  std::size_t num_of_launched = 0;
+  auto launch = [mem_resource, state, &num_of_launched]<typename Type>(Task<Type>& task,
+                                                                      TaskResult<Type>& result)
+  {
+    detachTask(mem_resource, std::move(task), [state, &result](TaskResult<Type>&& r)
+    {
+      result = std::move(r);
+      if (state->counter().arrive())
+        state->counter().resume();
+      StateT::release(state);
+    });
+    ++num_of_launched;
+  };
+  try {
+    std::apply([&launch, &tasks...](TaskResult<Types>&... result_list)
+    {
+      (launch(tasks, result_list), ...);
+    }, state->results());
+  }
+  catch (...) {
+    // The tasks which aren't launched don't hold the state
+    StateT::release(state, 1 + sizeof...(Types) - num_of_launched);
+    throw;
+  }
+  co_await state->counter();
+
+  ResultListT results = std::move(state->results());
+  StateT::release(state);
+  co_return std::apply([](TaskResult<Types>&... r)
+  {
+    return std::tuple<TaskValueT<Types>...>{r.get()...};
+  }, results);
+}
+
+/*!
+  \details The given tasks run concurrently if they are scheduled on
+  worker threads. The exception of the first failed task is rethrown
+
+  \tparam Type No description.
+  \param [in,out] mem_resource No description.
+  \param [in] tasks No description.
+  \return No description
+  */
+template <typename Type> inline
+auto whenAll(std::pmr::memory_resource* mem_resource, std::pmr::vector<Task<Type>> tasks)
+    -> Task<std::pmr::vector<TaskValueT<Type>>>
+{
+  using ResultListT = std::pmr::vector<TaskResult<Type>>;
+  using StateT = WhenAllState<ResultListT>;
+  StateT* state = StateT::create(tasks.size(),
+                                 mem_resource,
+                                 tasks.size(),
+                                 typename ResultListT::allocator_type{mem_resource});
+  std::size_t num_of_launched = 0;
+  try {
+    for (; num_of_launched < tasks.size(); ++num_of_launched) {
+      TaskResult<Type>& result = state->results()[num_of_launched];
+      detachTask(mem_resource, std::move(tasks[num_of_launched]), [state, &result](TaskResult<Type>&& r)
+      {
+        result = std::move(r);
+        if (state->counter().arrive())
+          state->counter().resume();
+        StateT::release(state);
+      });
+    }
+  }
+  catch (...) {
+    // The tasks which aren't launched don't hold the state
+    StateT::release(state, 1 + tasks.size() - num_of_launched);
+    throw;
+  }
+  co_await state->counter();
+
+  ResultListT results = std::move(state->results());
+  StateT::release(state);
+  using ValueListT = std::pmr::vector<TaskValueT<Type>>;
+  ValueListT values{typename ValueListT::allocator_type{mem_resource}};
+  values.reserve(results.size());
+  for (TaskResult<Type>& result : results)
+    values.emplace_back(result.get());
+  co_return values;
+}
+
+/*!
+  \details The rest tasks keep running after the first completion and
+  their results are discarded
+
+  \tparam Type No description.
+  \tparam Types No description.
+  \param [in,out] mem_resource No description.
+  \param [in] task No description.
+  \param [in] tasks No description.
+  \return The index of the first completed task and its value
+  */
+template <typename Type, std::same_as<Type> ...Types> inline
+auto whenAny(std::pmr::memory_resource* mem_resource, Task<Type> task, Task<Types>... tasks)
+    -> Task<std::pair<std::size_t, TaskValueT<Type>>>
+{
+  using StateT = WhenAnyState<Type>;
+  StateT* state = StateT::create(1 + sizeof...(Types), mem_resource);
+  std::size_t num_of_launched = 0;
+  auto launch = [mem_resource, state, &num_of_launched](Task<Type>& t)
+  {
+    const std::size_t index = num_of_launched;
+    detachTask(mem_resource, std::move(t), [state, index](TaskResult<Type>&& r)
+    {
+      if (state->tryComplete(index, std::move(r)) && state->counter().arrive())
+        state->counter().resume();
+      StateT::release(state);
+    });
+    ++num_of_launched;
+  };
+  try {
+    launch(task);
+    (launch(tasks), ...);
+  }
+  catch (...) {
+    // The tasks which aren't launched don't hold the state
+    StateT::release(state, 2 + sizeof...(Types) - num_of_launched);
+    throw;
+  }
+  co_await state->counter();
+
+  const std::size_t first = state->index();
+  TaskResult<Type> result = std::move(state->result());
+  StateT::release(state);
+  co_return std::pair<std::size_t, TaskValueT<Type>>{first, result.get()};
+}
+
+} // namespace zisc
+
+#endif // ZISC_TASK_INL_HPP
@@ -0,0 +1,502 @@
+/*!
+  \file task.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_TASK_HPP
+#define ZISC_TASK_HPP
+
+// Standard C++ library
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory_resource>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+// Zisc
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+// Forward declaration
+template <typename> class Task;
+
+//! The value type which a task of Type produces. void is replaced with std::monostate
+template <typename Type>
+using TaskValueT = std::conditional_t<std::is_void_v<Type>, std::monostate, Type>;
+
+/*!
+  \brief The base class of the promise types of coroutines
+
+  The coroutine frame is allocated from the first std::pmr::memory_resource*
+  argument of the coroutine. If there is no such argument,
+  the default memory resource is used.
+
+  \note No notation.
+  \attention No attention.
+  */
+class TaskPromiseBase : private NonCopyable<TaskPromiseBase>
+{
+ public:
+  /*!
+    \brief Resume the awaiting coroutine when the task is completed
+
+    No detailed description.
+    */
+  class FinalAwaiter
+  {
+   public:
+    //! Return false so that the coroutine is suspended
+    [[nodiscard]]
+    auto await_ready() const noexcept -> bool;
+
+    //! Transfer the control to the continuation
+    template <std::derived_from<TaskPromiseBase> Promise>
+    auto await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+        -> std::coroutine_handle<>;
+
+    //! Do nothing
+    void await_resume() const noexcept;
+  };
+
+
+  //! Initialize the promise
+  TaskPromiseBase() noexcept = default;
+
+
+  //! Allocate a coroutine frame
+  template <typename ...ArgTypes>
+  static auto operator new(const std::size_t size, const ArgTypes&... args) -> void*;
+
+  //! Deallocate a coroutine frame
+  static void operator delete(void* frame, const std::size_t size) noexcept;
+
+
+  //! Return the coroutine which awaits the task
+  [[nodiscard]]
+  auto continuation() const noexcept -> std::coroutine_handle<>;
+
+  //! Suspend the task at the end so that the continuation is resumed
+  static auto final_suspend() noexcept -> FinalAwaiter;
+
+  //! Suspend the task at the beginning. Tasks are started lazily
+  static auto initial_suspend() noexcept -> std::suspend_always;
+
+  //! Rethrow the exception thrown in the task if exists
+  void rethrowIfFailed() const;
+
+  //! Set the coroutine which awaits the task
+  void setContinuation(const std::coroutine_handle<> continuation) noexcept;
+
+  //! Store the exception thrown in the task
+  void unhandled_exception() noexcept;
+
+ private:
+  //! Return the memory resource from the given coroutine argument
+  template <typename Type>
+  static auto findResource(const Type& arg) noexcept -> std::pmr::memory_resource*;
+
+  //! Return the offset to the memory resource pointer in a coroutine frame
+  static constexpr auto resourceOffset(const std::size_t size) noexcept -> std::size_t;
+
+
+  static constexpr std::size_t kFrameAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+
+  std::coroutine_handle<> continuation_;
+  std::exception_ptr exception_;
+};
+
+/*!
+  \brief The promise type of Task
+
+  No detailed description.
+
+  \tparam Type No description.
+  */
+template <typename Type>
+class TaskPromise : public TaskPromiseBase
+{
+ public:
+  //! Create a task which is bound to the promise
+  auto get_return_object() noexcept -> Task<Type>;
+
+  //! Return the result of the task
+  auto result() -> Type;
+
+  //! Store the return value of the task
+  template <typename ValueT>
+  requires std::constructible_from<Type, ValueT&&>
+  void return_value(ValueT&& value) noexcept(std::is_nothrow_constructible_v<Type, ValueT&&>);
+
+ private:
+  std::optional<Type> value_;
+};
+
+/*!
+  \brief The promise type of Task which has no return value
+
+  No detailed description.
+  */
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+ public:
+  //! Create a task which is bound to the promise
+  auto get_return_object() noexcept -> Task<void>;
+
+  //! Check if the task succeeded
+  void result();
+
+  //! Do nothing
+  void return_void() noexcept;
+};
+
+/*!
+  \brief Task is a lazily started coroutine which produces a value of Type
+
+  A task isn't started until it's awaited.
+  The awaiting coroutine is resumed on the thread where the task is completed.
+  Use ThreadManager::schedule() to move a task onto a worker thread.
+
+  \tparam Type No description.
+  */
+template <typename Type>
+class Task : private NonCopyable<Task<Type>>
+{
+ public:
+  // Type aliases
+  using ValueT = Type;
+  using promise_type = TaskPromise<Type>;
+  using HandleT = std::coroutine_handle<promise_type>;
+
+
+  /*!
+    \brief No brief description
+
+    No detailed description.
+    */
+  class Awaiter
+  {
+   public:
+    //! Initialize the awaiter
+    explicit Awaiter(const HandleT handle) noexcept;
+
+
+    //! Check if the task is already completed
+    [[nodiscard]]
+    auto await_ready() const noexcept -> bool;
+
+    //! Start the task and transfer the control to it
+    auto await_suspend(const std::coroutine_handle<> continuation) noexcept
+        -> std::coroutine_handle<>;
+
+    //! Return the result of the task
+    auto await_resume() -> Type;
+
+   private:
+    HandleT handle_;
+  };
+
+
+  //! Create an empty task
+  Task() noexcept = default;
+
+  //! Create a task from the given coroutine
+  explicit Task(const HandleT handle) noexcept;
+
+  //! Move a data
+  Task(Task&& other) noexcept;
+
+  //! Destroy the coroutine
+  ~Task() noexcept;
+
+
+  //! Move a data
+  auto operator=(Task&& other) noexcept -> Task&;
+
+  //! Start the task and wait for the result
+  auto operator co_await() && noexcept -> Awaiter;
+
+
+  //! Check if the task is completed
+  [[nodiscard]]
+  auto isReady() const noexcept -> bool;
+
+  //! Check if the task has a coroutine
+  [[nodiscard]]
+  auto isValid() const noexcept -> bool;
+
+ private:
+  //! Destroy the coroutine
+  void destroy() noexcept;
+
+
+  HandleT handle_;
+};
+
+/*!
+  \brief The result of a task which is run by a task combinator
+
+  No detailed description.
+
+  \tparam Type No description.
+  */
+template <typename Type>
+class TaskResult
+{
+ public:
+  // Type aliases
+  using ValueT = TaskValueT<Type>;
+
+
+  //! Return the result. The exception is rethrown if the task failed
+  auto get() -> ValueT;
+
+  //! Check if the result is already set
+  [[nodiscard]]
+  auto hasResult() const noexcept -> bool;
+
+  //! Store the exception thrown in the task
+  void setException(std::exception_ptr exception) noexcept;
+
+  //! Store the value of the task
+  void setValue(ValueT&& value) noexcept(std::is_nothrow_move_constructible_v<ValueT>);
+
+ private:
+  std::optional<ValueT> value_;
+  std::exception_ptr exception_;
+};
+
+/*!
+  \brief Resume a coroutine when the given number of tasks are completed
+
+  The waiting coroutine also arrives at the counter when it gets suspended,
+  so the tasks which are completed before the suspension don't resume it.
+
+  \note No notation.
+  \attention No attention.
+  */
+class TaskCounter : private NonCopyable<TaskCounter>
+{
+ public:
+  /*!
+    \brief No brief description
+
+    No detailed description.
+    */
+  class Awaiter
+  {
+   public:
+    //! Initialize the awaiter
+    explicit Awaiter(TaskCounter* counter) noexcept;
+
+
+    //! Return false so that the waiter arrives at the counter
+    [[nodiscard]]
+    auto await_ready() const noexcept -> bool;
+
+    //! Suspend the waiter unless all tasks are already completed
+    auto await_suspend(const std::coroutine_handle<> waiter) noexcept -> bool;
+
+    //! Do nothing
+    void await_resume() const noexcept;
+
+   private:
+    TaskCounter* counter_;
+  };
+
+
+  //! Initialize the counter with the given number of tasks
+  explicit TaskCounter(const std::size_t num_of_tasks) noexcept;
+
+
+  //! Wait for the tasks
+  auto operator co_await() noexcept -> Awaiter;
+
+
+  //! Arrive at the counter. Return true if it is the last arrival
+  auto arrive() noexcept -> bool;
+
+  //! Resume the waiting coroutine
+  void resume() const;
+
+ private:
+  std::atomic<std::size_t> count_;
+  std::coroutine_handle<> waiter_;
+};
+
+/*!
+  \brief The shared state of whenAll
+
+  The state is held by each task and the waiting coroutine,
+  so the launched tasks can complete even if the waiter fails to launch the rest.
+
+  \tparam ResultListT No description.
+  */
+template <typename ResultListT>
+class WhenAllState : private NonCopyable<WhenAllState<ResultListT>>
+{
+ public:
+  //! Initialize the state
+  template <typename ...ArgTypes>
+  WhenAllState(const std::size_t num_of_tasks,
+               std::pmr::memory_resource* mem_resource,
+               ArgTypes&&... args);
+
+
+  //! Create a state
+  template <typename ...ArgTypes>
+  static auto create(const std::size_t num_of_tasks,
+                     std::pmr::memory_resource* mem_resource,
+                     ArgTypes&&... args) -> WhenAllState*;
+
+  //! Return the counter which resumes the waiting coroutine
+  auto counter() noexcept -> TaskCounter&;
+
+  //! Release holds on the state. The state is destroyed when no hold remains
+  static void release(WhenAllState* state, const std::size_t num_of_holds = 1) noexcept;
+
+  //! Return the results of the tasks
+  auto results() noexcept -> ResultListT&;
+
+ private:
+  TaskCounter counter_;
+  std::atomic<std::size_t> num_of_holds_;
+  ResultListT results_;
+  std::pmr::memory_resource* resource_;
+};
+
+/*!
+  \brief The shared state of whenAny
+
+  The state is held by each task and the waiting coroutine,
+  since the rest tasks keep running after the first completion.
+
+  \tparam Type No description.
+  */
+template <typename Type>
+class WhenAnyState : private NonCopyable<WhenAnyState<Type>>
+{
+ public:
+  //! Initialize the state
+  WhenAnyState(const std::size_t num_of_holds,
+               std::pmr::memory_resource* mem_resource) noexcept;
+
+
+  //! Create a state
+  static auto create(const std::size_t num_of_tasks,
+                     std::pmr::memory_resource* mem_resource) -> WhenAnyState*;
+
+  //! Return the counter which resumes the waiting coroutine
+  auto counter() noexcept -> TaskCounter&;
+
+  //! Return the index of the first completed task
+  [[nodiscard]]
+  auto index() const noexcept -> std::size_t;
+
+  //! Release holds on the state. The state is destroyed when no hold remains
+  static void release(WhenAnyState* state, const std::size_t num_of_holds = 1) noexcept;
+
+  //! Return the result of the first completed task
+  auto result() noexcept -> TaskResult<Type>&;
+
+  //! Store the given result if it's the first completion
+  auto tryComplete(const std::size_t index, TaskResult<Type>&& result) -> bool;
+
+ private:
+  TaskCounter counter_{1};
+  std::atomic<std::size_t> num_of_holds_;
+  std::atomic<bool> is_completed_{false};
+  std::size_t index_ = 0;
+  TaskResult<Type> result_;
+  std::pmr::memory_resource* resource_;
+};
+
+/*!
+  \brief A coroutine which starts eagerly and destroys itself at the end
+
+  No detailed description.
+
+  \note No notation.
+  \attention No attention.
+  */
+class DetachedTask
+{
+ public:
+  /*!
+    \brief No brief description
+
+    No detailed description.
+    */
+  class promise_type : public TaskPromiseBase
+  {
+   public:
+    //! Create a detached task
+    static auto get_return_object() noexcept -> DetachedTask;
+
+    //! Destroy the coroutine frame at the end
+    static auto final_suspend() noexcept -> std::suspend_never;
+
+    //! Start the coroutine immediately
+    static auto initial_suspend() noexcept -> std::suspend_never;
+
+    //! Do nothing
+    static void return_void() noexcept;
+
+    //! Terminate the program. Detached tasks must handle exceptions
+    [[noreturn]] static void unhandled_exception() noexcept;
+  };
+};
+
+//! Run the given task and call the callback with the result
+template <typename Type, typename Callback>
+requires std::invocable<Callback, TaskResult<Type>&&>
+auto detachTask(std::pmr::memory_resource* mem_resource,
+                Task<Type> task,
+                Callback callback) -> DetachedTask;
+
+//! Run the given task and block the current thread until it's completed
+template <typename Type>
+auto syncWait(std::pmr::memory_resource* mem_resource, Task<Type> task) -> Type;
+
+//! Create a task which completes when all the given tasks are completed
+template <typename ...Types>
+auto whenAll(std::pmr::memory_resource* mem_resource, Task<Types>... tasks)
+    -> Task<std::tuple<TaskValueT<Types>...>>;
+
+//! Create a task which completes when all the given tasks are completed
+template <typename Type>
+auto whenAll(std::pmr::memory_resource* mem_resource, std::pmr::vector<Task<Type>> tasks)
+    -> Task<std::pmr::vector<TaskValueT<Type>>>;
+
+//! Create a task which completes when one of the given tasks is completed
+template <typename Type, std::same_as<Type> ...Types>
+auto whenAny(std::pmr::memory_resource* mem_resource, Task<Type> task, Task<Types>... tasks)
+    -> Task<std::pair<std::size_t, TaskValueT<Type>>>;
+
+} // namespace zisc
+
+/*!
+  \example task_example.cpp
+  This is an example of how to use Task class.
+  */
+
+#include "task-inl.hpp"
+
+#endif // ZISC_TASK_HPP
@@ -21,20 +21,26 @@
 #include <array>
 #include <atomic>
 #include <bit>
+#include <chrono>
 #include <concepts>
+#include <condition_variable>
+#include <coroutine>
 #include <cstddef>
 #include <functional>
 #include <future>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <system_error>
 #include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
 // Zisc
 #include "packaged_task.hpp"
+#include "worker_local.hpp"
 #include "zisc/concepts.hpp"
 #include "zisc/error.hpp"
 #include "zisc/utility.hpp"
@@ -54,15 +60,56 @@ namespace zisc {
   \param [in] n No description.
   */
 inline
-ThreadManager::TaskExceptionData::TaskExceptionData(SharedTaskT&& t,
+ThreadManager::TaskExceptionData::TaskExceptionData(PackagedTask* t,
                                                     const DiffT offset,
-                                                    const DiffT n) :
-    task_{std::move(t)},
+                                                    const DiffT n) noexcept :
+    task_{t},
     begin_offset_{offset},
     num_of_iterations_{n}
 {
 }
 
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  */
+inline
+ThreadManager::TaskExceptionData::TaskExceptionData(TaskExceptionData&& other) noexcept :
+    task_{other.task_},
+    begin_offset_{other.begin_offset_},
+    num_of_iterations_{other.num_of_iterations_}
+{
+  other.task_ = nullptr;
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+ThreadManager::TaskExceptionData::~TaskExceptionData() noexcept
+{
+  release();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  \return No description
+  */
+inline
+auto ThreadManager::TaskExceptionData::operator=(TaskExceptionData&& other) noexcept
+    -> TaskExceptionData&
+{
+  release();
+  task_ = other.task_;
+  begin_offset_ = other.begin_offset_;
+  num_of_iterations_ = other.num_of_iterations_;
+  other.task_ = nullptr;
+  return *this;
+}
+
 /*!
   \details No detailed description
 
@@ -93,7 +140,7 @@ auto ThreadManager::TaskExceptionData::numOfIterations() const noexcept -> DiffT
 template <typename Type> inline
 auto ThreadManager::TaskExceptionData::task() noexcept -> PackagedTaskType<Type>&
 {
-  auto* t = dynamic_cast<PackagedTaskType<Type>*>(task_.get());
+  auto* t = dynamic_cast<PackagedTaskType<Type>*>(task_);
   ZISC_ASSERT(t != nullptr, "The dynamic cast of the packaged task failed.");
   return *t;
 }
@@ -106,11 +153,77 @@ auto ThreadManager::TaskExceptionData::task() noexcept -> PackagedTaskType<Type>
 template <typename Type> inline
 auto ThreadManager::TaskExceptionData::task() const noexcept -> const PackagedTaskType<Type>&
 {
-  const auto* t = dynamic_cast<const PackagedTaskType<Type>*>(task_.get());
+  const auto* t = dynamic_cast<const PackagedTaskType<Type>*>(task_);
   ZISC_ASSERT(t != nullptr, "The dynamic cast of the packaged task failed.");
   return *t;
 }
 
+/*!
+  \details The data holds the iterations which weren't enqueued except
+  the overflowed one and the hold of the enqueuer.
+  The overflowed iteration is released by the queue error
+  */
+inline
+void ThreadManager::TaskExceptionData::release() noexcept
+{
+  if (task_ != nullptr) {
+    PackagedTask::release(task_, num_of_iterations_ - begin_offset_);
+    task_ = nullptr;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] manager No description.
+  */
+inline
+ThreadManager::ScheduleAwaiter::ScheduleAwaiter(ThreadManager* manager) noexcept :
+    manager_{manager},
+    thread_id_{unmanagedThreadId()}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto ThreadManager::ScheduleAwaiter::await_ready() const noexcept -> bool
+{
+  return false;
+}
+
+/*!
+  \details The coroutine can be resumed before the function returns,
+  so the awaiter isn't accessed after enqueuing
+
+  \param [in] handle No description.
+  \exception OverflowError No description.
+  */
+inline
+void ThreadManager::ScheduleAwaiter::await_suspend(const std::coroutine_handle<> handle)
+{
+  auto resume = [this, handle](const int64b thread_id)
+  {
+    thread_id_ = thread_id;
+    handle.resume();
+  };
+  [[maybe_unused]] const std::future<void> result = manager_->enqueue(std::move(resume));
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto ThreadManager::ScheduleAwaiter::await_resume() const noexcept -> int64b
+{
+  return thread_id_;
+}
+
 /*!
   \details No detailed description
 
@@ -134,10 +247,13 @@ ThreadManager::ThreadManager(const int64b num_of_threads,
     task_id_count_{0},
     num_of_tasks_{0},
     num_of_active_workers_{0},
+    num_of_running_workers_{0},
+    num_of_parked_workers_{0},
+    idle_timeout_{noIdleTimeout().count()},
     task_queue_{defaultCapacity(), mem_resource},
     task_status_list_{taskStatusSize(), mem_resource},
     worker_list_{decltype(worker_list_)::allocator_type{mem_resource}},
-    worker_id_list_{decltype(worker_id_list_)::allocator_type{mem_resource}},
+    worker_running_list_{decltype(worker_running_list_)::allocator_type{mem_resource}},
     task_storage_list_{decltype(task_storage_list_)::allocator_type{mem_resource}}
 {
   initialize(num_of_threads);
@@ -243,6 +359,26 @@ void ThreadManager::clear() noexcept
   taskStatusList().reset();
 }
 
+/*!
+  \details The instances are created for the current number of workers.
+  The worker local storage isn't resized by setNumOfThreads(),
+  so the access from a worker added later throws SystemError.
+  Create the storage again after growing the thread pool
+
+  \tparam Type No description.
+  \tparam ArgTypes No description.
+  \param [in] args No description.
+  \return No description
+  */
+template <std::move_constructible Type, typename ...ArgTypes>
+requires std::constructible_from<Type, const ArgTypes&...> inline
+auto ThreadManager::createWorkerLocal(const ArgTypes&... args) const -> WorkerLocal<Type>
+{
+  const auto num_of_workers = cast<std::size_t>(numOfThreads());
+  WorkerLocal<Type> local{num_of_workers, resource(), args...};
+  return local;
+}
+
 /*!
   \details No detailed description
 
@@ -363,6 +499,18 @@ auto ThreadManager::enqueueLoop(Func&& task,
   return result;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto ThreadManager::idleTimeout() const noexcept -> std::chrono::milliseconds
+{
+  const int64b timeout = idle_timeout_.load(std::memory_order::acquire);
+  return std::chrono::milliseconds{timeout};
+}
+
 /*!
   \details No detailed description
 
@@ -390,6 +538,29 @@ auto ThreadManager::logicalCores() noexcept -> int64b
 /*!
   \details No detailed description
 
+  \return No description
+  */
+inline
+constexpr auto ThreadManager::noIdleTimeout() noexcept -> std::chrono::milliseconds
+{
+  return (std::chrono::milliseconds::max)();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto ThreadManager::numOfRunningThreads() const noexcept -> int64b
+{
+  const int num_of_threads = num_of_running_workers_.load(std::memory_order::acquire);
+  return cast<int64b>(num_of_threads);
+}
+
+/*!
+  \details The worker threads are counted even if they aren't spawned yet
+
   \return The number of worker threads
   */
 inline
@@ -411,6 +582,17 @@ auto ThreadManager::resource() const noexcept -> std::pmr::memory_resource*
   return mem_resource;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto ThreadManager::schedule() noexcept -> ScheduleAwaiter
+{
+  return ScheduleAwaiter{this};
+}
+
 /*!
   \details No detailed description
 
@@ -424,6 +606,39 @@ void ThreadManager::setCapacity(const std::size_t cap)
   clear();
 }
 
+/*!
+  \details A retired worker is spawned again at the next enqueue
+
+  \param [in] timeout No description.
+  */
+inline
+void ThreadManager::setIdleTimeout(const std::chrono::milliseconds timeout) noexcept
+{
+  idle_timeout_.store(timeout.count(), std::memory_order::release);
+  // Let the parked workers apply the new timeout
+  std::scoped_lock lock{worker_mutex_};
+  worker_condition_.notify_all();
+}
+
+/*!
+  \details All queued tasks are completed and the running workers are stopped.
+  The new workers are spawned at the next enqueue.
+  Enqueuing must not be performed concurrently with the call.
+  The worker local storages created before the call keep their sizes,
+  so the workers added by growing the pool can't use them.
+  The access with the thread ID of such a worker throws SystemError
+
+  \param [in] num_of_threads No description.
+  */
+inline
+void ThreadManager::setNumOfThreads(const int64b num_of_threads)
+{
+  waitForCompletion();
+  exitWorkersRunning();
+  resizeWorkers(num_of_threads);
+  num_of_tasks_.store(0, std::memory_order::release);
+}
+
 /*!
   \details No detailed description
 
@@ -468,9 +683,9 @@ void ThreadManager::waitForCompletion() noexcept
   \param [in] it_offset No description.
   */
 inline
-ThreadManager::WorkerTask::WorkerTask(SharedTaskT task, const DiffT it_offset) noexcept :
+ThreadManager::WorkerTask::WorkerTask(PackagedTask* task, const DiffT it_offset) noexcept :
     it_offset_{it_offset},
-    task_{std::move(task)}
+    task_{task}
 {
 }
 
@@ -482,8 +697,18 @@ ThreadManager::WorkerTask::WorkerTask(SharedTaskT task, const DiffT it_offset) n
 inline
 ThreadManager::WorkerTask::WorkerTask(WorkerTask&& other) noexcept :
     it_offset_{other.it_offset_},
-    task_{std::move(other.task_)}
+    task_{other.task_}
 {
+  other.task_ = nullptr;
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+ThreadManager::WorkerTask::~WorkerTask() noexcept
+{
+  release();
 }
 
 /*!
@@ -494,8 +719,10 @@ ThreadManager::WorkerTask::WorkerTask(WorkerTask&& other) noexcept :
 inline
 auto ThreadManager::WorkerTask::operator=(WorkerTask&& other) noexcept -> WorkerTask&
 {
+  release();
   it_offset_ = other.it_offset_;
-  task_ = std::move(other.task_);
+  task_ = other.task_;
+  other.task_ = nullptr;
   return *this;
 }
 
@@ -510,6 +737,19 @@ void ThreadManager::WorkerTask::operator()(const int64b thread_id)
   run(thread_id);
 }
 
+/*!
+  \details The caller takes over the hold and must release it
+
+  \return No description
+  */
+inline
+auto ThreadManager::WorkerTask::detach() noexcept -> PackagedTask*
+{
+  PackagedTask* task = task_;
+  task_ = nullptr;
+  return task;
+}
+
 /*!
   \details No detailed description
 
@@ -518,10 +758,22 @@ void ThreadManager::WorkerTask::operator()(const int64b thread_id)
 inline
 auto ThreadManager::WorkerTask::isValid() const noexcept -> bool
 {
-  const auto is_valid = cast<bool>(task_);
+  const bool is_valid = task_ != nullptr;
   return is_valid;
 }
 
+/*!
+  \details No detailed description
+  */
+inline
+void ThreadManager::WorkerTask::release() noexcept
+{
+  if (task_ != nullptr) {
+    PackagedTask::release(task_, 1);
+    task_ = nullptr;
+  }
+}
+
 /*!
   \details No detailed description
 
@@ -533,6 +785,17 @@ void ThreadManager::WorkerTask::run(const int64b thread_id)
   task_->run(thread_id, it_offset_);
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto ThreadManager::WorkerTask::task() const noexcept -> PackagedTask*
+{
+  return task_;
+}
+
 /*!
   \brief The implementation of loop task
 
@@ -554,10 +817,14 @@ class ThreadManager::TaskImpl<void, Data, Ite1, Ite2, true> : public PackagedTas
 
 
   //! Initialize the task
-  TaskImpl(const int64b task_info, PromiseT&& p, ThreadManager* manager) noexcept :
+  TaskImpl(const int64b task_info,
+           PromiseT&& p,
+           ThreadManager* manager,
+           std::pmr::memory_resource* mem_resource) noexcept :
       BaseT(task_info),
       promise_{std::move(p)},
-      manager_{manager}
+      manager_{manager},
+      resource_{mem_resource}
   {
   }
 
@@ -595,11 +862,20 @@ class ThreadManager::TaskImpl<void, Data, Ite1, Ite2, true> : public PackagedTas
     begin_.set(std::forward<I>(b));
   }
 
+ protected:
+  //! Destroy the task and deallocate the memory of the task
+  void destroy() noexcept override
+  {
+    std::pmr::polymorphic_allocator<TaskImpl> alloc{resource_};
+    alloc.delete_object(this);
+  }
+
  private:
   PromiseT promise_;
   DataStorage<DataT> task_;
   DataStorage<IteT> begin_;
   ThreadManager* manager_;
+  std::pmr::memory_resource* resource_;
 };
 
 /*!
@@ -625,10 +901,14 @@ class ThreadManager::TaskImpl<Return, Data, Ite1, Ite2, false> : public Packaged
 
 
   //! Initialize the task
-  TaskImpl(const int64b task_info, PromiseT&& p, ThreadManager* manager) noexcept :
+  TaskImpl(const int64b task_info,
+           PromiseT&& p,
+           ThreadManager* manager,
+           std::pmr::memory_resource* mem_resource) noexcept :
       BaseT(task_info),
       promise_{std::move(p)},
-      manager_{manager}
+      manager_{manager},
+      resource_{mem_resource}
   {
   }
 
@@ -670,10 +950,19 @@ class ThreadManager::TaskImpl<Return, Data, Ite1, Ite2, false> : public Packaged
     task_.set(std::forward<D>(data));
   }
 
+ protected:
+  //! Destroy the task and deallocate the memory of the task
+  void destroy() noexcept override
+  {
+    std::pmr::polymorphic_allocator<TaskImpl> alloc{resource_};
+    alloc.delete_object(this);
+  }
+
  private:
   PromiseT promise_;
   DataStorage<DataT> task_;
   ThreadManager* manager_;
+  std::pmr::memory_resource* resource_;
 };
 
 /*!
@@ -708,19 +997,23 @@ auto ThreadManager::advance(Ite& begin, const OffsetT offset) noexcept -> Ite
   \return No description
   */
 template <std::derived_from<PackagedTask> Task, typename Data, typename Ite> inline
-auto ThreadManager::createSharedTask(Data&& data,
-                                     Ite&& ite,
-                                     const bool wait_for_precedence) -> std::shared_ptr<Task>
+auto ThreadManager::createTask(Data&& data,
+                               Ite&& ite,
+                               const bool wait_for_precedence) -> Task*
 {
   constexpr std::size_t alloc_attempt_max = 4;
-  std::shared_ptr<Task> task{};
-  for (std::size_t i = 0; !task && (i < alloc_attempt_max); ++i) {
+  Task* task = nullptr;
+  for (std::size_t i = 0; (task == nullptr) && (i < alloc_attempt_max); ++i) {
     // Issue a task ID
     const int64b task_id = issueTaskId();
 
     // Check resource
     const auto storage_id = static_cast<std::size_t>(task_id);
-    TaskResource& task_resource = task_storage_list_[storage_id];
+    std::optional<TaskResource>& storage = task_storage_list_[storage_id];
+    // The storage is allocated on the first use of the task ID
+    if (!storage.has_value())
+      storage.emplace(resource());
+    TaskResource& task_resource = *storage;
     invokeIfTrue(!task_resource.isOccupied(), [&task_resource]() noexcept
     {
       task_resource.release();
@@ -744,56 +1037,19 @@ auto ThreadManager::createSharedTask(Data&& data,
 
       std::pmr::polymorphic_allocator<Task> task_alloc{mem_resource};
       const int64b info = PackagedTask::encodeInfo(task_id, wait_for_precedence);
-      task = std::allocate_shared<Task>(task_alloc, info, std::move(promise), this);
+      task = task_alloc.template new_object<Task>(info, std::move(promise), this, mem_resource);
     }
     catch ([[maybe_unused]] const Memory::BadAllocation& error) {
       if (i == (alloc_attempt_max - 1))
         throw;
     }
   }
-  ZISC_ASSERT(task != nullptr, "The shared task is still null.");
+  ZISC_ASSERT(task != nullptr, "The task is still null.");
   task->setData(std::forward<Data>(data), std::forward<Ite>(ite));
 
   return task;
 }
 
-/*!
-  \details No detailed description
-
-  \param [in] num_of_threads No description.
-  */
-inline
-void ThreadManager::createWorkers(const int64b num_of_threads)
-{
-  const std::size_t n = getAvailableNumOfThreads(num_of_threads);
-  constexpr DiffT not_ready = -1;
-  num_of_tasks_.store(not_ready, std::memory_order::release);
-  num_of_active_workers_.store(cast<int>(n), std::memory_order::release);
-
-  auto work = [this]()
-  {
-    // Wait until all worker creation are completed
-    num_of_tasks_.wait(not_ready, std::memory_order::acquire);
-    // Run worker tasks
-    const int64b thread_id = getCurrentThreadId();
-    doWorkerTasks(thread_id);
-  };
-
-  worker_list_.reserve(n);
-  worker_id_list_.reserve(n);
-  for (std::size_t i = 0; i < n; ++i) {
-    worker_list_.emplace_back(work);
-    worker_id_list_.emplace_back(worker_list_.back().get_id());
-  }
-  std::sort(worker_id_list_.begin(), worker_id_list_.end());
-
-  // Activate all workers
-  num_of_tasks_.store(0, std::memory_order::release);
-  num_of_tasks_.notify_all();
-  // Wait until underlying threads actually become ready
-  waitForCompletion();
-}
-
 /*!
   \details No detailed description
 
@@ -817,30 +1073,52 @@ auto ThreadManager::distance(const Ite1& begin, const Ite2& end) noexcept -> Dif
 }
 
 /*!
-  \details No detailed description
+  \details A worker keeps the holds of the iterations of a task it ran and
+  releases them with one atomic operation when it moves to another task or
+  runs out of tasks. So a loop task costs one release per worker instead of
+  one per iteration, and the task is completed before the worker waits or
+  runs a task which may wait for it
 
   \param [in] thread_id No description.
   */
 inline
 void ThreadManager::doWorkerTasks(const int64b thread_id)
 {
+  PackagedTask* held_task = nullptr;
+  DiffT num_of_holds = 0;
+  auto release_holds = [&held_task, &num_of_holds]() noexcept
+  {
+    if (held_task != nullptr)
+      PackagedTask::release(held_task, num_of_holds);
+    held_task = nullptr;
+    num_of_holds = 0;
+  };
+
   while (workersAreEnabled()) {
     std::optional<WorkerTask> task = fetchTask();
     if (task.has_value() && task->isValid()) {
+      if (task->task() != held_task)
+        release_holds();
       (*task)(thread_id);
+      held_task = task->detach();
+      ++num_of_holds;
+      continue;
     }
+    release_holds();
     // Wait for next task
-    else if (0 < num_of_tasks_.load(std::memory_order::acquire)) {
+    if (0 < num_of_tasks_.load(std::memory_order::acquire)) {
       // The worker just missed queued tasks, waits a little
       std::this_thread::yield();
     }
     else {
       // There is no task. The worker waits for next task queuing
       num_of_active_workers_.fetch_sub(1, std::memory_order::acq_rel);
-      num_of_tasks_.wait(0, std::memory_order::acquire);
+      if (!parkWorker(thread_id))
+        break;
       num_of_active_workers_.fetch_add(1, std::memory_order::acq_rel);
     }
   }
+  release_holds();
 }
 
 /*!
@@ -867,32 +1145,44 @@ auto ThreadManager::enqueueImpl(Data&& task,
 {
   const DiffT num_of_tasks = distance(begin, std::forward<Ite2>(end));
 
-  // Create a shared task
+  // Create a task. The task is held by each iteration and the enqueuer
   using TaskImplT = TaskImpl<ReturnT, Data, Ite1, Ite2, kIsLoop>;
-  std::shared_ptr shared_task = createSharedTask<TaskImplT>(std::forward<Data>(task),
-                                                            std::forward<Ite1>(begin),
-                                                            wait_for_precedence);
+  TaskImplT* task_impl = createTask<TaskImplT>(std::forward<Data>(task),
+                                               std::forward<Ite1>(begin),
+                                               wait_for_precedence);
+  task_impl->setNumOfHolds(num_of_tasks + 1);
 
   // Enqueue tasks
-  num_of_tasks_.fetch_add(num_of_tasks, std::memory_order::acq_rel);
+  num_of_tasks_.fetch_add(num_of_tasks, std::memory_order::seq_cst);
+  // Workers are spawned lazily, and retired workers are respawned
+  if (num_of_running_workers_.load(std::memory_order::seq_cst) < numOfThreads()) {
+    try {
+      spawnWorkers();
+    }
+    catch ([[maybe_unused]] const std::system_error& error) {
+      num_of_tasks_.fetch_sub(num_of_tasks, std::memory_order::acq_rel);
+      PackagedTask::release(task_impl, num_of_tasks + 1);
+      throw;
+    }
+  }
   for (DiffT i = 0; i < num_of_tasks; ++i) {
-    WorkerTask worker_task{shared_task, i};
+    WorkerTask worker_task{task_impl, i};
     try {
       [[maybe_unused]] const std::optional result = taskQueue().enqueue(std::move(worker_task));
     }
     catch ([[maybe_unused]] const TaskQueue::OverflowError& error) {
       const DiffT rest = num_of_tasks - i;
       num_of_tasks_.fetch_sub(rest, std::memory_order::acq_rel);
-      num_of_tasks_.notify_all();
+      // The exception takes over the holds of the rest iterations and the enqueuer
       const char* message = "Task queue overflow happened.";
-      throw OverflowError{message,
-                          resource(),
-                          {std::move(shared_task), i, num_of_tasks}};
+      throw OverflowError{message, resource(), {task_impl, i, num_of_tasks}};
     }
-    num_of_tasks_.notify_one();
+    notifyWorker();
   }
 
-  return shared_task->getFuture();
+  std::future<ReturnT> result = task_impl->getFuture();
+  PackagedTask::release(task_impl, 1);
+  return result;
 }
 
 /*!
@@ -901,12 +1191,18 @@ auto ThreadManager::enqueueImpl(Data&& task,
 inline
 void ThreadManager::exitWorkersRunning() noexcept
 {
-  num_of_tasks_.store(-1, std::memory_order::release);
-  num_of_tasks_.notify_all();
+  num_of_tasks_.store(-1, std::memory_order::seq_cst);
+  {
+    std::scoped_lock lock{worker_mutex_};
+    worker_condition_.notify_all();
+  }
   std::for_each(worker_list_.begin(), worker_list_.end(), [](std::thread& worker)
   {
-    worker.join();
+    if (worker.joinable())
+      worker.join();
   });
+  std::fill(worker_running_list_.begin(), worker_running_list_.end(), false);
+  num_of_running_workers_.store(0, std::memory_order::release);
   num_of_active_workers_.store(0, std::memory_order::release);
   clear();
 }
@@ -940,22 +1236,6 @@ auto ThreadManager::getAvailableNumOfThreads(const int64b s) noexcept -> std::si
   return cast<std::size_t>(num_of_threads);
 }
 
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-auto ThreadManager::getCurrentThreadId() const noexcept -> int64b
-{
-  const std::thread::id id = std::this_thread::get_id();
-  const auto t = std::lower_bound(worker_id_list_.begin(), worker_id_list_.end(), id);
-  const bool result = (t != worker_id_list_.end()) && (*t == id);
-  const int64b thread_id = result ? std::distance(worker_id_list_.begin(), t)
-                                  : unmanagedThreadId();
-  return thread_id;
-}
-
 /*!
   \details No detailed description
 
@@ -966,13 +1246,12 @@ void ThreadManager::initialize(const int64b num_of_threads) noexcept
 {
   static_assert(TaskQueue::isConcurrent(), "TaskQueue doesn't support concurrency.");
   try {
-    createWorkers(num_of_threads);
+    resizeWorkers(num_of_threads);
     setCapacity(defaultCapacity());
     // Initialize resources
+    // Task storages are allocated lazily
     task_storage_list_.clear();
-    task_storage_list_.reserve(taskStatusList().size());
-    for (std::size_t i = 0; i < taskStatusList().size(); ++i)
-      task_storage_list_.emplace_back(resource());
+    task_storage_list_.resize(taskStatusList().size());
   }
   catch ([[maybe_unused]] const std::exception& error) {
     ZISC_ASSERT(false, "ThreadManager initialization failed.");
@@ -998,6 +1277,115 @@ auto ThreadManager::issueTaskId() noexcept -> int64b
   return id;
 }
 
+/*!
+  \details No detailed description
+  */
+inline
+void ThreadManager::notifyWorker() noexcept
+{
+  if (0 < num_of_parked_workers_.load(std::memory_order::seq_cst)) {
+    std::scoped_lock lock{worker_mutex_};
+    worker_condition_.notify_one();
+  }
+}
+
+/*!
+  \details The worker retires if no task is queued within the idle timeout.
+  The running worker count is decremented before the final check of
+  the queued tasks, so an enqueuer either sees the retirement and spawns
+  a new worker or the worker sees the queued tasks
+
+  \param [in] thread_id No description.
+  \return No description
+  */
+inline
+auto ThreadManager::parkWorker(const int64b thread_id) noexcept -> bool
+{
+  auto has_task = [this]() noexcept
+  {
+    return num_of_tasks_.load(std::memory_order::seq_cst) != 0;
+  };
+
+  // Spin a little before parking since tasks are often enqueued in a row
+  for (std::size_t i = 0; i < kParkSpinCount; ++i) {
+    if (has_task())
+      return true;
+    std::this_thread::yield();
+  }
+
+  std::unique_lock lock{worker_mutex_};
+  num_of_parked_workers_.fetch_add(1, std::memory_order::seq_cst);
+  bool is_timed_out = false;
+  while (!has_task() && !is_timed_out) {
+    const std::chrono::milliseconds timeout = idleTimeout();
+    if (timeout == noIdleTimeout())
+      worker_condition_.wait(lock);
+    else
+      is_timed_out = worker_condition_.wait_for(lock, timeout) == std::cv_status::timeout;
+  }
+  num_of_parked_workers_.fetch_sub(1, std::memory_order::acq_rel);
+
+  bool is_woken = has_task();
+  if (!is_woken) {
+    num_of_running_workers_.fetch_sub(1, std::memory_order::seq_cst);
+    is_woken = has_task();
+    if (is_woken)
+      num_of_running_workers_.fetch_add(1, std::memory_order::acq_rel);
+    else
+      worker_running_list_[cast<std::size_t>(thread_id)] = false;
+  }
+  return is_woken;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] num_of_threads No description.
+  */
+inline
+void ThreadManager::resizeWorkers(const int64b num_of_threads)
+{
+  ZISC_ASSERT(num_of_running_workers_.load(std::memory_order::acquire) == 0,
+              "Some worker threads are still running.");
+  const std::size_t n = getAvailableNumOfThreads(num_of_threads);
+  worker_list_.clear();
+  worker_list_.resize(n);
+  worker_running_list_.assign(n, false);
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void ThreadManager::spawnWorkers()
+{
+  auto work = [this](const int64b thread_id)
+  {
+    doWorkerTasks(thread_id);
+  };
+
+  std::scoped_lock lock{worker_mutex_};
+  for (std::size_t i = 0; i < worker_list_.size(); ++i) {
+    if (worker_running_list_[i])
+      continue;
+    // Join the retired worker
+    std::thread& worker = worker_list_[i];
+    if (worker.joinable())
+      worker.join();
+    num_of_active_workers_.fetch_add(1, std::memory_order::acq_rel);
+    num_of_running_workers_.fetch_add(1, std::memory_order::acq_rel);
+    try {
+      worker = std::thread{work, cast<int64b>(i)};
+    }
+    catch ([[maybe_unused]] const std::system_error& error) {
+      num_of_running_workers_.fetch_sub(1, std::memory_order::acq_rel);
+      num_of_active_workers_.fetch_sub(1, std::memory_order::acq_rel);
+      throw;
+    }
+    worker_running_list_[i] = true;
+  }
+}
+
 /*!
   \details No detailed description
 
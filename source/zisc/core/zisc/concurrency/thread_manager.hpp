@@ -17,11 +17,15 @@
 
 // Standard C++ library
 #include <atomic>
+#include <chrono>
 #include <concepts>
+#include <condition_variable>
+#include <coroutine>
 #include <cstddef>
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <thread>
 #include <type_traits>
@@ -30,6 +34,7 @@
 // Zisc
 #include "bitset.hpp"
 #include "packaged_task.hpp"
+#include "worker_local.hpp"
 #include "zisc/concepts.hpp"
 #include "zisc/error.hpp"
 #include "zisc/non_copyable.hpp"
@@ -46,14 +51,15 @@ template <std::movable> class ContainerOverflowError;
 /*!
   \brief ThreadManager class provides task parallel and data parallel thread pool
 
-  No detailed description.
+  Worker threads aren't created at construction. They are spawned on
+  the first enqueue, and the workers which are parked longer than
+  the idle timeout retire until the next enqueue.
   */
 class ThreadManager : private NonCopyable<ThreadManager>
 {
  public:
   // Type aliases
   using DiffT = PackagedTask::DiffT;
-  using SharedTaskT = std::shared_ptr<PackagedTask>;
   template <typename Func, typename ...Args>
   using InvokeResultT = std::remove_volatile_t<std::invoke_result_t<Func, Args...>>;
   template <typename Ite1, typename Ite2>
@@ -71,7 +77,17 @@ class ThreadManager : private NonCopyable<ThreadManager>
   {
    public:
     //! Initialize the data
-    TaskExceptionData(SharedTaskT&& t, const DiffT offset, const DiffT n);
+    TaskExceptionData(PackagedTask* t, const DiffT offset, const DiffT n) noexcept;
+
+    //! Move data
+    TaskExceptionData(TaskExceptionData&& other) noexcept;
+
+    //! Release the holds on the underlying task
+    ~TaskExceptionData() noexcept;
+
+
+    //! Move data
+    auto operator=(TaskExceptionData&& other) noexcept -> TaskExceptionData&;
 
 
     //! Return the begin offset of the iterator
@@ -91,7 +107,11 @@ class ThreadManager : private NonCopyable<ThreadManager>
     auto task() const noexcept -> const PackagedTaskType<Type>&;
 
    private:
-    SharedTaskT task_;
+    //! Release the holds on the underlying task
+    void release() noexcept;
+
+
+    PackagedTask* task_;
     DiffT begin_offset_;
     DiffT num_of_iterations_;
   };
@@ -99,10 +119,40 @@ class ThreadManager : private NonCopyable<ThreadManager>
   using OverflowError = ContainerOverflowError<TaskExceptionData>;
 
 
-  //! Create threads as many as the number of supported concurrent CPU threads
+  // Coroutine
+  /*!
+    \brief Resume the awaiting coroutine on a worker thread
+
+    The result of co_await is the thread ID of the worker.
+    */
+  class ScheduleAwaiter
+  {
+   public:
+    //! Initialize the awaiter
+    explicit ScheduleAwaiter(ThreadManager* manager) noexcept;
+
+
+    //! Return false so that the coroutine is always scheduled
+    [[nodiscard]]
+    auto await_ready() const noexcept -> bool;
+
+    //! Enqueue the resumption of the given coroutine
+    void await_suspend(const std::coroutine_handle<> handle);
+
+    //! Return the thread ID of the worker which resumed the coroutine
+    [[nodiscard]]
+    auto await_resume() const noexcept -> int64b;
+
+   private:
+    ThreadManager* manager_;
+    int64b thread_id_;
+  };
+
+
+  //! Create a pool of threads as many as the number of supported concurrent CPU threads
   explicit ThreadManager(std::pmr::memory_resource* mem_resource) noexcept;
 
-  //! Create threads
+  //! Create a pool of threads
   ThreadManager(const int64b num_of_threads,
                 std::pmr::memory_resource* mem_resource) noexcept;
 
@@ -119,6 +169,12 @@ class ThreadManager : private NonCopyable<ThreadManager>
   //! Clear the thread manager state
   void clear() noexcept;
 
+  //! Create an instance of Type per current worker thread and for the unmanaged thread
+  template <std::move_constructible Type, typename ...ArgTypes>
+  requires std::constructible_from<Type, const ArgTypes&...>
+  [[nodiscard]]
+  auto createWorkerLocal(const ArgTypes&... args) const -> WorkerLocal<Type>;
+
   //! Return the default capacity of the task item queue
   static constexpr auto defaultCapacity() noexcept -> std::size_t;
 
@@ -148,12 +204,21 @@ class ThreadManager : private NonCopyable<ThreadManager>
   auto enqueueLoop(Func&& task, Ite1&& begin, Ite2&& end, const bool wait_for_precedence = false)
       -> std::future<void>;
 
+  //! Return the time which a parked worker waits for a task before retiring
+  auto idleTimeout() const noexcept -> std::chrono::milliseconds;
+
   //! Check whether the task queue is empty
   auto isEmpty() const noexcept -> bool;
 
   //! Return the number of logical cores
   static auto logicalCores() noexcept -> int64b;
 
+  //! Return the idle timeout which means that workers never retire
+  static constexpr auto noIdleTimeout() noexcept -> std::chrono::milliseconds;
+
+  //! Return the number of worker threads which are currently running
+  auto numOfRunningThreads() const noexcept -> int64b;
+
   //! Return the number of worker threads
   auto numOfThreads() const noexcept -> int64b;
 
@@ -163,9 +228,19 @@ class ThreadManager : private NonCopyable<ThreadManager>
   //! Change the maximum possible number of task items. The queued tasks are cleared
   void setCapacity(const std::size_t cap);
 
+  //! Set the time which a parked worker waits for a task before retiring
+  void setIdleTimeout(const std::chrono::milliseconds timeout) noexcept;
+
+  //! Change the number of worker threads. Existing worker local storages aren't resized
+  void setNumOfThreads(const int64b num_of_threads);
+
   //! Return the number of queued tasks
   auto size() const noexcept -> std::size_t;
 
+  //! Return an awaitable which resumes the awaiting coroutine on a worker thread
+  [[nodiscard]]
+  auto schedule() noexcept -> ScheduleAwaiter;
+
   //! Return the unmanaged thread ID
   static constexpr auto unmanagedThreadId() noexcept -> int64b;
 
@@ -186,14 +261,14 @@ class ThreadManager : private NonCopyable<ThreadManager>
     //! Create an empty task
     WorkerTask() noexcept = default;
 
-    //! Create a task
-    WorkerTask(SharedTaskT task, const DiffT it_offset) noexcept;
+    //! Create a task which takes over a hold on the given task
+    WorkerTask(PackagedTask* task, const DiffT it_offset) noexcept;
 
     //! Move data
     WorkerTask(WorkerTask&& other) noexcept;
 
-    //! Destroy a task
-    ~WorkerTask() noexcept = default;
+    //! Release the hold on the underlying task
+    ~WorkerTask() noexcept;
 
     //! Move data
     auto operator=(WorkerTask&& other) noexcept -> WorkerTask&;
@@ -201,6 +276,10 @@ class ThreadManager : private NonCopyable<ThreadManager>
     //! Move data
     void operator()(const int64b thread_id);
 
+    //! Give up the hold on the underlying task without releasing it
+    [[nodiscard]]
+    auto detach() noexcept -> PackagedTask*;
+
     //! Check if the underlying task is valid
     [[nodiscard]]
     auto isValid() const noexcept -> bool;
@@ -208,12 +287,20 @@ class ThreadManager : private NonCopyable<ThreadManager>
     //! Run a task
     void run(const int64b thread_id);
 
+    //! Return the underlying task
+    [[nodiscard]]
+    auto task() const noexcept -> PackagedTask*;
+
    private:
+    //! Release the hold on the underlying task
+    void release() noexcept;
+
+
     DiffT it_offset_ = 0;
-    SharedTaskT task_;
+    PackagedTask* task_ = nullptr;
   };
 
-  //! Implementation of shared task
+  //! Implementation of a task
   template <typename Return, typename Data, typename Ite1, typename Ite2, bool kIsLoop>
   class TaskImpl;
 
@@ -226,13 +313,9 @@ class ThreadManager : private NonCopyable<ThreadManager>
   template <typename Ite, typename OffsetT>
   static auto advance(Ite& begin, const OffsetT offset) noexcept -> Ite;
 
-  //! Create a shared task
+  //! Create a task in a task storage
   template <std::derived_from<PackagedTask> Task, typename Data, typename Ite>
-  auto createSharedTask(Data&& data, Ite&& ite, const bool wait_for_precedence)
-      -> std::shared_ptr<Task>;
-
-  //! Create worker threads
-  void createWorkers(const int64b num_of_threads);
+  auto createTask(Data&& data, Ite&& ite, const bool wait_for_precedence) -> Task*;
 
   //! Return the distance of given two iterators
   template <typename Ite1, typename Ite2>
@@ -255,9 +338,6 @@ class ThreadManager : private NonCopyable<ThreadManager>
   //! Return the actual available number of cores from the given hint s
   static auto getAvailableNumOfThreads(const int64b s) noexcept -> std::size_t;
 
-  //! Return the thread ID of the working thread
-  auto getCurrentThreadId() const noexcept -> int64b;
-
   //! Return the function reference of the given function data
   template <typename ...Types, typename WrappedTask>
   static auto getTask(WrappedTask&& data) noexcept;
@@ -268,6 +348,18 @@ class ThreadManager : private NonCopyable<ThreadManager>
   //! Issue a new task ID
   auto issueTaskId() noexcept -> int64b;
 
+  //! Notify a parked worker that a task is queued
+  void notifyWorker() noexcept;
+
+  //! Park the worker until a task is queued. Return false if the worker retired
+  auto parkWorker(const int64b thread_id) noexcept -> bool;
+
+  //! Resize the worker list. The workers must be stopped
+  void resizeWorkers(const int64b num_of_threads);
+
+  //! Spawn the workers which aren't running
+  void spawnWorkers();
+
   //! Return the task status list
   auto taskStatusList() noexcept -> Bitset&;
 
@@ -297,6 +389,7 @@ class ThreadManager : private NonCopyable<ThreadManager>
   static constexpr std::size_t kCacheLineSize = 2 * Config::l1CacheLineSize();
   static constexpr std::size_t kAlignmentMax = kCacheLineSize;
   static constexpr std::size_t kTaskStorageSize = 8 * kCacheLineSize;
+  static constexpr std::size_t kParkSpinCount = 64;
   using TaskResource = MonotonicBufferResource<kTaskStorageSize, kAlignmentMax>;
 
 
@@ -306,17 +399,27 @@ class ThreadManager : private NonCopyable<ThreadManager>
   [[maybe_unused]] Padding<kCacheLineSize - sizeof(num_of_tasks_)> pad2_{};
   alignas(kCacheLineSize) std::atomic<int> num_of_active_workers_;
   [[maybe_unused]] Padding<kCacheLineSize - sizeof(num_of_active_workers_)> pad3_{};
+  alignas(kCacheLineSize) std::atomic<int> num_of_running_workers_;
+  std::atomic<int> num_of_parked_workers_;
+  std::atomic<int64b> idle_timeout_;
+  [[maybe_unused]] Padding<kCacheLineSize - sizeof(num_of_running_workers_) -
+                           sizeof(num_of_parked_workers_) -
+                           sizeof(idle_timeout_)> pad4_{};
   TaskQueueImpl task_queue_;
   Bitset task_status_list_;
+  std::mutex worker_mutex_;
+  std::condition_variable worker_condition_;
   std::pmr::vector<std::thread> worker_list_;
-  std::pmr::vector<std::thread::id> worker_id_list_;
-  std::pmr::vector<TaskResource> task_storage_list_;
+  std::pmr::vector<bool> worker_running_list_;
+  std::pmr::vector<std::optional<TaskResource>> task_storage_list_;
   static constexpr std::size_t kManagerSize = sizeof(task_queue_) +
                                               sizeof(task_status_list_) +
+                                              sizeof(worker_mutex_) +
+                                              sizeof(worker_condition_) +
                                               sizeof(decltype(worker_list_)) +
-                                              sizeof(decltype(worker_id_list_)) +
+                                              sizeof(decltype(worker_running_list_)) +
                                               sizeof(decltype(task_storage_list_));
-  [[maybe_unused]] Padding<kCacheLineSize - (kManagerSize % kCacheLineSize)> pad4_{};
+  [[maybe_unused]] Padding<kCacheLineSize - (kManagerSize % kCacheLineSize)> pad5_{};
 };
 
 } // namespace zisc
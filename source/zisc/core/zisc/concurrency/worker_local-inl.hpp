@@ -0,0 +1,255 @@
+/*!
+  \file worker_local-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_WORKER_LOCAL_INL_HPP
+#define ZISC_WORKER_LOCAL_INL_HPP
+
+#include "worker_local.hpp"
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Zisc
+#include "zisc/concepts.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \tparam ArgTypes No description.
+  \param [in] num_of_workers No description.
+  \param [in,out] mem_resource No description.
+  \param [in] args No description.
+  */
+template <std::move_constructible Type>
+template <typename ...ArgTypes>
+requires std::constructible_from<Type, const ArgTypes&...> inline
+WorkerLocal<Type>::WorkerLocal(const std::size_t num_of_workers,
+                               std::pmr::memory_resource* mem_resource,
+                               const ArgTypes&... args) :
+    slot_list_{typename decltype(slot_list_)::allocator_type{mem_resource}}
+{
+  // The last instance is reserved for the unmanaged thread
+  const std::size_t n = num_of_workers + 1;
+  slot_list_.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    slot_list_.emplace_back(args...);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  */
+template <std::move_constructible Type> inline
+WorkerLocal<Type>::WorkerLocal(WorkerLocal&& other) noexcept :
+    slot_list_{std::move(other.slot_list_)}
+{
+}
+
+/*!
+  \details The instances and the memory resource of other are taken over.
+  The move assignment of the pmr vector moves each instance when the memory
+  resources differ, which requires assignable instances
+
+  \param [in,out] other No description.
+  \return No description
+  */
+template <std::move_constructible Type> inline
+auto WorkerLocal<Type>::operator=(WorkerLocal&& other) noexcept -> WorkerLocal&
+{
+  if (this != &other) {
+    std::destroy_at(std::addressof(slot_list_));
+    std::construct_at(std::addressof(slot_list_), std::move(other.slot_list_));
+  }
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] thread_id No description.
+  \return No description
+  */
+template <std::move_constructible Type> inline
+auto WorkerLocal<Type>::operator[](const int64b thread_id) -> Reference
+{
+  return get(thread_id);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] thread_id No description.
+  \return No description
+  */
+template <std::move_constructible Type> inline
+auto WorkerLocal<Type>::operator[](const int64b thread_id) const -> ConstReference
+{
+  return get(thread_id);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Func No description.
+  \param [in] init No description.
+  \param [in] op No description.
+  \return No description
+  */
+template <std::move_constructible Type>
+template <typename Func>
+requires InvocableR<Func, typename WorkerLocal<Type>::ValueT,
+                          typename WorkerLocal<Type>::ValueT,
+                          typename WorkerLocal<Type>::ConstReference> inline
+auto WorkerLocal<Type>::combine(ValueT init, Func&& op) const -> ValueT
+{
+  for (const Slot& slot : slot_list_)
+    init = std::invoke(op, std::move(init), slot.value_);
+  return init;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Func No description.
+  \param [in] func No description.
+  */
+template <std::move_constructible Type>
+template <Invocable<Type&> Func> inline
+void WorkerLocal<Type>::forEach(Func&& func)
+{
+  for (Slot& slot : slot_list_)
+    std::invoke(func, slot.value_);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Func No description.
+  \param [in] func No description.
+  */
+template <std::move_constructible Type>
+template <Invocable<const Type&> Func> inline
+void WorkerLocal<Type>::forEach(Func&& func) const
+{
+  for (const Slot& slot : slot_list_)
+    std::invoke(func, slot.value_);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] thread_id No description.
+  \return No description
+  */
+template <std::move_constructible Type> inline
+auto WorkerLocal<Type>::get(const int64b thread_id) -> Reference
+{
+  const std::size_t index = getIndex(thread_id);
+  return slot_list_[index].value_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] thread_id No description.
+  \return No description
+  */
+template <std::move_constructible Type> inline
+auto WorkerLocal<Type>::get(const int64b thread_id) const -> ConstReference
+{
+  const std::size_t index = getIndex(thread_id);
+  return slot_list_[index].value_;
+}
+
+/*!
+  \details The thread ID is checked in release builds too,
+  since a worker can be added to the thread pool after the creation
+
+  \param [in] thread_id No description.
+  \return No description
+  \exception SystemError The thread ID is out of the instances
+  */
+template <std::move_constructible Type> inline
+auto WorkerLocal<Type>::getIndex(const int64b thread_id) const -> std::size_t
+{
+  // The last instance is reserved for the unmanaged thread
+  const std::size_t last = size() - 1;
+  const std::size_t index = (thread_id < 0) ? last : cast<std::size_t>(thread_id);
+  if ((0 <= thread_id) && (last <= index)) [[unlikely]]
+    throwOutOfRange(thread_id);
+  return index;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::move_constructible Type> inline
+auto WorkerLocal<Type>::size() const noexcept -> std::size_t
+{
+  return slot_list_.size();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::move_constructible Type> inline
+constexpr auto WorkerLocal<Type>::slotAlignment() noexcept -> std::size_t
+{
+  return alignof(Slot);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] thread_id No description.
+  */
+template <std::move_constructible Type> inline
+void WorkerLocal<Type>::throwOutOfRange(const int64b thread_id)
+{
+  const std::string message = "The thread ID " + std::to_string(thread_id) +
+                              " is out of the worker local instances.";
+  throw SystemError{ErrorCode::kWorkerLocalOutOfRange, message};
+}
+
+/*!
+  \details No detailed description
+
+  \tparam ArgTypes No description.
+  \param [in] args No description.
+  */
+template <std::move_constructible Type>
+template <typename ...ArgTypes> inline
+WorkerLocal<Type>::Slot::Slot(const ArgTypes&... args) : value_(args...)
+{
+}
+
+} // namespace zisc
+
+#endif // ZISC_WORKER_LOCAL_INL_HPP
@@ -0,0 +1,145 @@
+/*!
+  \file worker_local.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_WORKER_LOCAL_HPP
+#define ZISC_WORKER_LOCAL_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+// Zisc
+#include "zisc/concepts.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief WorkerLocal class holds an instance of Type per worker thread
+
+  Each instance is placed on its own pair of cache lines, so per-thread accumulators
+  don't suffer from false sharing.
+  The instance of a worker is accessed with the thread ID which is given to
+  a task by ThreadManager. A negative thread ID (the unmanaged thread ID)
+  refers to the extra instance which is reserved for the unmanaged thread.
+  The number of instances is fixed at the creation, so a thread ID of
+  a worker added later is rejected with SystemError.
+
+  \tparam Type No description.
+  */
+template <std::move_constructible Type>
+class WorkerLocal : private NonCopyable<WorkerLocal<Type>>
+{
+ public:
+  // Type aliases
+  using ValueT = std::remove_cv_t<Type>;
+  using ConstT = std::add_const_t<ValueT>;
+  using Reference = std::add_lvalue_reference_t<ValueT>;
+  using ConstReference = std::add_lvalue_reference_t<ConstT>;
+
+
+  //! Create instances for the given number of workers and the unmanaged thread
+  template <typename ...ArgTypes>
+  requires std::constructible_from<Type, const ArgTypes&...>
+  WorkerLocal(const std::size_t num_of_workers,
+              std::pmr::memory_resource* mem_resource,
+              const ArgTypes&... args);
+
+  //! Move a data
+  WorkerLocal(WorkerLocal&& other) noexcept;
+
+
+  //! Move a data
+  auto operator=(WorkerLocal&& other) noexcept -> WorkerLocal&;
+
+  //! Return the instance of the given thread
+  auto operator[](const int64b thread_id) -> Reference;
+
+  //! Return the instance of the given thread
+  auto operator[](const int64b thread_id) const -> ConstReference;
+
+
+  //! Fold all instances into a value in the order of the thread ID
+  template <typename Func>
+  requires InvocableR<Func, ValueT, ValueT, ConstReference>
+  [[nodiscard]]
+  auto combine(ValueT init, Func&& op) const -> ValueT;
+
+  //! Invoke the given function with each instance
+  template <Invocable<Type&> Func>
+  void forEach(Func&& func);
+
+  //! Invoke the given function with each instance
+  template <Invocable<const Type&> Func>
+  void forEach(Func&& func) const;
+
+  //! Return the instance of the given thread
+  [[nodiscard]]
+  auto get(const int64b thread_id) -> Reference;
+
+  //! Return the instance of the given thread
+  [[nodiscard]]
+  auto get(const int64b thread_id) const -> ConstReference;
+
+  //! Return the index of the instance of the given thread
+  [[nodiscard]]
+  auto getIndex(const int64b thread_id) const -> std::size_t;
+
+  //! Return the number of instances including the one of the unmanaged thread
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+  //! Return the alignment of an instance
+  static constexpr auto slotAlignment() noexcept -> std::size_t;
+
+ private:
+  //! Two cache lines, since the adjacent line prefetcher fetches lines in pairs
+  static constexpr std::size_t kSlotAlignment = 2 * Config::l1CacheLineSize();
+
+
+  /*!
+    \brief No brief description
+
+    No detailed description.
+    */
+  class alignas(kSlotAlignment) Slot
+  {
+   public:
+    //! Create an instance
+    template <typename ...ArgTypes>
+    explicit Slot(const ArgTypes&... args);
+
+    //! Move a data
+    Slot(Slot&& other) noexcept(std::is_nothrow_move_constructible_v<ValueT>) = default;
+
+
+    ValueT value_;
+  };
+
+
+  //! Throw an exception of the out of range thread ID
+  [[noreturn]] static void throwOutOfRange(const int64b thread_id);
+
+
+  std::pmr::vector<Slot> slot_list_;
+};
+
+} // namespace zisc
+
+#include "worker_local-inl.hpp"
+
+#endif // ZISC_WORKER_LOCAL_HPP
@@ -42,8 +42,13 @@ auto getErrorCodeString(const ErrorCode code) -> std::string
   using namespace std::string_literals;
   std::string code_string;
   switch (code) {
+    ERROR_CODE_STRING_CASE(BinaryInvalidFormat, code_string)
+    ERROR_CODE_STRING_CASE(BinaryOutOfRange, code_string)
     ERROR_CODE_STRING_CASE(BoundedQueueOverflow, code_string)
+    ERROR_CODE_STRING_CASE(CsvInvalidFormat, code_string)
+    ERROR_CODE_STRING_CASE(JsonInvalidFormat, code_string)
     ERROR_CODE_STRING_CASE(ThreadManagerQueueOverflow, code_string)
+    ERROR_CODE_STRING_CASE(WorkerLocalOutOfRange, code_string)
   }
   return code_string;
 }
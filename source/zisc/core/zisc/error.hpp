@@ -58,8 +58,13 @@ namespace zisc {
   */
 enum class ErrorCode : int
 {
+  kBinaryInvalidFormat,
+  kBinaryOutOfRange,
   kBoundedQueueOverflow,
-  kThreadManagerQueueOverflow
+  kCsvInvalidFormat,
+  kJsonInvalidFormat,
+  kThreadManagerQueueOverflow,
+  kWorkerLocalOutOfRange
 };
 
 //! Return the string of the given error code
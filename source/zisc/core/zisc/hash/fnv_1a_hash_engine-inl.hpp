@@ -17,12 +17,19 @@
 
 #include "fnv_1a_hash_engine.hpp"
 // Standard C++ library
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <cstddef>
+#include <span>
+#include <string_view>
 #include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 // Zisc
 #include "hash_engine.hpp"
+#include "zisc/concepts.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 
@@ -46,6 +53,76 @@ constexpr auto Fnv1aHashEngine<T>::hashValue(const Int8* seed,
   return x;
 }
 
+/*!
+  \details FNV-1a has a byte serial dependency in a key,
+  so 8 keys are hashed together, each in a lane.
+  The lanes proceed in 8 bytes steps up to the shortest key of the group
+  and the rest of each key is hashed in scalar
+
+  \param [in] keys No description.
+  \param [out] out No description.
+  */
+template <HashValue T> inline
+void Fnv1aHashEngine<T>::hashBatchValue(const std::span<const std::string_view> keys,
+                                        const std::span<ValueT> out) noexcept
+{
+  std::size_t i = 0;
+  for (; (i + kNumOfLanes) <= keys.size(); i += kNumOfLanes) {
+    const std::span<const std::string_view, kNumOfLanes> group{keys.data() + i, kNumOfLanes};
+    const auto shortest = std::min_element(group.begin(), group.end(),
+    [](const std::string_view lhs, const std::string_view rhs) noexcept
+    {
+      return lhs.size() < rhs.size();
+    });
+    const std::size_t n = (shortest->size() / 8) * 8;
+
+    LaneArrayT x{};
+    x.fill(offset());
+    WordArrayT words{};
+    for (std::size_t j = 0; j < n; j += 8) {
+      for (std::size_t l = 0; l < kNumOfLanes; ++l)
+        words[l] = BaseEngineT::loadLe64(group[l].data() + j);
+      mixWords<char>(x, words, 8);
+    }
+    // Scalar tail
+    for (std::size_t l = 0; l < kNumOfLanes; ++l) {
+      const std::string_view key = group[l];
+      for (std::size_t j = n; j < key.size(); ++j)
+        x[l] = (x[l] ^ cast<ValueT>(key[j])) * prime();
+      out[i + l] = x[l];
+    }
+  }
+  for (; i < keys.size(); ++i)
+    out[i] = hashValue(keys[i].data(), keys[i].size());
+}
+
+/*!
+  \details The bytes of an integer key are hashed from the least significant byte
+
+  \tparam Integer No description.
+  \param [in] keys No description.
+  \param [out] out No description.
+  */
+template <HashValue T> template <UnsignedInteger Integer> inline
+void Fnv1aHashEngine<T>::hashBatchValue(const std::span<const Integer> keys,
+                                        const std::span<ValueT> out) noexcept
+{
+  std::size_t i = 0;
+  if constexpr (sizeof(Integer) <= sizeof(uint64b)) {
+    for (; (i + kNumOfLanes) <= keys.size(); i += kNumOfLanes) {
+      LaneArrayT x{};
+      x.fill(offset());
+      WordArrayT words{};
+      for (std::size_t l = 0; l < kNumOfLanes; ++l)
+        words[l] = cast<uint64b>(keys[i + l]);
+      mixWords<uint8b>(x, words, sizeof(Integer));
+      std::copy_n(x.begin(), kNumOfLanes, out.begin() + i);
+    }
+  }
+  for (; i < keys.size(); ++i)
+    out[i] = BaseEngineT::hash(keys[i]);
+}
+
 /*!
   \details No detailed description
 
@@ -78,6 +155,145 @@ constexpr auto Fnv1aHashEngine<T>::offset() noexcept -> ValueT
   return p;
 }
 
+/*!
+  \details The lanes are processed with AVX2 if available.
+  The multiplication by the 64bit prime 2^40 + 0x1b3 is decomposed into
+  32bit multiplications and a shift since AVX2 doesn't have
+  64bit multiplication. The 32bit hash is kept in the lower half of
+  each 64bit lane. Without AVX2, the lanes are interleaved in scalar
+  so that the multiplications of the lanes overlap
+
+  \tparam Int8 The element type of the keys. Signed bytes are sign extended.
+  \param [in,out] x No description.
+  \param [in] words No description.
+  \param [in] num_of_bytes No description.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+void Fnv1aHashEngine<T>::mixWords(LaneArrayT& x,
+                                  const WordArrayT& words,
+                                  const std::size_t num_of_bytes) noexcept
+{
+#if defined(__AVX2__)
+  constexpr std::size_t n = kNumOfLanes / 4;
+  // std::array of __m256i causes -Wignored-attributes
+  __m256i h[n];
+  __m256i w[n];
+  for (std::size_t i = 0; i < n; ++i) {
+    if constexpr (sizeof(ValueT) == 8) {
+      h[i] = _mm256_loadu_si256(reinterp<const __m256i*>(x.data() + 4 * i));
+    }
+    else {
+      const __m128i v = _mm_loadu_si128(reinterp<const __m128i*>(x.data() + 4 * i));
+      h[i] = _mm256_cvtepu32_epi64(v);
+    }
+    w[i] = _mm256_loadu_si256(reinterp<const __m256i*>(words.data() + 4 * i));
+  }
+  const __m256i byte_mask = _mm256_set1_epi64x(0xff);
+  const __m256i sign_bit = _mm256_set1_epi64x(0x80);
+  const __m256i p = _mm256_set1_epi64x(cast<int64b>(prime() & 0xffff'ffffu));
+  for (std::size_t b = 0; b < num_of_bytes; ++b) {
+    for (std::size_t i = 0; i < n; ++i) {
+      __m256i c = _mm256_and_si256(w[i], byte_mask);
+      if constexpr (std::is_signed_v<Int8>)
+        c = _mm256_sub_epi64(_mm256_xor_si256(c, sign_bit), sign_bit);
+      w[i] = _mm256_srli_epi64(w[i], 8);
+      h[i] = _mm256_xor_si256(h[i], c);
+      if constexpr (sizeof(ValueT) == 8) {
+        // x * (2^40 + 0x1b3)
+        const __m256i lo = _mm256_mul_epu32(h[i], p);
+        const __m256i hi = _mm256_mul_epu32(_mm256_srli_epi64(h[i], 32), p);
+        h[i] = _mm256_add_epi64(_mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32)),
+                                _mm256_slli_epi64(h[i], 40));
+      }
+      else {
+        h[i] = _mm256_mul_epu32(h[i], p);
+      }
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if constexpr (sizeof(ValueT) == 8) {
+      _mm256_storeu_si256(reinterp<__m256i*>(x.data() + 4 * i), h[i]);
+    }
+    else {
+      const __m256i index = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+      const __m256i v = _mm256_permutevar8x32_epi32(h[i], index);
+      _mm_storeu_si128(reinterp<__m128i*>(x.data() + 4 * i), _mm256_castsi256_si128(v));
+    }
+  }
+#else
+  WordArrayT w = words;
+  for (std::size_t b = 0; b < num_of_bytes; ++b) {
+    for (std::size_t l = 0; l < kNumOfLanes; ++l) {
+      const auto c = cast<Int8>(cast<uint8b>(w[l] & 0xffu));
+      x[l] = (x[l] ^ cast<ValueT>(c)) * prime();
+      w[l] >>= 8;
+    }
+  }
+#endif
+}
+
+/*!
+  \details The hasher can be updated further after this call
+
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto Fnv1aHashEngine<T>::Hasher::finalize() const noexcept -> ValueT
+{
+  return x_;
+}
+
+/*!
+  \details No detailed description
+  */
+template <HashValue T> inline
+constexpr void Fnv1aHashEngine<T>::Hasher::reset() noexcept
+{
+  x_ = offset();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] data No description.
+  */
+template <HashValue T> inline
+constexpr void Fnv1aHashEngine<T>::Hasher::update(const std::string_view data) noexcept
+{
+  update(data.data(), data.size());
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \tparam kExtent No description.
+  \param [in] data No description.
+  */
+template <HashValue T>
+template <HashKeyElement Int8, std::size_t kExtent> inline
+constexpr void Fnv1aHashEngine<T>::Hasher::update(const std::span<Int8, kExtent> data) noexcept
+{
+  update(data.data(), data.size());
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] data No description.
+  \param [in] n No description.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr void Fnv1aHashEngine<T>::Hasher::update(const Int8* data,
+                                                  const std::size_t n) noexcept
+{
+  ValueT x = x_;
+  for (std::size_t i = 0; i < n; ++i)
+    x = (x ^ cast<ValueT>(data[i])) * prime();
+  x_ = x;
+}
+
 } // namespace zisc
 
 #endif // ZISC_FNV_1A_HASH_ENGINE_INL_HPP
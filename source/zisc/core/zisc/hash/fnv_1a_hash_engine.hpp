@@ -16,8 +16,11 @@
 #define ZISC_FNV_1A_HASH_ENGINE_HPP
 
 // Standard C++ library
+#include <array>
 #include <cstdint>
 #include <cstddef>
+#include <span>
+#include <string_view>
 // Zisc
 #include "hash_engine.hpp"
 #include "zisc/zisc_config.hpp"
@@ -38,11 +41,34 @@ class Fnv1aHashEngine : public HashEngine<Fnv1aHashEngine<T>, T>
   using BaseEngineT = HashEngine<Fnv1aHashEngine, T>;
   using ValueT = typename BaseEngineT::ValueT;
 
+  // Incremental hash
+  class Hasher;
+
 
   //! Implementation of the hash function
   template <HashKeyElement Int8>
   static constexpr auto hashValue(const Int8* seed, const std::size_t n) noexcept -> ValueT;
+
+  //! Implementation of the batch hash function
+  static void hashBatchValue(const std::span<const std::string_view> keys,
+                             const std::span<ValueT> out) noexcept;
+
+  //! Implementation of the batch hash function
+  template <UnsignedInteger Integer>
+  static void hashBatchValue(const std::span<const Integer> keys,
+                             const std::span<ValueT> out) noexcept;
+
  private:
+  static constexpr std::size_t kNumOfLanes = 8;
+  using LaneArrayT = std::array<ValueT, kNumOfLanes>;
+  using WordArrayT = std::array<uint64b, kNumOfLanes>;
+
+
+  //! Mix the given number of bytes of the words into the states of the lanes
+  template <HashKeyElement Int8>
+  static void mixWords(LaneArrayT& x,
+                       const WordArrayT& words,
+                       const std::size_t num_of_bytes) noexcept;
 
   //!
   static constexpr auto prime() noexcept -> ValueT;
@@ -51,6 +77,45 @@ class Fnv1aHashEngine : public HashEngine<Fnv1aHashEngine<T>, T>
   static constexpr auto offset() noexcept -> ValueT;
 };
 
+/*!
+  \brief Compute a FNV-1a hash of data which is given in pieces
+
+  No detailed description.
+
+  \tparam T No description.
+  \note No notation.
+  \attention No attention.
+  */
+template <HashValue T>
+class Fnv1aHashEngine<T>::Hasher
+{
+ public:
+  //! Create a hasher
+  constexpr Hasher() noexcept = default;
+
+
+  //! Return the hash value of the data given so far
+  [[nodiscard]]
+  constexpr auto finalize() const noexcept -> ValueT;
+
+  //! Start a new hash
+  constexpr void reset() noexcept;
+
+  //! Append the given data
+  constexpr void update(const std::string_view data) noexcept;
+
+  //! Append the given data
+  template <HashKeyElement Int8, std::size_t kExtent>
+  constexpr void update(const std::span<Int8, kExtent> data) noexcept;
+
+  //! Append the given data
+  template <HashKeyElement Int8>
+  constexpr void update(const Int8* data, const std::size_t n) noexcept;
+
+ private:
+  ValueT x_ = offset();
+};
+
 // Type aliases
 
 using Fnv1aHash32 = Fnv1aHashEngine<uint32b>;
@@ -18,12 +18,17 @@
 #include "hash_engine.hpp"
 // Standard C++ library
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
+#include <span>
 #include <string_view>
 #include <type_traits>
 // Zisc
+#include "zisc/bit.hpp"
 #include "zisc/concepts.hpp"
+#include "zisc/error.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 
@@ -96,6 +101,128 @@ constexpr auto HashEngine<HashClass, T>::hash(const Integer seed) noexcept
   return result;
 }
 
+/*!
+  \details The hash class can provide hashBatchValue()
+  which hashes several keys at once. Otherwise the keys are hashed one by one
+
+  \param [in] keys No description.
+  \param [out] out The hash values of the keys.
+  */
+template <typename HashClass, HashValue T> inline
+void HashEngine<HashClass, T>::hashBatch(const std::span<const std::string_view> keys,
+                                         const std::span<ValueT> out) noexcept
+{
+  ZISC_ASSERT(keys.size() <= out.size(), "The output is smaller than the keys.");
+  if constexpr (requires {HashClass::hashBatchValue(keys, out);}) {
+    HashClass::hashBatchValue(keys, out);
+  }
+  else {
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      out[i] = hash(keys[i]);
+  }
+}
+
+/*!
+  \details The hash class can provide hashBatchValue()
+  which hashes several keys at once. Otherwise the keys are hashed one by one.
+  The hash values are the same as hash(Integer)
+
+  \tparam Integer No description.
+  \param [in] keys No description.
+  \param [out] out The hash values of the keys.
+  */
+template <typename HashClass, HashValue T>
+template <UnsignedInteger Integer> inline
+void HashEngine<HashClass, T>::hashBatch(const std::span<const Integer> keys,
+                                         const std::span<ValueT> out) noexcept
+{
+  ZISC_ASSERT(keys.size() <= out.size(), "The output is smaller than the keys.");
+  if constexpr (requires {HashClass::hashBatchValue(keys, out);}) {
+    HashClass::hashBatchValue(keys, out);
+  }
+  else {
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      out[i] = hash(keys[i]);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] p No description.
+  \return No description
+  */
+template <typename HashClass, HashValue T>
+template <HashKeyElement Int8> inline
+constexpr auto HashEngine<HashClass, T>::loadLe32(const Int8* p) noexcept -> uint32b
+{
+  uint32b x = 0;
+  if (std::is_constant_evaluated()) {
+    for (std::size_t i = 0; i < sizeof(x); ++i)
+      x |= cast<uint32b>(cast<uint8b>(p[i])) << (8 * i);
+  }
+  else {
+    std::memcpy(&x, p, sizeof(x));
+    if constexpr (std::endian::native == std::endian::big)
+      x = byteswap(x);
+  }
+  return x;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] p No description.
+  \return No description
+  */
+template <typename HashClass, HashValue T>
+template <HashKeyElement Int8> inline
+constexpr auto HashEngine<HashClass, T>::loadLe64(const Int8* p) noexcept -> uint64b
+{
+  uint64b x = 0;
+  if (std::is_constant_evaluated()) {
+    for (std::size_t i = 0; i < sizeof(x); ++i)
+      x |= cast<uint64b>(cast<uint8b>(p[i])) << (8 * i);
+  }
+  else {
+    std::memcpy(&x, p, sizeof(x));
+    if constexpr (std::endian::native == std::endian::big)
+      x = byteswap(x);
+  }
+  return x;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] lhs No description.
+  \param [in] rhs No description.
+  \return No description
+  */
+template <typename HashClass, HashValue T> inline
+constexpr auto HashEngine<HashClass, T>::multiply128(const uint64b lhs,
+                                                     const uint64b rhs) noexcept
+    -> std::array<uint64b, 2>
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ using Uint128 = unsigned __int128;
+  const Uint128 product = cast<Uint128>(lhs) * rhs;
+  return {{cast<uint64b>(product), cast<uint64b>(product >> 64)}};
+#else // __SIZEOF_INT128__
+  constexpr uint64b mask = 0xffff'ffffull;
+  const uint64b lo_lo = (lhs & mask) * (rhs & mask);
+  const uint64b hi_lo = (lhs >> 32) * (rhs & mask);
+  const uint64b lo_hi = (lhs & mask) * (rhs >> 32);
+  const uint64b hi_hi = (lhs >> 32) * (rhs >> 32);
+  const uint64b cross = (lo_lo >> 32) + (hi_lo & mask) + lo_hi;
+  const uint64b high = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+  const uint64b low = (cross << 32) | (lo_lo & mask);
+  return {{low, high}};
+#endif // __SIZEOF_INT128__
+}
+
 /*!
   \details No detailed description
 
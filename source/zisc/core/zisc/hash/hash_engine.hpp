@@ -16,8 +16,10 @@
 #define ZISC_HASH_ENGINE_HPP
 
 // Standard C++ library
+#include <array>
 #include <cstdint>
 #include <cstddef>
+#include <span>
 #include <string_view>
 #include <type_traits>
 // Zisc
@@ -64,6 +66,28 @@ class HashEngine
   template <UnsignedInteger Integer>
   static constexpr auto hash(const Integer seed) noexcept -> ValueT;
 
+  //! Compute the hash values of the given keys
+  static void hashBatch(const std::span<const std::string_view> keys,
+                        const std::span<ValueT> out) noexcept;
+
+  //! Compute the hash values of the given integer keys
+  template <UnsignedInteger Integer>
+  static void hashBatch(const std::span<const Integer> keys,
+                        const std::span<ValueT> out) noexcept;
+
+ protected:
+  //! Read a 4 bytes little endian integer
+  template <HashKeyElement Int8>
+  static constexpr auto loadLe32(const Int8* p) noexcept -> uint32b;
+
+  //! Read a 8 bytes little endian integer
+  template <HashKeyElement Int8>
+  static constexpr auto loadLe64(const Int8* p) noexcept -> uint64b;
+
+  //! Return the 128bit product of the given values as {low, high}
+  static constexpr auto multiply128(const uint64b lhs,
+                                    const uint64b rhs) noexcept -> std::array<uint64b, 2>;
+
  private:
   //! Implementation of the hash function
   template <HashKeyElement Int8>
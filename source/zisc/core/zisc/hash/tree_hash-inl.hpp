@@ -0,0 +1,233 @@
+/*!
+  \file tree_hash-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_TREE_HASH_INL_HPP
+#define ZISC_TREE_HASH_INL_HPP
+
+#include "tree_hash.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <future>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+// Zisc
+#include "hash_engine.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/thread_manager.hpp"
+
+namespace zisc {
+
+/*!
+  \details A leaf is large enough to amortize the task overhead
+  and small enough to balance the load
+
+  \return No description
+  */
+template <typename HashEngineT> inline
+constexpr auto TreeHash<HashEngineT>::defaultLeafSize() noexcept -> std::size_t
+{
+  constexpr std::size_t size = 1024 * 1024;
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \tparam kExtent No description.
+  \param [in] data No description.
+  \param [in] leaf_size No description.
+  \return No description
+  */
+template <typename HashEngineT>
+template <HashKeyElement Int8, std::size_t kExtent> inline
+constexpr auto TreeHash<HashEngineT>::hash(const std::span<Int8, kExtent> data,
+                                           const std::size_t leaf_size) noexcept -> ValueT
+{
+  const std::span<Int8> d = data;
+  const std::size_t s = (std::max)(leaf_size, std::size_t{1});
+  const ValueT root = reduce(numOfLeaves(d.size(), s), [d, s](const std::size_t index) noexcept
+  {
+    return hashLeaf(d, s, index);
+  });
+  return finalize(root, d.size());
+}
+
+/*!
+  \details The leaves are hashed on the worker threads and
+  the tree of the digests is built on the calling thread
+
+  \tparam Int8 No description.
+  \tparam kExtent No description.
+  \param [in] data No description.
+  \param [in,out] thread_manager No description.
+  \param [in,out] mem_resource No description.
+  \param [in] leaf_size No description.
+  \return No description
+  \exception ThreadManager::OverflowError The task queue is full
+  */
+template <typename HashEngineT>
+template <HashKeyElement Int8, std::size_t kExtent> inline
+auto TreeHash<HashEngineT>::hash(const std::span<Int8, kExtent> data,
+                                 ThreadManager& thread_manager,
+                                 std::pmr::memory_resource* mem_resource,
+                                 const std::size_t leaf_size) -> ValueT
+{
+  const std::span<Int8> d = data;
+  const std::size_t s = (std::max)(leaf_size, std::size_t{1});
+  const std::size_t num_of_leaves = numOfLeaves(d.size(), s);
+  const auto num_of_threads = cast<std::size_t>(thread_manager.numOfThreads());
+  const std::size_t num_of_tasks = (std::min)(num_of_leaves, num_of_threads);
+  if (num_of_tasks <= 1)
+    return hash(d, s);
+
+  // Hash the leaves. Each task hashes a contiguous range of leaves
+  using DigestList = std::pmr::vector<ValueT>;
+  DigestList digest_list{num_of_leaves, typename DigestList::allocator_type{mem_resource}};
+  auto hash_leaves = [d, s, num_of_leaves, num_of_tasks, &digest_list](const std::size_t task) noexcept
+  {
+    const std::size_t begin = (task * num_of_leaves) / num_of_tasks;
+    const std::size_t end = ((task + 1) * num_of_leaves) / num_of_tasks;
+    for (std::size_t index = begin; index < end; ++index)
+      digest_list[index] = hashLeaf(d, s, index);
+  };
+  std::future<void> result = thread_manager.enqueueLoop(hash_leaves,
+                                                        std::size_t{0},
+                                                        num_of_tasks);
+  result.get();
+
+  const ValueT root = reduce(num_of_leaves, [&digest_list](const std::size_t index) noexcept
+  {
+    return digest_list[index];
+  });
+  return finalize(root, d.size());
+}
+
+/*!
+  \details Empty data has one empty leaf
+
+  \param [in] n No description.
+  \param [in] leaf_size No description.
+  \return No description
+  */
+template <typename HashEngineT> inline
+constexpr auto TreeHash<HashEngineT>::numOfLeaves(const std::size_t n,
+                                                  const std::size_t leaf_size) noexcept
+    -> std::size_t
+{
+  const std::size_t s = (std::max)(leaf_size, std::size_t{1});
+  return (std::max)((n + s - 1) / s, std::size_t{1});
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] lhs No description.
+  \param [in] rhs No description.
+  \return No description
+  */
+template <typename HashEngineT> inline
+constexpr auto TreeHash<HashEngineT>::combine(const ValueT lhs, const ValueT rhs) noexcept
+    -> ValueT
+{
+  constexpr std::size_t size = sizeof(ValueT);
+  std::array<uint8b, 2 * size + 1> node{};
+  node[0] = kNodeTag;
+  for (std::size_t i = 0; i < size; ++i) {
+    node[1 + i] = cast<uint8b>(lhs >> (8 * i));
+    node[1 + size + i] = cast<uint8b>(rhs >> (8 * i));
+  }
+  return HashEngineT::hash(node.data(), node.size());
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] root No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <typename HashEngineT> inline
+constexpr auto TreeHash<HashEngineT>::finalize(const ValueT root, const std::size_t n) noexcept
+    -> ValueT
+{
+  constexpr std::size_t size = sizeof(ValueT);
+  std::array<uint8b, size + 9> node{};
+  node[0] = kRootTag;
+  for (std::size_t i = 0; i < size; ++i)
+    node[1 + i] = cast<uint8b>(root >> (8 * i));
+  const uint64b length = cast<uint64b>(n);
+  for (std::size_t i = 0; i < 8; ++i)
+    node[1 + size + i] = cast<uint8b>(length >> (8 * i));
+  return HashEngineT::hash(node.data(), node.size());
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] data No description.
+  \param [in] leaf_size No description.
+  \param [in] index No description.
+  \return No description
+  */
+template <typename HashEngineT> template <HashKeyElement Int8> inline
+constexpr auto TreeHash<HashEngineT>::hashLeaf(const std::span<Int8> data,
+                                               const std::size_t leaf_size,
+                                               const std::size_t index) noexcept -> ValueT
+{
+  const std::size_t offset = index * leaf_size;
+  const std::size_t size = (std::min)(leaf_size, data.size() - offset);
+  return HashEngineT::hash(data.data() + offset, size);
+}
+
+/*!
+  \details The digests are combined in a binary counter manner.
+  Two subtrees of the same height are combined as soon as both are complete,
+  and the remaining subtrees are combined from the right at the end.
+  This builds the same tree as combining each level in pairs,
+  with a stack of the logarithmic size
+
+  \tparam Func No description.
+  \param [in] num_of_leaves No description.
+  \param [in] get_leaf No description.
+  \return No description
+  */
+template <typename HashEngineT> template <typename Func> inline
+constexpr auto TreeHash<HashEngineT>::reduce(const std::size_t num_of_leaves,
+                                             Func&& get_leaf) noexcept -> ValueT
+{
+  std::array<ValueT, 8 * sizeof(std::size_t) + 1> stack{};
+  std::size_t size = 0;
+  for (std::size_t index = 0; index < num_of_leaves; ++index) {
+    stack[size++] = get_leaf(index);
+    for (int i = std::countr_zero(index + 1); 0 < i; --i) {
+      --size;
+      stack[size - 1] = combine(stack[size - 1], stack[size]);
+    }
+  }
+  for (; 1 < size; --size)
+    stack[size - 2] = combine(stack[size - 2], stack[size - 1]);
+  return stack[0];
+}
+
+} // namespace zisc
+
+#endif // ZISC_TREE_HASH_INL_HPP
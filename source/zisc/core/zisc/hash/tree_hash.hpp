@@ -0,0 +1,101 @@
+/*!
+  \file tree_hash.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_TREE_HASH_HPP
+#define ZISC_TREE_HASH_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+// Zisc
+#include "hash_engine.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+// Forward declaration
+class ThreadManager;
+
+/*!
+  \brief Hash a large buffer as a Merkle tree of fixed size leaves
+
+  The buffer is split into leaves of the given size and each leaf is
+  hashed by the given engine. Adjacent digests are combined level by level
+  and the last digest of a level with an odd number of nodes is promoted
+  to the next level. The root is combined with the length of the buffer.
+  Since the tree only depends on the length and the leaf size,
+  the parallel hash returns the same value as the sequential hash
+  regardless of the number of threads.
+  Note that the value is different from the hash of the whole buffer.
+
+  \tparam HashEngineT A hash engine, e.g. Xxh3Hash64.
+  \note No notation.
+  \attention No attention.
+  */
+template <typename HashEngineT>
+class TreeHash
+{
+ public:
+  using ValueT = typename HashEngineT::ValueT;
+
+
+  //! Return the default size of a leaf in bytes
+  static constexpr auto defaultLeafSize() noexcept -> std::size_t;
+
+  //! Compute a tree hash of the given data on the calling thread
+  template <HashKeyElement Int8, std::size_t kExtent>
+  static constexpr auto hash(const std::span<Int8, kExtent> data,
+                             const std::size_t leaf_size = defaultLeafSize()) noexcept
+      -> ValueT;
+
+  //! Compute a tree hash of the given data on the worker threads
+  template <HashKeyElement Int8, std::size_t kExtent>
+  static auto hash(const std::span<Int8, kExtent> data,
+                   ThreadManager& thread_manager,
+                   std::pmr::memory_resource* mem_resource,
+                   const std::size_t leaf_size = defaultLeafSize()) -> ValueT;
+
+  //! Return the number of leaves of the given data
+  static constexpr auto numOfLeaves(const std::size_t n, const std::size_t leaf_size) noexcept
+      -> std::size_t;
+
+ private:
+  //! Combine the given child digests into the parent digest
+  static constexpr auto combine(const ValueT lhs, const ValueT rhs) noexcept -> ValueT;
+
+  //! Combine the root digest with the length of the data
+  static constexpr auto finalize(const ValueT root, const std::size_t n) noexcept -> ValueT;
+
+  //! Hash the given leaf of the data
+  template <HashKeyElement Int8>
+  static constexpr auto hashLeaf(const std::span<Int8> data,
+                                 const std::size_t leaf_size,
+                                 const std::size_t index) noexcept -> ValueT;
+
+  //! Build the tree from the leaf digests which are given in order
+  template <typename Func>
+  static constexpr auto reduce(const std::size_t num_of_leaves, Func&& get_leaf) noexcept
+      -> ValueT;
+
+
+  static constexpr uint8b kNodeTag = 0x01;
+  static constexpr uint8b kRootTag = 0x02;
+};
+
+} // namespace zisc
+
+#include "tree_hash-inl.hpp"
+
+#endif // ZISC_TREE_HASH_HPP
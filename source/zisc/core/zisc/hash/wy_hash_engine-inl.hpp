@@ -0,0 +1,291 @@
+/*!
+  \file wy_hash_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_WY_HASH_ENGINE_INL_HPP
+#define ZISC_WY_HASH_ENGINE_INL_HPP
+
+#include "wy_hash_engine.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <string_view>
+// Zisc
+#include "hash_engine.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] seed No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto WyHashEngine<T>::hashValue(const Int8* seed,
+                                          const std::size_t n) noexcept -> ValueT
+{
+  const uint64b x = hashWithSeed(seed, n, 0);
+  return cast<ValueT>(x);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] input No description.
+  \param [in] n No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto WyHashEngine<T>::hashWithSeed(const Int8* input,
+                                             const std::size_t n,
+                                             const uint64b seed) noexcept -> uint64b
+{
+  uint64b x = 0;
+  if (n <= 16) {
+    x = finish(input, n, initialSeed(seed), n);
+  }
+  else {
+    const Int8* p = input;
+    std::size_t i = n;
+    std::array<uint64b, 3> seeds{};
+    seeds.fill(initialSeed(seed));
+    if (kChunkSize <= i) {
+      do {
+        mixChunk(p, seeds);
+        p += kChunkSize;
+        i -= kChunkSize;
+      } while (kChunkSize <= i);
+      seeds[0] ^= seeds[1] ^ seeds[2];
+    }
+    x = finish(p, i, seeds[0], n);
+  }
+  return x;
+}
+
+/*!
+  \details If n is greater than 16, the 16 bytes before p must be readable
+
+  \tparam Int8 No description.
+  \param [in] p No description.
+  \param [in] i The number of the remaining bytes.
+  \param [in] seed No description.
+  \param [in] n The total number of bytes.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto WyHashEngine<T>::finish(const Int8* p,
+                                       std::size_t i,
+                                       uint64b seed,
+                                       const std::size_t n) noexcept -> uint64b
+{
+  uint64b a = 0;
+  uint64b b = 0;
+  if (n <= 16) {
+    if (4 <= n) {
+      const std::size_t offset = (n >> 3) << 2;
+      a = (cast<uint64b>(BaseEngineT::loadLe32(p)) << 32) |
+          BaseEngineT::loadLe32(p + offset);
+      b = (cast<uint64b>(BaseEngineT::loadLe32(p + n - 4)) << 32) |
+          BaseEngineT::loadLe32(p + n - 4 - offset);
+    }
+    else if (0 < n) {
+      a = load3(p, n);
+    }
+  }
+  else {
+    for (; 16 < i; i -= 16, p += 16)
+      seed = mix(BaseEngineT::loadLe64(p) ^ kSecret[1], BaseEngineT::loadLe64(p + 8) ^ seed);
+    a = BaseEngineT::loadLe64(p + i - 16);
+    b = BaseEngineT::loadLe64(p + i - 8);
+  }
+  const std::array<uint64b, 2> product = BaseEngineT::multiply128(a ^ kSecret[1], b ^ seed);
+  return mix(product[0] ^ kSecret[0] ^ n, product[1] ^ kSecret[1]);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] seed No description.
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto WyHashEngine<T>::initialSeed(const uint64b seed) noexcept -> uint64b
+{
+  return seed ^ mix(seed ^ kSecret[0], kSecret[1]);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] lhs No description.
+  \param [in] rhs No description.
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto WyHashEngine<T>::mix(const uint64b lhs, const uint64b rhs) noexcept -> uint64b
+{
+  const std::array<uint64b, 2> product = BaseEngineT::multiply128(lhs, rhs);
+  return product[0] ^ product[1];
+}
+
+/*!
+  \details Three independent multiply chains
+
+  \tparam Int8 No description.
+  \param [in] p No description.
+  \param [in,out] seeds No description.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr void WyHashEngine<T>::mixChunk(const Int8* p, std::array<uint64b, 3>& seeds) noexcept
+{
+  seeds[0] = mix(BaseEngineT::loadLe64(p) ^ kSecret[1], BaseEngineT::loadLe64(p + 8) ^ seeds[0]);
+  seeds[1] = mix(BaseEngineT::loadLe64(p + 16) ^ kSecret[2], BaseEngineT::loadLe64(p + 24) ^ seeds[1]);
+  seeds[2] = mix(BaseEngineT::loadLe64(p + 32) ^ kSecret[3], BaseEngineT::loadLe64(p + 40) ^ seeds[2]);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] p No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto WyHashEngine<T>::load3(const Int8* p, const std::size_t n) noexcept -> uint64b
+{
+  const uint64b x = (cast<uint64b>(cast<uint8b>(p[0])) << 16) |
+                    (cast<uint64b>(cast<uint8b>(p[n >> 1])) << 8) |
+                    cast<uint64b>(cast<uint8b>(p[n - 1]));
+  return x;
+}
+
+/*!
+  \details No detailed description
+  */
+template <HashValue T> inline
+constexpr WyHashEngine<T>::Hasher::Hasher() noexcept
+{
+  reset();
+}
+
+/*!
+  \details The hasher can be updated further after this call
+
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto WyHashEngine<T>::Hasher::finalize() const noexcept -> ValueT
+{
+  uint64b x = 0;
+  if (total_size_ < kChunkSize) {
+    // No chunk is mixed yet
+    x = hashWithSeed(buffer_.data(), buffered_size_, 0);
+  }
+  else {
+    // The final step may read the mixed bytes again
+    std::array<uint8b, kHistorySize + kChunkSize> tail{};
+    std::copy_n(history_.begin(), kHistorySize, tail.begin());
+    std::copy_n(buffer_.begin(), buffered_size_, tail.begin() + kHistorySize);
+    const uint64b seed = seeds_[0] ^ seeds_[1] ^ seeds_[2];
+    x = finish(tail.data() + kHistorySize, buffered_size_, seed, total_size_);
+  }
+  return cast<ValueT>(x);
+}
+
+/*!
+  \details No detailed description
+  */
+template <HashValue T> inline
+constexpr void WyHashEngine<T>::Hasher::reset() noexcept
+{
+  seeds_.fill(initialSeed(0));
+  buffered_size_ = 0;
+  total_size_ = 0;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] data No description.
+  */
+template <HashValue T> inline
+constexpr void WyHashEngine<T>::Hasher::update(const std::string_view data) noexcept
+{
+  update(data.data(), data.size());
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \tparam kExtent No description.
+  \param [in] data No description.
+  */
+template <HashValue T>
+template <HashKeyElement Int8, std::size_t kExtent> inline
+constexpr void WyHashEngine<T>::Hasher::update(const std::span<Int8, kExtent> data) noexcept
+{
+  update(data.data(), data.size());
+}
+
+/*!
+  \details Complete chunks in the given data are mixed without copying
+
+  \tparam Int8 No description.
+  \param [in] data No description.
+  \param [in] n No description.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr void WyHashEngine<T>::Hasher::update(const Int8* data,
+                                               const std::size_t n) noexcept
+{
+  const auto to_byte = [](const Int8 c) noexcept {return cast<uint8b>(c);};
+  total_size_ += n;
+  std::size_t i = 0;
+  // Complete the buffered chunk
+  if (0 < buffered_size_) {
+    const std::size_t size = (std::min)(kChunkSize - buffered_size_, n);
+    std::transform(data, data + size, buffer_.begin() + buffered_size_, to_byte);
+    buffered_size_ += size;
+    i = size;
+    if (buffered_size_ < kChunkSize)
+      return;
+    mixChunk(buffer_.data(), seeds_);
+    std::copy_n(buffer_.end() - kHistorySize, kHistorySize, history_.begin());
+    buffered_size_ = 0;
+  }
+  // Mix the chunks directly
+  if ((i + kChunkSize) <= n) {
+    for (; (i + kChunkSize) <= n; i += kChunkSize)
+      mixChunk(data + i, seeds_);
+    std::transform(data + i - kHistorySize, data + i, history_.begin(), to_byte);
+  }
+  // Keep the rest
+  std::transform(data + i, data + n, buffer_.begin(), to_byte);
+  buffered_size_ = n - i;
+}
+
+} // namespace zisc
+
+#endif // ZISC_WY_HASH_ENGINE_INL_HPP
@@ -0,0 +1,151 @@
+/*!
+  \file wy_hash_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_WY_HASH_ENGINE_HPP
+#define ZISC_WY_HASH_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <string_view>
+// Zisc
+#include "hash_engine.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief wyhash (final version 4.2) with the default secret and seed 0
+
+  Each step consumes 48 bytes in three independent 64x64 to 128bit
+  multiply chains, so it is fast on 64bit CPUs for keys of any length.
+  The 32bit variant returns the lower 32 bits of the 64bit hash.
+
+  \tparam T No description.
+  \note No notation.
+  \attention No attention.
+  */
+template <HashValue T>
+class WyHashEngine : public HashEngine<WyHashEngine<T>, T>
+{
+ public:
+  using BaseEngineT = HashEngine<WyHashEngine, T>;
+  using ValueT = typename BaseEngineT::ValueT;
+
+  // Incremental hash
+  class Hasher;
+
+
+  //! Implementation of the hash function
+  template <HashKeyElement Int8>
+  static constexpr auto hashValue(const Int8* seed, const std::size_t n) noexcept -> ValueT;
+
+  //! Compute the 64bit hash value with the given seed
+  template <HashKeyElement Int8>
+  static constexpr auto hashWithSeed(const Int8* input,
+                                     const std::size_t n,
+                                     uint64b seed) noexcept -> uint64b;
+
+ private:
+
+  //! Hash the remaining bytes after the 48 bytes chunks
+  template <HashKeyElement Int8>
+  static constexpr auto finish(const Int8* p,
+                               std::size_t i,
+                               uint64b seed,
+                               const std::size_t n) noexcept -> uint64b;
+
+  //! Return the seed which is mixed with the secret
+  static constexpr auto initialSeed(const uint64b seed) noexcept -> uint64b;
+
+  //! Multiply the given values and fold the 128bit product into 64bit
+  static constexpr auto mix(const uint64b lhs, const uint64b rhs) noexcept -> uint64b;
+
+  //! Mix a 48 bytes chunk into the three seeds
+  template <HashKeyElement Int8>
+  static constexpr void mixChunk(const Int8* p, std::array<uint64b, 3>& seeds) noexcept;
+
+  //! Read 1 to 3 bytes
+  template <HashKeyElement Int8>
+  static constexpr auto load3(const Int8* p, const std::size_t n) noexcept -> uint64b;
+
+
+  static constexpr std::size_t kChunkSize = 48;
+  //! The default secret of wyhash
+  static constexpr std::array<uint64b, 4> kSecret{{0x2d35'8dcc'aa6c'78a5ull,
+                                                   0x8bb8'4b93'962e'acc9ull,
+                                                   0x4b33'a62e'd433'd4a3ull,
+                                                   0x4d5a'2da5'1de1'aa47ull}};
+};
+
+/*!
+  \brief Compute a wyhash of data which is given in pieces
+
+  Each 48 bytes chunk is mixed as soon as it is complete.
+  The last 16 bytes of the mixed data are kept since
+  the final step may read them again.
+
+  \tparam T No description.
+  \note No notation.
+  \attention No attention.
+  */
+template <HashValue T>
+class WyHashEngine<T>::Hasher
+{
+ public:
+  //! Create a hasher
+  constexpr Hasher() noexcept;
+
+
+  //! Return the hash value of the data given so far
+  [[nodiscard]]
+  constexpr auto finalize() const noexcept -> ValueT;
+
+  //! Start a new hash
+  constexpr void reset() noexcept;
+
+  //! Append the given data
+  constexpr void update(const std::string_view data) noexcept;
+
+  //! Append the given data
+  template <HashKeyElement Int8, std::size_t kExtent>
+  constexpr void update(const std::span<Int8, kExtent> data) noexcept;
+
+  //! Append the given data
+  template <HashKeyElement Int8>
+  constexpr void update(const Int8* data, const std::size_t n) noexcept;
+
+ private:
+  static constexpr std::size_t kHistorySize = 16;
+
+
+  std::array<uint64b, 3> seeds_{};
+  std::array<uint8b, kChunkSize> buffer_{};
+  std::array<uint8b, kHistorySize> history_{};
+  std::size_t buffered_size_ = 0;
+  std::size_t total_size_ = 0;
+};
+
+// Type aliases
+
+using WyHash32 = WyHashEngine<uint32b>;
+using WyHash64 = WyHashEngine<uint64b>;
+
+} // namespace zisc
+
+#include "wy_hash_engine-inl.hpp"
+
+#endif // ZISC_WY_HASH_ENGINE_HPP
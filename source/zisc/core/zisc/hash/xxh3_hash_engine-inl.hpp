@@ -0,0 +1,566 @@
+/*!
+  \file xxh3_hash_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_XXH3_HASH_ENGINE_INL_HPP
+#define ZISC_XXH3_HASH_ENGINE_INL_HPP
+
+#include "xxh3_hash_engine.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+// Zisc
+#include "hash_engine.hpp"
+#include "zisc/bit.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] seed No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto Xxh3HashEngine<T>::hashValue(const Int8* seed,
+                                            const std::size_t n) noexcept -> ValueT
+{
+  uint64b x = 0;
+  if (n <= 16)
+    x = hash0To16(seed, n);
+  else if (n <= 128)
+    x = hash17To128(seed, n);
+  else if (n <= 240)
+    x = hash129To240(seed, n);
+  else
+    x = hashLong(seed, n);
+  return cast<ValueT>(x);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in,out] acc No description.
+  \param [in] input No description.
+  \param [in] secret No description.
+  \param [in] num_of_stripes No description.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr void Xxh3HashEngine<T>::accumulate(AccumulatorT& acc,
+                                             const Int8* input,
+                                             const uint8b* secret,
+                                             const std::size_t num_of_stripes) noexcept
+{
+#if defined(__SSE2__)
+  if (!std::is_constant_evaluated()) {
+    accumulateSimd(acc, input, secret, num_of_stripes);
+    return;
+  }
+#endif // __SSE2__
+  for (std::size_t s = 0; s < num_of_stripes; ++s) {
+    const Int8* in = input + s * kStripeSize;
+    const uint8b* key = secret + s * kSecretConsumeRate;
+    for (std::size_t lane = 0; lane < acc.size(); ++lane) {
+      const uint64b data_value = BaseEngineT::loadLe64(in + 8 * lane);
+      const uint64b data_key = data_value ^ BaseEngineT::loadLe64(key + 8 * lane);
+      acc[lane ^ 1] += data_value; // Swap adjacent lanes
+      acc[lane] += (data_key & 0xffff'ffffull) * (data_key >> 32);
+    }
+  }
+}
+
+/*!
+  \details The accumulators are kept in registers during the loop
+
+  \tparam Int8 No description.
+  \param [in,out] acc No description.
+  \param [in] input No description.
+  \param [in] secret No description.
+  \param [in] num_of_stripes No description.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+void Xxh3HashEngine<T>::accumulateSimd(AccumulatorT& acc,
+                                       [[maybe_unused]] const Int8* input,
+                                       [[maybe_unused]] const uint8b* secret,
+                                       [[maybe_unused]] const std::size_t num_of_stripes) noexcept
+{
+#if defined(__AVX2__)
+  constexpr std::size_t n = sizeof(__m256i) / sizeof(uint64b);
+  constexpr std::size_t num_of_vectors = std::tuple_size_v<AccumulatorT> / n;
+  __m256i v[num_of_vectors]; // The attributes of __m256i are lost in std::array
+  for (std::size_t i = 0; i < num_of_vectors; ++i)
+    v[i] = _mm256_loadu_si256(reinterp<const __m256i*>(acc.data() + i * n));
+  for (std::size_t s = 0; s < num_of_stripes; ++s) {
+    const Int8* in = input + s * kStripeSize;
+    const uint8b* key = secret + s * kSecretConsumeRate;
+    for (std::size_t i = 0; i < num_of_vectors; ++i) {
+      const __m256i data = _mm256_loadu_si256(reinterp<const __m256i*>(in + i * sizeof(__m256i)));
+      const __m256i k = _mm256_loadu_si256(reinterp<const __m256i*>(key + i * sizeof(__m256i)));
+      const __m256i data_key = _mm256_xor_si256(data, k);
+      const __m256i data_key_hi = _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+      const __m256i product = _mm256_mul_epu32(data_key, data_key_hi);
+      const __m256i data_swap = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+      v[i] = _mm256_add_epi64(_mm256_add_epi64(v[i], data_swap), product);
+    }
+  }
+  for (std::size_t i = 0; i < num_of_vectors; ++i)
+    _mm256_storeu_si256(reinterp<__m256i*>(acc.data() + i * n), v[i]);
+#elif defined(__SSE2__)
+  constexpr std::size_t n = sizeof(__m128i) / sizeof(uint64b);
+  constexpr std::size_t num_of_vectors = std::tuple_size_v<AccumulatorT> / n;
+  __m128i v[num_of_vectors]; // The attributes of __m128i are lost in std::array
+  for (std::size_t i = 0; i < num_of_vectors; ++i)
+    v[i] = _mm_loadu_si128(reinterp<const __m128i*>(acc.data() + i * n));
+  for (std::size_t s = 0; s < num_of_stripes; ++s) {
+    const Int8* in = input + s * kStripeSize;
+    const uint8b* key = secret + s * kSecretConsumeRate;
+    for (std::size_t i = 0; i < num_of_vectors; ++i) {
+      const __m128i data = _mm_loadu_si128(reinterp<const __m128i*>(in + i * sizeof(__m128i)));
+      const __m128i k = _mm_loadu_si128(reinterp<const __m128i*>(key + i * sizeof(__m128i)));
+      const __m128i data_key = _mm_xor_si128(data, k);
+      const __m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+      const __m128i product = _mm_mul_epu32(data_key, data_key_hi);
+      const __m128i data_swap = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+      v[i] = _mm_add_epi64(_mm_add_epi64(v[i], data_swap), product);
+    }
+  }
+  for (std::size_t i = 0; i < num_of_vectors; ++i)
+    _mm_storeu_si128(reinterp<__m128i*>(acc.data() + i * n), v[i]);
+#else
+  static_cast<void>(acc);
+#endif
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in,out] acc No description.
+  \param [in] input The last 64 bytes of the key.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr void Xxh3HashEngine<T>::accumulateLast(AccumulatorT& acc,
+                                                 const Int8* input) noexcept
+{
+  constexpr std::size_t last_acc_start = 7;
+  accumulate(acc, input, kSecret.data() + kSecret.size() - kStripeSize - last_acc_start, 1);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] h No description.
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto Xxh3HashEngine<T>::avalanche(uint64b h) noexcept -> uint64b
+{
+  h ^= h >> 37;
+  h *= kPrimeMx1;
+  h ^= h >> 32;
+  return h;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] h No description.
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto Xxh3HashEngine<T>::avalanche64(uint64b h) noexcept -> uint64b
+{
+  h ^= h >> 33;
+  h *= kPrime64_2;
+  h ^= h >> 29;
+  h *= kPrime64_3;
+  h ^= h >> 32;
+  return h;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in,out] acc No description.
+  \param [in,out] stripe_count No description.
+  \param [in] input No description.
+  \param [in] num_of_stripes No description.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr void Xxh3HashEngine<T>::consumeStripes(AccumulatorT& acc,
+                                                 std::size_t& stripe_count,
+                                                 const Int8* input,
+                                                 std::size_t num_of_stripes) noexcept
+{
+  const uint8b* secret = kSecret.data();
+  while (0 < num_of_stripes) {
+    const std::size_t n = (std::min)(num_of_stripes, kStripesPerBlock - stripe_count);
+    accumulate(acc, input, secret + stripe_count * kSecretConsumeRate, n);
+    input += n * kStripeSize;
+    num_of_stripes -= n;
+    stripe_count += n;
+    if (stripe_count == kStripesPerBlock) {
+      scramble(acc, secret + kSecret.size() - kStripeSize);
+      stripe_count = 0;
+    }
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] input No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto Xxh3HashEngine<T>::hash0To16(const Int8* input,
+                                            const std::size_t n) noexcept -> uint64b
+{
+  const uint8b* secret = kSecret.data();
+  uint64b x = 0;
+  if (8 < n) {
+    const uint64b bitflip1 = BaseEngineT::loadLe64(secret + 24) ^ BaseEngineT::loadLe64(secret + 32);
+    const uint64b bitflip2 = BaseEngineT::loadLe64(secret + 40) ^ BaseEngineT::loadLe64(secret + 48);
+    const uint64b input_lo = BaseEngineT::loadLe64(input) ^ bitflip1;
+    const uint64b input_hi = BaseEngineT::loadLe64(input + n - 8) ^ bitflip2;
+    const uint64b acc = n + byteswap(input_lo) + input_hi + multiplyFold64(input_lo, input_hi);
+    x = avalanche(acc);
+  }
+  else if (4 <= n) {
+    const uint64b input1 = BaseEngineT::loadLe32(input);
+    const uint64b input2 = BaseEngineT::loadLe32(input + n - 4);
+    const uint64b bitflip = BaseEngineT::loadLe64(secret + 8) ^ BaseEngineT::loadLe64(secret + 16);
+    const uint64b keyed = (input2 + (input1 << 32)) ^ bitflip;
+    x = rrmxmx(keyed, n);
+  }
+  else if (0 < n) {
+    const uint32b c1 = cast<uint8b>(input[0]);
+    const uint32b c2 = cast<uint8b>(input[n >> 1]);
+    const uint32b c3 = cast<uint8b>(input[n - 1]);
+    const uint32b combined = (c1 << 16) | (c2 << 24) | c3 | (cast<uint32b>(n) << 8);
+    const uint64b bitflip = BaseEngineT::loadLe32(secret) ^ BaseEngineT::loadLe32(secret + 4);
+    x = avalanche64(combined ^ bitflip);
+  }
+  else {
+    x = avalanche64(BaseEngineT::loadLe64(secret + 56) ^ BaseEngineT::loadLe64(secret + 64));
+  }
+  return x;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] input No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto Xxh3HashEngine<T>::hash17To128(const Int8* input,
+                                              const std::size_t n) noexcept -> uint64b
+{
+  const uint8b* secret = kSecret.data();
+  uint64b acc = n * kPrime64_1;
+  if (32 < n) {
+    if (64 < n) {
+      if (96 < n) {
+        acc += mix16(input + 48, secret + 96);
+        acc += mix16(input + n - 64, secret + 112);
+      }
+      acc += mix16(input + 32, secret + 64);
+      acc += mix16(input + n - 48, secret + 80);
+    }
+    acc += mix16(input + 16, secret + 32);
+    acc += mix16(input + n - 32, secret + 48);
+  }
+  acc += mix16(input, secret);
+  acc += mix16(input + n - 16, secret + 16);
+  return avalanche(acc);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] input No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto Xxh3HashEngine<T>::hash129To240(const Int8* input,
+                                               const std::size_t n) noexcept -> uint64b
+{
+  constexpr std::size_t secret_size_min = 136;
+  constexpr std::size_t start_offset = 3;
+  constexpr std::size_t last_offset = 17;
+  const uint8b* secret = kSecret.data();
+  uint64b acc = n * kPrime64_1;
+  for (std::size_t i = 0; i < 8; ++i)
+    acc += mix16(input + 16 * i, secret + 16 * i);
+  acc = avalanche(acc);
+  uint64b acc_end = mix16(input + n - 16, secret + secret_size_min - last_offset);
+  const std::size_t num_of_rounds = n / 16;
+  for (std::size_t i = 8; i < num_of_rounds; ++i)
+    acc_end += mix16(input + 16 * i, secret + 16 * (i - 8) + start_offset);
+  return avalanche(acc + acc_end);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] input No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto Xxh3HashEngine<T>::hashLong(const Int8* input,
+                                           const std::size_t n) noexcept -> uint64b
+{
+  AccumulatorT acc = initAccumulator();
+  std::size_t stripe_count = 0;
+  consumeStripes(acc, stripe_count, input, (n - 1) / kStripeSize);
+  accumulateLast(acc, input + n - kStripeSize);
+  return merge(acc, n);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto Xxh3HashEngine<T>::initAccumulator() noexcept -> AccumulatorT
+{
+  return AccumulatorT{{kPrime32_3, kPrime64_1, kPrime64_2, kPrime64_3,
+                       kPrime64_4, kPrime32_2, kPrime64_5, kPrime32_1}};
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] acc No description.
+  \param [in] n The length of the key.
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto Xxh3HashEngine<T>::merge(const AccumulatorT& acc,
+                                        const std::size_t n) noexcept -> uint64b
+{
+  constexpr std::size_t merge_accs_start = 11;
+  uint64b result = n * kPrime64_1;
+  const uint8b* merge_secret = kSecret.data() + merge_accs_start;
+  for (std::size_t i = 0; i < acc.size() / 2; ++i) {
+    result += multiplyFold64(acc[2 * i] ^ BaseEngineT::loadLe64(merge_secret + 16 * i),
+                             acc[2 * i + 1] ^ BaseEngineT::loadLe64(merge_secret + 16 * i + 8));
+  }
+  return avalanche(result);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] input No description.
+  \param [in] secret No description.
+  \return No description
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr auto Xxh3HashEngine<T>::mix16(const Int8* input,
+                                        const uint8b* secret) noexcept -> uint64b
+{
+  const uint64b input_lo = BaseEngineT::loadLe64(input);
+  const uint64b input_hi = BaseEngineT::loadLe64(input + 8);
+  return multiplyFold64(input_lo ^ BaseEngineT::loadLe64(secret),
+                        input_hi ^ BaseEngineT::loadLe64(secret + 8));
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] lhs No description.
+  \param [in] rhs No description.
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto Xxh3HashEngine<T>::multiplyFold64(const uint64b lhs,
+                                                 const uint64b rhs) noexcept -> uint64b
+{
+  const std::array<uint64b, 2> product = BaseEngineT::multiply128(lhs, rhs);
+  return product[0] ^ product[1];
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] h No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto Xxh3HashEngine<T>::rrmxmx(uint64b h, const uint64b n) noexcept -> uint64b
+{
+  h ^= std::rotl(h, 49) ^ std::rotl(h, 24);
+  h *= kPrimeMx2;
+  h ^= (h >> 35) + n;
+  h *= kPrimeMx2;
+  h ^= h >> 28;
+  return h;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] acc No description.
+  \param [in] secret No description.
+  */
+template <HashValue T> inline
+constexpr void Xxh3HashEngine<T>::scramble(AccumulatorT& acc, const uint8b* secret) noexcept
+{
+  for (std::size_t lane = 0; lane < acc.size(); ++lane) {
+    uint64b a = acc[lane];
+    a ^= a >> 47;
+    a ^= BaseEngineT::loadLe64(secret + 8 * lane);
+    a *= kPrime32_1;
+    acc[lane] = a;
+  }
+}
+
+/*!
+  \details The hasher can be updated further after this call
+
+  \return No description
+  */
+template <HashValue T> inline
+constexpr auto Xxh3HashEngine<T>::Hasher::finalize() const noexcept -> ValueT
+{
+  // A key which fits in the buffer isn't accumulated yet
+  if (total_size_ <= kBufferSize)
+    return hashValue(buffer_.data(), total_size_);
+
+  AccumulatorT acc = acc_;
+  std::size_t stripe_count = stripe_count_;
+  consumeStripes(acc, stripe_count, buffer_.data(), (buffered_size_ - 1) / kStripeSize);
+  if (kStripeSize <= buffered_size_) {
+    accumulateLast(acc, buffer_.data() + buffered_size_ - kStripeSize);
+  }
+  else {
+    // The last stripe continues from the accumulated data
+    std::array<uint8b, kStripeSize> last_stripe{};
+    const std::size_t size = kStripeSize - buffered_size_;
+    std::copy_n(last_stripe_.end() - size, size, last_stripe.begin());
+    std::copy_n(buffer_.begin(), buffered_size_, last_stripe.begin() + size);
+    accumulateLast(acc, last_stripe.data());
+  }
+  return cast<ValueT>(merge(acc, total_size_));
+}
+
+/*!
+  \details No detailed description
+  */
+template <HashValue T> inline
+constexpr void Xxh3HashEngine<T>::Hasher::reset() noexcept
+{
+  acc_ = initAccumulator();
+  buffered_size_ = 0;
+  total_size_ = 0;
+  stripe_count_ = 0;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] data No description.
+  */
+template <HashValue T> inline
+constexpr void Xxh3HashEngine<T>::Hasher::update(const std::string_view data) noexcept
+{
+  update(data.data(), data.size());
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \tparam kExtent No description.
+  \param [in] data No description.
+  */
+template <HashValue T>
+template <HashKeyElement Int8, std::size_t kExtent> inline
+constexpr void Xxh3HashEngine<T>::Hasher::update(const std::span<Int8, kExtent> data) noexcept
+{
+  update(data.data(), data.size());
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int8 No description.
+  \param [in] data No description.
+  \param [in] n No description.
+  */
+template <HashValue T> template <HashKeyElement Int8> inline
+constexpr void Xxh3HashEngine<T>::Hasher::update(const Int8* data,
+                                                 const std::size_t n) noexcept
+{
+  const auto to_byte = [](const Int8 c) noexcept {return cast<uint8b>(c);};
+  total_size_ += n;
+  if ((buffered_size_ + n) <= kBufferSize) {
+    std::transform(data, data + n, buffer_.begin() + buffered_size_, to_byte);
+    buffered_size_ += n;
+    return;
+  }
+
+  std::size_t i = 0;
+  // More data follows, so the whole buffer can be accumulated
+  if (0 < buffered_size_) {
+    i = kBufferSize - buffered_size_;
+    std::transform(data, data + i, buffer_.begin() + buffered_size_, to_byte);
+    consumeStripes(acc_, stripe_count_, buffer_.data(), kBufferSize / kStripeSize);
+    std::copy_n(buffer_.end() - kStripeSize, kStripeSize, last_stripe_.begin());
+    buffered_size_ = 0;
+  }
+  // Accumulate the stripes directly except the last byte at least
+  if (kBufferSize < (n - i)) {
+    const std::size_t num_of_stripes = (n - i - 1) / kStripeSize;
+    consumeStripes(acc_, stripe_count_, data + i, num_of_stripes);
+    i += num_of_stripes * kStripeSize;
+    std::transform(data + i - kStripeSize, data + i, last_stripe_.begin(), to_byte);
+  }
+  std::transform(data + i, data + n, buffer_.begin(), to_byte);
+  buffered_size_ = n - i;
+}
+
+} // namespace zisc
+
+#endif // ZISC_XXH3_HASH_ENGINE_INL_HPP
@@ -0,0 +1,218 @@
+/*!
+  \file xxh3_hash_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_XXH3_HASH_ENGINE_HPP
+#define ZISC_XXH3_HASH_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <string_view>
+// Zisc
+#include "hash_engine.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief XXH3 64bit hash with the default secret and seed 0
+
+  The output is identical to XXH3_64bits() of xxHash.
+  Short keys are mixed with a few 64bit multiplies and
+  keys longer than 240 bytes are consumed 64 bytes per step by
+  8 accumulators, which are processed with SSE2 or AVX2 if available.
+  The 32bit variant returns the lower 32 bits of the 64bit hash.
+
+  \tparam T No description.
+  \note No notation.
+  \attention No attention.
+  */
+template <HashValue T>
+class Xxh3HashEngine : public HashEngine<Xxh3HashEngine<T>, T>
+{
+ public:
+  using BaseEngineT = HashEngine<Xxh3HashEngine, T>;
+  using ValueT = typename BaseEngineT::ValueT;
+
+  // Incremental hash
+  class Hasher;
+
+
+  //! Implementation of the hash function
+  template <HashKeyElement Int8>
+  static constexpr auto hashValue(const Int8* seed, const std::size_t n) noexcept -> ValueT;
+
+ private:
+  using AccumulatorT = std::array<uint64b, 8>;
+
+
+  //! Accumulate the given number of 64 bytes stripes
+  template <HashKeyElement Int8>
+  static constexpr void accumulate(AccumulatorT& acc,
+                                   const Int8* input,
+                                   const uint8b* secret,
+                                   const std::size_t num_of_stripes) noexcept;
+
+  //! Accumulate the given number of stripes with SIMD instructions
+  template <HashKeyElement Int8>
+  static void accumulateSimd(AccumulatorT& acc,
+                             const Int8* input,
+                             const uint8b* secret,
+                             const std::size_t num_of_stripes) noexcept;
+
+  //! Accumulate the last stripe of a long key
+  template <HashKeyElement Int8>
+  static constexpr void accumulateLast(AccumulatorT& acc, const Int8* input) noexcept;
+
+  //! Mix the bits of the given value
+  static constexpr auto avalanche(uint64b h) noexcept -> uint64b;
+
+  //! Accumulate the given number of stripes and scramble at the end of each block
+  template <HashKeyElement Int8>
+  static constexpr void consumeStripes(AccumulatorT& acc,
+                                       std::size_t& stripe_count,
+                                       const Int8* input,
+                                       std::size_t num_of_stripes) noexcept;
+
+  //! Mix the bits of the given value
+  static constexpr auto avalanche64(uint64b h) noexcept -> uint64b;
+
+  //! Hash a key of 0 to 16 bytes
+  template <HashKeyElement Int8>
+  static constexpr auto hash0To16(const Int8* input, const std::size_t n) noexcept -> uint64b;
+
+  //! Hash a key of 17 to 128 bytes
+  template <HashKeyElement Int8>
+  static constexpr auto hash17To128(const Int8* input, const std::size_t n) noexcept -> uint64b;
+
+  //! Hash a key of 129 to 240 bytes
+  template <HashKeyElement Int8>
+  static constexpr auto hash129To240(const Int8* input, const std::size_t n) noexcept -> uint64b;
+
+  //! Hash a key longer than 240 bytes
+  template <HashKeyElement Int8>
+  static constexpr auto hashLong(const Int8* input, const std::size_t n) noexcept -> uint64b;
+
+  //! Return the initial accumulators of a long key
+  static constexpr auto initAccumulator() noexcept -> AccumulatorT;
+
+  //! Merge the accumulators into the hash of a long key
+  static constexpr auto merge(const AccumulatorT& acc, const std::size_t n) noexcept -> uint64b;
+
+  //! Mix 16 bytes of the given input
+  template <HashKeyElement Int8>
+  static constexpr auto mix16(const Int8* input, const uint8b* secret) noexcept -> uint64b;
+
+  //! Multiply the given values and fold the 128bit product into 64bit
+  static constexpr auto multiplyFold64(const uint64b lhs, const uint64b rhs) noexcept -> uint64b;
+
+  //! Mix the bits of the given value
+  static constexpr auto rrmxmx(uint64b h, const uint64b n) noexcept -> uint64b;
+
+  //! Scramble the accumulators
+  static constexpr void scramble(AccumulatorT& acc, const uint8b* secret) noexcept;
+
+
+  static constexpr std::size_t kStripeSize = 64;
+  static constexpr std::size_t kSecretConsumeRate = 8;
+  static constexpr uint64b kPrime32_1 = 0x9E37'79B1u;
+  static constexpr uint64b kPrime32_2 = 0x85EB'CA77u;
+  static constexpr uint64b kPrime32_3 = 0xC2B2'AE3Du;
+  static constexpr uint64b kPrime64_1 = 0x9E37'79B1'85EB'CA87ull;
+  static constexpr uint64b kPrime64_2 = 0xC2B2'AE3D'27D4'EB4Full;
+  static constexpr uint64b kPrime64_3 = 0x1656'67B1'9E37'79F9ull;
+  static constexpr uint64b kPrime64_4 = 0x85EB'CA77'C2B2'AE63ull;
+  static constexpr uint64b kPrime64_5 = 0x27D4'EB2F'1656'67C5ull;
+  static constexpr uint64b kPrimeMx1 = 0x1656'6791'9E37'79F9ull;
+  static constexpr uint64b kPrimeMx2 = 0x9FB2'1C65'1E98'DF25ull;
+  //! The default secret of XXH3
+  static constexpr std::array<uint8b, 192> kSecret{{
+      0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+      0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+      0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+      0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+      0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+      0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+      0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+      0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+      0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+      0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+      0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+      0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e}};
+  static constexpr std::size_t kStripesPerBlock = (kSecret.size() - kStripeSize) / kSecretConsumeRate;
+};
+
+/*!
+  \brief Compute a XXH3 hash of data which is given in pieces
+
+  Data is buffered up to 256 bytes. Once more data is given,
+  the buffered stripes are accumulated with the same SIMD path as
+  the one-shot hash and large pieces are accumulated without copying.
+  At least one byte is always kept in the buffer, since the last stripe
+  of a long key is accumulated with a different secret.
+
+  \tparam T No description.
+  \note No notation.
+  \attention No attention.
+  */
+template <HashValue T>
+class Xxh3HashEngine<T>::Hasher
+{
+ public:
+  //! Create a hasher
+  constexpr Hasher() noexcept = default;
+
+
+  //! Return the hash value of the data given so far
+  [[nodiscard]]
+  constexpr auto finalize() const noexcept -> ValueT;
+
+  //! Start a new hash
+  constexpr void reset() noexcept;
+
+  //! Append the given data
+  constexpr void update(const std::string_view data) noexcept;
+
+  //! Append the given data
+  template <HashKeyElement Int8, std::size_t kExtent>
+  constexpr void update(const std::span<Int8, kExtent> data) noexcept;
+
+  //! Append the given data
+  template <HashKeyElement Int8>
+  constexpr void update(const Int8* data, const std::size_t n) noexcept;
+
+ private:
+  static constexpr std::size_t kBufferSize = 4 * kStripeSize;
+
+
+  AccumulatorT acc_ = initAccumulator();
+  std::array<uint8b, kBufferSize> buffer_{};
+  std::array<uint8b, kStripeSize> last_stripe_{}; //!< The last accumulated stripe
+  std::size_t buffered_size_ = 0;
+  std::size_t total_size_ = 0;
+  std::size_t stripe_count_ = 0; //!< The number of stripes in the current block
+};
+
+// Type aliases
+
+using Xxh3Hash32 = Xxh3HashEngine<uint32b>;
+using Xxh3Hash64 = Xxh3HashEngine<uint64b>;
+
+} // namespace zisc
+
+#include "xxh3_hash_engine-inl.hpp"
+
+#endif // ZISC_XXH3_HASH_ENGINE_HPP
@@ -0,0 +1,152 @@
+/*!
+  \file mapped_file-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_MAPPED_FILE_INL_HPP
+#define ZISC_MAPPED_FILE_INL_HPP
+
+#include "mapped_file.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+#include <utility>
+// Zisc
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] file_path No description.
+  \exception std::system_error The file can't be mapped
+  */
+inline
+MappedFile::MappedFile(const std::filesystem::path& file_path)
+{
+  open(file_path);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  */
+inline
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    data_{std::exchange(other.data_, nullptr)},
+    size_{std::exchange(other.size_, 0)},
+    is_open_{std::exchange(other.is_open_, false)}
+{
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+MappedFile::~MappedFile() noexcept
+{
+  close();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  \return No description
+  */
+inline
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile&
+{
+  close();
+  data_ = std::exchange(other.data_, nullptr);
+  size_ = std::exchange(other.size_, 0);
+  is_open_ = std::exchange(other.is_open_, false);
+  return *this;
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void MappedFile::close() noexcept
+{
+  if (data_ != nullptr)
+    unmap();
+  data_ = nullptr;
+  size_ = 0;
+  is_open_ = false;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto MappedFile::data() const noexcept -> const char*
+{
+  return data_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto MappedFile::isOpen() const noexcept -> bool
+{
+  return is_open_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] file_path No description.
+  \exception std::system_error The file can't be mapped
+  */
+inline
+void MappedFile::open(const std::filesystem::path& file_path)
+{
+  close();
+  map(file_path);
+  is_open_ = true;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto MappedFile::size() const noexcept -> std::size_t
+{
+  return size_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto MappedFile::view() const noexcept -> std::string_view
+{
+  return (data_ != nullptr) ? std::string_view{data_, size_} : std::string_view{};
+}
+
+} // namespace zisc
+
+#endif // ZISC_MAPPED_FILE_INL_HPP
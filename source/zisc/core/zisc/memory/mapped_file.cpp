@@ -0,0 +1,148 @@
+/*!
+  \file mapped_file.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#include "mapped_file.hpp"
+// Standard C++ library
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <system_error>
+// Zisc
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+// Platform
+#if defined(Z_WINDOWS)
+#define NOMINMAX
+#include <Windows.h>
+#elif defined(Z_LINUX) || defined(Z_MAC)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/*!
+  \details No detailed description
+
+  \param [in] code No description.
+  \param [in] message No description.
+  \param [in] file_path No description.
+  */
+[[noreturn]] void raiseMappingError(const std::error_code code,
+                                    const char* message,
+                                    const std::filesystem::path& file_path)
+{
+  throw std::system_error{code, message + (": " + file_path.string())};
+}
+
+} // namespace
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] file_path No description.
+  \exception std::system_error The file can't be mapped
+  */
+void MappedFile::map(const std::filesystem::path& file_path)
+{
+#if defined(Z_WINDOWS)
+  auto last_error = []() noexcept
+  {
+    return std::error_code{cast<int>(GetLastError()), std::system_category()};
+  };
+  HANDLE file = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    ::raiseMappingError(last_error(), "Opening the file failed", file_path);
+  LARGE_INTEGER file_size{};
+  if (GetFileSizeEx(file, &file_size) == 0) {
+    const std::error_code code = last_error();
+    CloseHandle(file);
+    ::raiseMappingError(code, "Retrieving the file size failed", file_path);
+  }
+  size_ = cast<std::size_t>(file_size.QuadPart);
+  // The view keeps the mapping alive after the handles are closed
+  if (0 < size_) {
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* data = (mapping != nullptr)
+        ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)
+        : nullptr;
+    const std::error_code code = last_error();
+    if (mapping != nullptr)
+      CloseHandle(mapping);
+    CloseHandle(file);
+    if (data == nullptr) {
+      size_ = 0;
+      ::raiseMappingError(code, "Mapping the file failed", file_path);
+    }
+    data_ = static_cast<const char*>(data);
+  }
+  else {
+    CloseHandle(file);
+  }
+#elif defined(Z_LINUX) || defined(Z_MAC)
+  auto last_error = []() noexcept
+  {
+    return std::error_code{errno, std::generic_category()};
+  };
+  const int file = ::open(file_path.c_str(), O_RDONLY);
+  if (file < 0)
+    ::raiseMappingError(last_error(), "Opening the file failed", file_path);
+  struct stat file_stat{};
+  if (fstat(file, &file_stat) != 0) {
+    const std::error_code code = last_error();
+    ::close(file);
+    ::raiseMappingError(code, "Retrieving the file size failed", file_path);
+  }
+  size_ = cast<std::size_t>(file_stat.st_size);
+  // The mapping is kept after the file descriptor is closed
+  if (0 < size_) {
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+    const std::error_code code = last_error();
+    ::close(file);
+    if (data == MAP_FAILED) {
+      size_ = 0;
+      ::raiseMappingError(code, "Mapping the file failed", file_path);
+    }
+    posix_madvise(data, size_, POSIX_MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(data);
+  }
+  else {
+    ::close(file);
+  }
+#else
+  ::raiseMappingError(std::make_error_code(std::errc::not_supported),
+                      "Mapping a file isn't supported on the platform",
+                      file_path);
+#endif
+}
+
+/*!
+  \details No detailed description
+  */
+void MappedFile::unmap() noexcept
+{
+#if defined(Z_WINDOWS)
+  UnmapViewOfFile(data_);
+#elif defined(Z_LINUX) || defined(Z_MAC)
+  munmap(const_cast<char*>(data_), size_);
+#endif
+}
+
+} // namespace zisc
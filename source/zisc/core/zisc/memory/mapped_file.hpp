@@ -0,0 +1,97 @@
+/*!
+  \file mapped_file.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_MAPPED_FILE_HPP
+#define ZISC_MAPPED_FILE_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+// Zisc
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Map a file into the memory as read-only
+
+  The mapped memory is valid until the file is closed
+  and it's kept valid when the object is moved.
+
+  \note No notation.
+  \attention No attention.
+  */
+class MappedFile : private NonCopyable<MappedFile>
+{
+ public:
+  //! Create an empty mapping
+  MappedFile() noexcept = default;
+
+  //! Map the given file
+  explicit MappedFile(const std::filesystem::path& file_path);
+
+  //! Move a data
+  MappedFile(MappedFile&& other) noexcept;
+
+  //! Unmap the file
+  ~MappedFile() noexcept;
+
+
+  //! Move a data
+  auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+
+  //! Unmap the file
+  void close() noexcept;
+
+  //! Return the pointer to the mapped memory
+  [[nodiscard]]
+  auto data() const noexcept -> const char*;
+
+  //! Check if a file is mapped
+  [[nodiscard]]
+  auto isOpen() const noexcept -> bool;
+
+  //! Map the given file
+  void open(const std::filesystem::path& file_path);
+
+  //! Return the size of the mapped file in bytes
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+  //! Return the view of the mapped memory
+  [[nodiscard]]
+  auto view() const noexcept -> std::string_view;
+
+ private:
+  //! Map the given file
+  void map(const std::filesystem::path& file_path);
+
+  //! Unmap the file
+  void unmap() noexcept;
+
+
+  const char* data_ = nullptr;
+  std::size_t size_ = 0;
+  bool is_open_ = false;
+  [[maybe_unused]] Padding<7> pad_{};
+};
+
+} // namespace zisc
+
+#include "mapped_file-inl.hpp"
+
+#endif // ZISC_MAPPED_FILE_HPP
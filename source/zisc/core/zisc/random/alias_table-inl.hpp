@@ -0,0 +1,263 @@
+/*!
+  \file alias_table-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_ALIAS_TABLE_INL_HPP
+#define ZISC_ALIAS_TABLE_INL_HPP
+
+#include "alias_table.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+// Zisc
+#include "distribution.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in,out] mem_resource No description.
+  */
+inline
+AliasTable::AliasTable(std::pmr::memory_resource* mem_resource) noexcept :
+    table_{typename decltype(table_)::allocator_type{mem_resource}},
+    probability_list_{typename decltype(probability_list_)::allocator_type{mem_resource}}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] weights No description.
+  \param [in,out] mem_resource No description.
+  */
+template <std::floating_point Float> inline
+AliasTable::AliasTable(const std::span<const Float> weights,
+                       std::pmr::memory_resource* mem_resource) :
+    AliasTable(mem_resource)
+{
+  setWeights(weights);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  */
+inline
+AliasTable::AliasTable(AliasTable&& other) noexcept :
+    table_{std::move(other.table_)},
+    probability_list_{std::move(other.probability_list_)}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  \return No description
+  */
+inline
+auto AliasTable::operator=(AliasTable&& other) noexcept -> AliasTable&
+{
+  table_ = std::move(other.table_);
+  probability_list_ = std::move(other.probability_list_);
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <RandomNumberEngine Engine> inline
+auto AliasTable::operator()(Engine& engine) const noexcept -> ValueT
+{
+  return generate(engine);
+}
+
+/*!
+  \details The result is the same sequence as calling generate() repeatedly
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [out] out No description.
+  */
+template <RandomNumberEngine Engine> inline
+void AliasTable::fill(Engine& engine, const std::span<ValueT> out) const noexcept
+{
+  ZISC_ASSERT(!isEmpty(), "The table is empty.");
+  std::array<uint64b, Distribution::kChunkSize> chunk;
+  for (std::size_t i = 0; i < out.size(); i += chunk.size()) {
+    const std::size_t n = (std::min)(chunk.size(), out.size() - i);
+    Distribution::fillBits64(engine, {chunk.data(), n});
+    for (std::size_t j = 0; j < n; ++j)
+      out[i + j] = select(chunk[j]);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <RandomNumberEngine Engine> inline
+auto AliasTable::generate(Engine& engine) const noexcept -> ValueT
+{
+  ZISC_ASSERT(!isEmpty(), "The table is empty.");
+  return select(Distribution::generateBits64(engine));
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto AliasTable::isEmpty() const noexcept -> bool
+{
+  return table_.empty();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto AliasTable::memoryResource() const noexcept -> std::pmr::memory_resource*
+{
+  return table_.get_allocator().resource();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+inline
+auto AliasTable::probability(const ValueT index) const noexcept -> double
+{
+  ZISC_ASSERT(index < size(), "The index is out of range.");
+  return probability_list_[index];
+}
+
+/*!
+  \details The weights are normalized, so they don't have to sum to one.
+  Weights must be non-negative and at least one weight must be positive
+
+  \tparam Float No description.
+  \param [in] weights No description.
+  */
+template <std::floating_point Float> inline
+void AliasTable::setWeights(const std::span<const Float> weights)
+{
+  ZISC_ASSERT(!weights.empty(), "The weights are empty.");
+  ZISC_ASSERT(weights.size() <= std::numeric_limits<ValueT>::max(),
+              "The number of the weights exceeds the limit.");
+  double sum = 0.0;
+  for (const Float w : weights) {
+    ZISC_ASSERT(0 <= w, "The weight is negative.");
+    sum += cast<double>(w);
+  }
+  ZISC_ASSERT(0.0 < sum, "The sum of the weights isn't positive.");
+
+  const std::size_t n = weights.size();
+  table_.resize(n);
+  probability_list_.resize(n);
+
+  // Scale the probabilities so that the average is one
+  std::pmr::memory_resource* mem_resource = memoryResource();
+  std::pmr::vector<double> scaled(n, mem_resource);
+  std::pmr::vector<ValueT> small{mem_resource};
+  std::pmr::vector<ValueT> large{mem_resource};
+  small.reserve(n);
+  large.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    probability_list_[i] = cast<double>(weights[i]) / sum;
+    scaled[i] = probability_list_[i] * cast<double>(n);
+    std::pmr::vector<ValueT>& list = (scaled[i] < 1.0) ? small : large;
+    list.push_back(cast<ValueT>(i));
+  }
+
+  // Pair each small bin with a large bin
+  constexpr double scale = 4294967296.0; // 2^32
+  const auto to_threshold = [scale](const double p) noexcept
+  {
+    return cast<ValueT>((std::min)(p * scale, scale - 1.0));
+  };
+  while (!small.empty() && !large.empty()) {
+    const ValueT s = small.back();
+    small.pop_back();
+    const ValueT l = large.back();
+    table_[s] = Bin{to_threshold(scaled[s]), l};
+    scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+    if (scaled[l] < 1.0) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // The remaining bins are full except for rounding errors
+  for (const ValueT i : large)
+    table_[i] = Bin{std::numeric_limits<ValueT>::max(), i};
+  for (const ValueT i : small)
+    table_[i] = Bin{std::numeric_limits<ValueT>::max(), i};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto AliasTable::size() const noexcept -> std::size_t
+{
+  return table_.size();
+}
+
+/*!
+  \details The bin is selected by the multiplication instead of the modulo
+
+  \param [in] bits No description.
+  \return No description
+  */
+inline
+auto AliasTable::select(const uint64b bits) const noexcept -> ValueT
+{
+  const auto n = cast<uint64b>(table_.size());
+  const auto index = cast<ValueT>(((bits >> 32) * n) >> 32);
+  const auto u = cast<ValueT>(bits);
+  const Bin& bin = table_[index];
+  return (u < bin.threshold_) ? index : bin.alias_;
+}
+
+} // namespace zisc
+
+#endif // ZISC_ALIAS_TABLE_INL_HPP
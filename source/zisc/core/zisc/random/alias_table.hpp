@@ -0,0 +1,122 @@
+/*!
+  \file alias_table.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_ALIAS_TABLE_HPP
+#define ZISC_ALIAS_TABLE_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+// Zisc
+#include "distribution.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Discrete distribution sampled in constant time by the alias method
+
+  The table is built from the given weights by Vose's algorithm in O(n).
+  A bin is selected by the upper 32 bits of a 64bit random number, and
+  the lower 32 bits are compared with the fixed point threshold of the bin
+  to choose the bin itself or its alias.
+  So a sample takes one random number, one table lookup and no division.
+  For more detail, please see the following paper:
+  <a href="https://doi.org/10.1109/32.92917">A linear algorithm for generating random numbers with a given distribution</a>.
+
+  \note No notation.
+  \attention No attention.
+  */
+class AliasTable : private NonCopyable<AliasTable>
+{
+ public:
+  using ValueT = uint32b;
+
+
+  //! Create an empty table
+  explicit AliasTable(std::pmr::memory_resource* mem_resource) noexcept;
+
+  //! Create a table of the given weights
+  template <std::floating_point Float>
+  AliasTable(const std::span<const Float> weights,
+             std::pmr::memory_resource* mem_resource);
+
+  //! Move a data
+  AliasTable(AliasTable&& other) noexcept;
+
+
+  //! Move a data
+  auto operator=(AliasTable&& other) noexcept -> AliasTable&;
+
+  //! Generate an index
+  template <RandomNumberEngine Engine>
+  auto operator()(Engine& engine) const noexcept -> ValueT;
+
+
+  //! Fill the given span with indices
+  template <RandomNumberEngine Engine>
+  void fill(Engine& engine, const std::span<ValueT> out) const noexcept;
+
+  //! Generate an index
+  template <RandomNumberEngine Engine>
+  auto generate(Engine& engine) const noexcept -> ValueT;
+
+  //! Check if the table has no weight
+  [[nodiscard]]
+  auto isEmpty() const noexcept -> bool;
+
+  //! Return the memory resource of the table
+  [[nodiscard]]
+  auto memoryResource() const noexcept -> std::pmr::memory_resource*;
+
+  //! Return the probability of the given index
+  [[nodiscard]]
+  auto probability(const ValueT index) const noexcept -> double;
+
+  //! Build the table of the given weights
+  template <std::floating_point Float>
+  void setWeights(const std::span<const Float> weights);
+
+  //! Return the number of the indices
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+ private:
+  /*!
+    \brief A bin of the table
+    */
+  struct Bin
+  {
+    ValueT threshold_; //!< The fixed point probability of the bin itself
+    ValueT alias_;
+  };
+
+
+  //! Return the index of the given 64bit random number
+  auto select(const uint64b bits) const noexcept -> ValueT;
+
+
+  std::pmr::vector<Bin> table_;
+  std::pmr::vector<double> probability_list_;
+};
+
+} // namespace zisc
+
+#include "alias_table-inl.hpp"
+
+#endif // ZISC_ALIAS_TABLE_HPP
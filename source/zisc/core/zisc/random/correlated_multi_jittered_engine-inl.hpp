@@ -18,11 +18,12 @@
 #include "correlated_multi_jittered_engine.hpp"
 // Standard C++ library
 #include <array>
-#include <bit>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 // Zisc
+#include "dynamic_correlated_multi_jittered_engine.hpp"
 #include "zisc/algorithm.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
@@ -44,7 +45,7 @@ auto CorrelatedMultiJitteredEngine<kRootN>::generate1d(
   constexpr ValueT n = getPeriod();
 
   // Generate a random
-  const ValueT u = hashInteger(s, p * 0x967a889b);
+  const ValueT u = DynamicEngineT::hashInteger(s, p * 0x967a889b);
   Float x = mapTo01<Float>(u);
 
   // Random jitter
@@ -55,6 +56,38 @@ auto CorrelatedMultiJitteredEngine<kRootN>::generate1d(
   return x;
 }
 
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] p No description.
+  \param [out] out No description.
+  */
+template <uint32b kRootN> template <std::floating_point Float> inline
+void CorrelatedMultiJitteredEngine<kRootN>::generate1d(
+    const ValueT first,
+    const ValueT p,
+    const std::span<Float> out) noexcept
+{
+  kDynamicEngine.generate1d(first, p, out);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] patterns No description.
+  \param [out] out No description.
+  */
+template <uint32b kRootN> template <std::floating_point Float> inline
+void CorrelatedMultiJitteredEngine<kRootN>::generate1d(
+    const std::span<const ValueT> patterns,
+    const std::span<Float> out) noexcept
+{
+  kDynamicEngine.generate1d(patterns, out);
+}
+
 /*!
   \details No detailed description
 
@@ -72,8 +105,8 @@ auto CorrelatedMultiJitteredEngine<kRootN>::generate2d(
 
   // Generate randoms
   s = permute<n>(s, p * 0x51633e2d);
-  const ValueT u1 = hashInteger(s, p * 0x967a889b);
-  const ValueT u2 = hashInteger(s, p * 0x368cc8b7);
+  const ValueT u1 = DynamicEngineT::hashInteger(s, p * 0x967a889b);
+  const ValueT u2 = DynamicEngineT::hashInteger(s, p * 0x368cc8b7);
   Float x = mapTo01<Float>(u1);
   Float y = mapTo01<Float>(u2);
 
@@ -93,73 +126,62 @@ auto CorrelatedMultiJitteredEngine<kRootN>::generate2d(
 /*!
   \details No detailed description
 
-  \return No description
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] p No description.
+  \param [out] out No description.
   */
-template <uint32b kRootN> inline
-constexpr auto CorrelatedMultiJitteredEngine<kRootN>::getPeriod() noexcept -> std::size_t
+template <uint32b kRootN> template <std::floating_point Float> inline
+void CorrelatedMultiJitteredEngine<kRootN>::generate2d(
+    const ValueT first,
+    const ValueT p,
+    const std::span<std::array<Float, 2>> out) noexcept
 {
-  constexpr auto period = static_cast<std::size_t>(kRootN * kRootN);
-  return period;
+  kDynamicEngine.generate2d(first, p, out);
 }
 
 /*!
   \details No detailed description
 
-  \tparam Integer No description.
-  \param [in] sample No description.
-  \return No description
+  \tparam Float No description.
+  \param [in] patterns No description.
+  \param [out] out No description.
   */
-template <uint32b kRootN> template <std::unsigned_integral Integer> inline
-constexpr auto CorrelatedMultiJitteredEngine<kRootN>::isEndOfPeriod(
-    const Integer sample) noexcept -> bool
+template <uint32b kRootN> template <std::floating_point Float> inline
+void CorrelatedMultiJitteredEngine<kRootN>::generate2d(
+    const std::span<const ValueT> patterns,
+    const std::span<std::array<Float, 2>> out) noexcept
 {
-  constexpr Integer umax = (std::numeric_limits<Integer>::max)();
-  constexpr Integer end_of_period = (umax < getPeriod()) ? umax : getPeriod() - 1;
-  const bool is_end_of_period = sample == end_of_period;
-  return is_end_of_period;
+  kDynamicEngine.generate2d(patterns, out);
 }
 
 /*!
   \details No detailed description
 
-  \param [in] i No description.
-  \param [in] p No description.
   \return No description
   */
 template <uint32b kRootN> inline
-auto CorrelatedMultiJitteredEngine<kRootN>::hashInteger(
-    ValueT i,
-    const ValueT p) noexcept -> ValueT
+constexpr auto CorrelatedMultiJitteredEngine<kRootN>::getPeriod() noexcept -> std::size_t
 {
-  i ^= p;
-  i ^= i >> 17;
-  i ^= i >> 10;
-  i *= 0xb36534e5;
-  i ^= i >> 12;
-  i ^= i >> 21;
-  i *= 0x93fc4795;
-  i ^= 0xdf6e307f;
-  i ^= i >> 17;
-  i *= 1 | p >> 18;
-  return i;
+  constexpr auto period = static_cast<std::size_t>(kRootN * kRootN);
+  return period;
 }
 
 /*!
   \details No detailed description
 
-  \param [in] w No description.
+  \tparam Integer No description.
+  \param [in] sample No description.
   \return No description
   */
-template <uint32b kRootN> inline
-constexpr auto CorrelatedMultiJitteredEngine<kRootN>::makeWMask(ValueT w) noexcept
-    -> ValueT
+template <uint32b kRootN> template <std::unsigned_integral Integer> inline
+constexpr auto CorrelatedMultiJitteredEngine<kRootN>::isEndOfPeriod(
+    const Integer sample) noexcept -> bool
 {
-  w |= w >> 1;
-  w |= w >> 2;
-  w |= w >> 4;
-  w |= w >> 8;
-  w |= w >> 16;
-  return w;
+  constexpr Integer umax = (std::numeric_limits<Integer>::max)();
+  constexpr Integer end_of_period = (umax < getPeriod()) ? umax : getPeriod() - 1;
+  const bool is_end_of_period = sample == end_of_period;
+  return is_end_of_period;
 }
 
 /*!
@@ -175,55 +197,8 @@ auto CorrelatedMultiJitteredEngine<kRootN>::permute(
     ValueT i,
     const ValueT p) noexcept -> ValueT
 {
-  constexpr bool is_power_of_2 = (1 < l) && std::has_single_bit(l);
-  constexpr ValueT w = makeWMask(l - 1);
-  if (is_power_of_2) {
-    // fast case
-    i = permuteImpl<w>(i, p);
-    i = (i + p) & w;
-  }
-  else {
-    // slow case
-    do {
-      i = permuteImpl<w>(i, p);
-    } while (l <= i);
-    i = (i + p) % l;
-  }
-  return i;
-}
-
-/*!
-  \details No detailed description
-
-  \tparam w No description.
-  \param [in] i No description.
-  \param [in] p No description.
-  \return No description
-  */
-template <uint32b kRootN> template <uint32b w> inline
-auto CorrelatedMultiJitteredEngine<kRootN>::permuteImpl(
-    ValueT i,
-    const ValueT p) noexcept -> ValueT
-{
-  i ^= p;
-  i *= 0xe170893d;
-  i ^= p >> 16;
-  i ^= (i & w) >> 4;
-  i ^= p >> 8;
-  i *= 0x0929eb3f;
-  i ^= p >> 23;
-  i ^= (i & w) >> 1;
-  i *= 1 | p >> 27;
-  i *= 0x6935fa69;
-  i ^= (i & w) >> 11;
-  i *= 0x74dcb303;
-  i ^= (i & w) >> 2;
-  i *= 0x9e501cc3;
-  i ^= (i & w) >> 2;
-  i *= 0xc860a3df;
-  i &= w;
-  i ^= i >> 5;
-  return i;
+  constexpr ValueT w = DynamicEngineT::makeWMask(l - 1);
+  return DynamicEngineT::permute(i, p, l, w);
 }
 
 } // namespace zisc
@@ -20,7 +20,9 @@
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 // Zisc
+#include "dynamic_correlated_multi_jittered_engine.hpp"
 #include "zisc/zisc_config.hpp"
 
 namespace zisc {
@@ -28,6 +30,9 @@ namespace zisc {
 /*!
   \brief Correlated Multi-Jittered Sampler
 
+  The batch functions generate samples in the same way as
+  DynamicCorrelatedMultiJitteredEngine, of which the constants are
+  evaluated at compile time.
   For more detail, please see the following paper:
   <a href="https://graphics.pixar.com/library/MultiJitteredSampling/">Correlated Multi-Jittered Sampling</a>.
 
@@ -44,10 +49,32 @@ class CorrelatedMultiJitteredEngine
   template <std::floating_point Float>
   static auto generate1d(const ValueT s, const ValueT p) noexcept -> Float;
 
+  //! Generate [0, 1) float random numbers of the successive samples from the given sample
+  template <std::floating_point Float>
+  static void generate1d(const ValueT first,
+                         const ValueT p,
+                         const std::span<Float> out) noexcept;
+
+  //! Generate all N [0, 1) float random numbers of each pattern
+  template <std::floating_point Float>
+  static void generate1d(const std::span<const ValueT> patterns,
+                         const std::span<Float> out) noexcept;
+
   //! Generate two [0, 1) float random numbers
   template <std::floating_point Float>
   static auto generate2d(ValueT s, const ValueT p) noexcept -> std::array<Float, 2>;
 
+  //! Generate 2d [0, 1) float random numbers of the successive samples from the given sample
+  template <std::floating_point Float>
+  static void generate2d(const ValueT first,
+                         const ValueT p,
+                         const std::span<std::array<Float, 2>> out) noexcept;
+
+  //! Generate all N 2d [0, 1) float random numbers of each pattern
+  template <std::floating_point Float>
+  static void generate2d(const std::span<const ValueT> patterns,
+                         const std::span<std::array<Float, 2>> out) noexcept;
+
   //! Return the period
   static constexpr auto getPeriod() noexcept -> std::size_t;
 
@@ -56,19 +83,15 @@ class CorrelatedMultiJitteredEngine
   static constexpr auto isEndOfPeriod(const Integer sample) noexcept -> bool;
 
  private:
-  //! Hash the i value
-  static auto hashInteger(ValueT i, const ValueT p) noexcept -> ValueT;
+  using DynamicEngineT = DynamicCorrelatedMultiJitteredEngine;
 
-  //! Make a w mask
-  static constexpr auto makeWMask(const ValueT w) noexcept -> ValueT;
 
-  //!
+  //! Permute the index of [0, l)
   template <uint32b l>
   static auto permute(ValueT i, const ValueT p) noexcept -> ValueT;
 
-  //! The implementation of permutation
-  template <uint32b w>
-  static auto permuteImpl(ValueT i, const ValueT p) noexcept -> ValueT;
+
+  static constexpr DynamicEngineT kDynamicEngine{kRootN}; //!< The engine of the batch functions
 };
 
 // Type aliases
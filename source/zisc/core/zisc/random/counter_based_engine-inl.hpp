@@ -0,0 +1,283 @@
+/*!
+  \file counter_based_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_COUNTER_BASED_ENGINE_INL_HPP
+#define ZISC_COUNTER_BASED_ENGINE_INL_HPP
+
+#include "counter_based_engine.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+// Zisc
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] key No description.
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::CounterBasedEngine(
+    const KeyT& key) noexcept :
+    key_{key}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] counter No description.
+  \return No description
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+auto CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::operator()(
+    const CounterT& counter) const noexcept -> CounterT
+{
+  const CounterT result = generate(counter);
+  return result;
+}
+
+/*!
+  \details The counter is treated as a little endian multi-word integer
+
+  \param [in] counter No description.
+  \param [in] n No description.
+  \return No description
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+constexpr auto CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::advanceCounter(
+    CounterT counter,
+    const uint64b n) noexcept -> CounterT
+{
+  constexpr std::size_t bit_size = std::numeric_limits<ValueT>::digits;
+  uint64b carry = n;
+  for (std::size_t i = 0; (i < counter.size()) && (carry != 0); ++i) {
+    if constexpr (bit_size == 64) {
+      counter[i] += carry;
+      carry = (counter[i] < carry) ? 1 : 0;
+    }
+    else {
+      constexpr uint64b mask = (uint64b{1} << bit_size) - 1;
+      const uint64b sum = uint64b{counter[i]} + (carry & mask);
+      counter[i] = cast<ValueT>(sum);
+      carry = (carry >> bit_size) + (sum >> bit_size);
+    }
+  }
+  return counter;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+constexpr auto CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::counterSize() noexcept
+    -> std::size_t
+{
+  return kCounterSize;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] counter No description.
+  \return No description
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+auto CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::generate(
+    const CounterT& counter) const noexcept -> CounterT
+{
+  const CounterT result = GeneratorT::generateBlock(key_, counter);
+  return result;
+}
+
+/*!
+  \details out[i * s + j] is the j-th random number of the counter (first + i),
+  where s is the counter size. If the size of out isn't a multiple of s,
+  the random numbers of the last counter are truncated.
+  The generator processes several counters at once if it provides generateBlocks()
+
+  \param [in] first No description.
+  \param [out] out No description.
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+void CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::generate(
+    const CounterT& first,
+    const std::span<ValueT> out) const noexcept
+{
+  const std::size_t num_of_blocks = out.size() / kCounterSize;
+  std::size_t i = 0;
+  if constexpr (requires { GeneratorT::generateBlocks(key_, first, out); })
+    i = GeneratorT::generateBlocks(key_, first, out.first(num_of_blocks * kCounterSize));
+  CounterT counter = advanceCounter(first, i);
+  for (; i < num_of_blocks; ++i) {
+    const CounterT result = generate(counter);
+    std::copy_n(result.begin(), kCounterSize, out.begin() + i * kCounterSize);
+    counter = advanceCounter(counter, 1);
+  }
+  // The rest
+  if (const std::size_t rest = out.size() - num_of_blocks * kCounterSize; 0 < rest) {
+    const CounterT result = generate(counter);
+    std::copy_n(result.begin(), rest, out.begin() + num_of_blocks * kCounterSize);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] counter No description.
+  \return No description
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize>
+template <std::floating_point Float> inline
+auto CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::generate01(
+    const CounterT& counter) const noexcept -> std::array<Float, kCounterSize>
+{
+  const CounterT x = generate(counter);
+  std::array<Float, kCounterSize> y{};
+  for (std::size_t i = 0; i < kCounterSize; ++i)
+    y[i] = mapTo01<Float>(x[i]);
+  return y;
+}
+
+/*!
+  \details The layout of out is the same as generate(first, out)
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [out] out No description.
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize>
+template <std::floating_point Float> inline
+void CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::generate01(
+    const CounterT& first,
+    const std::span<Float> out) const noexcept
+{
+  // Integer random numbers are generated in chunks and mapped to floats
+  constexpr std::size_t num_of_blocks = 64;
+  constexpr std::size_t chunk_size = num_of_blocks * kCounterSize;
+  std::array<ValueT, chunk_size> chunk;
+  CounterT counter = first;
+  for (std::size_t i = 0; i < out.size(); i += chunk_size) {
+    const std::size_t n = (std::min)(chunk_size, out.size() - i);
+    generate(counter, std::span{chunk.data(), n});
+    for (std::size_t j = 0; j < n; ++j)
+      out[i + j] = mapTo01<Float>(chunk[j]);
+    counter = advanceCounter(counter, num_of_blocks);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+auto CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::key() const noexcept
+    -> const KeyT&
+{
+  return key_;
+}
+
+/*!
+  \details The index is set to the lower 64 bits of the counter and
+  the stream is set to the next 64 bits
+
+  \param [in] index No description.
+  \param [in] stream No description.
+  \return No description
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+constexpr auto CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::makeCounter(
+    const uint64b index,
+    const uint64b stream) noexcept -> CounterT
+{
+  CounterT counter{};
+  constexpr std::size_t words_per_u64 = sizeof(uint64b) / sizeof(ValueT);
+  setWords(index, 0, counter);
+  setWords(stream, words_per_u64, counter);
+  return counter;
+}
+
+/*!
+  \details The seed is set to the lower 64 bits of the key
+
+  \param [in] seed No description.
+  \return No description
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+constexpr auto CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::makeKey(
+    const uint64b seed) noexcept -> KeyT
+{
+  KeyT key{};
+  setWords(seed, 0, key);
+  return key;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] key No description.
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+void CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::setKey(
+    const KeyT& key) noexcept
+{
+  key_ = key;
+}
+
+/*!
+  \details The words which are out of range are ignored
+
+  \param [in] value No description.
+  \param [in] position No description.
+  \param [out] words No description.
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize> inline
+constexpr void CounterBasedEngine<GeneratorClass, T, kCounterSize, kKeySize>::setWords(
+    const uint64b value,
+    const std::size_t position,
+    const std::span<ValueT> words) noexcept
+{
+  constexpr std::size_t bit_size = std::numeric_limits<ValueT>::digits;
+  constexpr std::size_t words_per_u64 = sizeof(uint64b) / sizeof(ValueT);
+  for (std::size_t i = 0; (i < words_per_u64) && ((position + i) < words.size()); ++i)
+    words[position + i] = cast<ValueT>(value >> (i * bit_size));
+}
+
+} // namespace zisc
+
+#endif // ZISC_COUNTER_BASED_ENGINE_INL_HPP
@@ -0,0 +1,123 @@
+/*!
+  \file counter_based_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_COUNTER_BASED_ENGINE_HPP
+#define ZISC_COUNTER_BASED_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Base class of counter-based random number algorithm
+
+  A counter-based engine computes random numbers as a function of
+  a key and a counter, so it has no state to update.
+  Any iteration of a parallel loop can generate its random numbers
+  from its index without sharing anything,
+  and the results don't depend on the scheduling.
+  For more detail, please see the following paper:
+  <a href="https://doi.org/10.1145/2063384.2063405">Parallel random numbers: as easy as 1, 2, 3</a>.
+
+  \tparam GeneratorClass No description.
+  \tparam T No description.
+  \tparam kCounterSize The number of words of a counter and a result.
+  \tparam kKeySize The number of words of a key.
+  \note No notation.
+  \attention No attention.
+  */
+template <typename GeneratorClass, std::unsigned_integral T,
+          std::size_t kCounterSize, std::size_t kKeySize>
+class CounterBasedEngine
+{
+ public:
+  using GeneratorT = GeneratorClass;
+  using ValueT = T;
+  using CounterT = std::array<ValueT, kCounterSize>;
+  using KeyT = std::array<ValueT, kKeySize>;
+
+
+  // Delete function
+  auto operator=(const CounterBasedEngine&) -> CounterBasedEngine& = delete;
+
+
+  //! Generate random numbers of the given counter
+  auto operator()(const CounterT& counter) const noexcept -> CounterT;
+
+
+  //! Return the counter advanced by the given steps
+  static constexpr auto advanceCounter(CounterT counter, const uint64b n) noexcept
+      -> CounterT;
+
+  //! Return the number of random numbers per counter
+  static constexpr auto counterSize() noexcept -> std::size_t;
+
+  //! Generate random numbers of the given counter
+  auto generate(const CounterT& counter) const noexcept -> CounterT;
+
+  //! Generate random numbers of the successive counters from the given counter
+  void generate(const CounterT& first, const std::span<ValueT> out) const noexcept;
+
+  //! Generate [0, 1) float random numbers of the given counter
+  template <std::floating_point Float>
+  auto generate01(const CounterT& counter) const noexcept -> std::array<Float, kCounterSize>;
+
+  //! Generate [0, 1) float random numbers of the successive counters from the given counter
+  template <std::floating_point Float>
+  void generate01(const CounterT& first, const std::span<Float> out) const noexcept;
+
+  //! Return the key
+  auto key() const noexcept -> const KeyT&;
+
+  //! Return the counter of the given index and stream
+  static constexpr auto makeCounter(const uint64b index, const uint64b stream = 0) noexcept
+      -> CounterT;
+
+  //! Return the key of the given seed
+  static constexpr auto makeKey(const uint64b seed) noexcept -> KeyT;
+
+  //! Set a key
+  void setKey(const KeyT& key) noexcept;
+
+ protected:
+  //! Initialize the engine with the zero key
+  CounterBasedEngine() noexcept = default;
+
+  //! Initialize the engine with the given key
+  explicit CounterBasedEngine(const KeyT& key) noexcept;
+
+  //! Copy an engine
+  CounterBasedEngine(const CounterBasedEngine&) noexcept = default;
+
+ private:
+  //! Set the given 64bit value to the words from the given position
+  static constexpr void setWords(const uint64b value,
+                                 const std::size_t position,
+                                 const std::span<ValueT> words) noexcept;
+
+
+  KeyT key_{};
+};
+
+} // namespace zisc
+
+#include "counter_based_engine-inl.hpp"
+
+#endif // ZISC_COUNTER_BASED_ENGINE_HPP
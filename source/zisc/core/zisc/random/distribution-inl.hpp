@@ -0,0 +1,119 @@
+/*!
+  \file distribution-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_DISTRIBUTION_INL_HPP
+#define ZISC_DISTRIBUTION_INL_HPP
+
+#include "distribution.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+// Zisc
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details The result is the same sequence as calling generateBits64() repeatedly
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [out] out No description.
+  */
+template <RandomNumberEngine Engine> inline
+void Distribution::fillBits64(Engine& engine, const std::span<uint64b> out) noexcept
+{
+  using ValueT = typename Engine::ValueT;
+  if constexpr (sizeof(ValueT) == sizeof(uint64b)) {
+    engine.fill(out);
+  }
+  else {
+    // The random numbers are combined from the upper bits
+    constexpr std::size_t k = sizeof(uint64b) / sizeof(ValueT);
+    constexpr std::size_t shift = std::numeric_limits<ValueT>::digits;
+    std::array<ValueT, k * kChunkSize> chunk;
+    for (std::size_t i = 0; i < out.size(); i += kChunkSize) {
+      const std::size_t n = (std::min)(kChunkSize, out.size() - i);
+      engine.fill(std::span{chunk.data(), k * n});
+      for (std::size_t j = 0; j < n; ++j) {
+        uint64b bits = 0;
+        for (std::size_t l = 0; l < k; ++l)
+          bits = (bits << shift) | chunk[k * j + l];
+        out[i + j] = bits;
+      }
+    }
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::floating_point Float, RandomNumberEngine Engine> inline
+auto Distribution::generate01(Engine& engine) noexcept -> Float
+{
+  return mapTo01<Float>(generateBits64(engine));
+}
+
+/*!
+  \details The random numbers of the engine are combined from the upper bits
+  if the engine generates less than 64bit
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <RandomNumberEngine Engine> inline
+auto Distribution::generateBits64(Engine& engine) noexcept -> uint64b
+{
+  using ValueT = typename Engine::ValueT;
+  uint64b bits = 0;
+  if constexpr (sizeof(ValueT) == sizeof(uint64b)) {
+    bits = engine();
+  }
+  else {
+    constexpr std::size_t k = sizeof(uint64b) / sizeof(ValueT);
+    constexpr std::size_t shift = std::numeric_limits<ValueT>::digits;
+    for (std::size_t l = 0; l < k; ++l)
+      bits = (bits << shift) | engine();
+  }
+  return bits;
+}
+
+/*!
+  \details The result can be passed to log() safely
+
+  \tparam Float No description.
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::floating_point Float, RandomNumberEngine Engine> inline
+auto Distribution::generateOpen01(Engine& engine) noexcept -> Float
+{
+  return cast<Float>(1) - generate01<Float>(engine);
+}
+
+} // namespace zisc
+
+#endif // ZISC_DISTRIBUTION_INL_HPP
@@ -0,0 +1,74 @@
+/*!
+  \file distribution.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_DISTRIBUTION_HPP
+#define ZISC_DISTRIBUTION_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+//! Specify a type is a pseudo random number engine of zisc
+template <typename Type>
+concept RandomNumberEngine =
+    std::unsigned_integral<typename Type::ValueT> &&
+    requires(Type& engine, const std::span<typename Type::ValueT> out) {
+      {engine()} -> std::same_as<typename Type::ValueT>;
+      engine.fill(out);
+    };
+
+/*!
+  \brief Random sources shared by the distributions
+
+  The distributions consume 64bit random numbers.
+  The random numbers of an engine are combined if it generates less than 64bit,
+  so any engine of zisc can be used with them.
+
+  \note No notation.
+  \attention No attention.
+  */
+class Distribution
+{
+ public:
+  //! The number of the random numbers generated at once in the batch sampling
+  static constexpr std::size_t kChunkSize = 64;
+
+
+  //! Fill the given span with 64bit random numbers
+  template <RandomNumberEngine Engine>
+  static void fillBits64(Engine& engine, const std::span<uint64b> out) noexcept;
+
+  //! Generate a [0, 1) float random number
+  template <std::floating_point Float, RandomNumberEngine Engine>
+  static auto generate01(Engine& engine) noexcept -> Float;
+
+  //! Generate a 64bit random number
+  template <RandomNumberEngine Engine>
+  static auto generateBits64(Engine& engine) noexcept -> uint64b;
+
+  //! Generate a (0, 1] float random number
+  template <std::floating_point Float, RandomNumberEngine Engine>
+  static auto generateOpen01(Engine& engine) noexcept -> Float;
+};
+
+} // namespace zisc
+
+#include "distribution-inl.hpp"
+
+#endif // ZISC_DISTRIBUTION_HPP
@@ -0,0 +1,450 @@
+/*!
+  \file dynamic_correlated_multi_jittered_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_DYNAMIC_CORRELATED_MULTI_JITTERED_ENGINE_INL_HPP
+#define ZISC_DYNAMIC_CORRELATED_MULTI_JITTERED_ENGINE_INL_HPP
+
+#include "dynamic_correlated_multi_jittered_engine.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+// Zisc
+#include "zisc/algorithm.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] root_n No description.
+  */
+inline
+constexpr DynamicCorrelatedMultiJitteredEngine::DynamicCorrelatedMultiJitteredEngine(
+    const ValueT root_n) noexcept :
+        root_n_{root_n},
+        period_{root_n * root_n}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] s No description.
+  \param [in] p No description.
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto DynamicCorrelatedMultiJitteredEngine::generate1d(
+    const ValueT s,
+    const ValueT p) const noexcept -> Float
+{
+  const ValueT n = period_.d_;
+
+  // Generate a random
+  const ValueT u = hashInteger(s, p * 0x967a889b);
+  Float x = mapTo01<Float>(u);
+
+  // Random jitter
+  const Float inv_n = invert(cast<Float>(n));
+  const ValueT sx = permute(s, p * 0x68bc21eb, n, period_.w_);
+  x = inv_n * (cast<Float>(sx) + x);
+
+  return x;
+}
+
+/*!
+  \details The samples from first to first + out.size() - 1 must be in the period
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] p No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float> inline
+void DynamicCorrelatedMultiJitteredEngine::generate1d(
+    const ValueT first,
+    const ValueT p,
+    const std::span<Float> out) const noexcept
+{
+  ZISC_ASSERT(cast<std::size_t>(first) + out.size() <= getPeriod(),
+              "The samples are out of the period.");
+  const Float inv_n = invert(cast<Float>(period_.d_));
+  ChunkT s;
+  ChunkT sx;
+  for (std::size_t i = 0; i < out.size(); i += kChunkSize) {
+    const std::size_t m = (std::min)(kChunkSize, out.size() - i);
+    // The rest of the last chunk is filled with the first sample of the chunk,
+    // since the cycle walking of a sample out of the period may not end
+    for (std::size_t j = 0; j < kChunkSize; ++j) {
+      s[j] = first + cast<ValueT>(i + ((j < m) ? j : 0));
+      sx[j] = s[j];
+    }
+    permuteChunk(sx, p * 0x68bc21eb, period_);
+    for (std::size_t j = 0; j < m; ++j) {
+      const ValueT u = hashInteger(s[j], p * 0x967a889b);
+      out[i + j] = inv_n * (cast<Float>(sx[j]) + mapTo01<Float>(u));
+    }
+  }
+}
+
+/*!
+  \details The size of the output must be the number of the patterns times N
+
+  \tparam Float No description.
+  \param [in] patterns No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float> inline
+void DynamicCorrelatedMultiJitteredEngine::generate1d(
+    const std::span<const ValueT> patterns,
+    const std::span<Float> out) const noexcept
+{
+  const std::size_t n = getPeriod();
+  ZISC_ASSERT(out.size() == patterns.size() * n, "The output size is wrong.");
+  for (std::size_t k = 0; k < patterns.size(); ++k)
+    generate1d(0, patterns[k], out.subspan(k * n, n));
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] s No description.
+  \param [in] p No description.
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto DynamicCorrelatedMultiJitteredEngine::generate2d(
+    ValueT s,
+    const ValueT p) const noexcept -> std::array<Float, 2>
+{
+  const ValueT root_n = root_n_.d_;
+  const ValueT n = period_.d_;
+
+  // Generate randoms
+  s = permute(s, p * 0x51633e2d, n, period_.w_);
+  const ValueT u1 = hashInteger(s, p * 0x967a889b);
+  const ValueT u2 = hashInteger(s, p * 0x368cc8b7);
+  Float x = mapTo01<Float>(u1);
+  Float y = mapTo01<Float>(u2);
+
+  // Random jitter
+  const Float inv_n = invert(cast<Float>(n));
+  const Float inv_root_n = invert(cast<Float>(root_n));
+  const ValueT s_div = divide(s, root_n_);
+  const ValueT s_mod = s - s_div * root_n;
+  const ValueT sx = permute(s_mod, p * 0x68bc21eb, root_n, root_n_.w_);
+  const ValueT sy = permute(s_div, p * 0x02e5be93, root_n, root_n_.w_);
+  x = inv_root_n * (cast<Float>(sx) + inv_root_n * (cast<Float>(sy) + x));
+  y = inv_n * (cast<Float>(s) + y);
+
+  return std::array<Float, 2>{{x, y}};
+}
+
+/*!
+  \details The samples from first to first + out.size() - 1 must be in the period
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] p No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float> inline
+void DynamicCorrelatedMultiJitteredEngine::generate2d(
+    const ValueT first,
+    const ValueT p,
+    const std::span<std::array<Float, 2>> out) const noexcept
+{
+  ZISC_ASSERT(cast<std::size_t>(first) + out.size() <= getPeriod(),
+              "The samples are out of the period.");
+  const Float inv_n = invert(cast<Float>(period_.d_));
+  const Float inv_root_n = invert(cast<Float>(root_n_.d_));
+  ChunkT s;
+  ChunkT sx;
+  ChunkT sy;
+  for (std::size_t i = 0; i < out.size(); i += kChunkSize) {
+    const std::size_t m = (std::min)(kChunkSize, out.size() - i);
+    // The rest of the last chunk is filled with the first sample of the chunk,
+    // since the cycle walking of a sample out of the period may not end
+    for (std::size_t j = 0; j < kChunkSize; ++j)
+      s[j] = first + cast<ValueT>(i + ((j < m) ? j : 0));
+    permuteChunk(s, p * 0x51633e2d, period_);
+    for (std::size_t j = 0; j < kChunkSize; ++j) {
+      sy[j] = divide(s[j], root_n_);
+      sx[j] = s[j] - sy[j] * root_n_.d_;
+    }
+    permuteChunk(sx, p * 0x68bc21eb, root_n_);
+    permuteChunk(sy, p * 0x02e5be93, root_n_);
+    for (std::size_t j = 0; j < m; ++j) {
+      const ValueT u1 = hashInteger(s[j], p * 0x967a889b);
+      const ValueT u2 = hashInteger(s[j], p * 0x368cc8b7);
+      const Float x = mapTo01<Float>(u1);
+      const Float y = mapTo01<Float>(u2);
+      out[i + j][0] = inv_root_n * (cast<Float>(sx[j]) + inv_root_n * (cast<Float>(sy[j]) + x));
+      out[i + j][1] = inv_n * (cast<Float>(s[j]) + y);
+    }
+  }
+}
+
+/*!
+  \details The size of the output must be the number of the patterns times N
+
+  \tparam Float No description.
+  \param [in] patterns No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float> inline
+void DynamicCorrelatedMultiJitteredEngine::generate2d(
+    const std::span<const ValueT> patterns,
+    const std::span<std::array<Float, 2>> out) const noexcept
+{
+  const std::size_t n = getPeriod();
+  ZISC_ASSERT(out.size() == patterns.size() * n, "The output size is wrong.");
+  for (std::size_t k = 0; k < patterns.size(); ++k)
+    generate2d(0, patterns[k], out.subspan(k * n, n));
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr auto DynamicCorrelatedMultiJitteredEngine::getPeriod() const noexcept
+    -> std::size_t
+{
+  return cast<std::size_t>(period_.d_);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] i No description.
+  \param [in] p No description.
+  \return No description
+  */
+inline
+constexpr auto DynamicCorrelatedMultiJitteredEngine::hashInteger(
+    ValueT i,
+    const ValueT p) noexcept -> ValueT
+{
+  i ^= p;
+  i ^= i >> 17;
+  i ^= i >> 10;
+  i *= 0xb36534e5;
+  i ^= i >> 12;
+  i ^= i >> 21;
+  i *= 0x93fc4795;
+  i ^= 0xdf6e307f;
+  i ^= i >> 17;
+  i *= 1 | p >> 18;
+  return i;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Integer No description.
+  \param [in] sample No description.
+  \return No description
+  */
+template <std::unsigned_integral Integer> inline
+constexpr auto DynamicCorrelatedMultiJitteredEngine::isEndOfPeriod(
+    const Integer sample) const noexcept -> bool
+{
+  constexpr Integer umax = (std::numeric_limits<Integer>::max)();
+  const Integer end_of_period = (umax < getPeriod()) ? umax : cast<Integer>(getPeriod() - 1);
+  const bool is_end_of_period = sample == end_of_period;
+  return is_end_of_period;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] w No description.
+  \return No description
+  */
+inline
+constexpr auto DynamicCorrelatedMultiJitteredEngine::makeWMask(ValueT w) noexcept
+    -> ValueT
+{
+  w |= w >> 1;
+  w |= w >> 2;
+  w |= w >> 4;
+  w |= w >> 8;
+  w |= w >> 16;
+  return w;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] i No description.
+  \param [in] p No description.
+  \param [in] l No description.
+  \param [in] w No description.
+  \return No description
+  */
+inline
+constexpr auto DynamicCorrelatedMultiJitteredEngine::permute(
+    ValueT i,
+    const ValueT p,
+    const ValueT l,
+    const ValueT w) noexcept -> ValueT
+{
+  const bool is_power_of_2 = (1 < l) && std::has_single_bit(l);
+  if (is_power_of_2) {
+    // fast case
+    i = permuteImpl(i, p, w);
+    i = (i + p) & w;
+  }
+  else {
+    // slow case
+    do {
+      i = permuteImpl(i, p, w);
+    } while (l <= i);
+    i = (i + p) % l;
+  }
+  return i;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr auto DynamicCorrelatedMultiJitteredEngine::rootN() const noexcept -> ValueT
+{
+  return root_n_.d_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] d No description.
+  */
+inline
+constexpr DynamicCorrelatedMultiJitteredEngine::Divisor::Divisor(const ValueT d) noexcept :
+    d_{d},
+    w_{makeWMask(d - 1)},
+    magic_{cast<ValueT>((std::numeric_limits<ValueT>::max)() / d + 1)},
+    is_power_of_2_{(1 < d) && std::has_single_bit(d)}
+{
+}
+
+/*!
+  \details The estimate by the rounded up reciprocal is the quotient or
+  the quotient plus one for any 32bit value, so it's corrected once.
+  Only multiplications of 32bit values into 64bit are used,
+  which are vectorized
+
+  \param [in] x No description.
+  \param [in] d No description.
+  \return No description
+  */
+inline
+constexpr auto DynamicCorrelatedMultiJitteredEngine::divide(const ValueT x,
+                                                            const Divisor& d) noexcept
+    -> ValueT
+{
+  ValueT q = cast<ValueT>((cast<uint64b>(x) * d.magic_) >> 32);
+  q -= cast<ValueT>(cast<uint64b>(x) < cast<uint64b>(q) * d.d_);
+  // The magic number of one doesn't fit in 32bit
+  return (d.d_ == 1) ? x : q;
+}
+
+/*!
+  \details The cycle walking of a non power of 2 length is done by
+  a branch-free pass over the chunk first.
+  The rest, which is a small fraction, is retried one by one
+
+  \param [in,out] chunk No description.
+  \param [in] p No description.
+  \param [in] l No description.
+  */
+inline
+void DynamicCorrelatedMultiJitteredEngine::permuteChunk(ChunkT& chunk,
+                                                        const ValueT p,
+                                                        const Divisor& l) noexcept
+{
+  if (l.is_power_of_2_) {
+    for (std::size_t j = 0; j < kChunkSize; ++j)
+      chunk[j] = (permuteImpl(chunk[j], p, l.w_) + p) & l.w_;
+    return;
+  }
+
+  for (std::size_t j = 0; j < kChunkSize; ++j)
+    chunk[j] = permuteImpl(chunk[j], p, l.w_);
+  for (std::size_t j = 0; j < kChunkSize; ++j) {
+    const ValueT i = permuteImpl(chunk[j], p, l.w_);
+    chunk[j] = (l.d_ <= chunk[j]) ? i : chunk[j];
+  }
+  for (std::size_t j = 0; j < kChunkSize; ++j) {
+    while (l.d_ <= chunk[j])
+      chunk[j] = permuteImpl(chunk[j], p, l.w_);
+  }
+  for (std::size_t j = 0; j < kChunkSize; ++j) {
+    const ValueT i = chunk[j] + p;
+    chunk[j] = i - divide(i, l) * l.d_;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] i No description.
+  \param [in] p No description.
+  \param [in] w No description.
+  \return No description
+  */
+inline
+constexpr auto DynamicCorrelatedMultiJitteredEngine::permuteImpl(
+    ValueT i,
+    const ValueT p,
+    const ValueT w) noexcept -> ValueT
+{
+  i ^= p;
+  i *= 0xe170893d;
+  i ^= p >> 16;
+  i ^= (i & w) >> 4;
+  i ^= p >> 8;
+  i *= 0x0929eb3f;
+  i ^= p >> 23;
+  i ^= (i & w) >> 1;
+  i *= 1 | p >> 27;
+  i *= 0x6935fa69;
+  i ^= (i & w) >> 11;
+  i *= 0x74dcb303;
+  i ^= (i & w) >> 2;
+  i *= 0x9e501cc3;
+  i ^= (i & w) >> 2;
+  i *= 0xc860a3df;
+  i &= w;
+  i ^= i >> 5;
+  return i;
+}
+
+} // namespace zisc
+
+#endif // ZISC_DYNAMIC_CORRELATED_MULTI_JITTERED_ENGINE_INL_HPP
@@ -0,0 +1,149 @@
+/*!
+  \file dynamic_correlated_multi_jittered_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_DYNAMIC_CORRELATED_MULTI_JITTERED_ENGINE_HPP
+#define ZISC_DYNAMIC_CORRELATED_MULTI_JITTERED_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Correlated Multi-Jittered Sampler of which the number of samples is given at runtime
+
+  The samples are identical to CorrelatedMultiJitteredEngine of the same root N.
+  The masks and the division constants of N and root N are computed
+  in the constructor, so a sample doesn't require any division.
+  The batch functions process samples in chunks of structure-of-arrays,
+  so the permutations and the hashes are vectorized by the compiler.
+  For more detail, please see the following paper:
+  <a href="https://graphics.pixar.com/library/MultiJitteredSampling/">Correlated Multi-Jittered Sampling</a>.
+
+  \note No notation.
+  \attention No attention.
+  */
+class DynamicCorrelatedMultiJitteredEngine
+{
+ public:
+  using ValueT = uint32b;
+
+
+  //! Initialize the sampler with N = root_n * root_n. The root_n must be in [1, 65535]
+  explicit constexpr DynamicCorrelatedMultiJitteredEngine(const ValueT root_n) noexcept;
+
+
+  //! Generate a [0, 1) float random number
+  template <std::floating_point Float>
+  auto generate1d(const ValueT s, const ValueT p) const noexcept -> Float;
+
+  //! Generate [0, 1) float random numbers of the successive samples from the given sample
+  template <std::floating_point Float>
+  void generate1d(const ValueT first,
+                  const ValueT p,
+                  const std::span<Float> out) const noexcept;
+
+  //! Generate all N [0, 1) float random numbers of each pattern
+  template <std::floating_point Float>
+  void generate1d(const std::span<const ValueT> patterns,
+                  const std::span<Float> out) const noexcept;
+
+  //! Generate two [0, 1) float random numbers
+  template <std::floating_point Float>
+  auto generate2d(const ValueT s, const ValueT p) const noexcept -> std::array<Float, 2>;
+
+  //! Generate 2d [0, 1) float random numbers of the successive samples from the given sample
+  template <std::floating_point Float>
+  void generate2d(const ValueT first,
+                  const ValueT p,
+                  const std::span<std::array<Float, 2>> out) const noexcept;
+
+  //! Generate all N 2d [0, 1) float random numbers of each pattern
+  template <std::floating_point Float>
+  void generate2d(const std::span<const ValueT> patterns,
+                  const std::span<std::array<Float, 2>> out) const noexcept;
+
+  //! Return the period
+  constexpr auto getPeriod() const noexcept -> std::size_t;
+
+  //! Hash the i value
+  static constexpr auto hashInteger(ValueT i, const ValueT p) noexcept -> ValueT;
+
+  //! Check if a specified sample (0 base count) is the end of period
+  template <std::unsigned_integral Integer>
+  constexpr auto isEndOfPeriod(const Integer sample) const noexcept -> bool;
+
+  //! Make a w mask
+  static constexpr auto makeWMask(ValueT w) noexcept -> ValueT;
+
+  //! Return the permuted index of [0, l). The w must be the mask of l - 1
+  static constexpr auto permute(ValueT i,
+                                const ValueT p,
+                                const ValueT l,
+                                const ValueT w) noexcept -> ValueT;
+
+  //! Return the root N
+  constexpr auto rootN() const noexcept -> ValueT;
+
+ private:
+  static constexpr std::size_t kChunkSize = 64;
+
+
+  using ChunkT = std::array<ValueT, kChunkSize>;
+
+
+  /*!
+    \brief The precomputed constants of a divisor
+    */
+  struct Divisor
+  {
+    //! Initialize the constants of the given divisor
+    constexpr Divisor(const ValueT d) noexcept;
+
+    ValueT d_; //!< The divisor
+    ValueT w_; //!< The mask of d - 1
+    ValueT magic_; //!< The reciprocal in 32bit fixed point rounded up
+    bool is_power_of_2_;
+    [[maybe_unused]] Padding<3> pad_{};
+  };
+
+
+  //! Return the quotient of the given value without division
+  static constexpr auto divide(const ValueT x, const Divisor& d) noexcept -> ValueT;
+
+  //! Permute the indices of a chunk
+  static void permuteChunk(ChunkT& chunk, const ValueT p, const Divisor& l) noexcept;
+
+  //! The implementation of permutation
+  static constexpr auto permuteImpl(ValueT i, const ValueT p, const ValueT w) noexcept
+      -> ValueT;
+
+
+  Divisor root_n_;
+  Divisor period_;
+};
+
+// Type aliases
+using DynamicCmj = DynamicCorrelatedMultiJitteredEngine;
+
+} // namespace zisc
+
+#include "dynamic_correlated_multi_jittered_engine-inl.hpp"
+
+#endif // ZISC_DYNAMIC_CORRELATED_MULTI_JITTERED_ENGINE_HPP
@@ -0,0 +1,108 @@
+/*!
+  \file exponential_distribution-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_EXPONENTIAL_DISTRIBUTION_INL_HPP
+#define ZISC_EXPONENTIAL_DISTRIBUTION_INL_HPP
+
+#include "exponential_distribution.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "distribution.hpp"
+#include "ziggurat.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] lambda No description.
+  */
+template <std::floating_point Float> inline
+ExponentialDistribution<Float>::ExponentialDistribution(const ValueT lambda) noexcept :
+    lambda_{lambda},
+    inv_lambda_{cast<ValueT>(1) / lambda}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::floating_point Float>
+template <RandomNumberEngine Engine> inline
+auto ExponentialDistribution<Float>::operator()(Engine& engine) const noexcept -> ValueT
+{
+  return generate(engine);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float>
+template <RandomNumberEngine Engine> inline
+void ExponentialDistribution<Float>::fill(Engine& engine,
+                                          const std::span<ValueT> out) const noexcept
+{
+  // The chunk is transformed while it's in the cache
+  for (std::size_t i = 0; i < out.size(); i += Distribution::kChunkSize) {
+    const std::size_t n = (std::min)(Distribution::kChunkSize, out.size() - i);
+    const std::span<ValueT> chunk = out.subspan(i, n);
+    Ziggurat::fillExponential(engine, chunk);
+    for (ValueT& x : chunk)
+      x *= inv_lambda_;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::floating_point Float>
+template <RandomNumberEngine Engine> inline
+auto ExponentialDistribution<Float>::generate(Engine& engine) const noexcept -> ValueT
+{
+  const auto x = cast<ValueT>(Ziggurat::generateExponential(engine));
+  return inv_lambda_ * x;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto ExponentialDistribution<Float>::lambda() const noexcept -> ValueT
+{
+  return lambda_;
+}
+
+} // namespace zisc
+
+#endif // ZISC_EXPONENTIAL_DISTRIBUTION_INL_HPP
@@ -0,0 +1,78 @@
+/*!
+  \file exponential_distribution.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_EXPONENTIAL_DISTRIBUTION_HPP
+#define ZISC_EXPONENTIAL_DISTRIBUTION_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <span>
+// Zisc
+#include "distribution.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Exponential distribution sampled by the Ziggurat method
+
+  Any engine of zisc can be used to generate random numbers.
+  fill() processes random numbers in chunks, so the results differ from
+  calling generate() repeatedly with the same engine.
+
+  \tparam Float No description.
+  \note No notation.
+  \attention No attention.
+  */
+template <std::floating_point Float>
+class ExponentialDistribution
+{
+ public:
+  using ValueT = Float;
+
+
+  //! Initialize the standard exponential distribution
+  ExponentialDistribution() noexcept = default;
+
+  //! Initialize the distribution with the given rate
+  explicit ExponentialDistribution(const ValueT lambda) noexcept;
+
+
+  //! Generate a random number
+  template <RandomNumberEngine Engine>
+  auto operator()(Engine& engine) const noexcept -> ValueT;
+
+
+  //! Fill the given span with random numbers
+  template <RandomNumberEngine Engine>
+  void fill(Engine& engine, const std::span<ValueT> out) const noexcept;
+
+  //! Generate a random number
+  template <RandomNumberEngine Engine>
+  auto generate(Engine& engine) const noexcept -> ValueT;
+
+  //! Return the rate
+  auto lambda() const noexcept -> ValueT;
+
+ private:
+  ValueT lambda_ = cast<ValueT>(1);
+  ValueT inv_lambda_ = cast<ValueT>(1);
+};
+
+} // namespace zisc
+
+#include "exponential_distribution-inl.hpp"
+
+#endif // ZISC_EXPONENTIAL_DISTRIBUTION_HPP
@@ -0,0 +1,410 @@
+/*!
+  \file halton_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_HALTON_ENGINE_INL_HPP
+#define ZISC_HALTON_ENGINE_INL_HPP
+
+#include "halton_engine.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+// Zisc
+#include "owen_scrambler.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] dimension No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto HaltonEngine<kScrambling>::base(const ValueT dimension) noexcept -> ValueT
+{
+  constexpr std::array<uint16b, kMaxDimension> primes = primeList();
+  return cast<ValueT>(primes[dimension]);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] index No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+auto HaltonEngine<kScrambling>::generate1d(const ValueT index,
+                                           const ValueT dimension,
+                                           const ValueT seed) noexcept -> Float
+{
+  ZISC_ASSERT(dimension < maxDimension(), "The dimension is out of range.");
+  return radicalInverse<Float>(index, base(dimension), dimensionSeed(dimension, seed));
+}
+
+/*!
+  \details The digits of the index are incremented with carries,
+  so no division is required except for the first index
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \param [out] out No description.
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+void HaltonEngine<kScrambling>::generate1d(const ValueT first,
+                                           const ValueT dimension,
+                                           const ValueT seed,
+                                           const std::span<Float> out) noexcept
+{
+  ZISC_ASSERT(dimension < maxDimension(), "The dimension is out of range.");
+  const ValueT b = base(dimension);
+  const ValueT s = dimensionSeed(dimension, seed);
+  if (b == 2)
+    generateRadicalInverses2<Float>(first, s, out);
+  else
+    generateRadicalInverses<Float>(first, b, s, out);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] index No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+auto HaltonEngine<kScrambling>::generate2d(const ValueT index,
+                                           const ValueT dimension,
+                                           const ValueT seed) noexcept
+    -> std::array<Float, 2>
+{
+  ZISC_ASSERT(dimension + 1 < maxDimension(), "The dimension is out of range.");
+  const Float x = generate1d<Float>(index, dimension, seed);
+  const Float y = generate1d<Float>(index, dimension + 1, seed);
+  return std::array<Float, 2>{{x, y}};
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \param [out] out No description.
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+void HaltonEngine<kScrambling>::generate2d(const ValueT first,
+                                           const ValueT dimension,
+                                           const ValueT seed,
+                                           const std::span<std::array<Float, 2>> out) noexcept
+{
+  ZISC_ASSERT(dimension + 1 < maxDimension(), "The dimension is out of range.");
+  std::array<Float, kChunkSize> chunk_x{};
+  std::array<Float, kChunkSize> chunk_y{};
+  for (std::size_t i = 0; i < out.size(); i += kChunkSize) {
+    const std::size_t n = (std::min)(kChunkSize, out.size() - i);
+    generate1d<Float>(first + cast<ValueT>(i), dimension, seed, {chunk_x.data(), n});
+    generate1d<Float>(first + cast<ValueT>(i), dimension + 1, seed, {chunk_y.data(), n});
+    for (std::size_t j = 0; j < n; ++j)
+      out[i + j] = {{chunk_x[j], chunk_y[j]}};
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto HaltonEngine<kScrambling>::maxDimension() noexcept -> std::size_t
+{
+  return kMaxDimension;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto HaltonEngine<kScrambling>::dimensionSeed(const ValueT dimension,
+                                                        const ValueT seed) noexcept
+    -> ValueT
+{
+  return OwenScrambler::hash(OwenScrambler::hashCombine(seed, dimension));
+}
+
+/*!
+  \details The results are identical to radicalInverse().
+  The index wraps around to zero after the maximum index
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] b No description.
+  \param [in] s No description.
+  \param [out] out No description.
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+void HaltonEngine<kScrambling>::generateRadicalInverses(const ValueT first,
+                                                        const ValueT b,
+                                                        const ValueT s,
+                                                        const std::span<Float> out) noexcept
+{
+  const std::size_t n = numOfDigits<Float>(b);
+  // The weight of the k-th digit is b^(n - 1 - k)
+  std::array<uint64b, kMaxDigits> weights{};
+  weights[n - 1] = 1;
+  for (std::size_t k = n - 1; 0 < k; --k)
+    weights[k - 1] = weights[k] * b;
+  const uint64b bn = weights[0] * b;
+
+  std::array<ValueT, kMaxDigits> digits{};
+  std::array<ValueT, kMaxDigits> permuted{};
+  uint64b r = 0;
+  auto reset = [b, s, n, &weights, &digits, &permuted, &r](ValueT index) noexcept
+  {
+    r = 0;
+    for (std::size_t k = 0; k < n; ++k) {
+      const ValueT q = index / b;
+      digits[k] = index - q * b;
+      index = q;
+      if constexpr (kScrambling != SequenceScrambling::Owen) {
+        permuted[k] = permuteDigit(digits[k], b, s, cast<ValueT>(k), 0);
+        r += weights[k] * permuted[k];
+      }
+    }
+  };
+
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    const ValueT index = first + cast<ValueT>(i);
+    if ((i == 0) || (index == 0)) {
+      reset(index);
+    }
+    else {
+      // Increment the digits. Only the digits which change are permuted again
+      for (std::size_t k = 0; k < n; ++k) {
+        digits[k] = (digits[k] + 1 == b) ? 0 : digits[k] + 1;
+        if constexpr (kScrambling != SequenceScrambling::Owen) {
+          const ValueT old = permuted[k];
+          permuted[k] = permuteDigit(digits[k], b, s, cast<ValueT>(k), 0);
+          r = r - weights[k] * old + weights[k] * permuted[k];
+        }
+        if (digits[k] != 0)
+          break;
+      }
+    }
+    if constexpr (kScrambling == SequenceScrambling::Owen) {
+      // The permutations depend on the lower digits of the index
+      r = 0;
+      ValueT prefix = 0;
+      uint64b bk = 1;
+      for (std::size_t k = 0; k < n; ++k) {
+        r += weights[k] * permuteDigit(digits[k], b, s, cast<ValueT>(k), prefix);
+        prefix += cast<ValueT>(bk * digits[k]);
+        bk *= b;
+      }
+    }
+    out[i] = toFloat<Float>(r, bn);
+  }
+}
+
+/*!
+  \details The base 2 radical inverse is the bit reversal of the index,
+  so the scrambling is applied to a chunk with SIMD instructions
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] s No description.
+  \param [out] out No description.
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+void HaltonEngine<kScrambling>::generateRadicalInverses2(const ValueT first,
+                                                         const ValueT s,
+                                                         const std::span<Float> out) noexcept
+{
+  std::array<ValueT, kChunkSize> chunk{};
+  for (std::size_t i = 0; i < out.size(); i += kChunkSize) {
+    const std::size_t n = (std::min)(kChunkSize, out.size() - i);
+    for (std::size_t j = 0; j < n; ++j)
+      chunk[j] = OwenScrambler::reverseBits(first + cast<ValueT>(i + j));
+    if constexpr (kScrambling == SequenceScrambling::DigitPermutation) {
+      for (std::size_t j = 0; j < n; ++j)
+        chunk[j] ^= s;
+    }
+    else if constexpr (kScrambling == SequenceScrambling::Owen) {
+      OwenScrambler::scramble({chunk.data(), n}, s);
+    }
+    for (std::size_t j = 0; j < n; ++j)
+      out[i + j] = mapTo01<Float>(chunk[j]);
+  }
+}
+
+/*!
+  \details Without scrambling, the digits of any 32bit index are computed.
+  With scrambling, the digits are computed until the precision of the float,
+  because the permuted trailing zeros contribute to the sample
+
+  \tparam Float No description.
+  \param [in] b No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+constexpr auto HaltonEngine<kScrambling>::numOfDigits(const ValueT b) noexcept -> std::size_t
+{
+  constexpr uint64b limit = (kScrambling == SequenceScrambling::None)
+      ? uint64b{1} << std::numeric_limits<ValueT>::digits
+      : uint64b{1} << std::numeric_limits<Float>::digits;
+  std::size_t n = 0;
+  for (uint64b bn = 1; bn < limit; bn *= b)
+    ++n;
+  return n;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] digit No description.
+  \param [in] b No description.
+  \param [in] s No description.
+  \param [in] position No description.
+  \param [in] prefix The lower digits of the index than the position.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto HaltonEngine<kScrambling>::permuteDigit(const ValueT digit,
+                                                       const ValueT b,
+                                                       const ValueT s,
+                                                       const ValueT position,
+                                                       [[maybe_unused]] const ValueT prefix) noexcept
+    -> ValueT
+{
+  ValueT y = digit;
+  if constexpr (kScrambling == SequenceScrambling::DigitPermutation) {
+    const ValueT h = OwenScrambler::hashCombine(s, position);
+    y = OwenScrambler::permute(digit, b, OwenScrambler::hash(h));
+  }
+  else if constexpr (kScrambling == SequenceScrambling::Owen) {
+    const ValueT h = OwenScrambler::hashCombine(OwenScrambler::hashCombine(s, position), prefix);
+    y = OwenScrambler::permute(digit, b, OwenScrambler::hash(h));
+  }
+  return y;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto HaltonEngine<kScrambling>::primeList() noexcept
+    -> std::array<uint16b, kMaxDimension>
+{
+  constexpr std::array<uint16b, kMaxDimension> primes{{
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+    59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131,
+    137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223,
+    227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311,
+    313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409,
+    419, 421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503,
+    509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613,
+    617, 619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719,
+    727, 733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827,
+    829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941,
+    947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049,
+    1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163,
+    1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283,
+    1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423,
+    1427, 1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511,
+    1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619
+  }};
+  return primes;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] index No description.
+  \param [in] b No description.
+  \param [in] s No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+auto HaltonEngine<kScrambling>::radicalInverse(ValueT index,
+                                               const ValueT b,
+                                               const ValueT s) noexcept -> Float
+{
+  if (b == 2) {
+    ValueT x = OwenScrambler::reverseBits(index);
+    if constexpr (kScrambling == SequenceScrambling::DigitPermutation)
+      x ^= s;
+    else if constexpr (kScrambling == SequenceScrambling::Owen)
+      x = OwenScrambler::scramble(x, s);
+    return mapTo01<Float>(x);
+  }
+
+  const std::size_t n = numOfDigits<Float>(b);
+  uint64b r = 0;
+  uint64b bn = 1;
+  ValueT prefix = 0;
+  for (std::size_t k = 0; k < n; ++k) {
+    if constexpr (kScrambling == SequenceScrambling::None) {
+      if (index == 0)
+        break;
+    }
+    const ValueT q = index / b;
+    const ValueT digit = index - q * b;
+    index = q;
+    r = r * b + permuteDigit(digit, b, s, cast<ValueT>(k), prefix);
+    prefix += cast<ValueT>(bn * digit);
+    bn *= b;
+  }
+  return toFloat<Float>(r, bn);
+}
+
+/*!
+  \details The result is clamped since the rounding can make it one
+
+  \tparam Float No description.
+  \param [in] r No description.
+  \param [in] bn No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+auto HaltonEngine<kScrambling>::toFloat(const uint64b r, const uint64b bn) noexcept -> Float
+{
+  constexpr Float one_minus_epsilon = cast<Float>(1) - std::numeric_limits<Float>::epsilon() / 2;
+  const double x = cast<double>(r) / cast<double>(bn);
+  return (std::min)(cast<Float>(x), one_minus_epsilon);
+}
+
+} // namespace zisc
+
+#endif // ZISC_HALTON_ENGINE_INL_HPP
@@ -0,0 +1,138 @@
+/*!
+  \file halton_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_HALTON_ENGINE_HPP
+#define ZISC_HALTON_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "owen_scrambler.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Halton low-discrepancy sequence
+
+  The sample of the dimension d is the radical inverse of the index
+  in the base of the d-th prime number.
+  A sample is computed from its index and dimension without any state.
+  With scrambling, the digits are permuted by hash-based permutations
+  instead of permutation tables.
+  The first 256 dimensions are supported.
+
+  \tparam kScrambling The randomization of the sequence.
+  \note No notation.
+  \attention No attention.
+  */
+template <SequenceScrambling kScrambling>
+class HaltonEngine
+{
+ public:
+  using ValueT = uint32b;
+
+
+  //! Return the base of the given dimension
+  static constexpr auto base(const ValueT dimension) noexcept -> ValueT;
+
+  //! Generate a [0, 1) float sample of the given dimension
+  template <std::floating_point Float>
+  static auto generate1d(const ValueT index,
+                         const ValueT dimension,
+                         const ValueT seed = 0) noexcept -> Float;
+
+  //! Generate [0, 1) float samples of the successive indices from the given index
+  template <std::floating_point Float>
+  static void generate1d(const ValueT first,
+                         const ValueT dimension,
+                         const ValueT seed,
+                         const std::span<Float> out) noexcept;
+
+  //! Generate [0, 1) float samples of the given dimension and the next dimension
+  template <std::floating_point Float>
+  static auto generate2d(const ValueT index,
+                         const ValueT dimension,
+                         const ValueT seed = 0) noexcept -> std::array<Float, 2>;
+
+  //! Generate 2d [0, 1) float samples of the successive indices from the given index
+  template <std::floating_point Float>
+  static void generate2d(const ValueT first,
+                         const ValueT dimension,
+                         const ValueT seed,
+                         const std::span<std::array<Float, 2>> out) noexcept;
+
+  //! Return the number of the dimensions supported
+  static constexpr auto maxDimension() noexcept -> std::size_t;
+
+ private:
+  static constexpr std::size_t kMaxDimension = 256;
+  static constexpr std::size_t kMaxDigits = 64;
+  static constexpr std::size_t kChunkSize = 64;
+
+
+  //! Return the seed of the given dimension
+  static constexpr auto dimensionSeed(const ValueT dimension, const ValueT seed) noexcept
+      -> ValueT;
+
+  //! Generate the radical inverses of the successive indices without divisions
+  template <std::floating_point Float>
+  static void generateRadicalInverses(const ValueT first,
+                                      const ValueT b,
+                                      const ValueT s,
+                                      const std::span<Float> out) noexcept;
+
+  //! Generate the base 2 radical inverses of the successive indices
+  template <std::floating_point Float>
+  static void generateRadicalInverses2(const ValueT first,
+                                       const ValueT s,
+                                       const std::span<Float> out) noexcept;
+
+  //! Return the number of the digits computed
+  template <std::floating_point Float>
+  static constexpr auto numOfDigits(const ValueT b) noexcept -> std::size_t;
+
+  //! Permute the digit of the given position
+  static constexpr auto permuteDigit(const ValueT digit,
+                                     const ValueT b,
+                                     const ValueT s,
+                                     const ValueT position,
+                                     const ValueT prefix) noexcept -> ValueT;
+
+  //! Return the first 256 prime numbers
+  static constexpr auto primeList() noexcept -> std::array<uint16b, kMaxDimension>;
+
+  //! Compute the radical inverse of the given index
+  template <std::floating_point Float>
+  static auto radicalInverse(ValueT index, const ValueT b, const ValueT s) noexcept
+      -> Float;
+
+  //! Convert the given fraction r / bn to a [0, 1) float
+  template <std::floating_point Float>
+  static auto toFloat(const uint64b r, const uint64b bn) noexcept -> Float;
+};
+
+// Type aliases
+using Halton = HaltonEngine<SequenceScrambling::None>;
+using PermutedHalton = HaltonEngine<SequenceScrambling::DigitPermutation>;
+using OwenScrambledHalton = HaltonEngine<SequenceScrambling::Owen>;
+
+} // namespace zisc
+
+#include "halton_engine-inl.hpp"
+
+#endif // ZISC_HALTON_ENGINE_HPP
@@ -0,0 +1,187 @@
+/*!
+  \file multi_stream_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_MULTI_STREAM_ENGINE_INL_HPP
+#define ZISC_MULTI_STREAM_ENGINE_INL_HPP
+
+#include "multi_stream_engine.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "pseudo_random_number_engine.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+MultiStreamEngine<EngineT, kNumOfStreams>::MultiStreamEngine() noexcept
+{
+  setSeed(BaseEngineT::defaultSeed());
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] seed No description.
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+MultiStreamEngine<EngineT, kNumOfStreams>::MultiStreamEngine(const ValueT seed) noexcept
+{
+  setSeed(seed);
+}
+
+/*!
+  \details The random numbers which remain from generate() are used first,
+  so the sequence is the same as calling generate() repeatedly
+
+  \param [out] out No description.
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+void MultiStreamEngine<EngineT, kNumOfStreams>::fillValues(const std::span<ValueT> out) noexcept
+{
+  std::size_t i = (std::min)(kNumOfStreams - position_, out.size());
+  std::copy_n(buffer_.begin() + position_, i, out.begin());
+  position_ += i;
+  const std::size_t n = ((out.size() - i) / kNumOfStreams) * kNumOfStreams;
+  generateStreams(out.subspan(i, n));
+  for (i += n; i < out.size(); ++i)
+    out[i] = generate();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+auto MultiStreamEngine<EngineT, kNumOfStreams>::generate() noexcept -> ValueT
+{
+  if (position_ == kNumOfStreams) {
+    generateStreams(buffer_);
+    position_ = 0;
+  }
+  return buffer_[position_++];
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+constexpr auto MultiStreamEngine<EngineT, kNumOfStreams>::getPeriodPow2() noexcept
+    -> std::size_t
+{
+  return EngineT::getPeriodPow2();
+}
+
+/*!
+  \details The end of period is reached when the last stream reaches it
+
+  \tparam Integer No description.
+  \param [in] sample No description.
+  \return No description
+  */
+template <typename EngineT, std::size_t kNumOfStreams>
+template <std::unsigned_integral Integer> inline
+constexpr auto MultiStreamEngine<EngineT, kNumOfStreams>::isEndOfPeriod(
+    const Integer sample) noexcept -> bool
+{
+  const bool is_last_stream = (sample % kNumOfStreams) == (kNumOfStreams - 1);
+  return is_last_stream && EngineT::isEndOfPeriod(cast<Integer>(sample / kNumOfStreams));
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+constexpr auto MultiStreamEngine<EngineT, kNumOfStreams>::numOfStreams() noexcept
+    -> std::size_t
+{
+  return kNumOfStreams;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] seed No description.
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+void MultiStreamEngine<EngineT, kNumOfStreams>::setSeed(const ValueT seed) noexcept
+{
+  for (std::size_t i = 0; i < kNumOfStreams; ++i)
+    stream_list_[i].setSeed(streamSeed(seed, i));
+  position_ = kNumOfStreams;
+}
+
+/*!
+  \details The seed and the index are mixed by the SplitMix64 finalizer,
+  so the seeds of the streams are decorrelated
+
+  \param [in] seed No description.
+  \param [in] index No description.
+  \return No description
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+constexpr auto MultiStreamEngine<EngineT, kNumOfStreams>::streamSeed(
+    const ValueT seed,
+    const std::size_t index) noexcept -> ValueT
+{
+  uint64b z = cast<uint64b>(seed) + cast<uint64b>(index + 1) * 0x9e37'79b9'7f4a'7c15ull;
+  z = (z ^ (z >> 30)) * 0xbf58'476d'1ce4'e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d0'49bb'1331'11ebull;
+  z = z ^ (z >> 31);
+  return cast<ValueT>(z);
+}
+
+/*!
+  \details No detailed description
+
+  \param [out] out No description.
+  */
+template <typename EngineT, std::size_t kNumOfStreams> inline
+void MultiStreamEngine<EngineT, kNumOfStreams>::generateStreams(
+    const std::span<ValueT> out) noexcept
+{
+  if constexpr (requires {EngineT::fillStreams(std::span{stream_list_}, out);}) {
+    EngineT::fillStreams(std::span{stream_list_}, out);
+  }
+  else {
+    // The states can be kept in registers since the chunk doesn't alias them
+    constexpr std::size_t num_of_rows = (std::max)(64 / kNumOfStreams, std::size_t{1});
+    std::array<ValueT, num_of_rows * kNumOfStreams> chunk;
+    for (std::size_t k = 0; k < out.size(); k += chunk.size()) {
+      const std::size_t n = (std::min)(chunk.size(), out.size() - k);
+      for (std::size_t j = 0; j < n; j += kNumOfStreams) {
+        for (std::size_t i = 0; i < kNumOfStreams; ++i)
+          chunk[j + i] = stream_list_[i].generate();
+      }
+      std::copy_n(chunk.begin(), n, out.begin() + k);
+    }
+  }
+}
+
+} // namespace zisc
+
+#endif // ZISC_MULTI_STREAM_ENGINE_INL_HPP
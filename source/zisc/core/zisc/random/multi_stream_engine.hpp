@@ -0,0 +1,102 @@
+/*!
+  \file multi_stream_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_MULTI_STREAM_ENGINE_HPP
+#define ZISC_MULTI_STREAM_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "pseudo_random_number_engine.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Run several independent streams of an engine side by side
+
+  The random numbers of the streams are interleaved.
+  The (k * n + i)-th random number is the k-th random number of
+  the i-th stream, where n is the number of the streams, and
+  the i-th stream is identical to EngineT{streamSeed(seed, i)}.
+  So the sequence is reproducible with scalar engines.
+  Since the streams don't depend on each other,
+  fill() generates random numbers of the streams in SIMD lanes if
+  the engine provides fillStreams(), otherwise the streams are
+  interleaved so that the state updates overlap.
+
+  \tparam EngineT A pseudo random number engine.
+  \tparam kNumOfStreams No description.
+  \note No notation.
+  \attention No attention.
+  */
+template <typename EngineT, std::size_t kNumOfStreams = 8>
+class MultiStreamEngine :
+    public PseudoRandomNumberEngine<MultiStreamEngine<EngineT, kNumOfStreams>,
+                                    typename EngineT::ValueT>
+{
+ public:
+  using BaseEngineT = PseudoRandomNumberEngine<MultiStreamEngine, typename EngineT::ValueT>;
+  using ValueT = typename BaseEngineT::ValueT;
+  using StreamT = EngineT;
+
+
+  //! Initialize
+  MultiStreamEngine() noexcept;
+
+  //! Initialize
+  explicit MultiStreamEngine(const ValueT seed) noexcept;
+
+
+  //! Fill the given span with random numbers
+  void fillValues(const std::span<ValueT> out) noexcept;
+
+  //! Generate a random number
+  auto generate() noexcept -> ValueT;
+
+  //! Return the n which of the period of a stream
+  static constexpr auto getPeriodPow2() noexcept -> std::size_t;
+
+  //! Check if a specified sample (0 base count) is the end of period
+  template <std::unsigned_integral Integer>
+  static constexpr auto isEndOfPeriod(const Integer sample) noexcept -> bool;
+
+  //! Return the number of the streams
+  static constexpr auto numOfStreams() noexcept -> std::size_t;
+
+  //! Set a seed
+  void setSeed(const ValueT seed) noexcept;
+
+  //! Return the seed of the given stream
+  static constexpr auto streamSeed(const ValueT seed, const std::size_t index) noexcept
+      -> ValueT;
+
+ private:
+  //! Generate random numbers of all streams. The size must be a multiple of the streams
+  void generateStreams(const std::span<ValueT> out) noexcept;
+
+
+  std::array<EngineT, kNumOfStreams> stream_list_;
+  std::array<ValueT, kNumOfStreams> buffer_{};
+  std::size_t position_ = kNumOfStreams;
+};
+
+} // namespace zisc
+
+#include "multi_stream_engine-inl.hpp"
+
+#endif // ZISC_MULTI_STREAM_ENGINE_HPP
@@ -0,0 +1,120 @@
+/*!
+  \file normal_distribution-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_NORMAL_DISTRIBUTION_INL_HPP
+#define ZISC_NORMAL_DISTRIBUTION_INL_HPP
+
+#include "normal_distribution.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "distribution.hpp"
+#include "ziggurat.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] mean No description.
+  \param [in] stddev No description.
+  */
+template <std::floating_point Float> inline
+NormalDistribution<Float>::NormalDistribution(const ValueT mean,
+                                              const ValueT stddev) noexcept :
+    mean_{mean},
+    stddev_{stddev}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::floating_point Float>
+template <RandomNumberEngine Engine> inline
+auto NormalDistribution<Float>::operator()(Engine& engine) const noexcept -> ValueT
+{
+  return generate(engine);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float>
+template <RandomNumberEngine Engine> inline
+void NormalDistribution<Float>::fill(Engine& engine, const std::span<ValueT> out) const noexcept
+{
+  // The chunk is transformed while it's in the cache
+  for (std::size_t i = 0; i < out.size(); i += Distribution::kChunkSize) {
+    const std::size_t n = (std::min)(Distribution::kChunkSize, out.size() - i);
+    const std::span<ValueT> chunk = out.subspan(i, n);
+    Ziggurat::fillNormal(engine, chunk);
+    for (ValueT& x : chunk)
+      x = mean_ + stddev_ * x;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::floating_point Float>
+template <RandomNumberEngine Engine> inline
+auto NormalDistribution<Float>::generate(Engine& engine) const noexcept -> ValueT
+{
+  const auto x = cast<ValueT>(Ziggurat::generateNormal(engine));
+  return mean_ + stddev_ * x;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto NormalDistribution<Float>::mean() const noexcept -> ValueT
+{
+  return mean_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto NormalDistribution<Float>::stddev() const noexcept -> ValueT
+{
+  return stddev_;
+}
+
+} // namespace zisc
+
+#endif // ZISC_NORMAL_DISTRIBUTION_INL_HPP
@@ -0,0 +1,286 @@
+/*!
+  \file owen_scrambler-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_OWEN_SCRAMBLER_INL_HPP
+#define ZISC_OWEN_SCRAMBLER_INL_HPP
+
+#include "owen_scrambler.hpp"
+// Standard C++ library
+#include <bit>
+#include <cstddef>
+#include <span>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+// Zisc
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details The lowbias32 hash by Chris Wellons is used
+
+  \param [in] x No description.
+  \return No description
+  */
+inline
+constexpr auto OwenScrambler::hash(ValueT x) noexcept -> ValueT
+{
+  x ^= x >> 16;
+  x *= 0x7feb352dU;
+  x ^= x >> 15;
+  x *= 0x846ca68bU;
+  x ^= x >> 16;
+  return x;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] seed No description.
+  \param [in] v No description.
+  \return No description
+  */
+inline
+constexpr auto OwenScrambler::hashCombine(const ValueT seed, const ValueT v) noexcept
+    -> ValueT
+{
+  return seed ^ (v + 0x9e3779b9U + (seed << 6) + (seed >> 2));
+}
+
+/*!
+  \details The permutation of Kensler's correlated multi-jittered sampling
+  with a runtime length. Indices out of [0, l) are cycled back by cycle-walking.
+  The length must be positive
+
+  \param [in] i No description.
+  \param [in] l No description.
+  \param [in] seed No description.
+  \return No description
+  */
+inline
+constexpr auto OwenScrambler::permute(ValueT i,
+                                      const ValueT l,
+                                      const ValueT seed) noexcept -> ValueT
+{
+  ValueT w = l - 1;
+  w |= w >> 1;
+  w |= w >> 2;
+  w |= w >> 4;
+  w |= w >> 8;
+  w |= w >> 16;
+  do {
+    i ^= seed;
+    i *= 0xe170893dU;
+    i ^= seed >> 16;
+    i ^= (i & w) >> 4;
+    i ^= seed >> 8;
+    i *= 0x0929eb3fU;
+    i ^= seed >> 23;
+    i ^= (i & w) >> 1;
+    i *= 1 | seed >> 27;
+    i *= 0x6935fa69U;
+    i ^= (i & w) >> 11;
+    i *= 0x74dcb303U;
+    i ^= (i & w) >> 2;
+    i *= 0x9e501cc3U;
+    i ^= (i & w) >> 2;
+    i *= 0xc860a3dfU;
+    i &= w;
+    i ^= i >> 5;
+  } while (l <= i);
+  i = std::has_single_bit(l) ? ((i + seed) & w) : ((i + seed) % l);
+  return i;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] x No description.
+  \return No description
+  */
+inline
+constexpr auto OwenScrambler::reverseBits(ValueT x) noexcept -> ValueT
+{
+  x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+  x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+  x = ((x >> 4) & 0x0f0f0f0fU) | ((x & 0x0f0f0f0fU) << 4);
+  x = ((x >> 8) & 0x00ff00ffU) | ((x & 0x00ff00ffU) << 8);
+  x = (x >> 16) | (x << 16);
+  return x;
+}
+
+/*!
+  \details The MSB of the given value is the first digit of the fixed point number
+
+  \param [in] x No description.
+  \param [in] seed No description.
+  \return No description
+  */
+inline
+constexpr auto OwenScrambler::scramble(const ValueT x, const ValueT seed) noexcept
+    -> ValueT
+{
+  return reverseBits(permuteLaineKarras(reverseBits(x), seed));
+}
+
+/*!
+  \details The results are identical to the scalar scrambling
+
+  \param [in,out] values No description.
+  \param [in] seed No description.
+  */
+inline
+void OwenScrambler::scramble(const std::span<ValueT> values, const ValueT seed) noexcept
+{
+  const std::size_t n = scrambleSimd(values, seed);
+  for (std::size_t i = n; i < values.size(); ++i)
+    values[i] = scramble(values[i], seed);
+}
+
+/*!
+  \details The improved hash by Nathan Vegdahl is used.
+  A multiplication by an even constant followed by xor only propagates
+  lower bits to higher bits, so each bit is flipped depending only on the lower bits
+
+  \param [in] x No description.
+  \param [in] seed No description.
+  \return No description
+  */
+inline
+constexpr auto OwenScrambler::permuteLaineKarras(ValueT x, const ValueT seed) noexcept
+    -> ValueT
+{
+  x ^= x * 0x3d20adeaU;
+  x += seed;
+  x *= (seed >> 16) | 1;
+  x ^= x * 0x05526c56U;
+  x ^= x * 0x53a22864U;
+  return x;
+}
+
+/*!
+  \details Two vectors are processed at once to hide the latency of the multiplications
+
+  \param [in,out] values No description.
+  \param [in] seed No description.
+  \return The number of the values processed
+  */
+inline
+auto OwenScrambler::scrambleSimd([[maybe_unused]] const std::span<ValueT> values,
+                                 [[maybe_unused]] const ValueT seed) noexcept
+    -> std::size_t
+{
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  constexpr std::size_t l = sizeof(__m256i) / sizeof(ValueT);
+  constexpr std::size_t num_of_vectors = 2;
+  const __m256i c0 = _mm256_set1_epi32(cast<int>(0x3d20adeaU));
+  const __m256i c1 = _mm256_set1_epi32(cast<int>(0x05526c56U));
+  const __m256i c2 = _mm256_set1_epi32(cast<int>(0x53a22864U));
+  const __m256i s = _mm256_set1_epi32(cast<int>(seed));
+  const __m256i m = _mm256_set1_epi32(cast<int>((seed >> 16) | 1));
+  // Reverse the bytes and then reverse the bits of each nibble with a table
+  const __m256i byte_order = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                              3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  const __m256i nibble_table = _mm256_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+                                                0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf,
+                                                0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+                                                0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+  const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+  auto reverse = [byte_order, nibble_table, nibble_mask](__m256i x) noexcept
+  {
+    x = _mm256_shuffle_epi8(x, byte_order);
+    const __m256i lo = _mm256_shuffle_epi8(nibble_table, _mm256_and_si256(x, nibble_mask));
+    const __m256i hi = _mm256_shuffle_epi8(nibble_table,
+                                           _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble_mask));
+    return _mm256_or_si256(_mm256_slli_epi16(lo, 4), hi);
+  };
+  for (; (i + num_of_vectors * l) <= values.size(); i += num_of_vectors * l) {
+    __m256i x[num_of_vectors]; // The attributes of __m256i are lost in std::array
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      x[v] = _mm256_loadu_si256(reinterp<const __m256i*>(values.data() + i + v * l));
+      x[v] = reverse(x[v]);
+    }
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      x[v] = _mm256_xor_si256(x[v], _mm256_mullo_epi32(x[v], c0));
+      x[v] = _mm256_mullo_epi32(_mm256_add_epi32(x[v], s), m);
+      x[v] = _mm256_xor_si256(x[v], _mm256_mullo_epi32(x[v], c1));
+      x[v] = _mm256_xor_si256(x[v], _mm256_mullo_epi32(x[v], c2));
+    }
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      auto* o = reinterp<__m256i*>(values.data() + i + v * l);
+      _mm256_storeu_si256(o, reverse(x[v]));
+    }
+  }
+#elif defined(__SSE2__)
+  constexpr std::size_t l = sizeof(__m128i) / sizeof(ValueT);
+  constexpr std::size_t num_of_vectors = 2;
+  const __m128i c0 = _mm_set1_epi32(cast<int>(0x3d20adeaU));
+  const __m128i c1 = _mm_set1_epi32(cast<int>(0x05526c56U));
+  const __m128i c2 = _mm_set1_epi32(cast<int>(0x53a22864U));
+  const __m128i s = _mm_set1_epi32(cast<int>(seed));
+  const __m128i m = _mm_set1_epi32(cast<int>((seed >> 16) | 1));
+  // SSE2 doesn't have 32bit x 32bit = 32bit multiplication
+  auto mullo = [](const __m128i a, const __m128i b) noexcept
+  {
+    const __m128i p_even = _mm_mul_epu32(a, b);
+    const __m128i p_odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(p_even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(p_odd, _MM_SHUFFLE(0, 0, 2, 0)));
+  };
+  auto swap = [](const __m128i x, const __m128i mask, const int shift) noexcept
+  {
+    return _mm_or_si128(_mm_and_si128(_mm_srl_epi32(x, _mm_cvtsi32_si128(shift)), mask),
+                        _mm_sll_epi32(_mm_and_si128(x, mask), _mm_cvtsi32_si128(shift)));
+  };
+  const __m128i mask1 = _mm_set1_epi32(0x55555555);
+  const __m128i mask2 = _mm_set1_epi32(0x33333333);
+  const __m128i mask4 = _mm_set1_epi32(0x0f0f0f0f);
+  const __m128i mask8 = _mm_set1_epi32(0x00ff00ff);
+  auto reverse = [&swap, mask1, mask2, mask4, mask8](__m128i x) noexcept
+  {
+    x = swap(x, mask1, 1);
+    x = swap(x, mask2, 2);
+    x = swap(x, mask4, 4);
+    x = swap(x, mask8, 8);
+    return _mm_or_si128(_mm_srli_epi32(x, 16), _mm_slli_epi32(x, 16));
+  };
+  for (; (i + num_of_vectors * l) <= values.size(); i += num_of_vectors * l) {
+    __m128i x[num_of_vectors]; // The attributes of __m128i are lost in std::array
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      x[v] = _mm_loadu_si128(reinterp<const __m128i*>(values.data() + i + v * l));
+      x[v] = reverse(x[v]);
+    }
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      x[v] = _mm_xor_si128(x[v], mullo(x[v], c0));
+      x[v] = mullo(_mm_add_epi32(x[v], s), m);
+      x[v] = _mm_xor_si128(x[v], mullo(x[v], c1));
+      x[v] = _mm_xor_si128(x[v], mullo(x[v], c2));
+    }
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      auto* o = reinterp<__m128i*>(values.data() + i + v * l);
+      _mm_storeu_si128(o, reverse(x[v]));
+    }
+  }
+#endif
+  return i;
+}
+
+} // namespace zisc
+
+#endif // ZISC_OWEN_SCRAMBLER_INL_HPP
@@ -0,0 +1,87 @@
+/*!
+  \file owen_scrambler.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_OWEN_SCRAMBLER_HPP
+#define ZISC_OWEN_SCRAMBLER_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <span>
+// Zisc
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Specify the randomization of a low-discrepancy sequence
+  */
+enum class SequenceScrambling : int
+{
+  None,
+  DigitPermutation, //!< All digits of a dimension are permuted by the same permutation
+  Owen //!< Each digit is permuted depending on the higher digits (nested uniform scrambling)
+};
+
+/*!
+  \brief Hash-based Owen scrambling of a 32bit fixed point number
+
+  The scrambling flips each bit depending only on the higher bits,
+  so the stratification of a (t, m, s)-net is preserved.
+  No permutation table is required.
+  For more detail, please see the following papers:
+  <a href="https://doi.org/10.1145/1275808.1276499">Stratified sampling for stochastic transparency</a> and
+  <a href="https://jcgt.org/published/0009/04/01/">Practical Hash-based Owen Scrambling</a>.
+
+  \note No notation.
+  \attention No attention.
+  */
+class OwenScrambler
+{
+ public:
+  using ValueT = uint32b;
+
+
+  //! Hash the given value
+  static constexpr auto hash(ValueT x) noexcept -> ValueT;
+
+  //! Combine the given value into the seed
+  static constexpr auto hashCombine(const ValueT seed, const ValueT v) noexcept -> ValueT;
+
+  //! Return the permuted index of [0, l)
+  static constexpr auto permute(ValueT i, const ValueT l, const ValueT seed) noexcept
+      -> ValueT;
+
+  //! Reverse the bits of the given value
+  static constexpr auto reverseBits(ValueT x) noexcept -> ValueT;
+
+  //! Apply the nested uniform scrambling to the given fixed point number
+  static constexpr auto scramble(const ValueT x, const ValueT seed) noexcept -> ValueT;
+
+  //! Apply the nested uniform scrambling to the given fixed point numbers
+  static void scramble(const std::span<ValueT> values, const ValueT seed) noexcept;
+
+ private:
+  //! Apply the Laine-Karras permutation to the given bit reversed number
+  static constexpr auto permuteLaineKarras(ValueT x, const ValueT seed) noexcept -> ValueT;
+
+  //! Apply the nested uniform scrambling with SIMD instructions
+  static auto scrambleSimd(const std::span<ValueT> values, const ValueT seed) noexcept
+      -> std::size_t;
+};
+
+} // namespace zisc
+
+#include "owen_scrambler-inl.hpp"
+
+#endif // ZISC_OWEN_SCRAMBLER_HPP
@@ -18,10 +18,18 @@
 #include "pcg_engine.hpp"
 // Standard C++ library
 #include <concepts>
+#include <array>
 #include <cstddef>
 #include <limits>
+#include <span>
 #include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 // Zisc
+#include "zisc/error.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 
@@ -47,6 +55,72 @@ PcgEngine<T, kBase>::PcgEngine(const ValueT seed) noexcept
   setSeed(seed);
 }
 
+/*!
+  \details Engines of different streams generate different sequences
+  even if they have the same seed. Only the lower (n-1) bits of
+  the stream are used, where n is the bit size of the value
+
+  \param [in] seed No description.
+  \param [in] stream No description.
+  */
+template <std::unsigned_integral T, PcgBase kBase> inline
+PcgEngine<T, kBase>::PcgEngine(const ValueT seed, const ValueT stream) noexcept
+    requires (kBase == PcgBase::Lcg)
+{
+  setSeed(seed, stream);
+}
+
+/*!
+  \details The state after advance(k) is the state after generating k random numbers.
+  The jump is computed by the algorithm of F. Brown,
+  "Random number generation with arbitrary strides".
+  Since the period is 2^n, advance(-k) (mod 2^n) moves the state backward
+
+  \param [in] delta No description.
+  */
+template <std::unsigned_integral T, PcgBase kBase> inline
+void PcgEngine<T, kBase>::advance(const ValueT delta) noexcept
+{
+  MulT acc_mult = 1;
+  MulT acc_plus = 0;
+  MulT cur_mult = multiplier();
+  MulT cur_plus = increment_;
+  for (ValueT d = delta; 0 < d; d >>= 1) {
+    if ((d & 1U) != 0) {
+      acc_mult = cast<ValueT>(acc_mult * cur_mult);
+      acc_plus = cast<ValueT>(acc_plus * cur_mult + cur_plus);
+    }
+    cur_plus = cast<ValueT>((cur_mult + 1U) * cur_plus);
+    cur_mult = cast<ValueT>(cur_mult * cur_mult);
+  }
+  state_ = cast<ValueT>(acc_mult * state_ + acc_plus);
+}
+
+/*!
+  \details out[k * n + i] is the k-th random number of engines[i],
+  where n is the number of the engines.
+  The engines are independent, so several engines are processed
+  in SIMD lanes and the rest are interleaved in scalar.
+  The size of out must be a multiple of the number of the engines
+
+  \param [in,out] engines No description.
+  \param [out] out No description.
+  */
+template <std::unsigned_integral T, PcgBase kBase> inline
+void PcgEngine<T, kBase>::fillStreams(const std::span<PcgEngine> engines,
+                                      const std::span<ValueT> out) noexcept
+    requires (sizeof(T) <= 4)
+{
+  const std::size_t n = engines.size();
+  ZISC_ASSERT((n != 0) && (out.size() % n) == 0, "The output isn't a multiple of the engines.");
+  const std::size_t first = fillStreamsSimd(engines, out);
+  const std::span<PcgEngine> rest = engines.subspan(first);
+  for (std::size_t k = 0; !rest.empty() && (k < out.size()); k += n) {
+    for (std::size_t i = 0; i < rest.size(); ++i)
+      out[k + first + i] = rest[i].generate();
+  }
+}
+
 /*!
   \details No detailed description
 
@@ -98,7 +172,7 @@ constexpr auto PcgEngine<T, kBase>::isEndOfPeriod(const Integer sample) noexcept
 }
 
 /*!
-  \details No detailed description
+  \details The stream of the engine is kept
 
   \param [in] seed No description.
   */
@@ -106,7 +180,34 @@ template <std::unsigned_integral T, PcgBase kBase> inline
 void PcgEngine<T, kBase>::setSeed(const ValueT seed) noexcept
 {
   constexpr bool is_mcg = (kBase == PcgBase::Mcg);
-  state_ = is_mcg ? (seed | cast<ValueT>(3)) : bump(seed + increment());
+  state_ = is_mcg ? (seed | cast<ValueT>(3)) : bump(seed + increment_);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] seed No description.
+  \param [in] stream No description.
+  */
+template <std::unsigned_integral T, PcgBase kBase> inline
+void PcgEngine<T, kBase>::setSeed(const ValueT seed, const ValueT stream) noexcept
+    requires (kBase == PcgBase::Lcg)
+{
+  // The increment must be odd
+  increment_ = cast<ValueT>(cast<ValueT>(stream << 1U) | 1U);
+  setSeed(seed);
+}
+
+/*!
+  \details The default stream is (default increment >> 1).
+  The stream of the MCG engines is always 0
+
+  \return No description
+  */
+template <std::unsigned_integral T, PcgBase kBase> inline
+auto PcgEngine<T, kBase>::stream() const noexcept -> ValueT
+{
+  return cast<ValueT>(increment_ >> 1U);
 }
 
 /*!
@@ -118,10 +219,128 @@ void PcgEngine<T, kBase>::setSeed(const ValueT seed) noexcept
 template <std::unsigned_integral T, PcgBase kBase> inline
 auto PcgEngine<T, kBase>::bump(const ValueT state) const noexcept -> ValueT
 {
-  const ValueT result = state * multiplier() + increment();
+  const ValueT result = cast<ValueT>(cast<MulT>(state) * multiplier() + increment_);
   return result;
 }
 
+/*!
+  \details The states of 8, 16 and 32 bit engines are held in 32bit lanes.
+  The 32bit multiplications are done by pmulld with AVX2, or
+  by two pmuludq and shuffles with SSE2.
+  The per lane shift of the output function is done by vpsrlvd with AVX2,
+  or by shifts selected with the bits of the shift count with SSE2.
+  The engines are processed in groups of two vectors,
+  which hide the latency of the multiplications
+
+  \param [in,out] engines No description.
+  \param [out] out No description.
+  \return The number of the engines processed
+  */
+template <std::unsigned_integral T, PcgBase kBase> inline
+auto PcgEngine<T, kBase>::fillStreamsSimd(
+    [[maybe_unused]] const std::span<PcgEngine> engines,
+    [[maybe_unused]] const std::span<ValueT> out) noexcept -> std::size_t
+{
+  std::size_t first = 0;
+#if defined(__AVX2__)
+  using VectorT = __m256i;
+  auto set1 = [](const uint32b x) noexcept {return _mm256_set1_epi32(cast<int>(x));};
+  auto load = [](const uint32b* p) noexcept {return _mm256_load_si256(reinterp<const VectorT*>(p));};
+  auto store = [](uint32b* p, const VectorT x) noexcept {_mm256_store_si256(reinterp<VectorT*>(p), x);};
+  auto storeu = [](void* p, const VectorT x) noexcept {_mm256_storeu_si256(reinterp<VectorT*>(p), x);};
+  auto add = [](const VectorT lhs, const VectorT rhs) noexcept {return _mm256_add_epi32(lhs, rhs);};
+  auto mul = [](const VectorT lhs, const VectorT rhs) noexcept {return _mm256_mullo_epi32(lhs, rhs);};
+  auto and_ = [](const VectorT lhs, const VectorT rhs) noexcept {return _mm256_and_si256(lhs, rhs);};
+  auto xor_ = [](const VectorT lhs, const VectorT rhs) noexcept {return _mm256_xor_si256(lhs, rhs);};
+  auto shr = [](const VectorT x, const int k) noexcept {return _mm256_srli_epi32(x, k);};
+  auto shrv = [](const VectorT x, const VectorT k) noexcept {return _mm256_srlv_epi32(x, k);};
+#elif defined(__SSE2__)
+  using VectorT = __m128i;
+  auto set1 = [](const uint32b x) noexcept {return _mm_set1_epi32(cast<int>(x));};
+  auto load = [](const uint32b* p) noexcept {return _mm_load_si128(reinterp<const VectorT*>(p));};
+  auto store = [](uint32b* p, const VectorT x) noexcept {_mm_store_si128(reinterp<VectorT*>(p), x);};
+  auto storeu = [](void* p, const VectorT x) noexcept {_mm_storeu_si128(reinterp<VectorT*>(p), x);};
+  auto add = [](const VectorT lhs, const VectorT rhs) noexcept {return _mm_add_epi32(lhs, rhs);};
+  auto mul = [](const VectorT lhs, const VectorT rhs) noexcept
+  {
+    // Multiply the even and odd lanes in 64bit, then gather the lower halves
+    const VectorT even = _mm_mul_epu32(lhs, rhs);
+    const VectorT odd = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+  };
+  auto and_ = [](const VectorT lhs, const VectorT rhs) noexcept {return _mm_and_si128(lhs, rhs);};
+  auto xor_ = [](const VectorT lhs, const VectorT rhs) noexcept {return _mm_xor_si128(lhs, rhs);};
+  auto shr = [](const VectorT x, const int k) noexcept {return _mm_srli_epi32(x, k);};
+  auto shrv = [](VectorT x, const VectorT k) noexcept
+  {
+    // Shift the lanes which have each bit of the count. The count is less than 32
+    for (int b = 1; b < 32; b <<= 1) {
+      const VectorT bit = _mm_set1_epi32(b);
+      const VectorT m = _mm_cmpeq_epi32(_mm_and_si128(k, bit), bit);
+      x = _mm_or_si128(_mm_andnot_si128(m, x), _mm_and_si128(m, _mm_srli_epi32(x, b)));
+    }
+    return x;
+  };
+#endif
+#if defined(__AVX2__) || defined(__SSE2__)
+  if constexpr (sizeof(ValueT) <= 4) {
+    static_assert(kOutputPrevious, "The engines must output the previous states.");
+    constexpr std::size_t l = sizeof(VectorT) / sizeof(uint32b);
+    constexpr std::size_t num_of_vectors = 2;
+    constexpr int bits = std::numeric_limits<ValueT>::digits;
+    constexpr int opbits = (32 <= bits) ? 4 : (16 <= bits) ? 3 : 2;
+    constexpr int xshift = (2 * bits + 2) / 3;
+    const std::size_t n = engines.size();
+    const VectorT value_mask = set1((std::numeric_limits<ValueT>::max)());
+    const VectorT opbits_mask = set1((1U << opbits) - 1U);
+    const VectorT mult = set1(multiplier());
+    const VectorT mcg_mult = set1(mcgMultiplier());
+    for (; (first + num_of_vectors * l) <= n; first += num_of_vectors * l) {
+      // Load the states and the increments in the structure of arrays layout
+      VectorT s[num_of_vectors]; // The attributes of the vector are lost in std::array
+      VectorT inc[num_of_vectors];
+      alignas(sizeof(VectorT)) std::array<uint32b, l> lanes{};
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        for (std::size_t i = 0; i < l; ++i)
+          lanes[i] = engines[first + v * l + i].state_;
+        s[v] = load(lanes.data());
+        for (std::size_t i = 0; i < l; ++i)
+          lanes[i] = engines[first + v * l + i].increment_;
+        inc[v] = load(lanes.data());
+      }
+      for (std::size_t k = 0; k < out.size(); k += n) {
+        for (std::size_t v = 0; v < num_of_vectors; ++v) {
+          // The random number is the output of the previous state
+          VectorT x = s[v];
+          s[v] = and_(add(mul(s[v], mult), inc[v]), value_mask);
+          const VectorT rshift = and_(shr(x, bits - opbits), opbits_mask);
+          x = xor_(x, shrv(shr(x, opbits), rshift));
+          x = and_(mul(x, mcg_mult), value_mask);
+          x = xor_(x, shr(x, xshift));
+          ValueT* o = out.data() + k + first + v * l;
+          if constexpr (sizeof(ValueT) == 4) {
+            storeu(o, x);
+          }
+          else {
+            store(lanes.data(), x);
+            for (std::size_t i = 0; i < l; ++i)
+              o[i] = cast<ValueT>(lanes[i]);
+          }
+        }
+      }
+      // Store the states
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        store(lanes.data(), s[v]);
+        for (std::size_t i = 0; i < l; ++i)
+          engines[first + v * l + i].state_ = cast<ValueT>(lanes[i]);
+      }
+    }
+  }
+#endif
+  return first;
+}
+
 /*!
   \details No detailed description
 
@@ -147,7 +366,7 @@ auto PcgEngine<T, kBase>::generateBase() noexcept -> ValueT
   \return No description
   */
 template <std::unsigned_integral T, PcgBase kBase> inline
-constexpr auto PcgEngine<T, kBase>::increment() noexcept -> ValueT
+constexpr auto PcgEngine<T, kBase>::defaultIncrement() noexcept -> ValueT
 {
   ValueT i = 0;
   constexpr bool is_mcg = kBase == PcgBase::Mcg;
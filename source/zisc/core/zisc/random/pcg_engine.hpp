@@ -18,6 +18,7 @@
 // Standard C++ library
 #include <concepts>
 #include <cstddef>
+#include <span>
 #include <type_traits>
 // Zisc
 #include "pseudo_random_number_engine.hpp"
@@ -58,6 +59,18 @@ class PcgEngine : public PseudoRandomNumberEngine<PcgEngine<T, kBase>, T>
   //! Initialize
   explicit PcgEngine(const ValueT seed) noexcept;
 
+  //! Initialize with the given stream
+  PcgEngine(const ValueT seed, const ValueT stream) noexcept
+      requires (kBase == PcgBase::Lcg);
+
+
+  //! Advance the state by the given steps in O(log delta)
+  void advance(const ValueT delta) noexcept;
+
+  //! Generate random numbers of the given engines in an interleaved order
+  static void fillStreams(const std::span<PcgEngine> engines,
+                          const std::span<ValueT> out) noexcept
+      requires (sizeof(T) <= 4);
 
   //! Generate a random number
   auto generate() noexcept -> ValueT;
@@ -72,18 +85,31 @@ class PcgEngine : public PseudoRandomNumberEngine<PcgEngine<T, kBase>, T>
   //! Set seed
   void setSeed(const ValueT seed) noexcept;
 
+  //! Set seed and select the stream
+  void setSeed(const ValueT seed, const ValueT stream) noexcept
+      requires (kBase == PcgBase::Lcg);
+
+  //! Return the stream of the engine
+  auto stream() const noexcept -> ValueT;
+
  private:
   using BitCountType = uint8b;
+  // Small integers are multiplied in unsigned int to avoid signed overflow
+  using MulT = std::conditional_t<sizeof(ValueT) < sizeof(unsigned int), unsigned int, ValueT>;
 
 
   //! Bump
   auto bump(const ValueT state) const noexcept -> ValueT;
 
+  //! Generate random numbers of the given engines with SIMD instructions
+  static auto fillStreamsSimd(const std::span<PcgEngine> engines,
+                              const std::span<ValueT> out) noexcept -> std::size_t;
+
   //! Generate a base of a random number
   auto generateBase() noexcept -> ValueT;
 
   //! Return the default increment
-  static constexpr auto increment() noexcept -> ValueT;
+  static constexpr auto defaultIncrement() noexcept -> ValueT;
 
   //! Return the default multiplier
   static constexpr auto mcgMultiplier() noexcept -> ValueT;
@@ -99,6 +125,7 @@ class PcgEngine : public PseudoRandomNumberEngine<PcgEngine<T, kBase>, T>
 
 
   ValueT state_;
+  ValueT increment_ = defaultIncrement();
 };
 
 // Type aliases
@@ -0,0 +1,289 @@
+/*!
+  \file philox_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_PHILOX_ENGINE_INL_HPP
+#define ZISC_PHILOX_ENGINE_INL_HPP
+
+#include "philox_engine.hpp"
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+// Zisc
+#include "counter_based_engine.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] key No description.
+  */
+template <std::size_t kRounds> inline
+PhiloxEngine<kRounds>::PhiloxEngine(const KeyT& key) noexcept :
+    BaseEngineT(key)
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] key No description.
+  \param [in] counter No description.
+  \return No description
+  */
+template <std::size_t kRounds> inline
+auto PhiloxEngine<kRounds>::generateBlock(KeyT key, CounterT counter) noexcept -> CounterT
+{
+  for (std::size_t round = 0; round < kRounds; ++round) {
+    if (0 < round) {
+      key[0] += weyl0();
+      key[1] += weyl1();
+    }
+    const uint64b p0 = cast<uint64b>(multiplier0()) * counter[0];
+    const uint64b p1 = cast<uint64b>(multiplier1()) * counter[2];
+    counter = {{cast<ValueT>(p1 >> 32) ^ counter[1] ^ key[0],
+                cast<ValueT>(p1),
+                cast<ValueT>(p0 >> 32) ^ counter[3] ^ key[1],
+                cast<ValueT>(p0)}};
+  }
+  return counter;
+}
+
+/*!
+  \details The counters are processed in the structure of arrays layout,
+  so a vector of the word i has the word i of the several counters.
+  Two vectors are processed at once to hide the latency of the multiplications.
+  32bit x 32bit = 64bit multiplications of the even and odd lanes are
+  computed separately and the high and low halves are gathered
+
+  \param [in] key No description.
+  \param [in] first No description.
+  \param [out] out No description.
+  \return The number of the counters processed
+  */
+template <std::size_t kRounds> inline
+auto PhiloxEngine<kRounds>::generateBlocks(
+    [[maybe_unused]] const KeyT& key,
+    [[maybe_unused]] const CounterT& first,
+    [[maybe_unused]] const std::span<ValueT> out) noexcept -> std::size_t
+{
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  constexpr std::size_t l = sizeof(__m256i) / sizeof(ValueT);
+  const std::size_t num_of_blocks = out.size() / 4;
+  const __m256i m0 = _mm256_set1_epi32(cast<int>(multiplier0()));
+  const __m256i m1 = _mm256_set1_epi32(cast<int>(multiplier1()));
+  constexpr std::size_t num_of_vectors = 2;
+  const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i lo_mask = _mm256_set1_epi64x(0xffff'ffffLL);
+  auto mulhilo = [lo_mask](const __m256i a, const __m256i m, __m256i* hi) noexcept
+  {
+    const __m256i p_even = _mm256_mul_epu32(a, m);
+    const __m256i p_odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+    *hi = _mm256_or_si256(_mm256_srli_epi64(p_even, 32), _mm256_andnot_si256(lo_mask, p_odd));
+    return _mm256_or_si256(_mm256_and_si256(p_even, lo_mask), _mm256_slli_epi64(p_odd, 32));
+  };
+  CounterT counter = first;
+  for (; (i + num_of_vectors * l) <= num_of_blocks; i += num_of_vectors * l) {
+    // Load the counters in the structure of arrays layout
+    __m256i c[num_of_vectors][4]; // The attributes of __m256i are lost in std::array
+    alignas(sizeof(__m256i)) std::array<ValueT, l> lanes;
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      if (counter[0] <= (std::numeric_limits<ValueT>::max)() - (l - 1)) {
+        // The lower words don't carry in the lanes
+        c[v][0] = _mm256_add_epi32(_mm256_set1_epi32(cast<int>(counter[0])), iota);
+        for (std::size_t w = 1; w < 4; ++w)
+          c[v][w] = _mm256_set1_epi32(cast<int>(counter[w]));
+        counter = BaseEngineT::advanceCounter(counter, l);
+      }
+      else {
+        for (std::size_t w = 0; w < 4; ++w) {
+          CounterT cnt = counter;
+          for (std::size_t j = 0; j < l; ++j) {
+            lanes[j] = cnt[w];
+            cnt = BaseEngineT::advanceCounter(cnt, 1);
+          }
+          c[v][w] = _mm256_load_si256(reinterp<const __m256i*>(lanes.data()));
+        }
+        counter = BaseEngineT::advanceCounter(counter, l);
+      }
+    }
+    KeyT k = key;
+    for (std::size_t round = 0; round < kRounds; ++round) {
+      if (0 < round) {
+        k[0] += weyl0();
+        k[1] += weyl1();
+      }
+      const __m256i k0 = _mm256_set1_epi32(cast<int>(k[0]));
+      const __m256i k1 = _mm256_set1_epi32(cast<int>(k[1]));
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        __m256i hi0;
+        __m256i hi1;
+        const __m256i lo0 = mulhilo(c[v][0], m0, &hi0);
+        const __m256i lo1 = mulhilo(c[v][2], m1, &hi1);
+        c[v][0] = _mm256_xor_si256(_mm256_xor_si256(hi1, c[v][1]), k0);
+        c[v][1] = lo1;
+        c[v][2] = _mm256_xor_si256(_mm256_xor_si256(hi0, c[v][3]), k1);
+        c[v][3] = lo0;
+      }
+    }
+    // Transpose the results into the array of structures layout
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      const __m256i t0 = _mm256_unpacklo_epi32(c[v][0], c[v][1]);
+      const __m256i t1 = _mm256_unpacklo_epi32(c[v][2], c[v][3]);
+      const __m256i t2 = _mm256_unpackhi_epi32(c[v][0], c[v][1]);
+      const __m256i t3 = _mm256_unpackhi_epi32(c[v][2], c[v][3]);
+      const __m256i b0 = _mm256_unpacklo_epi64(t0, t1); // block 0 and 4
+      const __m256i b1 = _mm256_unpackhi_epi64(t0, t1); // block 1 and 5
+      const __m256i b2 = _mm256_unpacklo_epi64(t2, t3); // block 2 and 6
+      const __m256i b3 = _mm256_unpackhi_epi64(t2, t3); // block 3 and 7
+      auto* o = reinterp<__m256i*>(out.data() + 4 * (i + v * l));
+      _mm256_storeu_si256(o + 0, _mm256_permute2x128_si256(b0, b1, 0x20));
+      _mm256_storeu_si256(o + 1, _mm256_permute2x128_si256(b2, b3, 0x20));
+      _mm256_storeu_si256(o + 2, _mm256_permute2x128_si256(b0, b1, 0x31));
+      _mm256_storeu_si256(o + 3, _mm256_permute2x128_si256(b2, b3, 0x31));
+    }
+  }
+#elif defined(__SSE2__)
+  constexpr std::size_t l = sizeof(__m128i) / sizeof(ValueT);
+  const std::size_t num_of_blocks = out.size() / 4;
+  const __m128i m0 = _mm_set1_epi32(cast<int>(multiplier0()));
+  const __m128i m1 = _mm_set1_epi32(cast<int>(multiplier1()));
+  constexpr std::size_t num_of_vectors = 2;
+  const __m128i iota = _mm_setr_epi32(0, 1, 2, 3);
+  const __m128i lo_mask = _mm_set1_epi64x(0xffff'ffffLL);
+  auto mulhilo = [lo_mask](const __m128i a, const __m128i m, __m128i* hi) noexcept
+  {
+    const __m128i p_even = _mm_mul_epu32(a, m);
+    const __m128i p_odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+    *hi = _mm_or_si128(_mm_srli_epi64(p_even, 32), _mm_andnot_si128(lo_mask, p_odd));
+    return _mm_or_si128(_mm_and_si128(p_even, lo_mask), _mm_slli_epi64(p_odd, 32));
+  };
+  CounterT counter = first;
+  for (; (i + num_of_vectors * l) <= num_of_blocks; i += num_of_vectors * l) {
+    // Load the counters in the structure of arrays layout
+    __m128i c[num_of_vectors][4]; // The attributes of __m128i are lost in std::array
+    alignas(sizeof(__m128i)) std::array<ValueT, l> lanes;
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      if (counter[0] <= (std::numeric_limits<ValueT>::max)() - (l - 1)) {
+        // The lower words don't carry in the lanes
+        c[v][0] = _mm_add_epi32(_mm_set1_epi32(cast<int>(counter[0])), iota);
+        for (std::size_t w = 1; w < 4; ++w)
+          c[v][w] = _mm_set1_epi32(cast<int>(counter[w]));
+        counter = BaseEngineT::advanceCounter(counter, l);
+      }
+      else {
+        for (std::size_t w = 0; w < 4; ++w) {
+          CounterT cnt = counter;
+          for (std::size_t j = 0; j < l; ++j) {
+            lanes[j] = cnt[w];
+            cnt = BaseEngineT::advanceCounter(cnt, 1);
+          }
+          c[v][w] = _mm_load_si128(reinterp<const __m128i*>(lanes.data()));
+        }
+        counter = BaseEngineT::advanceCounter(counter, l);
+      }
+    }
+    KeyT k = key;
+    for (std::size_t round = 0; round < kRounds; ++round) {
+      if (0 < round) {
+        k[0] += weyl0();
+        k[1] += weyl1();
+      }
+      const __m128i k0 = _mm_set1_epi32(cast<int>(k[0]));
+      const __m128i k1 = _mm_set1_epi32(cast<int>(k[1]));
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        __m128i hi0;
+        __m128i hi1;
+        const __m128i lo0 = mulhilo(c[v][0], m0, &hi0);
+        const __m128i lo1 = mulhilo(c[v][2], m1, &hi1);
+        c[v][0] = _mm_xor_si128(_mm_xor_si128(hi1, c[v][1]), k0);
+        c[v][1] = lo1;
+        c[v][2] = _mm_xor_si128(_mm_xor_si128(hi0, c[v][3]), k1);
+        c[v][3] = lo0;
+      }
+    }
+    // Transpose the results into the array of structures layout
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      const __m128i t0 = _mm_unpacklo_epi32(c[v][0], c[v][1]);
+      const __m128i t1 = _mm_unpacklo_epi32(c[v][2], c[v][3]);
+      const __m128i t2 = _mm_unpackhi_epi32(c[v][0], c[v][1]);
+      const __m128i t3 = _mm_unpackhi_epi32(c[v][2], c[v][3]);
+      auto* o = reinterp<__m128i*>(out.data() + 4 * (i + v * l));
+      _mm_storeu_si128(o + 0, _mm_unpacklo_epi64(t0, t1));
+      _mm_storeu_si128(o + 1, _mm_unpackhi_epi64(t0, t1));
+      _mm_storeu_si128(o + 2, _mm_unpacklo_epi64(t2, t3));
+      _mm_storeu_si128(o + 3, _mm_unpackhi_epi64(t2, t3));
+    }
+  }
+#endif
+  return i;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::size_t kRounds> inline
+constexpr auto PhiloxEngine<kRounds>::multiplier0() noexcept -> ValueT
+{
+  return 0xD2511F53U;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::size_t kRounds> inline
+constexpr auto PhiloxEngine<kRounds>::multiplier1() noexcept -> ValueT
+{
+  return 0xCD9E8D57U;
+}
+
+/*!
+  \details The golden ratio
+
+  \return No description
+  */
+template <std::size_t kRounds> inline
+constexpr auto PhiloxEngine<kRounds>::weyl0() noexcept -> ValueT
+{
+  return 0x9E3779B9U;
+}
+
+/*!
+  \details sqrt(3) - 1
+
+  \return No description
+  */
+template <std::size_t kRounds> inline
+constexpr auto PhiloxEngine<kRounds>::weyl1() noexcept -> ValueT
+{
+  return 0xBB67AE85U;
+}
+
+} // namespace zisc
+
+#endif // ZISC_PHILOX_ENGINE_INL_HPP
@@ -0,0 +1,84 @@
+/*!
+  \file philox_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_PHILOX_ENGINE_HPP
+#define ZISC_PHILOX_ENGINE_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <span>
+// Zisc
+#include "counter_based_engine.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Philox4x32 counter-based generator
+
+  Philox generates four 32bit random numbers from a 128bit counter and
+  a 64bit key with kRounds rounds of multiplications.
+  The results are identical to the Random123 implementation.
+
+  \tparam kRounds The number of rounds. 10 passes BigCrush.
+  \note No notation.
+  \attention No attention.
+  */
+template <std::size_t kRounds>
+class PhiloxEngine : public CounterBasedEngine<PhiloxEngine<kRounds>, uint32b, 4, 2>
+{
+ public:
+  using BaseEngineT = CounterBasedEngine<PhiloxEngine, uint32b, 4, 2>;
+  using ValueT = typename BaseEngineT::ValueT;
+  using CounterT = typename BaseEngineT::CounterT;
+  using KeyT = typename BaseEngineT::KeyT;
+
+
+  //! Initialize the engine with the zero key
+  PhiloxEngine() noexcept = default;
+
+  //! Initialize the engine with the given key
+  explicit PhiloxEngine(const KeyT& key) noexcept;
+
+
+  //! Generate random numbers of the given key and counter
+  static auto generateBlock(KeyT key, CounterT counter) noexcept -> CounterT;
+
+  //! Generate random numbers of the successive counters with SIMD instructions
+  static auto generateBlocks(const KeyT& key,
+                             const CounterT& first,
+                             const std::span<ValueT> out) noexcept -> std::size_t;
+
+ private:
+  //! Return the multiplier of the word 0
+  static constexpr auto multiplier0() noexcept -> ValueT;
+
+  //! Return the multiplier of the word 2
+  static constexpr auto multiplier1() noexcept -> ValueT;
+
+  //! Return the key increment of the word 0
+  static constexpr auto weyl0() noexcept -> ValueT;
+
+  //! Return the key increment of the word 1
+  static constexpr auto weyl1() noexcept -> ValueT;
+};
+
+// Type aliases
+using Philox4x32 = PhiloxEngine<10>;
+
+} // namespace zisc
+
+#include "philox_engine-inl.hpp"
+
+#endif // ZISC_PHILOX_ENGINE_HPP
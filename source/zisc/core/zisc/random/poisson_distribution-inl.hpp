@@ -0,0 +1,214 @@
+/*!
+  \file poisson_distribution-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_POISSON_DISTRIBUTION_INL_HPP
+#define ZISC_POISSON_DISTRIBUTION_INL_HPP
+
+#include "poisson_distribution.hpp"
+// Standard C++ library
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <numbers>
+#include <span>
+// Zisc
+#include "distribution.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+  */
+template <std::integral Int> inline
+PoissonDistribution<Int>::PoissonDistribution() noexcept
+{
+  initialize(1.0);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] mean No description.
+  */
+template <std::integral Int> inline
+PoissonDistribution<Int>::PoissonDistribution(const double mean) noexcept
+{
+  initialize(mean);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::integral Int>
+template <RandomNumberEngine Engine> inline
+auto PoissonDistribution<Int>::operator()(Engine& engine) const noexcept -> ValueT
+{
+  return generate(engine);
+}
+
+/*!
+  \details The method is selected once for all random numbers
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [out] out No description.
+  */
+template <std::integral Int>
+template <RandomNumberEngine Engine> inline
+void PoissonDistribution<Int>::fill(Engine& engine, const std::span<ValueT> out) const noexcept
+{
+  if (mean_ < kPtrsThreshold) {
+    for (ValueT& k : out)
+      k = generateMultiplication(engine);
+  }
+  else {
+    for (ValueT& k : out)
+      k = generatePtrs(engine);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::integral Int>
+template <RandomNumberEngine Engine> inline
+auto PoissonDistribution<Int>::generate(Engine& engine) const noexcept -> ValueT
+{
+  return (mean_ < kPtrsThreshold) ? generateMultiplication(engine)
+                                  : generatePtrs(engine);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::integral Int> inline
+auto PoissonDistribution<Int>::mean() const noexcept -> double
+{
+  return mean_;
+}
+
+/*!
+  \details The expected number of uniform random numbers is mean + 1
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::integral Int>
+template <RandomNumberEngine Engine> inline
+auto PoissonDistribution<Int>::generateMultiplication(Engine& engine) const noexcept
+    -> ValueT
+{
+  ValueT k = 0;
+  for (double p = Distribution::generate01<double>(engine);
+       exp_neg_mean_ < p;
+       p *= Distribution::generate01<double>(engine))
+    ++k;
+  return k;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <std::integral Int>
+template <RandomNumberEngine Engine> inline
+auto PoissonDistribution<Int>::generatePtrs(Engine& engine) const noexcept -> ValueT
+{
+  for (;;) {
+    const double u = Distribution::generate01<double>(engine) - 0.5;
+    const double v = Distribution::generateOpen01<double>(engine);
+    const double us = 0.5 - std::abs(u);
+    const double k = std::floor((2.0 * a_ / us + b_) * u + mean_ + 0.43);
+    // The squeeze
+    if ((0.07 <= us) && (v <= vr_))
+      return cast<ValueT>(k);
+    if ((k < 0.0) || ((us < 0.013) && (us < v)))
+      continue;
+    const double lhs = std::log(v) + log_inv_alpha_ - std::log(a_ / (us * us) + b_);
+    const double rhs = -mean_ + k * log_mean_ - logGamma(k + 1.0);
+    if (lhs <= rhs)
+      return cast<ValueT>(k);
+  }
+}
+
+/*!
+  \details std::lgamma() isn't used since it may not be thread safe.
+  The Stirling series is evaluated after the argument is shifted to 7 or more
+
+  \param [in] x No description.
+  \return No description
+  */
+template <std::integral Int> inline
+auto PoissonDistribution<Int>::logGamma(double x) noexcept -> double
+{
+  constexpr std::array<double, 10> coefficients = {{
+      8.333333333333333e-02, -2.777777777777778e-03,
+      7.936507936507937e-04, -5.952380952380952e-04,
+      8.417508417508418e-04, -1.917526917526918e-03,
+      6.410256410256410e-03, -2.955065359477124e-02,
+      1.796443723688307e-01, -1.39243221690590e+00}};
+  if ((x == 1.0) || (x == 2.0))
+    return 0.0;
+
+  const std::size_t n = (x < 7.0) ? cast<std::size_t>(7.0 - x) : 0;
+  x += cast<double>(n);
+  const double x2 = 1.0 / (x * x);
+  double g = coefficients.back();
+  for (std::size_t i = coefficients.size() - 1; 0 < i; --i)
+    g = g * x2 + coefficients[i - 1];
+  g = g / x + 0.5 * std::log(2.0 * std::numbers::pi) + (x - 0.5) * std::log(x) - x;
+  for (std::size_t i = 0; i < n; ++i) {
+    x -= 1.0;
+    g -= std::log(x);
+  }
+  return g;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] mean No description.
+  */
+template <std::integral Int> inline
+void PoissonDistribution<Int>::initialize(const double mean) noexcept
+{
+  mean_ = mean;
+  exp_neg_mean_ = std::exp(-mean);
+  log_mean_ = std::log(mean);
+  b_ = 0.931 + 2.53 * std::sqrt(mean);
+  a_ = -0.059 + 0.02483 * b_;
+  log_inv_alpha_ = std::log(1.1239 + 1.1328 / (b_ - 3.4));
+  vr_ = 0.9277 - 3.6224 / (b_ - 2.0);
+}
+
+} // namespace zisc
+
+#endif // ZISC_POISSON_DISTRIBUTION_INL_HPP
@@ -0,0 +1,104 @@
+/*!
+  \file poisson_distribution.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_POISSON_DISTRIBUTION_HPP
+#define ZISC_POISSON_DISTRIBUTION_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <span>
+// Zisc
+#include "distribution.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Poisson distribution
+
+  A small mean is sampled by multiplying uniform random numbers.
+  A large mean is sampled by the transformed rejection with squeeze (PTRS),
+  which takes constant time regardless of the mean.
+  The constants of the both methods are computed in the constructor.
+  For more detail, please see the following paper:
+  <a href="https://doi.org/10.1016/0167-6687(93)90997-4">The transformed rejection method for generating Poisson random variables</a>.
+
+  \tparam Int No description.
+  \note No notation.
+  \attention No attention.
+  */
+template <std::integral Int>
+class PoissonDistribution
+{
+ public:
+  using ValueT = Int;
+
+
+  //! Initialize the distribution of mean 1
+  PoissonDistribution() noexcept;
+
+  //! Initialize the distribution
+  explicit PoissonDistribution(const double mean) noexcept;
+
+
+  //! Generate a random number
+  template <RandomNumberEngine Engine>
+  auto operator()(Engine& engine) const noexcept -> ValueT;
+
+
+  //! Fill the given span with random numbers
+  template <RandomNumberEngine Engine>
+  void fill(Engine& engine, const std::span<ValueT> out) const noexcept;
+
+  //! Generate a random number
+  template <RandomNumberEngine Engine>
+  auto generate(Engine& engine) const noexcept -> ValueT;
+
+  //! Return the mean
+  auto mean() const noexcept -> double;
+
+ private:
+  //! The mean from which the PTRS is used
+  static constexpr double kPtrsThreshold = 10.0;
+
+
+  //! Generate a random number by the multiplication method
+  template <RandomNumberEngine Engine>
+  auto generateMultiplication(Engine& engine) const noexcept -> ValueT;
+
+  //! Generate a random number by the PTRS
+  template <RandomNumberEngine Engine>
+  auto generatePtrs(Engine& engine) const noexcept -> ValueT;
+
+  //! Return the log of the gamma function
+  static auto logGamma(double x) noexcept -> double;
+
+  //! Initialize the constants of the sampling
+  void initialize(const double mean) noexcept;
+
+
+  double mean_;
+  double exp_neg_mean_;
+  double log_mean_;
+  double a_;
+  double b_;
+  double log_inv_alpha_;
+  double vr_;
+};
+
+} // namespace zisc
+
+#include "poisson_distribution-inl.hpp"
+
+#endif // ZISC_POISSON_DISTRIBUTION_HPP
@@ -17,8 +17,12 @@
 
 #include "pseudo_random_number_engine.hpp"
 // Standard C++ library
+#include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <type_traits>
 // Zisc
 #include "zisc/utility.hpp"
@@ -73,6 +77,54 @@ constexpr auto PseudoRandomNumberEngine<GeneratorClass, T>::defaultSeed() noexce
   return seed;
 }
 
+/*!
+  \details The generator class can provide fillValues() which generates
+  random numbers in bulk. Otherwise generate() is called for each element.
+  The result is the same sequence as calling generate() repeatedly
+
+  \param [out] out No description.
+  */
+template <typename GeneratorClass, std::unsigned_integral T> inline
+void PseudoRandomNumberEngine<GeneratorClass, T>::fill(const std::span<ValueT> out) noexcept
+{
+  auto* generator = static_cast<GeneratorT*>(this);
+  if constexpr (requires {generator->fillValues(out);}) {
+    generator->fillValues(out);
+  }
+  else {
+    // The state can be kept in registers since the chunk doesn't alias it
+    constexpr std::size_t chunk_size = 64;
+    std::array<ValueT, chunk_size> chunk;
+    for (std::size_t i = 0; i < out.size(); i += chunk_size) {
+      const std::size_t n = (std::min)(chunk_size, out.size() - i);
+      for (std::size_t j = 0; j < n; ++j)
+        chunk[j] = generator->generate();
+      std::copy_n(chunk.begin(), n, out.begin() + i);
+    }
+  }
+}
+
+/*!
+  \details The result is the same sequence as calling generate01() repeatedly
+
+  \tparam Float No description.
+  \param [out] out No description.
+  */
+template <typename GeneratorClass, std::unsigned_integral T>
+template <std::floating_point Float> inline
+void PseudoRandomNumberEngine<GeneratorClass, T>::fill01(const std::span<Float> out) noexcept
+{
+  // Integer random numbers are generated in chunks and mapped to floats
+  constexpr std::size_t chunk_size = 256;
+  std::array<ValueT, chunk_size> chunk;
+  for (std::size_t i = 0; i < out.size(); i += chunk_size) {
+    const std::size_t n = (std::min)(chunk_size, out.size() - i);
+    fill(std::span{chunk.data(), n});
+    for (std::size_t j = 0; j < n; ++j)
+      out[i + j] = mapTo01<Float>(chunk[j]);
+  }
+}
+
 /*!
   \details No detailed description
 
@@ -18,6 +18,7 @@
 // Standard C++ library
 #include <concepts>
 #include <cstdint>
+#include <span>
 // Zisc
 #include "zisc/zisc_config.hpp"
 
@@ -54,6 +55,13 @@ class PseudoRandomNumberEngine
   //! Return the default seed
   static constexpr auto defaultSeed() noexcept -> ValueT;
 
+  //! Fill the given span with random numbers
+  void fill(const std::span<ValueT> out) noexcept;
+
+  //! Fill the given span with [0, 1) float random numbers
+  template <std::floating_point Float>
+  void fill01(const std::span<Float> out) noexcept;
+
   //! Generate a random number
   auto generate() noexcept -> ValueT;
 
@@ -0,0 +1,180 @@
+/*!
+  \file r_sequence_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_R_SEQUENCE_ENGINE_INL_HPP
+#define ZISC_R_SEQUENCE_ENGINE_INL_HPP
+
+#include "r_sequence_engine.hpp"
+// Standard C++ library
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] index No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto RSequenceEngine::generate1d(const ValueT index, const ValueT seed) noexcept -> Float
+{
+  const uint64b x = sample(index, r1Alpha(), shift(seed, 0));
+  return mapTo01<Float>(x);
+}
+
+/*!
+  \details A sample is computed from the previous sample with an addition
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] seed No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float> inline
+void RSequenceEngine::generate1d(const ValueT first,
+                                 const ValueT seed,
+                                 const std::span<Float> out) noexcept
+{
+  constexpr uint64b alpha = r1Alpha();
+  const uint64b s = shift(seed, 0);
+  uint64b x = sample(first, alpha, s);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    // The index wraps around to zero after the maximum index
+    if ((0 < i) && (first + cast<ValueT>(i) == 0))
+      x = sample(0, alpha, s);
+    out[i] = mapTo01<Float>(x);
+    x += alpha;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] index No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto RSequenceEngine::generate2d(const ValueT index, const ValueT seed) noexcept
+    -> std::array<Float, 2>
+{
+  constexpr std::array<uint64b, 2> alpha = r2Alpha();
+  const uint64b x = sample(index, alpha[0], shift(seed, 0));
+  const uint64b y = sample(index, alpha[1], shift(seed, 1));
+  return std::array<Float, 2>{{mapTo01<Float>(x), mapTo01<Float>(y)}};
+}
+
+/*!
+  \details A sample is computed from the previous sample with additions
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] seed No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float> inline
+void RSequenceEngine::generate2d(const ValueT first,
+                                 const ValueT seed,
+                                 const std::span<std::array<Float, 2>> out) noexcept
+{
+  constexpr std::array<uint64b, 2> alpha = r2Alpha();
+  const std::array<uint64b, 2> s = {{shift(seed, 0), shift(seed, 1)}};
+  uint64b x = sample(first, alpha[0], s[0]);
+  uint64b y = sample(first, alpha[1], s[1]);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    // The index wraps around to zero after the maximum index
+    if ((0 < i) && (first + cast<ValueT>(i) == 0)) {
+      x = sample(0, alpha[0], s[0]);
+      y = sample(0, alpha[1], s[1]);
+    }
+    out[i] = {{mapTo01<Float>(x), mapTo01<Float>(y)}};
+    x += alpha[0];
+    y += alpha[1];
+  }
+}
+
+/*!
+  \details The inverse of the golden ratio
+
+  \return No description
+  */
+inline
+constexpr auto RSequenceEngine::r1Alpha() noexcept -> uint64b
+{
+  return 0x9e3779b97f4a7c15ULL;
+}
+
+/*!
+  \details The inverse and the inverse square of the plastic number,
+  which is the real root of x^3 = x + 1
+
+  \return No description
+  */
+inline
+constexpr auto RSequenceEngine::r2Alpha() noexcept -> std::array<uint64b, 2>
+{
+  return {{0xc13fa9a902a6328fULL, 0x91e10da5c79e7b1dULL}};
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \param [in] alpha No description.
+  \param [in] shift No description.
+  \return No description
+  */
+inline
+constexpr auto RSequenceEngine::sample(const ValueT index,
+                                       const uint64b alpha,
+                                       const uint64b shift) noexcept -> uint64b
+{
+  constexpr uint64b half = uint64b{1} << 63;
+  return half + cast<uint64b>(index) * alpha + shift;
+}
+
+/*!
+  \details The seed zero gives the original sequence.
+  Otherwise, the finalizer of MurmurHash3 scatters the seed and the dimension
+
+  \param [in] seed No description.
+  \param [in] dimension No description.
+  \return No description
+  */
+inline
+constexpr auto RSequenceEngine::shift(const ValueT seed, const ValueT dimension) noexcept
+    -> uint64b
+{
+  uint64b k = (cast<uint64b>(seed) << 32) | dimension;
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ULL;
+  k ^= k >> 33;
+  return (seed == 0) ? 0 : k;
+}
+
+} // namespace zisc
+
+#endif // ZISC_R_SEQUENCE_ENGINE_INL_HPP
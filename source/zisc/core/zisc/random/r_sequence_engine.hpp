@@ -0,0 +1,88 @@
+/*!
+  \file r_sequence_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_R_SEQUENCE_ENGINE_HPP
+#define ZISC_R_SEQUENCE_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Additive recurrence low-discrepancy sequences (R1 and R2)
+
+  The sample n is frac(1/2 + n * alpha), where alpha is the inverse of
+  the golden ratio for R1 and the inverses of the powers of the plastic number for R2.
+  The samples are computed in 64bit fixed point, so they don't lose precision
+  with large indices.
+  A non-zero seed applies a random toroidal shift (Cranley-Patterson rotation).
+  For more detail, please see the following article:
+  <a href="http://extremelearning.com.au/unreasonable-effectiveness-of-quasirandom-sequences/">The Unreasonable Effectiveness of Quasirandom Sequences</a>.
+
+  \note No notation.
+  \attention No attention.
+  */
+class RSequenceEngine
+{
+ public:
+  using ValueT = uint32b;
+
+
+  //! Generate a [0, 1) float sample of the R1 sequence
+  template <std::floating_point Float>
+  static auto generate1d(const ValueT index, const ValueT seed = 0) noexcept -> Float;
+
+  //! Generate [0, 1) float samples of the R1 sequence from the given index
+  template <std::floating_point Float>
+  static void generate1d(const ValueT first,
+                         const ValueT seed,
+                         const std::span<Float> out) noexcept;
+
+  //! Generate [0, 1) float samples of the R2 sequence
+  template <std::floating_point Float>
+  static auto generate2d(const ValueT index, const ValueT seed = 0) noexcept
+      -> std::array<Float, 2>;
+
+  //! Generate [0, 1) float samples of the R2 sequence from the given index
+  template <std::floating_point Float>
+  static void generate2d(const ValueT first,
+                         const ValueT seed,
+                         const std::span<std::array<Float, 2>> out) noexcept;
+
+  //! Return the alpha of the R1 sequence in 64bit fixed point
+  static constexpr auto r1Alpha() noexcept -> uint64b;
+
+  //! Return the alphas of the R2 sequence in 64bit fixed point
+  static constexpr auto r2Alpha() noexcept -> std::array<uint64b, 2>;
+
+  //! Return the 64bit fixed point sample of the given index
+  static constexpr auto sample(const ValueT index,
+                               const uint64b alpha,
+                               const uint64b shift) noexcept -> uint64b;
+
+  //! Return the random shift of the given dimension
+  static constexpr auto shift(const ValueT seed, const ValueT dimension) noexcept -> uint64b;
+};
+
+} // namespace zisc
+
+#include "r_sequence_engine-inl.hpp"
+
+#endif // ZISC_R_SEQUENCE_ENGINE_HPP
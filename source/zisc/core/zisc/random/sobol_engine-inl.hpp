@@ -0,0 +1,491 @@
+/*!
+  \file sobol_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_SOBOL_ENGINE_INL_HPP
+#define ZISC_SOBOL_ENGINE_INL_HPP
+
+#include "sobol_engine.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "owen_scrambler.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] index No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+auto SobolEngine<kScrambling>::generate1d(const ValueT index,
+                                          const ValueT dimension,
+                                          const ValueT seed) noexcept -> Float
+{
+  ZISC_ASSERT(dimension < maxDimension(), "The dimension is out of range.");
+  const ValueT x = sample(index, dimension, seed);
+  return mapTo01<Float>(x);
+}
+
+/*!
+  \details The samples are computed in chunks.
+  In a chunk, a sample is computed from the previous sample with an xor,
+  and the scrambling is applied to the whole chunk with SIMD instructions
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \param [out] out No description.
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+void SobolEngine<kScrambling>::generate1d(const ValueT first,
+                                          const ValueT dimension,
+                                          const ValueT seed,
+                                          const std::span<Float> out) noexcept
+{
+  ZISC_ASSERT(dimension < maxDimension(), "The dimension is out of range.");
+  std::array<ValueT, kChunkSize> chunk{};
+  for (std::size_t i = 0; i < out.size(); i += kChunkSize) {
+    const std::size_t n = (std::min)(kChunkSize, out.size() - i);
+    generateChunk(first + cast<ValueT>(i), dimension, seed, {chunk.data(), n});
+    for (std::size_t j = 0; j < n; ++j)
+      out[i + j] = mapTo01<Float>(chunk[j]);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] index No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+auto SobolEngine<kScrambling>::generate2d(const ValueT index,
+                                          const ValueT dimension,
+                                          const ValueT seed) noexcept
+    -> std::array<Float, 2>
+{
+  ZISC_ASSERT(dimension + 1 < maxDimension(), "The dimension is out of range.");
+  const ValueT x = sample(index, dimension, seed);
+  const ValueT y = sample(index, dimension + 1, seed);
+  return std::array<Float, 2>{{mapTo01<Float>(x), mapTo01<Float>(y)}};
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] first No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \param [out] out No description.
+  */
+template <SequenceScrambling kScrambling> template <std::floating_point Float> inline
+void SobolEngine<kScrambling>::generate2d(const ValueT first,
+                                          const ValueT dimension,
+                                          const ValueT seed,
+                                          const std::span<std::array<Float, 2>> out) noexcept
+{
+  ZISC_ASSERT(dimension + 1 < maxDimension(), "The dimension is out of range.");
+  std::array<ValueT, kChunkSize> chunk_x{};
+  std::array<ValueT, kChunkSize> chunk_y{};
+  for (std::size_t i = 0; i < out.size(); i += kChunkSize) {
+    const std::size_t n = (std::min)(kChunkSize, out.size() - i);
+    generateChunk(first + cast<ValueT>(i), dimension, seed, {chunk_x.data(), n});
+    generateChunk(first + cast<ValueT>(i), dimension + 1, seed, {chunk_y.data(), n});
+    for (std::size_t j = 0; j < n; ++j)
+      out[i + j] = {{mapTo01<Float>(chunk_x[j]), mapTo01<Float>(chunk_y[j])}};
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto SobolEngine<kScrambling>::maxDimension() noexcept -> std::size_t
+{
+  return kMaxDimension;
+}
+
+/*!
+  \details The MSB of the result is the first binary digit of the sample
+
+  \param [in] index No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto SobolEngine<kScrambling>::sample(const ValueT index,
+                                                const ValueT dimension,
+                                                const ValueT seed) noexcept -> ValueT
+{
+  const ValueT x = computeSample(index, dimension);
+  return scramble(x, dimensionSeed(dimension, seed));
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \param [in] dimension No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto SobolEngine<kScrambling>::computeSample(ValueT index,
+                                                       const ValueT dimension) noexcept
+    -> ValueT
+{
+  const std::array<ValueT, kNumOfBits>& v = kDirectionTable[dimension];
+  ValueT x = 0;
+  for (std::size_t j = 0; index != 0; index >>= 1, ++j)
+    x ^= (index & 1) ? v[j] : 0;
+  return x;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto SobolEngine<kScrambling>::dimensionSeed(const ValueT dimension,
+                                                       const ValueT seed) noexcept
+    -> ValueT
+{
+  return OwenScrambler::hash(OwenScrambler::hashCombine(seed, dimension));
+}
+
+/*!
+  \details The bits which change from i to i + 1 are the trailing ones of i and
+  the next bit, so x(i + 1) = x(i) ^ v[0] ^ ... ^ v[ctz(i + 1)]
+
+  \param [in] first No description.
+  \param [in] dimension No description.
+  \param [in] seed No description.
+  \param [out] chunk No description.
+  */
+template <SequenceScrambling kScrambling> inline
+void SobolEngine<kScrambling>::generateChunk(const ValueT first,
+                                             const ValueT dimension,
+                                             const ValueT seed,
+                                             const std::span<ValueT> chunk) noexcept
+{
+  const std::array<ValueT, kNumOfBits>& v = kDirectionTable[dimension];
+  std::array<ValueT, kNumOfBits> steps{};
+  for (std::size_t j = 0; j < kNumOfBits; ++j)
+    steps[j] = (0 < j) ? (steps[j - 1] ^ v[j]) : v[j];
+
+  ValueT x = computeSample(first, dimension);
+  for (std::size_t i = 0; i < chunk.size(); ++i) {
+    if (0 < i) {
+      const ValueT index = first + cast<ValueT>(i);
+      const auto j = cast<std::size_t>(std::countr_zero(index));
+      x ^= steps[(std::min)(j, kNumOfBits - 1)];
+    }
+    chunk[i] = x;
+  }
+
+  const ValueT s = dimensionSeed(dimension, seed);
+  if constexpr (kScrambling == SequenceScrambling::DigitPermutation) {
+    for (ValueT& value : chunk)
+      value ^= s;
+  }
+  else if constexpr (kScrambling == SequenceScrambling::Owen) {
+    OwenScrambler::scramble(chunk, s);
+  }
+}
+
+/*!
+  \details The initial direction numbers m_1, ..., m_s of each dimension,
+  where s is the degree of the primitive polynomial of the dimension.
+  The first dimension has no numbers
+
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto SobolEngine<kScrambling>::initialNumberList() noexcept
+    -> std::array<uint16b, kNumOfInitialNumbers>
+{
+  constexpr std::array<uint16b, kNumOfInitialNumbers> numbers{{
+    1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, 3, 3, 1, 3, 5,
+    13, 1, 1, 5, 5, 17, 1, 1, 5, 5, 5, 1, 1, 7, 11, 19,
+    1, 1, 5, 1, 1, 1, 1, 1, 3, 11, 1, 3, 5, 5, 31, 1,
+    3, 3, 9, 7, 49, 1, 1, 1, 15, 21, 21, 1, 3, 1, 13, 27,
+    49, 1, 1, 1, 15, 7, 5, 1, 3, 1, 15, 13, 25, 1, 1, 5,
+    5, 19, 61, 1, 3, 7, 11, 23, 15, 103, 1, 3, 7, 13, 13, 15,
+    69, 1, 1, 3, 13, 7, 35, 63, 1, 3, 5, 9, 1, 25, 53, 1,
+    3, 1, 13, 9, 35, 107, 1, 3, 1, 5, 27, 61, 31, 1, 1, 5,
+    11, 19, 41, 61, 1, 3, 5, 3, 3, 13, 69, 1, 1, 7, 13, 1,
+    19, 1, 1, 3, 7, 5, 13, 19, 59, 1, 1, 3, 9, 25, 29, 41,
+    1, 3, 5, 13, 23, 1, 55, 1, 3, 7, 3, 13, 59, 17, 1, 3,
+    1, 3, 5, 53, 69, 1, 1, 5, 5, 23, 33, 13, 1, 1, 7, 7,
+    1, 61, 123, 1, 1, 7, 9, 13, 61, 49, 1, 3, 3, 5, 3, 55,
+    33, 1, 3, 1, 15, 31, 13, 49, 245, 1, 3, 5, 15, 31, 59, 63,
+    97, 1, 3, 1, 11, 11, 11, 77, 249, 1, 3, 1, 11, 27, 43, 71,
+    9, 1, 1, 7, 15, 21, 11, 81, 45, 1, 3, 7, 3, 25, 31, 65,
+    79, 1, 3, 1, 1, 19, 11, 3, 205, 1, 1, 5, 9, 19, 21, 29,
+    157, 1, 3, 7, 11, 1, 33, 89, 185, 1, 3, 3, 3, 15, 9, 79,
+    71, 1, 3, 7, 11, 15, 39, 119, 27, 1, 1, 3, 1, 11, 31, 97,
+    225, 1, 1, 1, 3, 23, 43, 57, 177, 1, 3, 7, 7, 17, 17, 37,
+    71, 1, 3, 1, 5, 27, 63, 123, 213, 1, 1, 3, 5, 11, 43, 53,
+    133, 1, 3, 5, 5, 29, 17, 47, 173, 479, 1, 3, 3, 11, 3, 1,
+    109, 9, 69, 1, 1, 1, 5, 17, 39, 23, 5, 343, 1, 3, 1, 5,
+    25, 15, 31, 103, 499, 1, 1, 1, 11, 11, 17, 63, 105, 183, 1, 1,
+    5, 11, 9, 29, 97, 231, 363, 1, 1, 5, 15, 19, 45, 41, 7, 383,
+    1, 3, 7, 7, 31, 19, 83, 137, 221, 1, 1, 1, 3, 23, 15, 111,
+    223, 83, 1, 1, 5, 13, 31, 15, 55, 25, 161, 1, 1, 3, 13, 25,
+    47, 39, 87, 257, 1, 1, 1, 11, 21, 53, 125, 249, 293, 1, 1, 7,
+    11, 11, 7, 57, 79, 323, 1, 1, 5, 5, 17, 13, 81, 3, 131, 1,
+    1, 7, 13, 23, 7, 65, 251, 475, 1, 3, 5, 1, 9, 43, 3, 149,
+    11, 1, 1, 3, 13, 31, 13, 13, 255, 487, 1, 3, 3, 1, 5, 63,
+    89, 91, 127, 1, 1, 3, 3, 1, 19, 123, 127, 237, 1, 1, 5, 7,
+    23, 31, 37, 243, 289, 1, 1, 5, 11, 17, 53, 117, 183, 491, 1, 1,
+    1, 5, 1, 13, 13, 209, 345, 1, 1, 3, 15, 1, 57, 115, 7, 33,
+    1, 3, 1, 11, 7, 43, 81, 207, 175, 1, 3, 1, 1, 15, 27, 63,
+    255, 49, 1, 3, 5, 3, 27, 61, 105, 171, 305, 1, 1, 5, 3, 1,
+    3, 57, 249, 149, 1, 1, 3, 5, 5, 57, 15, 13, 159, 1, 1, 1,
+    11, 7, 11, 105, 141, 225, 1, 3, 3, 5, 27, 59, 121, 101, 271, 1,
+    3, 5, 9, 11, 49, 51, 59, 115, 1, 1, 7, 1, 23, 45, 125, 71,
+    419, 1, 1, 3, 5, 23, 5, 105, 109, 75, 1, 1, 7, 15, 7, 11,
+    67, 121, 453, 1, 3, 7, 3, 9, 13, 31, 27, 449, 1, 3, 1, 15,
+    19, 39, 39, 89, 15, 1, 1, 1, 1, 1, 33, 73, 145, 379, 1, 3,
+    1, 15, 15, 43, 29, 13, 483, 1, 1, 7, 3, 19, 27, 85, 131, 431,
+    1, 3, 3, 3, 5, 35, 23, 195, 349, 1, 3, 3, 7, 9, 27, 39,
+    59, 297, 1, 1, 3, 9, 11, 17, 13, 241, 157, 1, 3, 7, 15, 25,
+    57, 33, 189, 213, 1, 1, 7, 1, 9, 55, 73, 83, 217, 1, 3, 3,
+    13, 19, 27, 23, 113, 249, 1, 3, 5, 3, 23, 43, 3, 253, 479, 1,
+    1, 5, 5, 11, 5, 45, 117, 217, 1, 3, 3, 7, 29, 37, 33, 123,
+    147, 1, 3, 1, 15, 5, 5, 37, 227, 223, 459, 1, 1, 7, 5, 5,
+    39, 63, 255, 135, 487, 1, 3, 1, 7, 9, 7, 87, 249, 217, 599, 1,
+    1, 3, 13, 9, 47, 7, 225, 363, 247, 1, 3, 7, 13, 19, 13, 9,
+    67, 9, 737, 1, 3, 5, 5, 19, 59, 7, 41, 319, 677, 1, 1, 5,
+    3, 31, 63, 15, 43, 207, 789, 1, 1, 7, 9, 13, 39, 3, 47, 497,
+    169, 1, 3, 1, 7, 21, 17, 97, 19, 415, 905, 1, 3, 7, 1, 3,
+    31, 71, 111, 165, 127, 1, 1, 5, 11, 1, 61, 83, 119, 203, 847, 1,
+    3, 3, 13, 9, 61, 19, 97, 47, 35, 1, 1, 7, 7, 15, 29, 63,
+    95, 417, 469, 1, 3, 1, 9, 25, 9, 71, 57, 213, 385, 1, 3, 5,
+    13, 31, 47, 101, 57, 39, 341, 1, 1, 3, 3, 31, 57, 125, 173, 365,
+    551, 1, 3, 7, 1, 13, 57, 67, 157, 451, 707, 1, 1, 1, 7, 21,
+    13, 105, 89, 429, 965, 1, 1, 5, 9, 17, 51, 45, 119, 157, 141, 1,
+    3, 7, 7, 13, 45, 91, 9, 129, 741, 1, 3, 7, 1, 23, 57, 67,
+    141, 151, 571, 1, 1, 3, 11, 17, 47, 93, 107, 375, 157, 1, 3, 3,
+    5, 11, 21, 43, 51, 169, 915, 1, 1, 5, 3, 15, 55, 101, 67, 455,
+    625, 1, 3, 5, 9, 1, 23, 29, 47, 345, 595, 1, 3, 7, 7, 5,
+    49, 29, 155, 323, 589, 1, 3, 3, 7, 5, 41, 127, 61, 261, 717, 1,
+    3, 7, 7, 17, 23, 117, 67, 129, 1009, 1, 1, 3, 13, 11, 39, 21,
+    207, 123, 305, 1, 1, 3, 9, 29, 3, 95, 47, 231, 73, 1, 3, 1,
+    9, 1, 29, 117, 21, 441, 259, 1, 3, 1, 13, 21, 39, 125, 211, 439,
+    723, 1, 1, 7, 3, 17, 63, 115, 89, 49, 773, 1, 3, 7, 13, 11,
+    33, 101, 107, 63, 73, 1, 1, 5, 5, 13, 57, 63, 135, 437, 177, 1,
+    1, 3, 7, 27, 63, 93, 47, 417, 483, 1, 1, 3, 1, 23, 29, 1,
+    191, 49, 23, 1, 1, 3, 15, 25, 55, 9, 101, 219, 607, 1, 3, 1,
+    7, 7, 19, 51, 251, 393, 307, 1, 3, 3, 3, 25, 55, 17, 75, 337,
+    3, 1, 1, 1, 13, 25, 17, 65, 45, 479, 413, 1, 1, 7, 7, 27,
+    49, 99, 161, 213, 727, 1, 3, 5, 1, 23, 5, 43, 41, 251, 857, 1,
+    3, 3, 7, 11, 61, 39, 87, 383, 835, 1, 1, 3, 15, 13, 7, 29,
+    7, 505, 923, 1, 3, 7, 1, 5, 31, 47, 157, 445, 501, 1, 1, 3,
+    7, 1, 43, 9, 147, 115, 605, 1, 3, 3, 13, 5, 1, 119, 211, 455,
+    1001, 1, 1, 3, 5, 13, 19, 3, 243, 75, 843, 1, 3, 7, 7, 1,
+    19, 91, 249, 357, 589, 1, 1, 1, 9, 1, 25, 109, 197, 279, 411, 1,
+    3, 1, 15, 23, 57, 59, 135, 191, 75, 1, 1, 5, 15, 29, 21, 39,
+    253, 383, 349, 1, 3, 3, 5, 19, 45, 61, 151, 199, 981, 1, 3, 5,
+    13, 9, 61, 107, 141, 141, 1, 1, 3, 1, 11, 27, 25, 85, 105, 309,
+    979, 1, 3, 3, 11, 19, 7, 115, 223, 349, 43, 1, 1, 7, 9, 21,
+    39, 123, 21, 275, 927, 1, 1, 7, 13, 15, 41, 47, 243, 303, 437, 1,
+    1, 1, 7, 7, 3, 15, 99, 409, 719, 1, 3, 3, 15, 27, 49, 113,
+    123, 113, 67, 469, 1, 3, 7, 11, 3, 23, 87, 169, 119, 483, 199, 1,
+    1, 5, 15, 7, 17, 109, 229, 179, 213, 741, 1, 1, 5, 13, 11, 17,
+    25, 135, 403, 557, 1433, 1, 3, 1, 1, 1, 61, 67, 215, 189, 945, 1243,
+    1, 1, 7, 13, 17, 33, 9, 221, 429, 217, 1679, 1, 1, 3, 11, 27,
+    3, 15, 93, 93, 865, 1049, 1, 3, 7, 7, 25, 41, 121, 35, 373, 379,
+    1547, 1, 3, 3, 9, 11, 35, 45, 205, 241, 9, 59, 1, 3, 1, 7,
+    3, 51, 7, 177, 53, 975, 89, 1, 1, 3, 5, 27, 1, 113, 231, 299,
+    759, 861, 1, 3, 3, 15, 25, 29, 5, 255, 139, 891, 2031, 1, 3, 1,
+    1, 13, 9, 109, 193, 419, 95, 17, 1, 1, 7, 9, 3, 7, 29, 41,
+    135, 839, 867, 1, 1, 7, 9, 25, 49, 123, 217, 113, 909, 215, 1, 1,
+    7, 3, 23, 15, 43, 133, 217, 327, 901, 1, 1, 3, 3, 13, 53, 63,
+    123, 477, 711, 1387, 1, 1, 3, 15, 7, 29, 75, 119, 181, 957, 247, 1,
+    1, 1, 11, 27, 25, 109, 151, 267, 99, 1461, 1, 3, 7, 15, 5, 5,
+    53, 145, 11, 725, 1501, 1, 3, 7, 1, 9, 43, 71, 229, 157, 607, 1835,
+    1, 3, 3, 13, 25, 1, 5, 27, 471, 349, 127, 1, 1, 1, 1, 23,
+    37, 9, 221, 269, 897, 1685, 1, 1, 3, 3, 31, 29, 51, 19, 311, 553,
+    1969, 1, 3, 7, 5, 5, 55, 17, 39, 475, 671, 1529, 1, 1, 7, 1,
+    1, 35, 47, 27, 437, 395, 1635, 1, 1, 7, 3, 13, 23, 43, 135, 327,
+    139, 389, 1, 3, 7, 3, 9, 25, 91, 25, 429, 219, 513, 1, 1, 3,
+    5, 13, 29, 119, 201, 277, 157, 2043, 1, 3, 5, 3, 29, 57, 13, 17,
+    167, 739, 1031, 1, 3, 3, 5, 29, 21, 95, 27, 255, 679, 1531, 1, 3,
+    7, 15, 9, 5, 21, 71, 61, 961, 1201, 1, 3, 5, 13, 15, 57, 33,
+    93, 459, 867, 223, 1, 1, 1, 15, 17, 43, 127, 191, 67, 177, 1073, 1,
+    1, 1, 15, 23, 7, 21, 199, 75, 293, 1611, 1, 3, 7, 13, 15, 39,
+    21, 149, 65, 741, 319, 1, 3, 7, 11, 23, 13, 101, 89, 277, 519, 711,
+    1, 3, 7, 15, 19, 27, 85, 203, 441, 97, 1895, 1, 3, 1, 3, 29,
+    25, 21, 155, 11, 191, 197, 1, 1, 7, 5, 27, 11, 81, 101, 457, 675,
+    1687, 1, 3, 1, 5, 25, 5, 65, 193, 41, 567, 781, 1, 3, 1, 5,
+    11, 15, 113, 77, 411, 695, 1111, 1, 1, 3, 9, 11, 53, 119, 171, 55,
+    297, 509, 1, 1, 1, 1, 11, 39, 113, 139, 165, 347, 595, 1, 3, 7,
+    11, 9, 17, 101, 13, 81, 325, 1733, 1, 3, 1, 1, 21, 43, 115, 9,
+    113, 907, 645, 1, 1, 7, 3, 9, 25, 117, 197, 159, 471, 475, 1, 3,
+    1, 9, 11, 21, 57, 207, 485, 613, 1661, 1, 1, 7, 7, 27, 55, 49,
+    223, 89, 85, 1523, 1, 1, 5, 3, 19, 41, 45, 51, 447, 299, 1355, 1,
+    3, 1, 13, 1, 33, 117, 143, 313, 187, 1073, 1, 1, 7, 7, 5, 11,
+    65, 97, 377, 377, 1501, 1, 3, 1, 1, 21, 35, 95, 65, 99, 23, 1239,
+    1, 1, 5, 9, 3, 37, 95, 167, 115, 425, 867, 1, 3, 3, 13, 1,
+    37, 27, 189, 81, 679, 773, 1, 1, 3, 11, 1, 61, 99, 233, 429, 969,
+    49, 1, 1, 1, 7, 25, 63, 99, 165, 245, 793, 1143, 1, 1, 5, 11,
+    11, 43, 55, 65, 71, 283, 273, 1, 1, 5, 5, 9, 3, 101, 251, 355,
+    379, 1611, 1, 1, 1, 15, 21, 63, 85, 99, 49, 749, 1335, 1, 1, 5,
+    13, 27, 9, 121, 43, 255, 715, 289, 1, 3, 1, 5, 27, 19, 17, 223,
+    77, 571, 1415, 1, 1, 5, 3, 13, 59, 125, 251, 195, 551, 1737, 1, 3,
+    3, 15, 13, 27, 49, 105, 389, 971, 755, 1, 3, 5, 15, 23, 43, 35,
+    107, 447, 763, 253, 1, 3, 5, 11, 21, 3, 17, 39, 497, 407, 611, 1,
+    1, 7, 13, 15, 31, 113, 17, 23, 507, 1995, 1, 1, 7, 15, 3, 15,
+    31, 153, 423, 79, 503, 1, 1, 7, 9, 19, 25, 23, 171, 505, 923, 1989,
+    1, 1, 5, 9, 21, 27, 121, 223, 133, 87, 697, 1, 1, 5, 5, 9,
+    19, 107, 99, 319, 765, 1461, 1, 1, 3, 3, 19, 25, 3, 101, 171, 729,
+    187, 1, 1, 3, 1, 13, 23, 85, 93, 291, 209, 37, 1, 1, 1, 15,
+    25, 25, 77, 253, 333, 947, 1073, 1, 1, 3, 9, 17, 29, 55, 47, 255,
+    305, 2037, 1, 3, 3, 9, 29, 63, 9, 103, 489, 939, 1523, 1, 3, 7,
+    15, 7, 31, 89, 175, 369, 339, 595, 1, 3, 7, 13, 25, 5, 71, 207,
+    251, 367, 665, 1, 3, 3, 3, 21, 25, 75, 35, 31, 321, 1603, 1, 1,
+    1, 9, 11, 1, 65, 5, 11, 329, 535, 1, 1, 5, 3, 19, 13, 17,
+    43, 379, 485, 383, 1, 3, 5, 13, 13, 9, 85, 147, 489, 787, 1133, 1,
+    3, 1, 1, 5, 51, 37, 129, 195, 297, 1783, 1, 1, 3, 15, 19, 57,
+    59, 181, 455, 697, 2033, 1, 3, 7, 1, 27, 9, 65, 145, 325, 189, 201,
+    1, 3, 1, 15, 31, 23, 19, 5, 485, 581, 539, 1, 1, 7, 13, 11,
+    15, 65, 83, 185, 847, 831, 1, 3, 5, 7, 7, 55, 73, 15, 303, 511,
+    1905, 1, 3, 5, 9, 7, 21, 45, 15, 397, 385, 597, 1, 3, 7, 3,
+    23, 13, 73, 221, 511, 883, 1265, 1, 1, 3, 11, 1, 51, 73, 185, 33,
+    975, 1441, 1, 3, 3, 9, 19, 59, 21, 39, 339, 37, 143, 1, 1, 7,
+    1, 31, 33, 19, 167, 117, 635, 639, 1, 1, 1, 3, 5, 13, 59, 83,
+    355, 349, 1967, 1, 1, 1, 5, 19, 3, 53, 133, 97, 863, 983
+  }};
+  return numbers;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto SobolEngine<kScrambling>::makeDirectionTable() noexcept -> DirectionTableT
+{
+  const std::array<uint16b, kMaxDimension> polynomials = polynomialList();
+  const std::array<uint16b, kNumOfInitialNumbers> numbers = initialNumberList();
+  DirectionTableT table{};
+  std::size_t offset = 0;
+  for (std::size_t d = 0; d < kMaxDimension; ++d) {
+    std::array<ValueT, kNumOfBits>& v = table[d];
+    const ValueT polynomial = polynomials[d];
+    // The leading and the constant terms aren't coefficients
+    const auto s = cast<std::size_t>(std::bit_width(polynomial) - 1);
+    const ValueT a = (0 < s) ? ((polynomial >> 1) & ((ValueT{1} << (s - 1)) - 1)) : 0;
+    for (std::size_t j = 0; j < kNumOfBits; ++j) {
+      if (s == 0) { // van der Corput sequence
+        v[j] = ValueT{1} << (kNumOfBits - 1 - j);
+      }
+      else if (j < s) {
+        v[j] = cast<ValueT>(numbers[offset + j]) << (kNumOfBits - 1 - j);
+      }
+      else {
+        v[j] = v[j - s] ^ (v[j - s] >> s);
+        for (std::size_t k = 1; k < s; ++k)
+          v[j] ^= ((a >> (s - 1 - k)) & 1) ? v[j - k] : 0;
+      }
+    }
+    offset += s;
+  }
+  return table;
+}
+
+/*!
+  \details The primitive polynomials including the leading and the constant terms.
+  The first dimension has the polynomial 1 which represents the van der Corput sequence
+
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto SobolEngine<kScrambling>::polynomialList() noexcept
+    -> std::array<uint16b, kMaxDimension>
+{
+  constexpr std::array<uint16b, kMaxDimension> polynomials{{
+    0x0001, 0x0003, 0x0007, 0x000b, 0x000d, 0x0013, 0x0019, 0x0025, 0x0029, 0x002f, 0x0037, 0x003b,
+    0x003d, 0x0043, 0x005b, 0x0061, 0x0067, 0x006d, 0x0073, 0x0083, 0x0089, 0x008f, 0x0091, 0x009d,
+    0x00a7, 0x00ab, 0x00b9, 0x00bf, 0x00c1, 0x00cb, 0x00d3, 0x00d5, 0x00e5, 0x00ef, 0x00f1, 0x00f7,
+    0x00fd, 0x011d, 0x012b, 0x012d, 0x014d, 0x015f, 0x0163, 0x0165, 0x0169, 0x0171, 0x0187, 0x018d,
+    0x01a9, 0x01c3, 0x01cf, 0x01e7, 0x01f5, 0x0211, 0x021b, 0x0221, 0x022d, 0x0233, 0x0259, 0x025f,
+    0x0269, 0x026f, 0x0277, 0x027d, 0x0287, 0x0295, 0x02a3, 0x02a5, 0x02af, 0x02b7, 0x02bd, 0x02cf,
+    0x02d1, 0x02db, 0x02f5, 0x02f9, 0x0313, 0x0315, 0x031f, 0x0323, 0x0331, 0x033b, 0x034f, 0x035b,
+    0x0361, 0x036b, 0x036d, 0x0373, 0x037f, 0x0385, 0x038f, 0x03b5, 0x03b9, 0x03c7, 0x03cb, 0x03cd,
+    0x03d5, 0x03d9, 0x03e3, 0x03e9, 0x03fb, 0x0409, 0x041b, 0x0427, 0x042d, 0x0465, 0x046f, 0x0481,
+    0x048b, 0x04c5, 0x04d7, 0x04e7, 0x04f3, 0x04ff, 0x050d, 0x0519, 0x0523, 0x0531, 0x053d, 0x0543,
+    0x0557, 0x056b, 0x0585, 0x058f, 0x0597, 0x05a1, 0x05c7, 0x05e5, 0x05f7, 0x05fb, 0x0613, 0x0615,
+    0x0625, 0x0637, 0x0643, 0x064f, 0x065b, 0x0679, 0x067f, 0x0689, 0x06b5, 0x06c1, 0x06d3, 0x06df,
+    0x06fd, 0x0717, 0x071d, 0x0721, 0x0739, 0x0747, 0x074d, 0x0755, 0x0759, 0x0763, 0x077d, 0x078d,
+    0x0793, 0x07b1, 0x07db, 0x07f3, 0x07f9, 0x0805, 0x0817, 0x082b, 0x082d, 0x0847, 0x0863, 0x0865,
+    0x0871, 0x087b, 0x088d, 0x0895, 0x089f, 0x08a9, 0x08b1, 0x08cf, 0x08d1, 0x08e1, 0x08e7, 0x08eb,
+    0x08f5, 0x090d, 0x0913, 0x0925, 0x0929, 0x093b, 0x093d, 0x0945, 0x0949, 0x0951, 0x095b, 0x0973,
+    0x0975, 0x097f, 0x0983, 0x098f, 0x09ab, 0x09ad, 0x09b9, 0x09c7, 0x09d9, 0x09e5, 0x09f7, 0x0a01,
+    0x0a07, 0x0a13, 0x0a15, 0x0a29, 0x0a49, 0x0a61, 0x0a6d, 0x0a79, 0x0a7f, 0x0a85, 0x0a91, 0x0a9d,
+    0x0aa7, 0x0aab, 0x0ab3, 0x0ab5, 0x0ad5, 0x0adf, 0x0ae9, 0x0aef, 0x0af1, 0x0afb, 0x0b03, 0x0b09,
+    0x0b11, 0x0b33, 0x0b3f, 0x0b41, 0x0b4b, 0x0b59, 0x0b5f, 0x0b65, 0x0b6f, 0x0b7d, 0x0b87, 0x0b8b,
+    0x0b93, 0x0b95, 0x0baf, 0x0bb7, 0x0bbd, 0x0bc9, 0x0bdb, 0x0bdd, 0x0be7, 0x0bed, 0x0c0b, 0x0c0d,
+    0x0c19, 0x0c1f, 0x0c57, 0x0c61
+  }};
+  return polynomials;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] x No description.
+  \param [in] s No description.
+  \return No description
+  */
+template <SequenceScrambling kScrambling> inline
+constexpr auto SobolEngine<kScrambling>::scramble(const ValueT x, const ValueT s) noexcept
+    -> ValueT
+{
+  ValueT y = x;
+  if constexpr (kScrambling == SequenceScrambling::DigitPermutation)
+    y = x ^ s;
+  else if constexpr (kScrambling == SequenceScrambling::Owen)
+    y = OwenScrambler::scramble(x, s);
+  return y;
+}
+
+} // namespace zisc
+
+#endif // ZISC_SOBOL_ENGINE_INL_HPP
@@ -0,0 +1,136 @@
+/*!
+  \file sobol_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_SOBOL_ENGINE_HPP
+#define ZISC_SOBOL_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "owen_scrambler.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Sobol low-discrepancy sequence
+
+  A sample is computed from its index and dimension without any state,
+  so samples can be generated in any order.
+  The direction numbers of the first 256 dimensions by Joe and Kuo (new-joe-kuo-6.21201)
+  are built in as constexpr tables.
+  Unscrambled samples are identical to the other implementations using
+  the same direction numbers.
+  For more detail, please see the following paper:
+  <a href="https://doi.org/10.1137/070709359">Constructing Sobol sequences with better two-dimensional projections</a>.
+
+  \tparam kScrambling The randomization of the sequence.
+  \note No notation.
+  \attention No attention.
+  */
+template <SequenceScrambling kScrambling>
+class SobolEngine
+{
+ public:
+  using ValueT = uint32b;
+
+
+  //! Generate a [0, 1) float sample of the given dimension
+  template <std::floating_point Float>
+  static auto generate1d(const ValueT index,
+                         const ValueT dimension,
+                         const ValueT seed = 0) noexcept -> Float;
+
+  //! Generate [0, 1) float samples of the successive indices from the given index
+  template <std::floating_point Float>
+  static void generate1d(const ValueT first,
+                         const ValueT dimension,
+                         const ValueT seed,
+                         const std::span<Float> out) noexcept;
+
+  //! Generate [0, 1) float samples of the given dimension and the next dimension
+  template <std::floating_point Float>
+  static auto generate2d(const ValueT index,
+                         const ValueT dimension,
+                         const ValueT seed = 0) noexcept -> std::array<Float, 2>;
+
+  //! Generate 2d [0, 1) float samples of the successive indices from the given index
+  template <std::floating_point Float>
+  static void generate2d(const ValueT first,
+                         const ValueT dimension,
+                         const ValueT seed,
+                         const std::span<std::array<Float, 2>> out) noexcept;
+
+  //! Return the number of the dimensions supported
+  static constexpr auto maxDimension() noexcept -> std::size_t;
+
+  //! Return the 32bit fixed point sample of the given dimension
+  static constexpr auto sample(const ValueT index,
+                               const ValueT dimension,
+                               const ValueT seed = 0) noexcept -> ValueT;
+
+ private:
+  static constexpr std::size_t kMaxDimension = 256;
+  static constexpr std::size_t kNumOfBits = 32;
+  static constexpr std::size_t kChunkSize = 64;
+  static constexpr std::size_t kNumOfInitialNumbers = 2414;
+
+
+  using DirectionTableT = std::array<std::array<ValueT, kNumOfBits>, kMaxDimension>;
+
+
+  //! Return the unscrambled fixed point sample of the given dimension
+  static constexpr auto computeSample(ValueT index, const ValueT dimension) noexcept
+      -> ValueT;
+
+  //! Return the seed of the given dimension
+  static constexpr auto dimensionSeed(const ValueT dimension, const ValueT seed) noexcept
+      -> ValueT;
+
+  //! Generate the fixed point samples of the successive indices from the given index
+  static void generateChunk(const ValueT first,
+                            const ValueT dimension,
+                            const ValueT seed,
+                            const std::span<ValueT> chunk) noexcept;
+
+  //! Return the initial direction numbers of all dimensions in order
+  static constexpr auto initialNumberList() noexcept
+      -> std::array<uint16b, kNumOfInitialNumbers>;
+
+  //! Make the direction numbers of all dimensions
+  static constexpr auto makeDirectionTable() noexcept -> DirectionTableT;
+
+  //! Return the primitive polynomials of all dimensions
+  static constexpr auto polynomialList() noexcept -> std::array<uint16b, kMaxDimension>;
+
+  //! Apply the scrambling to the given fixed point sample
+  static constexpr auto scramble(const ValueT x, const ValueT s) noexcept -> ValueT;
+
+
+  static constexpr DirectionTableT kDirectionTable = makeDirectionTable();
+};
+
+// Type aliases
+using Sobol = SobolEngine<SequenceScrambling::None>;
+using XorScrambledSobol = SobolEngine<SequenceScrambling::DigitPermutation>;
+using OwenScrambledSobol = SobolEngine<SequenceScrambling::Owen>;
+
+} // namespace zisc
+
+#include "sobol_engine-inl.hpp"
+
+#endif // ZISC_SOBOL_ENGINE_HPP
@@ -0,0 +1,149 @@
+/*!
+  \file stream_splitter-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_STREAM_SPLITTER_INL_HPP
+#define ZISC_STREAM_SPLITTER_INL_HPP
+
+#include "stream_splitter.hpp"
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <limits>
+// Zisc
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/concurrency/worker_local.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] seed No description.
+  */
+template <SplittableEngine EngineT> inline
+StreamSplitter<EngineT>::StreamSplitter(const ValueT seed) noexcept :
+    seed_{seed}
+{
+}
+
+/*!
+  \details The engine of the thread ID i is the i-th stream and
+  the engine of the unmanaged thread is the stream next to the last worker.
+  The engines are created for the current number of workers,
+  so create them again after growing the thread pool
+
+  \param [in] thread_manager No description.
+  \return No description
+  */
+template <SplittableEngine EngineT> inline
+auto StreamSplitter<EngineT>::createWorkerLocal(const ThreadManager& thread_manager) const
+    -> WorkerLocal<EngineT>
+{
+  WorkerLocal<EngineT> local = thread_manager.createWorkerLocal<EngineT>(seed_);
+  std::size_t index = 0;
+  local.forEach([this, &index](EngineT& engine) noexcept
+  {
+    initStream(index++, engine);
+  });
+  return local;
+}
+
+/*!
+  \details Initializing the stream i of xoshiro engines takes i jumps.
+  PCG MCG engines are advanced in O(log i) steps
+
+  \param [in] index No description.
+  \param [out] engine No description.
+  */
+template <SplittableEngine EngineT> inline
+void StreamSplitter<EngineT>::initStream(const std::size_t index,
+                                         EngineT& engine) const noexcept
+{
+  ZISC_ASSERT(index < maxNumOfStreams(), "The stream index is out of range.");
+  if constexpr (requires { engine.jump(); }) {
+    engine.setSeed(seed_);
+    for (std::size_t i = 0; i < index; ++i)
+      engine.jump();
+  }
+  else if constexpr (hasStreamId()) {
+    engine.setSeed(seed_, cast<ValueT>(index));
+  }
+  else {
+    engine.setSeed(seed_);
+    constexpr std::size_t stride_pow2 = EngineT::getPeriodPow2() / 2;
+    engine.advance(cast<ValueT>(cast<ValueT>(index) << stride_pow2));
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <SplittableEngine EngineT> inline
+auto StreamSplitter<EngineT>::makeStream(const std::size_t index) const noexcept
+    -> EngineT
+{
+  EngineT engine{seed_};
+  initStream(index, engine);
+  return engine;
+}
+
+/*!
+  \details The stream IDs of PCG LCG engines are (n - 1) bits.
+  The number of the streams of xoshiro engines is 2^(n/2),
+  which is saturated to the maximum of std::size_t
+
+  \return No description
+  */
+template <SplittableEngine EngineT> inline
+constexpr auto StreamSplitter<EngineT>::maxNumOfStreams() noexcept -> std::size_t
+{
+  constexpr std::size_t period_pow2 = EngineT::getPeriodPow2();
+  constexpr std::size_t num_of_bits = hasStreamId() ? period_pow2 - 1
+                                                    : period_pow2 - period_pow2 / 2;
+  constexpr std::size_t max_bits = 8 * sizeof(std::size_t);
+  return (num_of_bits < max_bits) ? (std::size_t{1} << num_of_bits)
+                                  : (std::numeric_limits<std::size_t>::max)();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <SplittableEngine EngineT> inline
+auto StreamSplitter<EngineT>::seed() const noexcept -> ValueT
+{
+  return seed_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <SplittableEngine EngineT> inline
+constexpr auto StreamSplitter<EngineT>::hasStreamId() noexcept -> bool
+{
+  return requires (EngineT& engine, const ValueT v) { engine.setSeed(v, v); };
+}
+
+} // namespace zisc
+
+#endif // ZISC_STREAM_SPLITTER_INL_HPP
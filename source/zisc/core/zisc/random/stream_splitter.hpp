@@ -0,0 +1,95 @@
+/*!
+  \file stream_splitter.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_STREAM_SPLITTER_HPP
+#define ZISC_STREAM_SPLITTER_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+// Zisc
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/concurrency/worker_local.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+//! Specify an engine which can jump or advance ahead
+template <typename Type>
+concept SplittableEngine = requires (Type& engine) {
+  engine.jump();
+} || requires (Type& engine, const typename Type::ValueT v) {
+  engine.advance(v);
+};
+
+/*!
+  \brief Split an engine into non-overlapping streams
+
+  The i-th stream of xoshiro engines is the seeded engine jumped i times.
+  The i-th stream of PCG LCG engines has the same seed and the stream ID i,
+  so each stream has its own increment and its full period.
+  PCG MCG engines don't have stream IDs,
+  so the i-th stream is the seeded engine advanced by i * 2^(n/2) steps,
+  where 2^n is the period, and generates at most 2^(n/2) random numbers.
+  The index must be less than maxNumOfStreams().
+  The streams depend only on the seed and the index,
+  so parallel computations are reproducible regardless of the scheduling.
+
+  \tparam EngineT A xoshiro engine or a PCG engine.
+  \note No notation.
+  \attention No attention.
+  */
+template <SplittableEngine EngineT>
+class StreamSplitter
+{
+ public:
+  using ValueT = typename EngineT::ValueT;
+
+
+  //! Initialize the splitter
+  explicit StreamSplitter(const ValueT seed) noexcept;
+
+
+  //! Create an engine per worker thread of the given thread manager
+  [[nodiscard]]
+  auto createWorkerLocal(const ThreadManager& thread_manager) const
+      -> WorkerLocal<EngineT>;
+
+  //! Initialize the given engine as the stream of the given index
+  void initStream(const std::size_t index, EngineT& engine) const noexcept;
+
+  //! Create an engine as the stream of the given index
+  [[nodiscard]]
+  auto makeStream(const std::size_t index) const noexcept -> EngineT;
+
+  //! Return the maximum number of the distinct streams
+  static constexpr auto maxNumOfStreams() noexcept -> std::size_t;
+
+  //! Return the seed
+  [[nodiscard]]
+  auto seed() const noexcept -> ValueT;
+
+ private:
+  //! Check if the engine has stream IDs
+  static constexpr auto hasStreamId() noexcept -> bool;
+
+
+  ValueT seed_;
+};
+
+} // namespace zisc
+
+#include "stream_splitter-inl.hpp"
+
+#endif // ZISC_STREAM_SPLITTER_HPP
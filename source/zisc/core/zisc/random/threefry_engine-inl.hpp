@@ -0,0 +1,232 @@
+/*!
+  \file threefry_engine-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_THREEFRY_ENGINE_INL_HPP
+#define ZISC_THREEFRY_ENGINE_INL_HPP
+
+#include "threefry_engine.hpp"
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+// Zisc
+#include "counter_based_engine.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] key No description.
+  */
+template <std::size_t kRounds> inline
+ThreefryEngine<kRounds>::ThreefryEngine(const KeyT& key) noexcept :
+    BaseEngineT(key)
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] key No description.
+  \param [in] counter No description.
+  \return No description
+  */
+template <std::size_t kRounds> inline
+auto ThreefryEngine<kRounds>::generateBlock(const KeyT& key, CounterT counter) noexcept
+    -> CounterT
+{
+  const std::array<ValueT, 5> ks = makeKeySchedule(key);
+  CounterT& x = counter;
+  for (std::size_t i = 0; i < x.size(); ++i)
+    x[i] += ks[i];
+  auto mix = [&x, &ks]<std::size_t round>() noexcept
+  {
+    // The word pairs are (0, 1) and (2, 3) in the even rounds and (0, 3) and (2, 1) in the odd
+    constexpr std::size_t p = ((round % 2) == 0) ? 1 : 3;
+    constexpr std::size_t q = 4 - p;
+    x[0] += x[p];
+    x[p] = rotateLeft(x[p], rotation(round, 0)) ^ x[0];
+    x[2] += x[q];
+    x[q] = rotateLeft(x[q], rotation(round, 1)) ^ x[2];
+    // Inject the key every 4 rounds
+    if constexpr ((round % 4) == 3) {
+      constexpr std::size_t s = (round + 1) / 4;
+      for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] += ks[(s + i) % ks.size()];
+      x[3] += s;
+    }
+  };
+  // The rounds are unrolled so that the rotations are constants
+  [&mix]<std::size_t... rounds>(std::index_sequence<rounds...>) noexcept
+  {
+    (mix.template operator()<rounds>(), ...);
+  }(std::make_index_sequence<kRounds>{});
+  return counter;
+}
+
+/*!
+  \details The counters are processed in the structure of arrays layout.
+  Two vectors are processed at once to hide the latency of the rounds.
+  Only AVX2 is supported since 64bit operations of two lanes
+  don't outperform scalar operations
+
+  \param [in] key No description.
+  \param [in] first No description.
+  \param [out] out No description.
+  \return The number of the counters processed
+  */
+template <std::size_t kRounds> inline
+auto ThreefryEngine<kRounds>::generateBlocks(
+    [[maybe_unused]] const KeyT& key,
+    [[maybe_unused]] const CounterT& first,
+    [[maybe_unused]] const std::span<ValueT> out) noexcept -> std::size_t
+{
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  constexpr std::size_t l = sizeof(__m256i) / sizeof(ValueT);
+  const std::size_t num_of_blocks = out.size() / 4;
+  constexpr std::size_t num_of_vectors = 2;
+  const __m256i iota = _mm256_setr_epi64x(0, 1, 2, 3);
+  const std::array<ValueT, 5> ks = makeKeySchedule(key);
+  auto rotl = [](const __m256i x, const int k) noexcept
+  {
+    return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+  };
+  auto inject = [&ks](__m256i (&x)[4], const std::size_t s) noexcept
+  {
+    for (std::size_t w = 0; w < 4; ++w) {
+      const ValueT k = ks[(s + w) % ks.size()] + ((w == 3) ? s : 0);
+      x[w] = _mm256_add_epi64(x[w], _mm256_set1_epi64x(cast<long long>(k)));
+    }
+  };
+  CounterT counter = first;
+  for (; (i + num_of_vectors * l) <= num_of_blocks; i += num_of_vectors * l) {
+    // Load the counters in the structure of arrays layout
+    __m256i x[num_of_vectors][4]; // The attributes of __m256i are lost in std::array
+    alignas(sizeof(__m256i)) std::array<ValueT, l> lanes;
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      if (counter[0] <= (std::numeric_limits<ValueT>::max)() - (l - 1)) {
+        // The lower words don't carry in the lanes
+        x[v][0] = _mm256_add_epi64(_mm256_set1_epi64x(cast<long long>(counter[0])), iota);
+        for (std::size_t w = 1; w < 4; ++w)
+          x[v][w] = _mm256_set1_epi64x(cast<long long>(counter[w]));
+      }
+      else {
+        for (std::size_t w = 0; w < 4; ++w) {
+          CounterT c = counter;
+          for (std::size_t j = 0; j < l; ++j) {
+            lanes[j] = c[w];
+            c = BaseEngineT::advanceCounter(c, 1);
+          }
+          x[v][w] = _mm256_load_si256(reinterp<const __m256i*>(lanes.data()));
+        }
+      }
+      counter = BaseEngineT::advanceCounter(counter, l);
+      inject(x[v], 0);
+    }
+    auto mix = [&x, &rotl, &inject]<std::size_t round>() noexcept
+    {
+      constexpr std::size_t p = ((round % 2) == 0) ? 1 : 3;
+      constexpr std::size_t q = 4 - p;
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        x[v][0] = _mm256_add_epi64(x[v][0], x[v][p]);
+        x[v][p] = _mm256_xor_si256(rotl(x[v][p], rotation(round, 0)), x[v][0]);
+        x[v][2] = _mm256_add_epi64(x[v][2], x[v][q]);
+        x[v][q] = _mm256_xor_si256(rotl(x[v][q], rotation(round, 1)), x[v][2]);
+        if constexpr ((round % 4) == 3)
+          inject(x[v], (round + 1) / 4);
+      }
+    };
+    [&mix]<std::size_t... rounds>(std::index_sequence<rounds...>) noexcept
+    {
+      (mix.template operator()<rounds>(), ...);
+    }(std::make_index_sequence<kRounds>{});
+    // Transpose the results into the array of structures layout
+    for (std::size_t v = 0; v < num_of_vectors; ++v) {
+      const __m256i t0 = _mm256_unpacklo_epi64(x[v][0], x[v][1]); // block 0 and 2 of word 0-1
+      const __m256i t1 = _mm256_unpackhi_epi64(x[v][0], x[v][1]); // block 1 and 3 of word 0-1
+      const __m256i t2 = _mm256_unpacklo_epi64(x[v][2], x[v][3]); // block 0 and 2 of word 2-3
+      const __m256i t3 = _mm256_unpackhi_epi64(x[v][2], x[v][3]); // block 1 and 3 of word 2-3
+      auto* o = reinterp<__m256i*>(out.data() + 4 * (i + v * l));
+      _mm256_storeu_si256(o + 0, _mm256_permute2x128_si256(t0, t2, 0x20));
+      _mm256_storeu_si256(o + 1, _mm256_permute2x128_si256(t1, t3, 0x20));
+      _mm256_storeu_si256(o + 2, _mm256_permute2x128_si256(t0, t2, 0x31));
+      _mm256_storeu_si256(o + 3, _mm256_permute2x128_si256(t1, t3, 0x31));
+    }
+  }
+#endif
+  return i;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] key No description.
+  \return No description
+  */
+template <std::size_t kRounds> inline
+constexpr auto ThreefryEngine<kRounds>::makeKeySchedule(const KeyT& key) noexcept
+    -> std::array<ValueT, 5>
+{
+  // The parity constant of Skein
+  constexpr ValueT parity = 0x1BD11BDAA9FC1A22ULL;
+  const std::array<ValueT, 5> ks{{key[0], key[1], key[2], key[3],
+                                  parity ^ key[0] ^ key[1] ^ key[2] ^ key[3]}};
+  return ks;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] round No description.
+  \param [in] pair No description.
+  \return No description
+  */
+template <std::size_t kRounds> inline
+constexpr auto ThreefryEngine<kRounds>::rotation(const std::size_t round,
+                                                 const std::size_t pair) noexcept -> int
+{
+  constexpr std::array<std::array<int, 2>, 8> rotations{{{{14, 16}}, {{52, 57}},
+                                                         {{23, 40}}, {{5, 37}},
+                                                         {{25, 33}}, {{46, 12}},
+                                                         {{58, 22}}, {{32, 32}}}};
+  return rotations[round % rotations.size()][pair];
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] x No description.
+  \param [in] k No description.
+  \return No description
+  */
+template <std::size_t kRounds> inline
+constexpr auto ThreefryEngine<kRounds>::rotateLeft(const ValueT x, const int k) noexcept
+    -> ValueT
+{
+  constexpr int bit_size = std::numeric_limits<ValueT>::digits;
+  return (x << k) | (x >> (bit_size - k));
+}
+
+} // namespace zisc
+
+#endif // ZISC_THREEFRY_ENGINE_INL_HPP
@@ -0,0 +1,84 @@
+/*!
+  \file threefry_engine.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_THREEFRY_ENGINE_HPP
+#define ZISC_THREEFRY_ENGINE_HPP
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "counter_based_engine.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Threefry4x64 counter-based generator
+
+  Threefry generates four 64bit random numbers from a 256bit counter and
+  a 256bit key with kRounds rounds of the Threefish block cipher,
+  which consists of only additions, rotations and xors.
+  The results are identical to the Random123 implementation.
+
+  \tparam kRounds The number of rounds. 20 is the recommended value.
+  \note No notation.
+  \attention No attention.
+  */
+template <std::size_t kRounds>
+class ThreefryEngine : public CounterBasedEngine<ThreefryEngine<kRounds>, uint64b, 4, 4>
+{
+ public:
+  using BaseEngineT = CounterBasedEngine<ThreefryEngine, uint64b, 4, 4>;
+  using ValueT = typename BaseEngineT::ValueT;
+  using CounterT = typename BaseEngineT::CounterT;
+  using KeyT = typename BaseEngineT::KeyT;
+
+
+  //! Initialize the engine with the zero key
+  ThreefryEngine() noexcept = default;
+
+  //! Initialize the engine with the given key
+  explicit ThreefryEngine(const KeyT& key) noexcept;
+
+
+  //! Generate random numbers of the given key and counter
+  static auto generateBlock(const KeyT& key, CounterT counter) noexcept -> CounterT;
+
+  //! Generate random numbers of the successive counters with SIMD instructions
+  static auto generateBlocks(const KeyT& key,
+                             const CounterT& first,
+                             const std::span<ValueT> out) noexcept -> std::size_t;
+
+ private:
+  //! Return the key schedule which has the parity word
+  static constexpr auto makeKeySchedule(const KeyT& key) noexcept -> std::array<ValueT, 5>;
+
+  //! Return the rotation of the given round and the given word pair
+  static constexpr auto rotation(const std::size_t round, const std::size_t pair) noexcept
+      -> int;
+
+  //! Rotate the given value to the left
+  static constexpr auto rotateLeft(const ValueT x, const int k) noexcept -> ValueT;
+};
+
+// Type aliases
+using Threefry4x64 = ThreefryEngine<20>;
+
+} // namespace zisc
+
+#include "threefry_engine-inl.hpp"
+
+#endif // ZISC_THREEFRY_ENGINE_HPP
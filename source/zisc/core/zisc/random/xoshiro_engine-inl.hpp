@@ -21,9 +21,16 @@
 #include <concepts>
 #include <cstddef>
 #include <limits>
+#include <span>
 #include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 // Zisc
 #include "pseudo_random_number_engine.hpp"
+#include "zisc/error.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 
@@ -49,6 +56,30 @@ XoshiroEngine<T, kMethod>::XoshiroEngine(const ValueT seed) noexcept
   setSeed(seed);
 }
 
+/*!
+  \details out[k * n + i] is the k-th random number of engines[i],
+  where n is the number of the engines.
+  The engines are independent, so several engines are processed
+  in SIMD lanes and the rest are interleaved in scalar.
+  The size of out must be a multiple of the number of the engines
+
+  \param [in,out] engines No description.
+  \param [out] out No description.
+  */
+template <std::unsigned_integral T, XoshiroMethod kMethod> inline
+void XoshiroEngine<T, kMethod>::fillStreams(const std::span<XoshiroEngine> engines,
+                                            const std::span<ValueT> out) noexcept
+{
+  const std::size_t n = engines.size();
+  ZISC_ASSERT((n != 0) && (out.size() % n) == 0, "The output isn't a multiple of the engines.");
+  const std::size_t first = fillStreamsSimd(engines, out);
+  const std::span<XoshiroEngine> rest = engines.subspan(first);
+  for (std::size_t k = 0; !rest.empty() && (k < out.size()); k += n) {
+    for (std::size_t i = 0; i < rest.size(); ++i)
+      out[k + first + i] = rest[i].generate();
+  }
+}
+
 /*!
   \details No detailed description
 
@@ -100,6 +131,28 @@ constexpr auto XoshiroEngine<T, kMethod>::isEndOfPeriod(const Integer sample) no
   }
 }
 
+/*!
+  \details Calling jump() k times on copies of an engine gives
+  k non-overlapping subsequences of 2^(n/2) random numbers each,
+  e.g. 2^128 for the 256bit engines. It's useful for parallel computation
+  */
+template <std::unsigned_integral T, XoshiroMethod kMethod> inline
+void XoshiroEngine<T, kMethod>::jump() noexcept
+{
+  jumpState(jumpPolynomial());
+}
+
+/*!
+  \details longJump() generates starting points of which
+  each can be further divided by jump(),
+  e.g. one per machine and then one per thread
+  */
+template <std::unsigned_integral T, XoshiroMethod kMethod> inline
+void XoshiroEngine<T, kMethod>::longJump() noexcept
+{
+  jumpState(longJumpPolynomial());
+}
+
 /*!
   \details No detailed description
 
@@ -159,6 +212,170 @@ constexpr auto XoshiroEngine<T, kMethod>::c() noexcept -> ValueT
   return value;
 }
 
+/*!
+  \details The engines are processed in groups of two vectors,
+  which hide the latency of the state update.
+  The multiplications of xoshiro** are done by shifts and adds,
+  so both of the 32bit and 64bit engines use only SSE2 or AVX2 instructions
+
+  \param [in,out] engines No description.
+  \param [out] out No description.
+  \return The number of the engines processed
+  */
+template <std::unsigned_integral T, XoshiroMethod kMethod> inline
+auto XoshiroEngine<T, kMethod>::fillStreamsSimd(
+    [[maybe_unused]] const std::span<XoshiroEngine> engines,
+    [[maybe_unused]] const std::span<ValueT> out) noexcept -> std::size_t
+{
+  std::size_t first = 0;
+#if defined(__AVX2__)
+  {
+    constexpr std::size_t l = sizeof(__m256i) / sizeof(ValueT);
+    constexpr std::size_t num_of_vectors = 2;
+    const std::size_t n = engines.size();
+    auto add = [](const __m256i lhs, const __m256i rhs) noexcept
+    {
+      if constexpr (sizeof(ValueT) == 4)
+        return _mm256_add_epi32(lhs, rhs);
+      else
+        return _mm256_add_epi64(lhs, rhs);
+    };
+    auto shl = [](const __m256i x, const int k) noexcept
+    {
+      if constexpr (sizeof(ValueT) == 4)
+        return _mm256_slli_epi32(x, k);
+      else
+        return _mm256_slli_epi64(x, k);
+    };
+    auto rotl = [&shl](const __m256i x, const int k) noexcept
+    {
+      constexpr int bit_size = std::numeric_limits<ValueT>::digits;
+      if constexpr (sizeof(ValueT) == 4)
+        return _mm256_or_si256(shl(x, k), _mm256_srli_epi32(x, bit_size - k));
+      else
+        return _mm256_or_si256(shl(x, k), _mm256_srli_epi64(x, bit_size - k));
+    };
+    for (; (first + num_of_vectors * l) <= n; first += num_of_vectors * l) {
+      // Load the states in the structure of arrays layout
+      __m256i s[num_of_vectors][4]; // The attributes of __m256i are lost in std::array
+      alignas(sizeof(__m256i)) std::array<ValueT, l> lanes{};
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        for (std::size_t w = 0; w < 4; ++w) {
+          for (std::size_t i = 0; i < l; ++i)
+            lanes[i] = engines[first + v * l + i].state_[w];
+          s[v][w] = _mm256_load_si256(reinterp<const __m256i*>(lanes.data()));
+        }
+      }
+      for (std::size_t k = 0; k < out.size(); k += n) {
+        for (std::size_t v = 0; v < num_of_vectors; ++v) {
+          __m256i result;
+          if constexpr (kMethod == XoshiroMethod::Plus) {
+            result = add(s[v][0], s[v][3]);
+          }
+          else if constexpr (kMethod == XoshiroMethod::PlusPlus) {
+            result = add(rotl(add(s[v][0], s[v][3]), cast<int>(a())), s[v][0]);
+          }
+          else if constexpr (kMethod == XoshiroMethod::StarStar) {
+            const __m256i x5 = add(s[v][1], shl(s[v][1], 2));
+            const __m256i y = rotl(x5, 7);
+            result = add(y, shl(y, 3));
+          }
+          _mm256_storeu_si256(reinterp<__m256i*>(out.data() + k + first + v * l), result);
+          const __m256i t = shl(s[v][1], cast<int>(b()));
+          s[v][2] = _mm256_xor_si256(s[v][2], s[v][0]);
+          s[v][3] = _mm256_xor_si256(s[v][3], s[v][1]);
+          s[v][1] = _mm256_xor_si256(s[v][1], s[v][2]);
+          s[v][0] = _mm256_xor_si256(s[v][0], s[v][3]);
+          s[v][2] = _mm256_xor_si256(s[v][2], t);
+          s[v][3] = rotl(s[v][3], cast<int>(c()));
+        }
+      }
+      // Store the states
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        for (std::size_t w = 0; w < 4; ++w) {
+          _mm256_store_si256(reinterp<__m256i*>(lanes.data()), s[v][w]);
+          for (std::size_t i = 0; i < l; ++i)
+            engines[first + v * l + i].state_[w] = lanes[i];
+        }
+      }
+    }
+  }
+#elif defined(__SSE2__)
+  {
+    constexpr std::size_t l = sizeof(__m128i) / sizeof(ValueT);
+    constexpr std::size_t num_of_vectors = 2;
+    const std::size_t n = engines.size();
+    auto add = [](const __m128i lhs, const __m128i rhs) noexcept
+    {
+      if constexpr (sizeof(ValueT) == 4)
+        return _mm_add_epi32(lhs, rhs);
+      else
+        return _mm_add_epi64(lhs, rhs);
+    };
+    auto shl = [](const __m128i x, const int k) noexcept
+    {
+      if constexpr (sizeof(ValueT) == 4)
+        return _mm_slli_epi32(x, k);
+      else
+        return _mm_slli_epi64(x, k);
+    };
+    auto rotl = [&shl](const __m128i x, const int k) noexcept
+    {
+      constexpr int bit_size = std::numeric_limits<ValueT>::digits;
+      if constexpr (sizeof(ValueT) == 4)
+        return _mm_or_si128(shl(x, k), _mm_srli_epi32(x, bit_size - k));
+      else
+        return _mm_or_si128(shl(x, k), _mm_srli_epi64(x, bit_size - k));
+    };
+    for (; (first + num_of_vectors * l) <= n; first += num_of_vectors * l) {
+      // Load the states in the structure of arrays layout
+      __m128i s[num_of_vectors][4]; // The attributes of __m128i are lost in std::array
+      alignas(sizeof(__m128i)) std::array<ValueT, l> lanes{};
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        for (std::size_t w = 0; w < 4; ++w) {
+          for (std::size_t i = 0; i < l; ++i)
+            lanes[i] = engines[first + v * l + i].state_[w];
+          s[v][w] = _mm_load_si128(reinterp<const __m128i*>(lanes.data()));
+        }
+      }
+      for (std::size_t k = 0; k < out.size(); k += n) {
+        for (std::size_t v = 0; v < num_of_vectors; ++v) {
+          __m128i result;
+          if constexpr (kMethod == XoshiroMethod::Plus) {
+            result = add(s[v][0], s[v][3]);
+          }
+          else if constexpr (kMethod == XoshiroMethod::PlusPlus) {
+            result = add(rotl(add(s[v][0], s[v][3]), cast<int>(a())), s[v][0]);
+          }
+          else if constexpr (kMethod == XoshiroMethod::StarStar) {
+            const __m128i x5 = add(s[v][1], shl(s[v][1], 2));
+            const __m128i y = rotl(x5, 7);
+            result = add(y, shl(y, 3));
+          }
+          _mm_storeu_si128(reinterp<__m128i*>(out.data() + k + first + v * l), result);
+          const __m128i t = shl(s[v][1], cast<int>(b()));
+          s[v][2] = _mm_xor_si128(s[v][2], s[v][0]);
+          s[v][3] = _mm_xor_si128(s[v][3], s[v][1]);
+          s[v][1] = _mm_xor_si128(s[v][1], s[v][2]);
+          s[v][0] = _mm_xor_si128(s[v][0], s[v][3]);
+          s[v][2] = _mm_xor_si128(s[v][2], t);
+          s[v][3] = rotl(s[v][3], cast<int>(c()));
+        }
+      }
+      // Store the states
+      for (std::size_t v = 0; v < num_of_vectors; ++v) {
+        for (std::size_t w = 0; w < 4; ++w) {
+          _mm_store_si128(reinterp<__m128i*>(lanes.data()), s[v][w]);
+          for (std::size_t i = 0; i < l; ++i)
+            engines[first + v * l + i].state_[w] = lanes[i];
+        }
+      }
+    }
+  }
+#endif
+  return first;
+}
+
 /*!
   \details No detailed description
 
@@ -177,6 +394,67 @@ auto XoshiroEngine<T, kMethod>::generateRandom() noexcept -> ValueT
   return result;
 }
 
+/*!
+  \details The polynomials are from the reference implementation by
+  David Blackman and Sebastiano Vigna
+
+  \return No description
+  */
+template <std::unsigned_integral T, XoshiroMethod kMethod> inline
+constexpr auto XoshiroEngine<T, kMethod>::jumpPolynomial() noexcept
+    -> std::array<ValueT, 4>
+{
+  std::array<ValueT, 4> polynomial{};
+  if constexpr (sizeof(ValueT) == 4)
+    polynomial = {{0x8764000bU, 0xf542d2d3U, 0x6fa035c3U, 0x77f2db5bU}};
+  else if constexpr (sizeof(ValueT) == 8)
+    polynomial = {{0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+                   0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL}};
+  return polynomial;
+}
+
+/*!
+  \details The state after the jump is the sum (xor) of the states
+  of which the bits of the polynomial are set. It takes 4n state updates
+
+  \param [in] polynomial No description.
+  */
+template <std::unsigned_integral T, XoshiroMethod kMethod> inline
+void XoshiroEngine<T, kMethod>::jumpState(const std::array<ValueT, 4>& polynomial) noexcept
+{
+  constexpr std::size_t bit_size = std::numeric_limits<ValueT>::digits;
+  std::array<ValueT, 4> state{};
+  for (const ValueT p : polynomial) {
+    for (std::size_t b = 0; b < bit_size; ++b) {
+      if (((p >> b) & 1U) != 0) {
+        for (std::size_t i = 0; i < state.size(); ++i)
+          state[i] ^= state_[i];
+      }
+      nextState();
+    }
+  }
+  state_ = state;
+}
+
+/*!
+  \details The polynomials are from the reference implementation by
+  David Blackman and Sebastiano Vigna
+
+  \return No description
+  */
+template <std::unsigned_integral T, XoshiroMethod kMethod> inline
+constexpr auto XoshiroEngine<T, kMethod>::longJumpPolynomial() noexcept
+    -> std::array<ValueT, 4>
+{
+  std::array<ValueT, 4> polynomial{};
+  if constexpr (sizeof(ValueT) == 4)
+    polynomial = {{0xb523952eU, 0x0b6f099fU, 0xccf5a0efU, 0x1c580662U}};
+  else if constexpr (sizeof(ValueT) == 8)
+    polynomial = {{0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL,
+                   0x77710069854ee241ULL, 0x39109bb02acbe635ULL}};
+  return polynomial;
+}
+
 /*!
   \details No detailed description
   */
@@ -19,6 +19,7 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <span>
 // Zisc
 #include "pseudo_random_number_engine.hpp"
 #include "zisc/zisc_config.hpp"
@@ -55,6 +56,10 @@ class XoshiroEngine : public PseudoRandomNumberEngine<XoshiroEngine<T, kMethod>,
   explicit XoshiroEngine(const ValueT seed) noexcept;
 
 
+  //! Generate random numbers of the given engines in an interleaved order
+  static void fillStreams(const std::span<XoshiroEngine> engines,
+                          const std::span<ValueT> out) noexcept;
+
   //! Generate a random number
   auto generate() noexcept -> ValueT;
 
@@ -65,6 +70,12 @@ class XoshiroEngine : public PseudoRandomNumberEngine<XoshiroEngine<T, kMethod>,
   template <std::unsigned_integral Integer>
   static constexpr auto isEndOfPeriod(const Integer sample) noexcept -> bool;
 
+  //! Advance the state by 2^(n/2) steps, where 2^n-1 is the period
+  void jump() noexcept;
+
+  //! Advance the state by 2^(3n/4) steps, where 2^n-1 is the period
+  void longJump() noexcept;
+
   //! Set a seed
   void setSeed(const ValueT seed) noexcept;
 
@@ -78,9 +89,22 @@ class XoshiroEngine : public PseudoRandomNumberEngine<XoshiroEngine<T, kMethod>,
   //!
   static constexpr auto c() noexcept -> ValueT;
 
+  //! Generate random numbers of the given engines with SIMD instructions
+  static auto fillStreamsSimd(const std::span<XoshiroEngine> engines,
+                              const std::span<ValueT> out) noexcept -> std::size_t;
+
   //! Generate a random number
   auto generateRandom() noexcept -> ValueT;
 
+  //! Return the polynomial of jump()
+  static constexpr auto jumpPolynomial() noexcept -> std::array<ValueT, 4>;
+
+  //! Advance the state by the steps represented by the given polynomial
+  void jumpState(const std::array<ValueT, 4>& polynomial) noexcept;
+
+  //! Return the polynomial of longJump()
+  static constexpr auto longJumpPolynomial() noexcept -> std::array<ValueT, 4>;
+
   //! Next seed state
   void nextState() noexcept;
 
@@ -0,0 +1,275 @@
+/*!
+  \file ziggurat-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_ZIGGURAT_INL_HPP
+#define ZISC_ZIGGURAT_INL_HPP
+
+#include "ziggurat.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "distribution.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details The random numbers of a chunk are generated at once by the engine.
+  The rejected candidates are completed with additional random numbers,
+  so the results differ from calling generateExponential() repeatedly
+
+  \tparam Float No description.
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float, RandomNumberEngine Engine> inline
+void Ziggurat::fillExponential(Engine& engine, const std::span<Float> out) noexcept
+{
+  const Table& t = exponentialTable();
+  std::array<uint64b, Distribution::kChunkSize> chunk;
+  for (std::size_t i = 0; i < out.size(); i += chunk.size()) {
+    const std::size_t n = (std::min)(chunk.size(), out.size() - i);
+    Distribution::fillBits64(engine, {chunk.data(), n});
+    for (std::size_t j = 0; j < n; ++j) {
+      const std::size_t l = layer(chunk[j]);
+      const double x = mapTo01<double>(chunk[j]) * t.x_[l];
+      out[i + j] = cast<Float>((x < t.x_[l + 1]) ? x : finishExponential(engine, l, x));
+    }
+  }
+}
+
+/*!
+  \details The random numbers of a chunk are generated at once by the engine.
+  The rejected candidates are completed with additional random numbers,
+  so the results differ from calling generateNormal() repeatedly
+
+  \tparam Float No description.
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [out] out No description.
+  */
+template <std::floating_point Float, RandomNumberEngine Engine> inline
+void Ziggurat::fillNormal(Engine& engine, const std::span<Float> out) noexcept
+{
+  const Table& t = normalTable();
+  std::array<uint64b, Distribution::kChunkSize> chunk;
+  for (std::size_t i = 0; i < out.size(); i += chunk.size()) {
+    const std::size_t n = (std::min)(chunk.size(), out.size() - i);
+    Distribution::fillBits64(engine, {chunk.data(), n});
+    for (std::size_t j = 0; j < n; ++j) {
+      const std::size_t l = layer(chunk[j]);
+      const double x = (2.0 * mapTo01<double>(chunk[j]) - 1.0) * t.x_[l];
+      out[i + j] = cast<Float>((std::abs(x) < t.x_[l + 1]) ? x : finishNormal(engine, l, x));
+    }
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <RandomNumberEngine Engine> inline
+auto Ziggurat::generateExponential(Engine& engine) noexcept -> double
+{
+  const Table& t = exponentialTable();
+  const uint64b bits = Distribution::generateBits64(engine);
+  const std::size_t l = layer(bits);
+  const double x = mapTo01<double>(bits) * t.x_[l];
+  return (x < t.x_[l + 1]) ? x : finishExponential(engine, l, x);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \return No description
+  */
+template <RandomNumberEngine Engine> inline
+auto Ziggurat::generateNormal(Engine& engine) noexcept -> double
+{
+  const Table& t = normalTable();
+  const uint64b bits = Distribution::generateBits64(engine);
+  const std::size_t l = layer(bits);
+  const double x = (2.0 * mapTo01<double>(bits) - 1.0) * t.x_[l];
+  return (std::abs(x) < t.x_[l + 1]) ? x : finishNormal(engine, l, x);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto Ziggurat::exponentialTable() noexcept -> const Table&
+{
+  static const Table table = makeExponentialTable();
+  return table;
+}
+
+/*!
+  \details The sampling starts over if the candidate is rejected in the wedge
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [in] i No description.
+  \param [in] x No description.
+  \return No description
+  */
+template <RandomNumberEngine Engine> inline
+auto Ziggurat::finishExponential(Engine& engine, std::size_t i, double x) noexcept -> double
+{
+  const Table& t = exponentialTable();
+  for (;;) {
+    // The tail is the exponential distribution shifted by r
+    if (i == 0)
+      return t.x_[1] - std::log(Distribution::generateOpen01<double>(engine));
+    const double v = Distribution::generate01<double>(engine);
+    if (t.f_[i] + (t.f_[i + 1] - t.f_[i]) * v < std::exp(-x))
+      return x;
+    const uint64b bits = Distribution::generateBits64(engine);
+    i = layer(bits);
+    x = mapTo01<double>(bits) * t.x_[i];
+    if (x < t.x_[i + 1])
+      return x;
+  }
+}
+
+/*!
+  \details The sampling starts over if the candidate is rejected in the wedge
+
+  \tparam Engine No description.
+  \param [in,out] engine No description.
+  \param [in] i No description.
+  \param [in] x No description.
+  \return No description
+  */
+template <RandomNumberEngine Engine> inline
+auto Ziggurat::finishNormal(Engine& engine, std::size_t i, double x) noexcept -> double
+{
+  const Table& t = normalTable();
+  for (;;) {
+    if (i == 0) {
+      // Marsaglia's method for the tail
+      const double r = t.x_[1];
+      double a = 0.0;
+      double b = 0.0;
+      do {
+        a = -std::log(Distribution::generateOpen01<double>(engine)) / r;
+        b = -std::log(Distribution::generateOpen01<double>(engine));
+      } while (b + b < a * a);
+      return std::signbit(x) ? -(r + a) : (r + a);
+    }
+    const double v = Distribution::generate01<double>(engine);
+    if (t.f_[i] + (t.f_[i + 1] - t.f_[i]) * v < std::exp(-0.5 * x * x))
+      return x;
+    const uint64b bits = Distribution::generateBits64(engine);
+    i = layer(bits);
+    x = (2.0 * mapTo01<double>(bits) - 1.0) * t.x_[i];
+    if (std::abs(x) < t.x_[i + 1])
+      return x;
+  }
+}
+
+/*!
+  \details The upper bits are used for the coordinate
+
+  \param [in] bits No description.
+  \return No description
+  */
+inline
+auto Ziggurat::layer(const uint64b bits) noexcept -> std::size_t
+{
+  return cast<std::size_t>(bits & (kNumOfLayers - 1));
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto Ziggurat::makeExponentialTable() noexcept -> Table
+{
+  // The start of the tail and the area of a layer
+  constexpr double r = 7.69711747013104972;
+  constexpr double v = 0.0039496598225815571993;
+  Table table{};
+  double f = std::exp(-r);
+  table.x_[0] = v / f;
+  table.x_[1] = r;
+  table.f_[0] = 0.0;
+  table.f_[1] = f;
+  for (std::size_t i = 2; i < kNumOfLayers; ++i) {
+    table.x_[i] = -std::log(v / table.x_[i - 1] + f);
+    f = std::exp(-table.x_[i]);
+    table.f_[i] = f;
+  }
+  table.x_[kNumOfLayers] = 0.0;
+  table.f_[kNumOfLayers] = 1.0;
+  return table;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto Ziggurat::makeNormalTable() noexcept -> Table
+{
+  // The start of the tail and the area of a layer
+  constexpr double r = 3.6541528853610088;
+  constexpr double v = 0.00492867323399;
+  Table table{};
+  double f = std::exp(-0.5 * r * r);
+  table.x_[0] = v / f;
+  table.x_[1] = r;
+  table.f_[0] = 0.0;
+  table.f_[1] = f;
+  for (std::size_t i = 2; i < kNumOfLayers; ++i) {
+    table.x_[i] = std::sqrt(-2.0 * std::log(v / table.x_[i - 1] + f));
+    f = std::exp(-0.5 * table.x_[i] * table.x_[i]);
+    table.f_[i] = f;
+  }
+  table.x_[kNumOfLayers] = 0.0;
+  table.f_[kNumOfLayers] = 1.0;
+  return table;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto Ziggurat::normalTable() noexcept -> const Table&
+{
+  static const Table table = makeNormalTable();
+  return table;
+}
+
+} // namespace zisc
+
+#endif // ZISC_ZIGGURAT_INL_HPP
@@ -0,0 +1,110 @@
+/*!
+  \file ziggurat.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_ZIGGURAT_HPP
+#define ZISC_ZIGGURAT_HPP
+
+// Standard C++ library
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+// Zisc
+#include "distribution.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Ziggurat method for the standard normal and exponential distributions
+
+  The area under the density is covered by 256 layers of the same area.
+  A sample is accepted after one 64bit random number, a table lookup and
+  a comparison in about 99% of cases. Only the rest evaluates exp() or log().
+  The lower 8 bits of a random number select a layer and
+  the upper 53 bits make the coordinate.
+  For more detail, please see the following papers:
+  <a href="https://doi.org/10.18637/jss.v005.i08">The Ziggurat Method for Generating Random Variables</a> and
+  <a href="https://www.doornik.com/research/ziggurat.pdf">An Improved Ziggurat Method to Generate Normal Random Samples</a>.
+
+  \note No notation.
+  \attention No attention.
+  */
+class Ziggurat
+{
+ public:
+  //! Fill the given span with standard exponential random numbers
+  template <std::floating_point Float, RandomNumberEngine Engine>
+  static void fillExponential(Engine& engine, const std::span<Float> out) noexcept;
+
+  //! Fill the given span with standard normal random numbers
+  template <std::floating_point Float, RandomNumberEngine Engine>
+  static void fillNormal(Engine& engine, const std::span<Float> out) noexcept;
+
+  //! Generate a standard exponential random number
+  template <RandomNumberEngine Engine>
+  static auto generateExponential(Engine& engine) noexcept -> double;
+
+  //! Generate a standard normal random number
+  template <RandomNumberEngine Engine>
+  static auto generateNormal(Engine& engine) noexcept -> double;
+
+ private:
+  static constexpr std::size_t kNumOfLayers = 256;
+
+
+  /*!
+    \brief The right edges and the densities of the layers
+
+    x_[0] is the width of the base layer including the tail,
+    x_[1] is the start of the tail and x_[kNumOfLayers] is zero.
+    */
+  struct Table
+  {
+    std::array<double, kNumOfLayers + 1> x_;
+    std::array<double, kNumOfLayers + 1> f_;
+  };
+
+
+  //! Return the table of the exponential distribution
+  static auto exponentialTable() noexcept -> const Table&;
+
+  //! Complete the exponential sampling of the candidate rejected by the fast check
+  template <RandomNumberEngine Engine>
+  static auto finishExponential(Engine& engine, std::size_t i, double x) noexcept
+      -> double;
+
+  //! Complete the normal sampling of the candidate rejected by the fast check
+  template <RandomNumberEngine Engine>
+  static auto finishNormal(Engine& engine, std::size_t i, double x) noexcept
+      -> double;
+
+  //! Return the layer of the given random number
+  static auto layer(const uint64b bits) noexcept -> std::size_t;
+
+  //! Make the table of the exponential distribution
+  static auto makeExponentialTable() noexcept -> Table;
+
+  //! Make the table of the normal distribution
+  static auto makeNormalTable() noexcept -> Table;
+
+  //! Return the table of the normal distribution
+  static auto normalTable() noexcept -> const Table&;
+};
+
+} // namespace zisc
+
+#include "ziggurat-inl.hpp"
+
+#endif // ZISC_ZIGGURAT_HPP
@@ -0,0 +1,509 @@
+/*!
+  \file schema_serializer-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_SCHEMA_SERIALIZER_INL_HPP
+#define ZISC_SCHEMA_SERIALIZER_INL_HPP
+
+#include "schema_serializer.hpp"
+// Standard C++ library
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+// Zisc
+#include "binary_reader.hpp"
+#include "binary_writer.hpp"
+#include "concepts.hpp"
+#include "error.hpp"
+#include "ieee_754_binary.hpp"
+#include "utility.hpp"
+#include "zisc_config.hpp"
+#include "math/fraction.hpp"
+
+namespace zisc {
+
+/*!
+  \details The number is the largest number of initializers which
+  the aggregate accepts
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+constexpr auto SchemaSerializer::fieldCount() noexcept -> std::size_t
+{
+  static_assert(std::is_aggregate_v<Type>, "The type isn't an aggregate.");
+  constexpr std::size_t max_count = 16 + 1;
+  auto count = []<std::size_t... kCounts>(std::index_sequence<kCounts...>) -> std::size_t
+  {
+    std::size_t n = 0;
+    ((n = isInitializable<Type>(std::make_index_sequence<kCounts>{}) ? kCounts : n), ...);
+    return n;
+  };
+  return count(std::make_index_sequence<max_count + 1>{});
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr auto SchemaSerializer::headerMagic() noexcept -> uint32b
+{
+  // "ZSCH" in little endian
+  constexpr uint32b magic = 0x4843'535au;
+  return magic;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+constexpr auto SchemaSerializer::isBlock() noexcept -> bool
+{
+  using T = std::remove_cv_t<Type>;
+  if constexpr (!std::is_trivially_copyable_v<T>)
+    return false;
+  else if constexpr (Arithmetic<T> || std::is_enum_v<T>)
+    return true;
+  else if constexpr (isFraction<T>())
+    return isBlock<typename T::Type>() && (sizeof(T) == 2 * sizeof(typename T::Type));
+  else if constexpr (isIeee754Binary<T>())
+    return sizeof(T) == sizeof(typename T::BitT);
+  else if constexpr (isTupleLike<T>() || std::is_aggregate_v<T>)
+    return getBlockFieldSize<T>() == sizeof(T);
+  else
+    return false;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kEndian No description.
+  \param [out] value No description.
+  \param [in,out] reader No description.
+  \exception SystemError The reader doesn't have enough bytes
+  */
+template <typename Type, std::endian kEndian> inline
+void SchemaSerializer::read(Type* value, BinaryReader<kEndian>* reader)
+{
+  ZISC_ASSERT(value != nullptr, "The given value is null.");
+  ZISC_ASSERT(reader != nullptr, "The given reader is null.");
+  using T = std::remove_cv_t<Type>;
+  if constexpr (Arithmetic<T> || std::is_enum_v<T>) {
+    reader->read(value);
+  }
+  else if constexpr (isMemcpyCopyable<T, kEndian>()) {
+    reader->read(std::span<T, 1>{value, 1});
+  }
+  else if constexpr (isContainer<T>()) {
+    using ValueT = typename T::value_type;
+    const auto n = cast<std::size_t>(reader->template read<uint64b>());
+    // Check the size before allocating the storage for a broken snapshot
+    constexpr std::size_t min_size = std::is_empty_v<ValueT>
+        ? 0
+        : (isBlock<ValueT>() ? sizeof(ValueT) : 1);
+    if ((0 < min_size) && ((reader->remaining() / min_size) < n))
+      throw SystemError{ErrorCode::kBinaryOutOfRange,
+                        "The reader doesn't have enough bytes for the container."};
+    value->resize(n);
+    if constexpr (isMemcpyCopyable<ValueT, kEndian>() ||
+                  Arithmetic<ValueT> || std::is_enum_v<ValueT>) {
+      reader->read(std::span{value->data(), n});
+    }
+    else {
+      for (ValueT& element : *value)
+        read(&element, reader);
+    }
+  }
+  else if constexpr (isFraction<T>()) {
+    read(&value->numer(), reader);
+    read(&value->denom(), reader);
+  }
+  else if constexpr (isIeee754Binary<T>()) {
+    *value = T{reader->template read<typename T::BitT>()};
+  }
+  else if constexpr (isTupleLike<T>()) {
+    std::apply([reader](auto&... elements)
+    {
+      (read(&elements, reader), ...);
+    }, *value);
+  }
+  else if constexpr (std::is_aggregate_v<T>) {
+    visitFields(*value, [reader](auto&... fields)
+    {
+      (read(&fields, reader), ...);
+    });
+  }
+  else {
+    static_assert(!std::is_same_v<T, T>, "The type isn't serializable.");
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam kEndian No description.
+  \param [in,out] reader No description.
+  \return No description
+  \exception SystemError The header is invalid
+  */
+template <std::endian kEndian> inline
+auto SchemaSerializer::readHeader(BinaryReader<kEndian>* reader) -> SchemaHeader
+{
+  SchemaHeader header{};
+  read(&header, reader);
+  if (header.magic_ != headerMagic())
+    throw SystemError{ErrorCode::kBinaryInvalidFormat,
+                      "The snapshot doesn't start with a schema header."};
+  if (reader->remaining() < header.size_)
+    throw SystemError{ErrorCode::kBinaryOutOfRange,
+                      "The snapshot is truncated."};
+  return header;
+}
+
+/*!
+  \details If the version doesn't match, the payload is skipped and
+  the value isn't modified
+
+  \tparam Type No description.
+  \tparam kEndian No description.
+  \param [out] value No description.
+  \param [in] version No description.
+  \param [in,out] reader No description.
+  \return True if the value is read, false otherwise
+  \exception SystemError The snapshot is invalid
+  */
+template <typename Type, std::endian kEndian> inline
+auto SchemaSerializer::readVersioned(Type* value,
+                                     const uint32b version,
+                                     BinaryReader<kEndian>* reader) -> bool
+{
+  const SchemaHeader header = readHeader(reader);
+  if (header.version_ != version) {
+    reader->skip(cast<std::size_t>(header.size_));
+    return false;
+  }
+  const std::size_t begin = reader->position();
+  read(value, reader);
+  if ((reader->position() - begin) != header.size_)
+    throw SystemError{ErrorCode::kBinaryInvalidFormat,
+                      "The payload size doesn't match the header."};
+  return true;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kEndian No description.
+  \param [in] value No description.
+  \param [in,out] writer No description.
+  \exception SystemError The writer doesn't have enough space
+  */
+template <typename Type, std::endian kEndian> inline
+void SchemaSerializer::write(const Type& value, BinaryWriter<kEndian>* writer)
+{
+  ZISC_ASSERT(writer != nullptr, "The given writer is null.");
+  using T = std::remove_cv_t<Type>;
+  if constexpr (Arithmetic<T> || std::is_enum_v<T>) {
+    writer->write(value);
+  }
+  else if constexpr (isMemcpyCopyable<T, kEndian>()) {
+    writer->write(std::span<const T, 1>{&value, 1});
+  }
+  else if constexpr (isContainer<T>()) {
+    using ValueT = typename T::value_type;
+    writer->write(cast<uint64b>(value.size()));
+    if constexpr (isMemcpyCopyable<ValueT, kEndian>() ||
+                  Arithmetic<ValueT> || std::is_enum_v<ValueT>) {
+      writer->write(std::span{value.data(), value.size()});
+    }
+    else {
+      for (const ValueT& element : value)
+        write(element, writer);
+    }
+  }
+  else if constexpr (isFraction<T>()) {
+    write(value.numer(), writer);
+    write(value.denom(), writer);
+  }
+  else if constexpr (isIeee754Binary<T>()) {
+    writer->write(value.bits());
+  }
+  else if constexpr (isTupleLike<T>()) {
+    std::apply([writer](const auto&... elements)
+    {
+      (write(elements, writer), ...);
+    }, value);
+  }
+  else if constexpr (std::is_aggregate_v<T>) {
+    visitFields(value, [writer](const auto&... fields)
+    {
+      (write(fields, writer), ...);
+    });
+  }
+  else {
+    static_assert(!std::is_same_v<T, T>, "The type isn't serializable.");
+  }
+}
+
+/*!
+  \details The header keeps the size of the payload,
+  so a snapshot of another version can be skipped without parsing it
+
+  \tparam Type No description.
+  \tparam kEndian No description.
+  \param [in] value No description.
+  \param [in] version No description.
+  \param [in,out] writer No description.
+  \exception SystemError The writer doesn't have enough space
+  */
+template <typename Type, std::endian kEndian> inline
+void SchemaSerializer::writeVersioned(const Type& value,
+                                      const uint32b version,
+                                      BinaryWriter<kEndian>* writer)
+{
+  const std::size_t header_position = writer->position();
+  SchemaHeader header{headerMagic(), version, 0};
+  write(header, writer);
+  const std::size_t begin = writer->position();
+  write(value, writer);
+  const std::size_t end = writer->position();
+  // Patch the size of the payload
+  header.size_ = cast<uint64b>(end - begin);
+  writer->seek(header_position);
+  write(header, writer);
+  writer->seek(end);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+constexpr auto SchemaSerializer::isContainer() noexcept -> bool
+{
+  const bool result = requires (Type& c, std::size_t n) {
+    typename Type::value_type;
+    {c.data()} -> std::same_as<typename Type::value_type*>;
+    {c.size()} -> std::convertible_to<std::size_t>;
+    c.resize(n);
+  };
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+constexpr auto SchemaSerializer::isFraction() noexcept -> bool
+{
+  if constexpr (requires {typename Type::Type;})
+    return std::is_same_v<Type, Fraction<typename Type::Type>>;
+  else
+    return false;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+constexpr auto SchemaSerializer::isIeee754Binary() noexcept -> bool
+{
+  if constexpr (requires {typename Type::BitT;})
+    return std::is_same_v<Type, BinaryFromBytes<sizeof(typename Type::BitT)>>;
+  else
+    return false;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kIndices No description.
+  \return No description
+  */
+template <typename Type, std::size_t... kIndices> inline
+constexpr auto SchemaSerializer::isInitializable(std::index_sequence<kIndices...>) noexcept
+    -> bool
+{
+  const bool result = requires {
+    Type{(static_cast<void>(kIndices), AnyField{})...};
+  };
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+constexpr auto SchemaSerializer::isTupleLike() noexcept -> bool
+{
+  const bool result = requires {
+    std::tuple_size<Type>::value;
+  };
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kEndian No description.
+  \return No description
+  */
+template <typename Type, std::endian kEndian> inline
+constexpr auto SchemaSerializer::isMemcpyCopyable() noexcept -> bool
+{
+  const bool result = isBlock<Type>() && (kEndian == std::endian::native);
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+constexpr auto SchemaSerializer::getBlockFieldSize() noexcept -> std::size_t
+{
+  auto get_size = []<typename... Fields>(const Fields*...) -> std::size_t
+  {
+    const bool is_block = (isBlock<Fields>() && ...);
+    return is_block ? (std::size_t{0} + ... + sizeof(Fields)) : 0;
+  };
+  if constexpr (isTupleLike<Type>()) {
+    using IndexSeq = std::make_index_sequence<std::tuple_size_v<Type>>;
+    return [get_size]<std::size_t... kIndices>(std::index_sequence<kIndices...>)
+    {
+      return get_size(static_cast<const std::tuple_element_t<kIndices, Type>*>(nullptr)...);
+    }(IndexSeq{});
+  }
+  else {
+    using FieldPointers = decltype(visitFields(std::declval<Type&>(), [](auto&... fields)
+    {
+      return std::tuple<const std::remove_cvref_t<decltype(fields)>*...>{};
+    }));
+    return std::apply(get_size, FieldPointers{});
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam Func No description.
+  \param [in] value No description.
+  \param [in] func No description.
+  \return No description
+  */
+template <typename Type, typename Func> inline
+constexpr auto SchemaSerializer::visitFields(Type& value, Func&& func) -> decltype(auto)
+{
+  constexpr std::size_t n = fieldCount<std::remove_cv_t<Type>>();
+  static_assert(n <= 16, "The aggregate has more than 16 fields.");
+  if constexpr (n == 0) {
+    static_cast<void>(value);
+    return func();
+  }
+  else if constexpr (n == 1) {
+    auto& [f0] = value;
+    return func(f0);
+  }
+  else if constexpr (n == 2) {
+    auto& [f0, f1] = value;
+    return func(f0, f1);
+  }
+  else if constexpr (n == 3) {
+    auto& [f0, f1, f2] = value;
+    return func(f0, f1, f2);
+  }
+  else if constexpr (n == 4) {
+    auto& [f0, f1, f2, f3] = value;
+    return func(f0, f1, f2, f3);
+  }
+  else if constexpr (n == 5) {
+    auto& [f0, f1, f2, f3, f4] = value;
+    return func(f0, f1, f2, f3, f4);
+  }
+  else if constexpr (n == 6) {
+    auto& [f0, f1, f2, f3, f4, f5] = value;
+    return func(f0, f1, f2, f3, f4, f5);
+  }
+  else if constexpr (n == 7) {
+    auto& [f0, f1, f2, f3, f4, f5, f6] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6);
+  }
+  else if constexpr (n == 8) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7);
+  }
+  else if constexpr (n == 9) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+  }
+  else if constexpr (n == 10) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+  }
+  else if constexpr (n == 11) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+  }
+  else if constexpr (n == 12) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+  }
+  else if constexpr (n == 13) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+  }
+  else if constexpr (n == 14) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+  }
+  else if constexpr (n == 15) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+  }
+  else {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = value;
+    return func(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+  }
+}
+
+} // namespace zisc
+
+#endif // ZISC_SCHEMA_SERIALIZER_INL_HPP
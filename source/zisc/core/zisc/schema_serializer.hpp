@@ -0,0 +1,147 @@
+/*!
+  \file schema_serializer.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_SCHEMA_SERIALIZER_HPP
+#define ZISC_SCHEMA_SERIALIZER_HPP
+
+// Standard C++ library
+#include <bit>
+#include <cstddef>
+#include <utility>
+// Zisc
+#include "binary_reader.hpp"
+#include "binary_writer.hpp"
+#include "zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief The header of a versioned snapshot
+
+  No detailed description.
+  */
+struct SchemaHeader
+{
+  uint32b magic_ = 0;
+  uint32b version_ = 0;
+  uint64b size_ = 0; //!< The size of the payload in bytes
+};
+
+/*!
+  \brief Serialize values field by field without handwritten code
+
+  The layout of a value is generated at compile time from its type.
+  The following types are supported and can be nested.
+  - Arithmetic and enum types
+  - Aggregates. The fields are found by structured bindings,
+    so C arrays, base classes and more than 16 fields aren't supported
+  - Contiguous containers with resize(), such as std::pmr::vector and
+    std::pmr::string. The size is written as uint64b before the elements
+  - Tuple-like types, such as std::tuple of a Csv record, std::pair and std::array
+  - Fraction and Ieee754Binary
+
+  A value which is trivially copyable and has no padding is a block.
+  If the wire endianness is native, a block and a container of blocks are
+  copied with a single memcpy instead of field by field.
+
+  \note No notation.
+  \attention No attention.
+  */
+class SchemaSerializer
+{
+ public:
+  //! Return the number of the fields of the given aggregate
+  template <typename Type>
+  static constexpr auto fieldCount() noexcept -> std::size_t;
+
+  //! Return the magic number of a versioned header
+  static constexpr auto headerMagic() noexcept -> uint32b;
+
+  //! Check if the given type is trivially copyable and has no padding
+  template <typename Type>
+  static constexpr auto isBlock() noexcept -> bool;
+
+  //! Deserialize a value from the given reader
+  template <typename Type, std::endian kEndian>
+  static void read(Type* value, BinaryReader<kEndian>* reader);
+
+  //! Read a versioned header
+  template <std::endian kEndian>
+  static auto readHeader(BinaryReader<kEndian>* reader) -> SchemaHeader;
+
+  //! Deserialize a value if the version of the snapshot matches
+  template <typename Type, std::endian kEndian>
+  static auto readVersioned(Type* value,
+                            const uint32b version,
+                            BinaryReader<kEndian>* reader) -> bool;
+
+  //! Serialize the given value into the writer
+  template <typename Type, std::endian kEndian>
+  static void write(const Type& value, BinaryWriter<kEndian>* writer);
+
+  //! Serialize the given value with a versioned header
+  template <typename Type, std::endian kEndian>
+  static void writeVersioned(const Type& value,
+                             const uint32b version,
+                             BinaryWriter<kEndian>* writer);
+
+ private:
+  /*!
+    \brief A placeholder which is convertible to any field
+    */
+  struct AnyField
+  {
+    template <typename Type>
+    constexpr operator Type&() const&& noexcept; // Used only in unevaluated contexts
+  };
+
+
+  //! Check if the given type is a contiguous resizable container
+  template <typename Type>
+  static constexpr auto isContainer() noexcept -> bool;
+
+  //! Check if the given type is a Fraction
+  template <typename Type>
+  static constexpr auto isFraction() noexcept -> bool;
+
+  //! Check if the given type is an Ieee754Binary
+  template <typename Type>
+  static constexpr auto isIeee754Binary() noexcept -> bool;
+
+  //! Check if the given aggregate can be initialized with the given number of fields
+  template <typename Type, std::size_t... kIndices>
+  static constexpr auto isInitializable(std::index_sequence<kIndices...>) noexcept -> bool;
+
+  //! Check if the given type is tuple-like
+  template <typename Type>
+  static constexpr auto isTupleLike() noexcept -> bool;
+
+  //! Check if a block of the given type can be copied with memcpy
+  template <typename Type, std::endian kEndian>
+  static constexpr auto isMemcpyCopyable() noexcept -> bool;
+
+  //! Return the sum of the sizes of the elements if they are all blocks. 0 otherwise
+  template <typename Type>
+  static constexpr auto getBlockFieldSize() noexcept -> std::size_t;
+
+  //! Call the given function with references of the fields of the given value
+  template <typename Type, typename Func>
+  static constexpr auto visitFields(Type& value, Func&& func) -> decltype(auto);
+};
+
+} // namespace zisc
+
+#include "schema_serializer-inl.hpp"
+
+#endif // ZISC_SCHEMA_SERIALIZER_HPP
@@ -0,0 +1,419 @@
+/*!
+  \file columnar_csv-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_COLUMNAR_CSV_INL_HPP
+#define ZISC_COLUMNAR_CSV_INL_HPP
+
+#include "columnar_csv.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Zisc
+#include "csv_tokenizer.hpp"
+#include "json_value_parser.hpp"
+#include "zisc/concepts.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/memory/mapped_file.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief The array of a bool, integer or float column
+
+  No detailed description.
+
+  \tparam Type No description.
+  */
+template <typename Type>
+struct CsvColumnImpl
+{
+  using ElementT = std::conditional_t<std::same_as<bool, Type>, uint8b, Type>;
+
+  //! Initialize the column
+  explicit CsvColumnImpl(std::pmr::memory_resource* mem_resource) noexcept :
+      data_{typename decltype(data_)::allocator_type{mem_resource}}
+  {
+  }
+
+  //! Clear the column
+  void clear() noexcept
+  {
+    data_.clear();
+  }
+
+  //! Reserve storage for the given number of rows
+  void reserve(const std::size_t cap)
+  {
+    data_.reserve(cap);
+  }
+
+  //! Return the number of rows that can be held in allocated storage
+  auto rowCapacity() const noexcept -> std::size_t
+  {
+    return data_.capacity();
+  }
+
+  std::pmr::vector<ElementT> data_; //!< Values of the column
+};
+
+/*!
+  \brief The byte buffer and the offsets of a string column
+
+  No detailed description.
+
+  \tparam Type No description.
+  */
+template <String Type>
+struct CsvColumnImpl<Type>
+{
+  using ElementT = char;
+
+  //! Initialize the column
+  explicit CsvColumnImpl(std::pmr::memory_resource* mem_resource) noexcept :
+      data_{typename decltype(data_)::allocator_type{mem_resource}},
+      offset_list_{typename decltype(offset_list_)::allocator_type{mem_resource}}
+  {
+  }
+
+  //! Clear the column
+  void clear() noexcept
+  {
+    data_.clear();
+    offset_list_.clear();
+  }
+
+  //! Reserve storage for the given number of rows
+  void reserve(const std::size_t cap)
+  {
+    offset_list_.reserve(cap);
+  }
+
+  //! Return the number of rows that can be held in allocated storage
+  auto rowCapacity() const noexcept -> std::size_t
+  {
+    return offset_list_.capacity();
+  }
+
+  std::pmr::vector<char> data_; //!< Null-terminated strings of the column
+  std::pmr::vector<std::size_t> offset_list_; //!< The beginning of the string of each row
+};
+
+/*!
+  \details No detailed description
+
+  \param [in,out] mem_resource No description.
+  */
+template <typename Type, typename ...Types> inline
+ColumnarCsv<Type, Types...>::ColumnarCsv(std::pmr::memory_resource* mem_resource) noexcept :
+    column_list_{CsvColumnImpl<Type>{mem_resource}, CsvColumnImpl<Types>{mem_resource}...}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  */
+template <typename Type, typename ...Types> inline
+ColumnarCsv<Type, Types...>::ColumnarCsv(ColumnarCsv&& other) noexcept :
+    column_list_{std::move(other.column_list_)},
+    row_size_{other.row_size_}
+{
+  other.row_size_ = 0;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  */
+template <typename Type, typename ...Types> inline
+auto ColumnarCsv<Type, Types...>::operator=(ColumnarCsv&& other) noexcept -> ColumnarCsv&
+{
+  column_list_ = std::move(other.column_list_);
+  row_size_ = other.row_size_;
+  other.row_size_ = 0;
+  return *this;
+}
+
+/*!
+  \details The whole stream is read at once, so lines can be of any length
+
+  \param [in,out] csv No description.
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> inline
+void ColumnarCsv<Type, Types...>::append(std::istream& csv)
+{
+  constexpr std::size_t block_size = 64 * 1024;
+  std::pmr::string text{std::pmr::string::allocator_type{memoryResource()}};
+  for (std::size_t size = 0; csv;) {
+    text.resize(size + block_size);
+    csv.read(text.data() + size, cast<std::streamsize>(block_size));
+    size += cast<std::size_t>(csv.gcount());
+    text.resize(size);
+  }
+  append(text);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] csv No description.
+  \param [in] line_number The line number of the beginning of the text.
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> inline
+void ColumnarCsv<Type, Types...>::append(const std::string_view csv,
+                                         const std::size_t line_number)
+{
+  appendImpl(csv, line_number);
+}
+
+/*!
+  \details Strings are copied into the columns, so the file is unmapped after parsing
+
+  \param [in] file_path No description.
+  \exception std::system_error The file can't be mapped
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> inline
+void ColumnarCsv<Type, Types...>::appendFile(const std::filesystem::path& file_path)
+{
+  const MappedFile file{file_path};
+  appendImpl(file.view(), 1);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto ColumnarCsv<Type, Types...>::capacity() const noexcept -> std::size_t
+{
+  const std::size_t cap = std::apply([](const auto& ...columns) noexcept
+  {
+    return (std::min)({columns.rowCapacity()...});
+  }, column_list_);
+  return cap;
+}
+
+/*!
+  \details No detailed description
+  */
+template <typename Type, typename ...Types> inline
+void ColumnarCsv<Type, Types...>::clear() noexcept
+{
+  std::apply([](auto& ...columns) noexcept
+  {
+    (columns.clear(), ...);
+  }, column_list_);
+  row_size_ = 0;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam index No description.
+  \return No description
+  */
+template <typename Type, typename ...Types> template <std::size_t index> inline
+auto ColumnarCsv<Type, Types...>::column() const noexcept
+    -> std::span<const ElementType<index>>
+{
+  return {std::get<index>(column_list_).data_};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+constexpr auto ColumnarCsv<Type, Types...>::columnSize() noexcept -> uint
+{
+  constexpr uint size = 1 + sizeof...(Types);
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam index No description.
+  \param [in] row No description.
+  \return No description
+  */
+template <typename Type, typename ...Types> template <std::size_t index> inline
+auto ColumnarCsv<Type, Types...>::get(const std::size_t row) const noexcept
+    -> FieldType<index>
+{
+  //! \todo Exception check
+  ZISC_ASSERT(row < rowSize(), "The row is out of range.");
+  using FieldT = FieldType<index>;
+  const auto& c = std::get<index>(column_list_);
+  if constexpr (String<FieldT>) {
+    const std::size_t begin = c.offset_list_[row];
+    const std::size_t end = ((row + 1) < rowSize()) ? c.offset_list_[row + 1]
+                                                    : c.data_.size();
+    const char* s = c.data_.data() + begin;
+    if constexpr (CharPointer<FieldT>) {
+      return s;
+    }
+    else {
+      const FieldT result{std::string_view{s, end - begin - 1}};
+      return result;
+    }
+  }
+  else {
+    const auto result = cast<FieldT>(c.data_[row]);
+    return result;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam index No description.
+  \return No description
+  */
+template <typename Type, typename ...Types> template <std::size_t index> inline
+auto ColumnarCsv<Type, Types...>::offsets() const noexcept -> std::span<const std::size_t>
+{
+  static_assert(String<FieldType<index>>, "The column isn't a string column.");
+  return {std::get<index>(column_list_).offset_list_};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto ColumnarCsv<Type, Types...>::rowSize() const noexcept -> std::size_t
+{
+  return row_size_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] cap No description.
+  */
+template <typename Type, typename ...Types> inline
+void ColumnarCsv<Type, Types...>::setCapacity(const std::size_t cap) noexcept
+{
+  std::apply([cap](auto& ...columns) noexcept
+  {
+    (columns.reserve(cap), ...);
+  }, column_list_);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam index No description.
+  \param [in] field No description.
+  */
+template <typename Type, typename ...Types> template <std::size_t index> inline
+void ColumnarCsv<Type, Types...>::appendField(const std::string_view field)
+{
+  using FieldT = FieldType<index>;
+  auto& c = std::get<index>(column_list_);
+  if constexpr (String<FieldT>) {
+    const std::size_t offset = c.data_.size();
+    const std::size_t size = CsvTokenizer::getUnquotedSize(field);
+    c.offset_list_.push_back(offset);
+    c.data_.resize(offset + size + 1); // Null-terminated
+    CsvTokenizer::unquote(field, c.data_.data() + offset);
+    c.data_[offset + size] = '\0';
+  }
+  else if constexpr (std::same_as<bool, FieldT>) {
+    c.data_.push_back(JsonValueParser::toCxxBool(field) ? 1 : 0);
+  }
+  else if constexpr (std::floating_point<FieldT>) {
+    c.data_.push_back(JsonValueParser::toCxxFloat<FieldT>(field));
+  }
+  else {
+    c.data_.push_back(JsonValueParser::toCxxInteger<FieldT>(field));
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] csv No description.
+  \param [in] line_number No description.
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> inline
+void ColumnarCsv<Type, Types...>::appendImpl(const std::string_view csv,
+                                             const std::size_t line_number)
+{
+  CsvTokenizer tokenizer{csv, line_number};
+  std::array<std::string_view, columnSize()> field_list{};
+  while (tokenizer.next(field_list))
+    appendRecord(tokenizer, field_list, std::make_index_sequence<columnSize()>());
+}
+
+/*!
+  \details All fields are validated before any column grows,
+  so a malformed record leaves no partial row
+
+  \tparam indices No description.
+  \param [in] tokenizer No description.
+  \param [in] field_list No description.
+  \exception CsvParseError The record is malformed
+  */
+template <typename Type, typename ...Types>
+template <std::size_t ...indices> inline
+void ColumnarCsv<Type, Types...>::appendRecord(const CsvTokenizer& tokenizer,
+                                               std::span<const std::string_view> field_list,
+                                               [[maybe_unused]] std::index_sequence<indices...> idx)
+{
+  tokenizer.validateNumOfFields(columnSize());
+  (tokenizer.validateField<FieldType<indices>>(indices, field_list[indices]), ...);
+  (appendField<indices>(field_list[indices]), ...);
+  ++row_size_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto ColumnarCsv<Type, Types...>::memoryResource() noexcept -> std::pmr::memory_resource*
+{
+  auto mem_resource = std::get<0>(column_list_).data_.get_allocator().resource();
+  return mem_resource;
+}
+
+} // namespace zisc
+
+#endif // ZISC_COLUMNAR_CSV_INL_HPP
@@ -0,0 +1,142 @@
+/*!
+  \file columnar_csv.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_COLUMNAR_CSV_HPP
+#define ZISC_COLUMNAR_CSV_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <utility>
+// Zisc
+#include "zisc/concepts.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+// Forward declaration
+template <typename Type> struct CsvColumnImpl;
+class CsvTokenizer;
+
+/*!
+  \brief Manipulate CSV file in structure-of-arrays layout
+
+  Each column is stored in its own contiguous array, so scanning a column
+  doesn't pull other columns through the cache.
+  A bool column is stored as uint8b (0 or 1).
+  A string column is stored as a byte buffer and an offset array.
+  The string of a row begins at offsets<index>()[row] of the buffer
+  and is null-terminated.
+  Records are parsed and validated in the same way as Csv.
+  A malformed record throws CsvParseError and leaves no partial row.
+
+  \tparam Type No description.
+  \tparam Types No description.
+  */
+template <typename Type, typename ...Types>
+class ColumnarCsv : private NonCopyable<ColumnarCsv<Type, Types...>>
+{
+ public:
+  //! Represent a value in a line by the index
+  template <std::size_t index>
+  using FieldType = typename std::tuple_element<index,
+                                                std::tuple<Type, Types...>>::type;
+
+  //! Represent an element of a column array by the index
+  template <std::size_t index>
+  using ElementType = typename CsvColumnImpl<FieldType<index>>::ElementT;
+
+
+  //! Initialize CSV
+  explicit ColumnarCsv(std::pmr::memory_resource* mem_resource) noexcept;
+
+  //! Move data
+  ColumnarCsv(ColumnarCsv&& other) noexcept;
+
+
+  //! Move data
+  auto operator=(ColumnarCsv&& other) noexcept -> ColumnarCsv&;
+
+
+  //! Add values
+  void append(std::istream& csv);
+
+  //! Add values of the given CSV text
+  void append(const std::string_view csv, const std::size_t line_number = 1);
+
+  //! Map the given CSV file and add values
+  void appendFile(const std::filesystem::path& file_path);
+
+  //! Return the number of rows that can be held in allocated storage
+  [[nodiscard]]
+  auto capacity() const noexcept -> std::size_t;
+
+  //! Clear all csv data
+  void clear() noexcept;
+
+  //! Return the array of the given column
+  template <std::size_t index>
+  auto column() const noexcept -> std::span<const ElementType<index>>;
+
+  //! Return the column size
+  static constexpr auto columnSize() noexcept -> uint;
+
+  //! Return the field value of the given row by the column index
+  template <std::size_t index>
+  auto get(const std::size_t row) const noexcept -> FieldType<index>;
+
+  //! Return the offsets of strings in the given string column
+  template <std::size_t index>
+  auto offsets() const noexcept -> std::span<const std::size_t>;
+
+  //! Return the row size
+  [[nodiscard]]
+  auto rowSize() const noexcept -> std::size_t;
+
+  //! Reserve storage
+  void setCapacity(const std::size_t cap) noexcept;
+
+ private:
+  //! Convert a CSV value and add it to the column
+  template <std::size_t index>
+  void appendField(const std::string_view field);
+
+  //! Add values of the given CSV text
+  void appendImpl(const std::string_view csv, const std::size_t line_number);
+
+  //! Add the current record of the tokenizer to the columns
+  template <std::size_t ...indices>
+  void appendRecord(const CsvTokenizer& tokenizer,
+                    std::span<const std::string_view> field_list,
+                    std::index_sequence<indices...> idx);
+
+  //! Return the underlying memory resource
+  auto memoryResource() noexcept -> std::pmr::memory_resource*;
+
+
+  std::tuple<CsvColumnImpl<Type>, CsvColumnImpl<Types>...> column_list_;
+  std::size_t row_size_ = 0;
+};
+
+} // namespace zisc
+
+#include "columnar_csv-inl.hpp"
+
+#endif // ZISC_COLUMNAR_CSV_HPP
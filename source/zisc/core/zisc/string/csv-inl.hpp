@@ -17,12 +17,16 @@
 
 #include "csv.hpp"
 // Standard C++ library
+#include <algorithm>
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <future>
 #include <istream>
+#include <iterator>
 #include <memory_resource>
-#include <regex>
 #include <span>
 #include <string>
 #include <string_view>
@@ -31,11 +35,15 @@
 #include <utility>
 #include <vector>
 // Zisc
-#include "constant_string.hpp"
+#include "csv_parse_error.hpp"
+#include "csv_tokenizer.hpp"
 #include "json_value_parser.hpp"
+#include "string_scan.hpp"
 #include "zisc/concepts.hpp"
 #include "zisc/error.hpp"
 #include "zisc/utility.hpp"
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/memory/mapped_file.hpp"
 #include "zisc/zisc_config.hpp"
 
 namespace zisc {
@@ -66,7 +74,8 @@ struct CsvRecordTypeImpl<0, Type, Types...>
 template <std::size_t kN, typename Type, typename ...Types>
 struct CsvRecordTypeImpl
 {
-  using T = std::conditional_t<String<Type>, std::pmr::string, Type>;
+  using StringT = std::conditional_t<StdStringView<Type>, std::string_view, std::pmr::string>;
+  using T = std::conditional_t<String<Type>, StringT, Type>;
   using RecordT = typename CsvRecordTypeImpl<kN - 1, Types..., T>::RecordT;
 };
 
@@ -78,8 +87,8 @@ struct CsvRecordTypeImpl
 template <typename Type, typename ...Types> inline
 Csv<Type, Types...>::Csv(std::pmr::memory_resource* mem_resource) noexcept : 
     data_{typename decltype(data_)::allocator_type{mem_resource}},
-    csv_pattern_{csvPattern().toCStr(),
-                 std::regex_constants::optimize | std::regex_constants::ECMAScript}
+    file_list_{typename decltype(file_list_)::allocator_type{mem_resource}},
+    string_block_list_{typename decltype(string_block_list_)::allocator_type{mem_resource}}
 {
 }
 
@@ -91,7 +100,8 @@ Csv<Type, Types...>::Csv(std::pmr::memory_resource* mem_resource) noexcept :
 template <typename Type, typename ...Types> inline
 Csv<Type, Types...>::Csv(Csv&& other) noexcept : 
     data_{std::move(other.data_)},
-    csv_pattern_{std::move(other.csv_pattern_)}
+    file_list_{std::move(other.file_list_)},
+    string_block_list_{std::move(other.string_block_list_)}
 {
 }
 
@@ -104,60 +114,107 @@ template <typename Type, typename ...Types> inline
 auto Csv<Type, Types...>::operator=(Csv&& other) noexcept -> Csv&
 {
   data_ = std::move(other.data_);
-  csv_pattern_ = std::move(other.csv_pattern_);
+  file_list_ = std::move(other.file_list_);
+  string_block_list_ = std::move(other.string_block_list_);
   return *this;
 }
 
 /*!
   \details No detailed description
 
-  \tparam kMaxNumCharsPerLine No description.
+  \param [in] begin No description.
+  \param [in] limit No description.
+  \param [in,out] mem_resource No description.
+  */
+template <typename Type, typename ...Types> inline
+Csv<Type, Types...>::ParseChunk::ParseChunk(const std::size_t begin,
+                                            const std::size_t limit,
+                                            std::pmr::memory_resource* mem_resource) noexcept :
+    csv_{mem_resource},
+    begin_{begin},
+    limit_{limit}
+{
+}
+
+/*!
+  \details The whole stream is read at once, so lines can be of any length
+
   \param [in,out] csv No description.
+  \exception CsvParseError A record is malformed
   */
-template <typename Type, typename ...Types> template <std::size_t kMaxNumCharsPerLine>
-inline
-void Csv<Type, Types...>::append(std::istream& csv) noexcept
+template <typename Type, typename ...Types> inline
+void Csv<Type, Types...>::append(std::istream& csv)
 {
-  constexpr std::size_t n = kMaxNumCharsPerLine;
-  std::array<char, n> s{};
-  for (csv.getline(s.data(), n); !csv.eof(); csv.getline(s.data(), n)) {
-    std::string_view line{s.data()};
-    const RecordType cxx_record = parseCsvLine(line);
-    data_.emplace_back(std::move(cxx_record));
+  std::pmr::string text{std::pmr::string::allocator_type{memoryResource()}};
+  for (std::size_t size = 0; csv;) {
+    text.resize(size + kStringBlockSize);
+    csv.read(text.data() + size, cast<std::streamsize>(kStringBlockSize));
+    size += cast<std::size_t>(csv.gcount());
+    text.resize(size);
   }
+  append(text);
 }
 
 /*!
   \details No detailed description
 
-  \return No description
+  \param [in] csv No description.
+  \param [in] line_number The line number of the beginning of the text.
+  \exception CsvParseError A record is malformed
   */
 template <typename Type, typename ...Types> inline
-auto Csv<Type, Types...>::capacity() const noexcept -> std::size_t
+void Csv<Type, Types...>::append(const std::string_view csv, const std::size_t line_number)
 {
-  const std::size_t cap = data_.capacity();
-  return cap;
+  appendImpl(csv, line_number, false);
 }
 
 /*!
   \details No detailed description
+
+  \param [in] file_path No description.
+  \exception std::system_error The file can't be mapped
+  \exception CsvParseError A record is malformed
   */
 template <typename Type, typename ...Types> inline
-void Csv<Type, Types...>::clear() noexcept
+void Csv<Type, Types...>::appendFile(const std::filesystem::path& file_path)
 {
-  data_.clear();
+  // The mapping is kept until clear() since records refer to it
+  const MappedFile& file = file_list_.emplace_back(file_path);
+  appendImpl(file.view(), 1, true);
 }
 
 /*!
   \details No detailed description
 
-  \return No description
+  \param [in] file_path No description.
+  \param [in,out] thread_manager No description.
+  \param [in] chunk_size No description.
+  \exception std::system_error The file can't be mapped
+  \exception CsvParseError A record is malformed
   */
 template <typename Type, typename ...Types> inline
-constexpr auto Csv<Type, Types...>::columnSize() noexcept -> uint
+void Csv<Type, Types...>::appendFileParallel(const std::filesystem::path& file_path,
+                                             ThreadManager& thread_manager,
+                                             const std::size_t chunk_size)
 {
-  constexpr uint size = 1 + sizeof...(Types);
-  return size;
+  const MappedFile& file = file_list_.emplace_back(file_path);
+  appendParallelImpl(file.view(), thread_manager, chunk_size, true);
+}
+
+/*!
+  \details The memory resource of the csv must be thread safe
+
+  \param [in] csv No description.
+  \param [in,out] thread_manager No description.
+  \param [in] chunk_size No description.
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> inline
+void Csv<Type, Types...>::appendParallel(const std::string_view csv,
+                                         ThreadManager& thread_manager,
+                                         const std::size_t chunk_size)
+{
+  appendParallelImpl(csv, thread_manager, chunk_size, false);
 }
 
 /*!
@@ -166,10 +223,21 @@ constexpr auto Csv<Type, Types...>::columnSize() noexcept -> uint
   \return No description
   */
 template <typename Type, typename ...Types> inline
-constexpr auto Csv<Type, Types...>::csvPattern() noexcept
+auto Csv<Type, Types...>::capacity() const noexcept -> std::size_t
 {
-  constexpr auto pattern = getCsvPattern<Type, Types...>();
-  return pattern;
+  const std::size_t cap = data_.capacity();
+  return cap;
+}
+
+/*!
+  \details No detailed description
+  */
+template <typename Type, typename ...Types> inline
+void Csv<Type, Types...>::clear() noexcept
+{
+  data_.clear();
+  file_list_.clear();
+  string_block_list_.clear();
 }
 
 /*!
@@ -178,9 +246,10 @@ constexpr auto Csv<Type, Types...>::csvPattern() noexcept
   \return No description
   */
 template <typename Type, typename ...Types> inline
-auto Csv<Type, Types...>::csvRegex() const noexcept -> const std::regex&
+constexpr auto Csv<Type, Types...>::columnSize() noexcept -> uint
 {
-  return csv_pattern_;
+  constexpr uint size = 1 + sizeof...(Types);
+  return size;
 }
 
 /*!
@@ -194,6 +263,18 @@ auto Csv<Type, Types...>::data() const noexcept -> std::span<const RecordType>
   return {data_};
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+constexpr auto Csv<Type, Types...>::defaultChunkSize() noexcept -> std::size_t
+{
+  constexpr std::size_t size = 1024 * 1024;
+  return size;
+}
+
 /*!
   \details No detailed description
 
@@ -313,132 +394,280 @@ auto Csv<Type, Types...>::toCxxType(const std::string_view json_value) noexcept
   std::pmr::string::allocator_type alloc{memoryResource()};
   std::pmr::string result{alloc};
 
-  const std::size_t size = JsonValueParser::getCxxStringSize(json_value);
+  const std::size_t size = CsvTokenizer::getUnquotedSize(json_value);
   result.resize(size);
 
-  JsonValueParser::toCxxString(json_value, result.data());
+  CsvTokenizer::unquote(json_value, result.data());
   return result;
 }
 
 /*!
   \details No detailed description
 
-  \tparam PType No description.
-  \tparam PTypes No description.
+  \param [in] size No description.
   \return No description
   */
-template <typename Type, typename ...Types>
-template <typename PType, typename ...PTypes> inline
-constexpr auto Csv<Type, Types...>::getCsvPattern() noexcept
+template <typename Type, typename ...Types> inline
+auto Csv<Type, Types...>::allocateString(const std::size_t size) -> char*
 {
-  constexpr std::size_t rest = sizeof...(PTypes);
-  const auto pattern1 = R"(\s*()" + getTypePattern<PType>() + R"()\s*)";
-  if constexpr (rest == 0) {
-    return pattern1;
-  }
-  else {
-    const auto pattern2 = pattern1 + R"(,)" + getCsvPattern<PTypes...>();
-    return pattern2;
+  const std::size_t n = size + 1; // Null-terminated
+  if (string_block_list_.empty() ||
+      ((string_block_list_.back().capacity() - string_block_list_.back().size()) < n)) {
+    // Strings never move since a block doesn't grow beyond its capacity
+    std::pmr::vector<char>& block = string_block_list_.emplace_back();
+    block.reserve((std::max)(kStringBlockSize, n));
   }
+  std::pmr::vector<char>& block = string_block_list_.back();
+  const std::size_t offset = block.size();
+  block.resize(offset + n);
+  char* s = block.data() + offset;
+  s[size] = '\0';
+  return s;
 }
 
 /*!
   \details No detailed description
 
-  \tparam PType No description.
-  \return No description
+  \param [in] csv No description.
+  \param [in] line_number No description.
+  \param [in] is_persistent The text is alive until clear() is called.
   */
-template <typename Type, typename ...Types> template <std::same_as<bool> PType> inline
-constexpr auto Csv<Type, Types...>::getTypePattern() noexcept
+template <typename Type, typename ...Types> inline
+void Csv<Type, Types...>::appendImpl(const std::string_view csv,
+                                     const std::size_t line_number,
+                                     const bool is_persistent)
 {
-  return JsonValueParser::booleanPattern();
+  std::size_t first_record_position = 0;
+  parseRange(csv, 0, csv.size(), line_number, is_persistent, &first_record_position);
 }
 
 /*!
   \details No detailed description
 
-  \tparam PType No description.
-  \return No description
+  \param [in] csv No description.
+  \param [in,out] thread_manager No description.
+  \param [in] chunk_size No description.
+  \param [in] is_persistent No description.
+  \exception CsvParseError A record is malformed
   */
-template <typename Type, typename ...Types> template <std::floating_point PType> inline
-constexpr auto Csv<Type, Types...>::getTypePattern() noexcept
+template <typename Type, typename ...Types> inline
+void Csv<Type, Types...>::appendParallelImpl(const std::string_view csv,
+                                             ThreadManager& thread_manager,
+                                             const std::size_t chunk_size,
+                                             const bool is_persistent)
 {
-  return JsonValueParser::floatPattern();
+  const std::size_t size = csv.size();
+  const std::size_t s = (std::max)(chunk_size, std::size_t{1});
+  const std::size_t n = (std::min)((size + s - 1) / s, thread_manager.capacity());
+  if (n <= 1) {
+    appendImpl(csv, 1, is_persistent);
+    return;
+  }
+
+  // Split the text into chunks just after line feeds
+  using ChunkList = std::pmr::vector<ParseChunk>;
+  ChunkList chunk_list{typename ChunkList::allocator_type{memoryResource()}};
+  chunk_list.reserve(n);
+  const std::size_t step = (size + n - 1) / n;
+  for (std::size_t begin = 0; begin < size;) {
+    const std::size_t pos = (std::min)(begin + step, size);
+    const std::size_t limit = (std::min)(findFirstOf<'\n'>(csv, pos) + 1, size);
+    chunk_list.emplace_back(begin, limit, memoryResource());
+    begin = limit;
+  }
+
+  // Parse the chunks speculatively
+  auto parse_chunk = [csv, is_persistent, &chunk_list](const std::size_t index) noexcept
+  {
+    ParseChunk& chunk = chunk_list[index];
+    try {
+      chunk.end_ = chunk.csv_.parseRange(csv,
+                                         chunk.begin_,
+                                         chunk.limit_,
+                                         1,
+                                         is_persistent,
+                                         &chunk.first_record_);
+    }
+    catch (...) {
+      chunk.exception_ = std::current_exception();
+    }
+  };
+  std::future<void> result = thread_manager.enqueueLoop(parse_chunk,
+                                                        std::size_t{0},
+                                                        chunk_list.size());
+  result.get();
+
+  // Verify the chunks in order. A misspeculated chunk is parsed again
+  // from the position where the previous chunk stopped
+  std::size_t position = 0;
+  std::size_t line_position = 0;
+  std::size_t line_number = 1;
+  std::size_t num_of_records = 0;
+  for (ParseChunk& chunk : chunk_list) {
+    if (chunk.limit_ <= position) {
+      // No record begins in the chunk
+      chunk.csv_.clear();
+      continue;
+    }
+    const bool is_valid = (chunk.begin_ == position) || (chunk.first_record_ == position);
+    if (!is_valid || chunk.exception_) {
+      // The line number is required for reporting errors
+      const auto count = std::count(csv.begin() + cast<std::ptrdiff_t>(line_position),
+                                    csv.begin() + cast<std::ptrdiff_t>(position),
+                                    '\n');
+      line_number += cast<std::size_t>(count);
+      line_position = position;
+      chunk.csv_.clear();
+      chunk.end_ = chunk.csv_.parseRange(csv,
+                                         position,
+                                         chunk.limit_,
+                                         line_number,
+                                         is_persistent,
+                                         &chunk.first_record_);
+    }
+    position = chunk.end_;
+    num_of_records += chunk.csv_.rowSize();
+  }
+
+  // Splice the records in order
+  data_.reserve(data_.size() + num_of_records);
+  for (ParseChunk& chunk : chunk_list)
+    splice(chunk.csv_);
 }
 
 /*!
   \details No detailed description
 
-  \tparam PType No description.
   \return No description
   */
-template <typename Type, typename ...Types> template <Integer PType> inline
-constexpr auto Csv<Type, Types...>::getTypePattern() noexcept
+template <typename Type, typename ...Types> inline
+auto Csv<Type, Types...>::memoryResource() noexcept -> std::pmr::memory_resource*
 {
-  return JsonValueParser::integerPattern();
+  auto mem_resource = data_.get_allocator().resource();
+  return mem_resource;
 }
 
 /*!
   \details No detailed description
 
-  \tparam PType No description.
+  \param [in] tokenizer No description.
+  \param [in] field_list No description.
+  \param [in] is_persistent No description.
   \return No description
+  \exception CsvParseError The record is malformed
   */
-template <typename Type, typename ...Types> template <String PType> inline
-constexpr auto Csv<Type, Types...>::getTypePattern() noexcept
+template <typename Type, typename ...Types> inline
+auto Csv<Type, Types...>::parseCsvRecord(const CsvTokenizer& tokenizer,
+                                         std::span<const std::string_view> field_list,
+                                         const bool is_persistent)
+    -> RecordType
 {
-  return JsonValueParser::stringPattern();
+  tokenizer.validateNumOfFields(columnSize());
+  auto cxx_record = toCxxRecord(tokenizer,
+                                field_list,
+                                is_persistent,
+                                std::make_index_sequence<columnSize()>());
+  return cxx_record;
 }
 
 /*!
   \details No detailed description
 
+  \param [in] csv No description.
+  \param [in] begin No description.
+  \param [in] limit No description.
+  \param [in] line_number The line number at the begin.
+  \param [in] is_persistent No description.
+  \param [out] first_record_position The position where the first record begins.
   \return No description
+  \exception CsvParseError A record is malformed
   */
 template <typename Type, typename ...Types> inline
-auto Csv<Type, Types...>::memoryResource() noexcept -> std::pmr::memory_resource*
+auto Csv<Type, Types...>::parseRange(const std::string_view csv,
+                                     const std::size_t begin,
+                                     const std::size_t limit,
+                                     const std::size_t line_number,
+                                     const bool is_persistent,
+                                     std::size_t* first_record_position) -> std::size_t
 {
-  auto mem_resource = data_.get_allocator().resource();
-  return mem_resource;
+  CsvTokenizer tokenizer{csv.substr(begin), line_number};
+  std::array<std::string_view, columnSize()> field_list{};
+  std::size_t end = csv.size();
+  *first_record_position = end;
+  for (bool is_first = true; tokenizer.next(field_list); is_first = false) {
+    const std::size_t position = begin + tokenizer.recordPosition();
+    if (is_first)
+      *first_record_position = position;
+    if (limit <= position) {
+      end = position;
+      break;
+    }
+    data_.emplace_back(parseCsvRecord(tokenizer, field_list, is_persistent));
+  }
+  return end;
 }
 
 /*!
   \details No detailed description
 
-  \param [in] line No description.
+  \param [in,out] other No description.
+  */
+template <typename Type, typename ...Types> inline
+void Csv<Type, Types...>::splice(Csv& other)
+{
+  data_.insert(data_.end(),
+               std::make_move_iterator(other.data_.begin()),
+               std::make_move_iterator(other.data_.end()));
+  // Strings don't move since the blocks are allocated from the same memory resource
+  for (std::pmr::vector<char>& block : other.string_block_list_)
+    string_block_list_.emplace_back(std::move(block));
+  for (MappedFile& file : other.file_list_)
+    file_list_.emplace_back(std::move(file));
+  other.clear();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] csv_value No description.
+  \param [in] is_persistent No description.
   \return No description
   */
 template <typename Type, typename ...Types> inline
-auto Csv<Type, Types...>::parseCsvLine(std::string_view line) noexcept
-    -> RecordType
+auto Csv<Type, Types...>::toCxxStringView(const std::string_view csv_value,
+                                          const bool is_persistent) -> std::string_view
 {
-  //! \todo Exception check
-  std::pmr::cmatch::allocator_type alloc{memoryResource()};
-  std::pmr::cmatch result{alloc};
-  [[maybe_unused]] const auto is_success = std::regex_match(line.data(),
-                                                            result,
-                                                            csvRegex());
-//  if (!is_success) {
-//    error << R"(Parsing ")" << line << R"(" failed.)" << std::endl;
-//  }
-  auto cxx_record = toCxxRecord(result, std::make_index_sequence<columnSize()>());
-  return cxx_record;
+  const std::string_view value = csv_value.substr(1, csv_value.size() - 2);
+  if (is_persistent && (findFirstOf<'"', '\\'>(value, 0) == value.size()))
+    return value;
+
+  const std::size_t size = CsvTokenizer::getUnquotedSize(csv_value);
+  char* result = allocateString(size);
+  CsvTokenizer::unquote(csv_value, result);
+  return {result, size};
 }
 
 /*!
   \details No detailed description
 
   \tparam indices No description.
-  \param [in] result No description.
+  \param [in] tokenizer No description.
+  \param [in] field_list No description.
+  \param [in] is_persistent No description.
   \return No description
   */
 template <typename Type, typename ...Types>
 template <std::size_t ...indices> inline
-auto Csv<Type, Types...>::toCxxRecord(const std::pmr::cmatch& result,
-                                      [[maybe_unused]] std::index_sequence<indices...> idx) noexcept
+auto Csv<Type, Types...>::toCxxRecord(const CsvTokenizer& tokenizer,
+                                      std::span<const std::string_view> field_list,
+                                      const bool is_persistent,
+                                      [[maybe_unused]] std::index_sequence<indices...> idx)
     -> RecordType
 {
-  const RecordType cxx_record = std::make_tuple(toCxxField<indices>(result)...);
+  // Fields are converted from left to right in braced initialization
+  RecordType cxx_record{toCxxField<indices>(tokenizer,
+                                            field_list[indices],
+                                            is_persistent)...};
   return cxx_record;
 }
 
@@ -446,19 +675,28 @@ auto Csv<Type, Types...>::toCxxRecord(const std::pmr::cmatch& result,
   \details No detailed description
 
   \tparam index No description.
-  \param [in] result No description.
+  \param [in] tokenizer No description.
+  \param [in] field No description.
+  \param [in] is_persistent No description.
   \return No description
+  \exception CsvParseError The field doesn't match the type of the column
   */
 template <typename Type, typename ...Types> template <std::size_t index> inline
-auto Csv<Type, Types...>::toCxxField(const std::pmr::cmatch& result) noexcept
+auto Csv<Type, Types...>::toCxxField(const CsvTokenizer& tokenizer,
+                                     const std::string_view field,
+                                     const bool is_persistent)
     -> InnerFieldType<index>
 {
   using FieldT = InnerFieldType<index>;
-  std::pmr::cmatch::const_reference match = result[index + 1];
-  const auto fieldsize = cast<std::size_t>(std::distance(match.first, match.second));
-  std::string_view field{match.first, fieldsize};
-  auto cxx_field = toCxxType<FieldT>(field);
-  return cxx_field;
+  tokenizer.validateField<FieldT>(index, field);
+  if constexpr (std::is_same_v<std::string_view, FieldT>) {
+    const std::string_view cxx_field = toCxxStringView(field, is_persistent);
+    return cxx_field;
+  }
+  else {
+    auto cxx_field = toCxxType<FieldT>(field);
+    return cxx_field;
+  }
 }
 
 } // namespace zisc
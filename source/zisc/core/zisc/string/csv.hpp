@@ -18,9 +18,10 @@
 // Standard C++ library
 #include <concepts>
 #include <cstddef>
+#include <exception>
+#include <filesystem>
 #include <istream>
 #include <memory_resource>
-#include <regex>
 #include <span>
 #include <string_view>
 #include <tuple>
@@ -28,17 +29,26 @@
 // Zisc
 #include "zisc/concepts.hpp"
 #include "zisc/non_copyable.hpp"
+#include "zisc/memory/mapped_file.hpp"
 #include "zisc/zisc_config.hpp"
 
 namespace zisc {
 
 // Forward declaration
 template <std::size_t kN, typename Type, typename ...Types> struct CsvRecordTypeImpl;
+class CsvTokenizer;
+class ThreadManager;
 
 /*!
   \brief Manipulate CSV file
 
-  No detailed description.
+  Records are split by CsvTokenizer and each field is validated against
+  the type of the column. CsvParseError is thrown with the line number
+  if a record is malformed.
+  A std::string_view column is stored as a view. It refers to the mapped file
+  loaded by appendFile() if the field has no escape sequence,
+  otherwise to a null-terminated copy in the string arena of the Csv.
+  Other string columns are stored as std::pmr::string.
 
   \tparam Type No description.
   \tparam Types No description.
@@ -71,8 +81,23 @@ class Csv : private NonCopyable<Csv<Type, Types...>>
 
 
   //! Add values
-  template <std::size_t kMaxCharsPerLine = 256>
-  void append(std::istream& csv) noexcept;
+  void append(std::istream& csv);
+
+  //! Add values of the given CSV text
+  void append(const std::string_view csv, const std::size_t line_number = 1);
+
+  //! Map the given CSV file and add values without copying string fields
+  void appendFile(const std::filesystem::path& file_path);
+
+  //! Map the given CSV file and add values in parallel
+  void appendFileParallel(const std::filesystem::path& file_path,
+                          ThreadManager& thread_manager,
+                          const std::size_t chunk_size = defaultChunkSize());
+
+  //! Add values of the given CSV text in parallel
+  void appendParallel(const std::string_view csv,
+                      ThreadManager& thread_manager,
+                      const std::size_t chunk_size = defaultChunkSize());
 
   //! Return the number of elements that can be held in allocated storage
   [[nodiscard]]
@@ -84,16 +109,12 @@ class Csv : private NonCopyable<Csv<Type, Types...>>
   //! Return the column size
   static constexpr auto columnSize() noexcept -> uint;
 
-  //! Return the pattern string for regex
-  static constexpr auto csvPattern() noexcept;
-
-  //! Return the CSV regex
-  [[nodiscard]]
-  auto csvRegex() const noexcept -> const std::regex&;
-
   //! Return the data of the csv
   auto data() const noexcept -> std::span<const RecordType>;
 
+  //! Return the default size of a chunk of the text which is parsed in parallel
+  static constexpr auto defaultChunkSize() noexcept -> std::size_t;
+
   //! Return the field value of the given row by the column index
   template <std::size_t column>
   auto get(const std::size_t row) const noexcept -> FieldType<column>;
@@ -112,6 +133,9 @@ class Csv : private NonCopyable<Csv<Type, Types...>>
   template <std::size_t index>
   using InnerFieldType = typename std::tuple_element<index, RecordType>::type;
 
+  // Forward declaration
+  struct ParseChunk;
+
 
   //! Convert a CSV bool to a C++ bool 
   template <std::same_as<bool> PType>
@@ -129,44 +153,89 @@ class Csv : private NonCopyable<Csv<Type, Types...>>
   template <String PType>
   auto toCxxType(const std::string_view json_value) noexcept -> std::pmr::string;
 
-  //! Return the pattern string for regex
-  template <typename PType, typename ...PTypes>
-  static constexpr auto getCsvPattern() noexcept;
-
-  //! Return the boolean pattern string for regex
-  template <std::same_as<bool> PType>
-  static constexpr auto getTypePattern() noexcept;
-
-  //! Return the float pattern string for regex
-  template <std::floating_point PType>
-  static constexpr auto getTypePattern() noexcept;
+  //! Allocate a null-terminated string in the string arena
+  auto allocateString(const std::size_t size) -> char*;
 
-  //! Return the integer pattern string for regex
-  template <Integer PType>
-  static constexpr auto getTypePattern() noexcept;
+  //! Add values of the given CSV text
+  void appendImpl(const std::string_view csv,
+                  const std::size_t line_number,
+                  const bool is_persistent);
 
-  //! Return the string pattern string for regex
-  template <String PType>
-  static constexpr auto getTypePattern() noexcept;
+  //! Add values of the given CSV text in parallel
+  void appendParallelImpl(const std::string_view csv,
+                          ThreadManager& thread_manager,
+                          const std::size_t chunk_size,
+                          const bool is_persistent);
 
   //! Return the underlying memory resource
   auto memoryResource() noexcept -> std::pmr::memory_resource*;
 
-  //! Parse csv line
-  auto parseCsvLine(std::string_view line) noexcept -> RecordType;
+  //! Add records which begin in [begin, limit) of the text. Return where parsing stopped
+  auto parseRange(const std::string_view csv,
+                  const std::size_t begin,
+                  const std::size_t limit,
+                  const std::size_t line_number,
+                  const bool is_persistent,
+                  std::size_t* first_record_position) -> std::size_t;
 
-  //! Convert a CSV line to C++ values
+  //! Move the records and the strings of the given csv to the end
+  void splice(Csv& other);
+
+  //! Parse the current record of the tokenizer
+  auto parseCsvRecord(const CsvTokenizer& tokenizer,
+                      std::span<const std::string_view> field_list,
+                      const bool is_persistent) -> RecordType;
+
+  //! Convert a CSV string to a view
+  auto toCxxStringView(const std::string_view csv_value, const bool is_persistent)
+      -> std::string_view;
+
+  //! Convert a CSV record to C++ values
   template <std::size_t ...indices>
-  auto toCxxRecord(const std::pmr::cmatch& result,
-                   std::index_sequence<indices...> idx) noexcept -> RecordType;
+  auto toCxxRecord(const CsvTokenizer& tokenizer,
+                   std::span<const std::string_view> field_list,
+                   const bool is_persistent,
+                   std::index_sequence<indices...> idx) -> RecordType;
 
   //! Convert a CSV value to a C++ value
   template <std::size_t index>
-  auto toCxxField(const std::pmr::cmatch& result) noexcept -> InnerFieldType<index>;
+  auto toCxxField(const CsvTokenizer& tokenizer,
+                  const std::string_view field,
+                  const bool is_persistent) -> InnerFieldType<index>;
+
+
+  static constexpr std::size_t kStringBlockSize = 64 * 1024;
 
 
   std::pmr::vector<RecordType> data_;
-  std::regex csv_pattern_;
+  std::pmr::vector<MappedFile> file_list_;
+  std::pmr::vector<std::pmr::vector<char>> string_block_list_;
+};
+
+/*!
+  \brief A chunk of CSV text which is parsed speculatively in parallel
+
+  A chunk begins just after a line feed, which may be in a quoted field.
+  The chunk is valid only if its first record begins where
+  parsing the previous valid chunk stopped.
+
+  \tparam Type No description.
+  \tparam Types No description.
+  */
+template <typename Type, typename ...Types>
+struct Csv<Type, Types...>::ParseChunk
+{
+  //! Initialize the chunk
+  ParseChunk(const std::size_t begin,
+             const std::size_t limit,
+             std::pmr::memory_resource* mem_resource) noexcept;
+
+  Csv csv_; //!< The records of the chunk
+  std::size_t begin_; //!< The speculative beginning of the chunk
+  std::size_t limit_; //!< Records which begin before the limit belong to the chunk
+  std::size_t first_record_ = 0; //!< The beginning of the first record
+  std::size_t end_ = 0; //!< The position where parsing stopped
+  std::exception_ptr exception_; //!< The exception thrown in parsing
 };
 
 } // namespace zisc
@@ -0,0 +1,98 @@
+/*!
+  \file csv_parse_error-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_CSV_PARSE_ERROR_INL_HPP
+#define ZISC_CSV_PARSE_ERROR_INL_HPP
+
+#include "csv_parse_error.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <string_view>
+#include <utility>
+// Zisc
+#include "zisc/error.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] what_arg No description.
+  \param [in] line_number No description.
+  \param [in] column No description.
+  */
+inline
+CsvParseError::CsvParseError(const std::string_view what_arg,
+                             const std::size_t line_number,
+                             const std::size_t column) :
+    SystemError(ErrorCode::kCsvInvalidFormat, what_arg),
+    line_number_{line_number},
+    column_{column}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  */
+inline
+CsvParseError::CsvParseError(CsvParseError&& other) noexcept :
+    SystemError(std::move(other)),
+    line_number_{other.line_number_},
+    column_{other.column_}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  \return No description
+  */
+inline
+auto CsvParseError::operator=(CsvParseError&& other) noexcept -> CsvParseError&
+{
+  SystemError::operator=(std::move(other));
+  line_number_ = other.line_number_;
+  column_ = other.column_;
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvParseError::column() const noexcept -> std::size_t
+{
+  return column_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvParseError::lineNumber() const noexcept -> std::size_t
+{
+  return line_number_;
+}
+
+} // namespace zisc
+
+#endif // ZISC_CSV_PARSE_ERROR_INL_HPP
@@ -0,0 +1,71 @@
+/*!
+  \file csv_parse_error.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_CSV_PARSE_ERROR_HPP
+#define ZISC_CSV_PARSE_ERROR_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <string_view>
+// Zisc
+#include "zisc/error.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief The error which is thrown when a CSV record is malformed
+
+  No detailed description.
+
+  \note No notation.
+  \attention No attention.
+  */
+class CsvParseError : public SystemError
+{
+ public:
+  //! Construct the CSV parse error
+  CsvParseError(const std::string_view what_arg,
+                const std::size_t line_number,
+                const std::size_t column);
+
+  //! Move data
+  CsvParseError(CsvParseError&& other) noexcept;
+
+  //! Finalize the CSV parse error
+  ~CsvParseError() noexcept override = default;
+
+
+  //! Move data
+  auto operator=(CsvParseError&& other) noexcept -> CsvParseError&;
+
+
+  //! Return the index of the column where the error occurred
+  [[nodiscard]]
+  auto column() const noexcept -> std::size_t;
+
+  //! Return the line number (1-based) of the malformed record
+  [[nodiscard]]
+  auto lineNumber() const noexcept -> std::size_t;
+
+ private:
+  std::size_t line_number_;
+  std::size_t column_;
+};
+
+} // namespace zisc
+
+#include "csv_parse_error-inl.hpp"
+
+#endif // ZISC_CSV_PARSE_ERROR_HPP
@@ -0,0 +1,396 @@
+/*!
+  \file csv_reader-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_CSV_READER_INL_HPP
+#define ZISC_CSV_READER_INL_HPP
+
+#include "csv_reader.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <cstddef>
+#include <concepts>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Zisc
+#include "csv_parse_error.hpp"
+#include "csv_tokenizer.hpp"
+#include "json_value_parser.hpp"
+#include "string_scan.hpp"
+#include "zisc/concepts.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in,out] csv No description.
+  \param [in,out] mem_resource No description.
+  \param [in] buffer_size No description.
+  */
+template <typename Type, typename ...Types> inline
+CsvReader<Type, Types...>::CsvReader(std::istream& csv,
+                                     std::pmr::memory_resource* mem_resource,
+                                     const std::size_t buffer_size) :
+    csv_{&csv},
+    buffer_{typename decltype(buffer_)::allocator_type{mem_resource}},
+    record_{std::allocator_arg, std::pmr::polymorphic_allocator<>{mem_resource}}
+{
+  buffer_.resize((std::max)(buffer_size, std::size_t{1}));
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::begin() -> Iterator
+{
+  const bool has_record = next();
+  return Iterator{has_record ? this : nullptr};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::bufferSize() const noexcept -> std::size_t
+{
+  return buffer_.size();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+constexpr auto CsvReader<Type, Types...>::columnSize() noexcept -> uint
+{
+  constexpr uint size = 1 + sizeof...(Types);
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+constexpr auto CsvReader<Type, Types...>::defaultBufferSize() noexcept -> std::size_t
+{
+  constexpr std::size_t size = 64 * 1024;
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::end() const noexcept -> std::default_sentinel_t
+{
+  return std::default_sentinel;
+}
+
+/*!
+  \details If the visitor returns bool, reading stops when it returns false.
+  A visitor can block to apply backpressure to the reader
+
+  \tparam Func No description.
+  \param [in] visitor No description.
+  \return No description
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> template <typename Func> inline
+auto CsvReader<Type, Types...>::forEach(Func&& visitor) -> std::size_t
+{
+  using ReturnT = std::invoke_result_t<Func, const RecordType&>;
+  std::size_t num_of_records = 0;
+  while (next()) {
+    ++num_of_records;
+    if constexpr (std::same_as<bool, ReturnT>) {
+      if (!visitor(record()))
+        break;
+    }
+    else {
+      visitor(record());
+    }
+  }
+  return num_of_records;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam index No description.
+  \return No description
+  */
+template <typename Type, typename ...Types> template <std::size_t index> inline
+auto CsvReader<Type, Types...>::get() const noexcept -> FieldType<index>
+{
+  const InnerFieldType<index>& field = std::get<index>(record());
+  using FieldT = FieldType<index>;
+  if constexpr (CharPointer<FieldT>) {
+    static_assert(String<InnerFieldType<index>>);
+    const FieldT result = field.c_str();
+    return result;
+  }
+  else {
+    const FieldT result = field;
+    return result;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::lineNumber() const noexcept -> std::size_t
+{
+  return record_line_number_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  \exception CsvParseError A record is malformed or exceeds the buffer
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::next() -> bool
+{
+  while (true) {
+    const std::string_view text{buffer_.data() + begin_, end_ - begin_};
+    CsvTokenizer tokenizer{text, line_number_};
+    bool has_record = false;
+    try {
+      has_record = tokenizer.next(field_list_);
+    }
+    catch ([[maybe_unused]] const CsvParseError& error) {
+      // The record may be cut at the end of the buffer
+      if (is_eof_ || ((begin_ == 0) && (end_ == bufferSize())))
+        throw;
+    }
+    const std::size_t position = tokenizer.position();
+    // A record is complete if it's followed by a line feed
+    const bool is_complete = has_record &&
+                             (is_eof_ || (text[position - 1] == '\n'));
+    if (is_complete) {
+      setRecord(tokenizer, std::make_index_sequence<columnSize()>());
+      record_line_number_ = tokenizer.lineNumber();
+      line_number_ = tokenizer.nextLineNumber();
+      begin_ += position;
+      return true;
+    }
+    if (!has_record && (position == text.size())) {
+      // Skip the blank lines at the end of the buffer
+      line_number_ = tokenizer.nextLineNumber();
+      begin_ = end_;
+      if (is_eof_)
+        return false;
+    }
+    if (!fill()) {
+      const std::string message = "Line " + std::to_string(line_number_) +
+          ": The record exceeds the buffer size " + std::to_string(bufferSize()) + ".";
+      throw CsvParseError{message, line_number_, 0};
+    }
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::record() const noexcept -> const RecordType&
+{
+  return record_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::fill() -> bool
+{
+  const std::size_t rest = end_ - begin_;
+  if (begin_ != 0) {
+    std::copy_n(buffer_.begin() + cast<std::ptrdiff_t>(begin_),
+                rest,
+                buffer_.begin());
+    begin_ = 0;
+    end_ = rest;
+  }
+  if (end_ == bufferSize())
+    return false;
+
+  const std::size_t size = bufferSize() - end_;
+  csv_->read(buffer_.data() + end_, cast<std::streamsize>(size));
+  end_ += cast<std::size_t>(csv_->gcount());
+  is_eof_ = !(*csv_);
+  return true;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam index No description.
+  \param [in] field No description.
+  */
+template <typename Type, typename ...Types> template <std::size_t index> inline
+void CsvReader<Type, Types...>::setField(const std::string_view field)
+{
+  using FieldT = InnerFieldType<index>;
+  FieldT& cxx_field = std::get<index>(record_);
+  if constexpr (std::is_same_v<std::string_view, FieldT>) {
+    const std::string_view value = field.substr(1, field.size() - 2);
+    if (findFirstOf<'"', '\\'>(value, 0) == value.size()) {
+      cxx_field = value;
+    }
+    else {
+      // An unquoted string is never longer than the quoted one,
+      // so it's written in place of the consumed text
+      const auto offset = cast<std::size_t>(field.data() - buffer_.data());
+      char* s = buffer_.data() + offset;
+      const std::size_t size = CsvTokenizer::getUnquotedSize(field);
+      CsvTokenizer::unquote(field, s);
+      cxx_field = std::string_view{s, size};
+    }
+  }
+  else if constexpr (String<FieldT>) {
+    // The capacity of the string is reused
+    cxx_field.resize(CsvTokenizer::getUnquotedSize(field));
+    CsvTokenizer::unquote(field, cxx_field.data());
+  }
+  else if constexpr (std::same_as<bool, FieldT>) {
+    cxx_field = JsonValueParser::toCxxBool(field);
+  }
+  else if constexpr (std::floating_point<FieldT>) {
+    cxx_field = JsonValueParser::toCxxFloat<FieldT>(field);
+  }
+  else {
+    cxx_field = JsonValueParser::toCxxInteger<FieldT>(field);
+  }
+}
+
+/*!
+  \details All fields are validated before the record is overwritten
+
+  \tparam indices No description.
+  \param [in] tokenizer No description.
+  \exception CsvParseError The record is malformed
+  */
+template <typename Type, typename ...Types>
+template <std::size_t ...indices> inline
+void CsvReader<Type, Types...>::setRecord(const CsvTokenizer& tokenizer,
+                                          [[maybe_unused]] std::index_sequence<indices...> idx)
+{
+  tokenizer.validateNumOfFields(columnSize());
+  (tokenizer.validateField<InnerFieldType<indices>>(indices, field_list_[indices]), ...);
+  (setField<indices>(field_list_[indices]), ...);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] reader No description.
+  */
+template <typename Type, typename ...Types> inline
+CsvReader<Type, Types...>::Iterator::Iterator(CsvReader* reader) noexcept :
+    reader_{reader}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::Iterator::operator*() const noexcept -> reference
+{
+  return reader_->record();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::Iterator::operator->() const noexcept -> pointer
+{
+  return std::addressof(reader_->record());
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::Iterator::operator++() -> Iterator&
+{
+  if (!reader_->next())
+    reader_ = nullptr;
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \exception CsvParseError A record is malformed
+  */
+template <typename Type, typename ...Types> inline
+void CsvReader<Type, Types...>::Iterator::operator++(int)
+{
+  ++(*this);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvReader<Type, Types...>::Iterator::operator==(std::default_sentinel_t) const noexcept
+    -> bool
+{
+  return reader_ == nullptr;
+}
+
+} // namespace zisc
+
+#endif // ZISC_CSV_READER_INL_HPP
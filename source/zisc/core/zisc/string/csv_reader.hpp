@@ -0,0 +1,183 @@
+/*!
+  \file csv_reader.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_CSV_READER_HPP
+#define ZISC_CSV_READER_HPP
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+// Zisc
+#include "csv.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+// Forward declaration
+class CsvTokenizer;
+
+/*!
+  \brief Read CSV records from a stream one by one
+
+  The stream is read into a fixed size buffer and only the current record
+  is kept, so the memory doesn't grow with the stream size.
+  Records are parsed and validated in the same way as Csv.
+  Records can be pulled by next() or by the input iterator,
+  or pushed to a visitor by forEach().
+  A std::string_view field of the record refers to the buffer,
+  so it's valid until the next record is read.
+  A record must fit in the buffer, otherwise CsvParseError is thrown.
+
+  \tparam Type No description.
+  \tparam Types No description.
+  */
+template <typename Type, typename ...Types>
+class CsvReader : private NonCopyable<CsvReader<Type, Types...>>
+{
+ public:
+  //! Represent values in a line
+  using RecordType = typename Csv<Type, Types...>::RecordType;
+  //! Represent a value in a line by the index
+  template <std::size_t index>
+  using FieldType = typename Csv<Type, Types...>::template FieldType<index>;
+
+  // Forward declaration
+  class Iterator;
+
+
+  //! Initialize the reader with the given stream
+  CsvReader(std::istream& csv,
+            std::pmr::memory_resource* mem_resource,
+            const std::size_t buffer_size = defaultBufferSize());
+
+
+  //! Read the first record and return an iterator to it
+  auto begin() -> Iterator;
+
+  //! Return the size of the buffer in bytes
+  [[nodiscard]]
+  auto bufferSize() const noexcept -> std::size_t;
+
+  //! Return the column size
+  static constexpr auto columnSize() noexcept -> uint;
+
+  //! Return the default size of the buffer
+  static constexpr auto defaultBufferSize() noexcept -> std::size_t;
+
+  //! Return the sentinel of the iterator
+  auto end() const noexcept -> std::default_sentinel_t;
+
+  //! Pass each remaining record to the visitor. Return the number of the records
+  template <typename Func>
+  auto forEach(Func&& visitor) -> std::size_t;
+
+  //! Return the field value of the current record by the column index
+  template <std::size_t index>
+  auto get() const noexcept -> FieldType<index>;
+
+  //! Return the line number (1-based) of the current record
+  [[nodiscard]]
+  auto lineNumber() const noexcept -> std::size_t;
+
+  //! Read the next record. Return false if no record remains
+  auto next() -> bool;
+
+  //! Return the current record
+  auto record() const noexcept -> const RecordType&;
+
+ private:
+  template <std::size_t index>
+  using InnerFieldType = typename std::tuple_element<index, RecordType>::type;
+
+
+  //! Move the remaining text to the front of the buffer and read the stream
+  auto fill() -> bool;
+
+  //! Convert a CSV value to the field of the current record
+  template <std::size_t index>
+  void setField(const std::string_view field);
+
+  //! Convert the current record of the tokenizer
+  template <std::size_t ...indices>
+  void setRecord(const CsvTokenizer& tokenizer, std::index_sequence<indices...> idx);
+
+
+  std::istream* csv_;
+  std::pmr::vector<char> buffer_;
+  RecordType record_;
+  std::array<std::string_view, 1 + sizeof...(Types)> field_list_;
+  std::size_t begin_ = 0;
+  std::size_t end_ = 0;
+  std::size_t line_number_ = 1;
+  std::size_t record_line_number_ = 0;
+  bool is_eof_ = false;
+  [[maybe_unused]] Padding<7> pad_{};
+};
+
+/*!
+  \brief The input iterator over the records of a CsvReader
+
+  \tparam Type No description.
+  \tparam Types No description.
+  */
+template <typename Type, typename ...Types>
+class CsvReader<Type, Types...>::Iterator
+{
+ public:
+  // Type aliases for STL
+  using value_type = RecordType;
+  using difference_type = std::ptrdiff_t;
+  using reference = const RecordType&;
+  using pointer = const RecordType*;
+  using iterator_category = std::input_iterator_tag;
+  using iterator_concept = iterator_category;
+
+
+  //! Create an iterator
+  explicit Iterator(CsvReader* reader) noexcept;
+
+
+  //! Return the current record
+  auto operator*() const noexcept -> reference;
+
+  //! Return the current record
+  auto operator->() const noexcept -> pointer;
+
+  //! Read the next record
+  auto operator++() -> Iterator&;
+
+  //! Read the next record
+  void operator++(int);
+
+  //! Check if no record remains
+  auto operator==(std::default_sentinel_t) const noexcept -> bool;
+
+ private:
+  CsvReader* reader_;
+};
+
+} // namespace zisc
+
+#include "csv_reader-inl.hpp"
+
+#endif // ZISC_CSV_READER_HPP
@@ -0,0 +1,398 @@
+/*!
+  \file csv_tokenizer-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_CSV_TOKENIZER_INL_HPP
+#define ZISC_CSV_TOKENIZER_INL_HPP
+
+#include "csv_tokenizer.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+// Zisc
+#include "csv_parse_error.hpp"
+#include "json_value_parser.hpp"
+#include "string_scan.hpp"
+#include "zisc/concepts.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] text No description.
+  \param [in] line_number No description.
+  */
+inline
+CsvTokenizer::CsvTokenizer(const std::string_view text,
+                           const std::size_t line_number) noexcept :
+    text_{text},
+    position_{0},
+    line_number_{line_number},
+    next_line_number_{line_number}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] field No description.
+  \return No description
+  */
+inline
+auto CsvTokenizer::getUnquotedSize(const std::string_view field) noexcept -> std::size_t
+{
+  const std::size_t size = unquoteImpl(field, nullptr);
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] field No description.
+  \return No description
+  */
+inline
+auto CsvTokenizer::isQuoted(const std::string_view field) noexcept -> bool
+{
+  const bool result = (2 <= field.size()) && field.starts_with('"') && field.ends_with('"');
+  return result;
+}
+
+/*!
+  \details A string column requires a quoted field
+
+  \tparam Type No description.
+  \param [in] field No description.
+  \return No description
+  */
+template <typename Type> inline
+auto CsvTokenizer::isValidValue(const std::string_view field) noexcept -> bool
+{
+  bool result = false;
+  if constexpr (String<Type>)
+    result = isQuoted(field);
+  else if constexpr (std::same_as<bool, Type>)
+    result = JsonValueParser::isBoolValue(field);
+  else if constexpr (std::floating_point<Type>)
+    result = JsonValueParser::isFloatValue(field);
+  else if constexpr (Integer<Type>)
+    result = JsonValueParser::isIntegerValue(field);
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvTokenizer::lineNumber() const noexcept -> std::size_t
+{
+  return line_number_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [out] field_list No description.
+  \return No description
+  \exception CsvParseError The record is malformed
+  */
+inline
+auto CsvTokenizer::next(std::span<std::string_view> field_list) -> bool
+{
+  if (!skipBlankLines())
+    return false;
+
+  line_number_ = next_line_number_;
+  record_position_ = position_;
+  num_of_fields_ = 0;
+  const std::size_t size = text_.size();
+  std::size_t pos = position_;
+  for (bool is_end = false; !is_end;) {
+    pos = skipWhitespaces(pos);
+    const std::size_t begin = pos;
+    std::size_t end = pos;
+    if ((pos < size) && (text_[pos] == '"')) {
+      pos = skipQuotedField(pos);
+      end = pos;
+      pos = skipWhitespaces(pos);
+      if ((pos < size) && (text_[pos] != ',') && (text_[pos] != '\n'))
+        raiseParseError(num_of_fields_, "Unexpected character after a quoted field.");
+    }
+    else {
+      pos = findFirstOf<',', '"', '\n'>(text_, pos);
+      if ((pos < size) && (text_[pos] == '"'))
+        raiseParseError(num_of_fields_, "Unexpected quote in an unquoted field.");
+      for (end = pos; (begin < end) && isWhitespace(text_[end - 1]); --end);
+    }
+
+    if (num_of_fields_ < field_list.size())
+      field_list[num_of_fields_] = text_.substr(begin, end - begin);
+    ++num_of_fields_;
+
+    is_end = (size <= pos) || (text_[pos] == '\n');
+    ++pos; // Skip the delimiter or the line feed
+  }
+  if (pos <= size)
+    ++next_line_number_;
+  position_ = (std::min)(pos, size);
+  return true;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvTokenizer::nextLineNumber() const noexcept -> std::size_t
+{
+  return next_line_number_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvTokenizer::numOfFields() const noexcept -> std::size_t
+{
+  return num_of_fields_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvTokenizer::position() const noexcept -> std::size_t
+{
+  return position_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvTokenizer::recordPosition() const noexcept -> std::size_t
+{
+  return record_position_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] column No description.
+  \param [in] message No description.
+  \exception CsvParseError Always thrown
+  */
+inline
+void CsvTokenizer::raiseParseError(const std::size_t column,
+                                   const std::string_view message) const
+{
+  std::string what = "Line " + std::to_string(lineNumber()) +
+                     ", column " + std::to_string(column) + ": ";
+  what.append(message);
+  throw CsvParseError{what, lineNumber(), column};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvTokenizer::text() const noexcept -> std::string_view
+{
+  return text_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] field No description.
+  \param [out] value No description.
+  */
+inline
+void CsvTokenizer::unquote(const std::string_view field, char* value) noexcept
+{
+  unquoteImpl(field, value);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] column No description.
+  \param [in] field No description.
+  \exception CsvParseError The field doesn't match the type of the column
+  */
+template <typename Type> inline
+void CsvTokenizer::validateField(const std::size_t column, const std::string_view field) const
+{
+  if (!isValidValue<Type>(field)) {
+    std::string message = "Invalid value \"";
+    message.append(field);
+    message.append("\" for the column type.");
+    raiseParseError(column, message);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] num_of_columns No description.
+  \exception CsvParseError The record has a wrong number of fields
+  */
+inline
+void CsvTokenizer::validateNumOfFields(const std::size_t num_of_columns) const
+{
+  const std::size_t num_of_fields = numOfFields();
+  if (num_of_fields != num_of_columns) {
+    const std::string message = "The record has " + std::to_string(num_of_fields) +
+                                " fields, but " + std::to_string(num_of_columns) +
+                                " are expected.";
+    raiseParseError((std::min)(num_of_fields, num_of_columns), message);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] c No description.
+  \return No description
+  */
+inline
+constexpr auto CsvTokenizer::isWhitespace(const char c) noexcept -> bool
+{
+  const bool result = (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') || (c == '\f');
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto CsvTokenizer::skipBlankLines() noexcept -> bool
+{
+  const std::size_t size = text_.size();
+  for (std::size_t pos = skipWhitespaces(position_);
+       (pos < size) && (text_[pos] == '\n');
+       pos = skipWhitespaces(position_)) {
+    position_ = pos + 1;
+    ++next_line_number_;
+  }
+  const bool has_record = skipWhitespaces(position_) < size;
+  if (!has_record)
+    position_ = size;
+  return has_record;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] pos No description.
+  \return No description
+  \exception CsvParseError The quoted field is malformed
+  */
+inline
+auto CsvTokenizer::skipQuotedField(std::size_t pos) -> std::size_t
+{
+  const std::size_t size = text_.size();
+  for (++pos; true;) {
+    pos = findFirstOf<'"', '\\', '\n'>(text_, pos);
+    if (size <= pos)
+      raiseParseError(num_of_fields_, "Unterminated quoted field.");
+    const char c = text_[pos];
+    if (c == '\n') {
+      ++next_line_number_;
+      ++pos;
+    }
+    else if (c == '\\') {
+      if ((size <= (pos + 1)) || (JsonValueParser::getEscapedCharacter(text_[pos + 1]) == '\0'))
+        raiseParseError(num_of_fields_, "Invalid escape sequence in a quoted field.");
+      pos += 2;
+    }
+    else if (((pos + 1) < size) && (text_[pos + 1] == '"')) {
+      pos += 2; // Escaped quote
+    }
+    else {
+      break;
+    }
+  }
+  return pos + 1;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] pos No description.
+  \return No description
+  */
+inline
+auto CsvTokenizer::skipWhitespaces(std::size_t pos) const noexcept -> std::size_t
+{
+  const std::size_t size = text_.size();
+  for (; (pos < size) && isWhitespace(text_[pos]); ++pos);
+  return pos;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] field No description.
+  \param [out] value No description.
+  \return No description
+  */
+inline
+auto CsvTokenizer::unquoteImpl(std::string_view field, char* value) noexcept
+    -> std::size_t
+{
+  // Remove prefix and suffix '"'
+  field.remove_prefix(1);
+  field.remove_suffix(1);
+
+  std::size_t size = 0;
+  for (auto i = field.begin(); i != field.end(); ++i) {
+    char c = *i;
+    if (c == '\\') {
+      ++i;
+      c = JsonValueParser::getEscapedCharacter(*i);
+    }
+    else if (c == '"') {
+      ++i; // Skip the doubled quote
+    }
+    if (value != nullptr)
+      value[size] = c;
+    ++size;
+  }
+  return size;
+}
+
+} // namespace zisc
+
+#endif // ZISC_CSV_TOKENIZER_INL_HPP
@@ -0,0 +1,129 @@
+/*!
+  \file csv_tokenizer.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_CSV_TOKENIZER_HPP
+#define ZISC_CSV_TOKENIZER_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <span>
+#include <string_view>
+// Zisc
+#include "zisc/concepts.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief Split CSV text into records and fields without regex
+
+  Delimiters, quotes and line feeds are searched with SSE2 or AVX2
+  if the target supports them, otherwise with a scalar loop.
+  A quoted field can contain delimiters and line feeds.
+  A quote in a quoted field is escaped either by doubling it ("")
+  or by a JSON escape sequence (\").
+  Leading and trailing whitespaces of a field are removed.
+
+  \note No notation.
+  \attention No attention.
+  */
+class CsvTokenizer
+{
+ public:
+  //! Initialize the tokenizer with the given CSV text
+  explicit CsvTokenizer(const std::string_view text,
+                        const std::size_t line_number = 1) noexcept;
+
+
+  //! Return the required size for unquoting the given quoted field
+  static auto getUnquotedSize(const std::string_view field) noexcept -> std::size_t;
+
+  //! Check if the given field is quoted
+  static auto isQuoted(const std::string_view field) noexcept -> bool;
+
+  //! Check if the given field is a valid value of the column type
+  template <typename Type>
+  static auto isValidValue(const std::string_view field) noexcept -> bool;
+
+  //! Return the line number (1-based) where the current record begins
+  [[nodiscard]]
+  auto lineNumber() const noexcept -> std::size_t;
+
+  //! Split the next record into fields. Return false if no record remains
+  auto next(std::span<std::string_view> field_list) -> bool;
+
+  //! Return the line number (1-based) where the next record begins
+  [[nodiscard]]
+  auto nextLineNumber() const noexcept -> std::size_t;
+
+  //! Return the number of fields of the current record
+  [[nodiscard]]
+  auto numOfFields() const noexcept -> std::size_t;
+
+  //! Return the position where the next record begins
+  [[nodiscard]]
+  auto position() const noexcept -> std::size_t;
+
+  //! Return the position where the current record begins
+  [[nodiscard]]
+  auto recordPosition() const noexcept -> std::size_t;
+
+  //! Throw a parse error of the current record
+  [[noreturn]] void raiseParseError(const std::size_t column,
+                                    const std::string_view message) const;
+
+  //! Return the text
+  [[nodiscard]]
+  auto text() const noexcept -> std::string_view;
+
+  //! Throw a parse error if the given field isn't a valid value of the column type
+  template <typename Type>
+  void validateField(const std::size_t column, const std::string_view field) const;
+
+  //! Throw a parse error if the current record doesn't have the given number of fields
+  void validateNumOfFields(const std::size_t num_of_columns) const;
+
+  //! Unquote the given quoted field
+  static void unquote(const std::string_view field, char* value) noexcept;
+
+ private:
+  //! Check if the given character is a whitespace except line feed
+  static constexpr auto isWhitespace(const char c) noexcept -> bool;
+
+  //! Skip blank lines. Return false if no record remains
+  auto skipBlankLines() noexcept -> bool;
+
+  //! Skip a quoted field. Return the position after the closing quote
+  auto skipQuotedField(std::size_t pos) -> std::size_t;
+
+  //! Skip whitespaces
+  auto skipWhitespaces(std::size_t pos) const noexcept -> std::size_t;
+
+  //! Unquote the given quoted field
+  static auto unquoteImpl(std::string_view field, char* value) noexcept -> std::size_t;
+
+
+  std::string_view text_;
+  std::size_t position_;
+  std::size_t record_position_ = 0;
+  std::size_t line_number_;
+  std::size_t next_line_number_;
+  std::size_t num_of_fields_ = 0;
+};
+
+} // namespace zisc
+
+#include "csv_tokenizer-inl.hpp"
+
+#endif // ZISC_CSV_TOKENIZER_HPP
@@ -0,0 +1,173 @@
+/*!
+  \file csv_writer-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_CSV_WRITER_INL_HPP
+#define ZISC_CSV_WRITER_INL_HPP
+
+#include "csv_writer.hpp"
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+// Zisc
+#include "string_scan.hpp"
+#include "write_buffer.hpp"
+#include "zisc/concepts.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in,out] output No description.
+  */
+template <typename Type, typename ...Types> inline
+CsvWriter<Type, Types...>::CsvWriter(WriteBuffer& output) noexcept :
+    output_{&output}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+constexpr auto CsvWriter<Type, Types...>::columnSize() noexcept -> uint
+{
+  constexpr uint size = 1 + sizeof...(Types);
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvWriter<Type, Types...>::output() const noexcept -> WriteBuffer&
+{
+  return *output_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, typename ...Types> inline
+auto CsvWriter<Type, Types...>::rowSize() const noexcept -> std::size_t
+{
+  return row_size_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] record No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+template <typename Type, typename ...Types> inline
+void CsvWriter<Type, Types...>::write(const RecordType& record)
+{
+  std::apply([this](const auto& ...values)
+  {
+    writeRecord(values...);
+  }, record);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] value No description.
+  \param [in] values No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+template <typename Type, typename ...Types> inline
+void CsvWriter<Type, Types...>::write(const Type& value, const Types&... values)
+{
+  writeRecord(value, values...);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam FieldT No description.
+  \param [in] value No description.
+  */
+template <typename Type, typename ...Types> template <typename FieldT> inline
+void CsvWriter<Type, Types...>::writeField(const FieldT& value)
+{
+  if constexpr (String<FieldT>)
+    writeString(std::string_view{value});
+  else if constexpr (std::same_as<bool, FieldT>)
+    output_->append(value ? std::string_view{"true"} : std::string_view{"false"});
+  else if constexpr (std::floating_point<FieldT>)
+    output_->appendFloat(value);
+  else
+    output_->appendInteger(value);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam FieldTypes No description.
+  \param [in] values No description.
+  */
+template <typename Type, typename ...Types> template <typename ...FieldTypes> inline
+void CsvWriter<Type, Types...>::writeRecord(const FieldTypes&... values)
+{
+  static_assert(sizeof...(FieldTypes) == columnSize());
+  bool is_first = true;
+  auto write_field = [this, &is_first](const auto& value)
+  {
+    if (!is_first)
+      output_->append(',');
+    is_first = false;
+    writeField(value);
+  };
+  (write_field(values), ...);
+  output_->append('\n');
+  ++row_size_;
+}
+
+/*!
+  \details The runs without escapes are copied at once
+
+  \param [in] value No description.
+  */
+template <typename Type, typename ...Types> inline
+void CsvWriter<Type, Types...>::writeString(const std::string_view value)
+{
+  output_->append('"');
+  std::size_t begin = 0;
+  for (std::size_t pos = findFirstOf<'"', '\\'>(value, 0);
+       pos < value.size();
+       pos = findFirstOf<'"', '\\'>(value, begin)) {
+    output_->append(value.substr(begin, pos - begin));
+    // '"' is doubled and '\' is escaped
+    output_->append((value[pos] == '"') ? std::string_view{"\"\""} : std::string_view{"\\\\"});
+    begin = pos + 1;
+  }
+  output_->append(value.substr(begin));
+  output_->append('"');
+}
+
+} // namespace zisc
+
+#endif // ZISC_CSV_WRITER_INL_HPP
@@ -0,0 +1,97 @@
+/*!
+  \file csv_writer.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_CSV_WRITER_HPP
+#define ZISC_CSV_WRITER_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <utility>
+// Zisc
+#include "csv.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+// Forward declaration
+class WriteBuffer;
+
+/*!
+  \brief Write CSV records into a WriteBuffer
+
+  Records are written in the format which Csv and CsvReader read.
+  Strings are quoted, and '"' and '\\' in them are escaped.
+  Numbers are formatted without the locale and floats are written
+  in the shortest form which round-trips.
+
+  \tparam Type No description.
+  \tparam Types No description.
+  */
+template <typename Type, typename ...Types>
+class CsvWriter : private NonCopyable<CsvWriter<Type, Types...>>
+{
+ public:
+  //! Represent values in a line
+  using RecordType = typename Csv<Type, Types...>::RecordType;
+  //! Represent a value in a line by the index
+  template <std::size_t index>
+  using FieldType = typename Csv<Type, Types...>::template FieldType<index>;
+
+
+  //! Initialize the writer with the given output
+  explicit CsvWriter(WriteBuffer& output) noexcept;
+
+
+  //! Return the column size
+  static constexpr auto columnSize() noexcept -> uint;
+
+  //! Return the output
+  [[nodiscard]]
+  auto output() const noexcept -> WriteBuffer&;
+
+  //! Return the number of the written records
+  [[nodiscard]]
+  auto rowSize() const noexcept -> std::size_t;
+
+  //! Write a record
+  void write(const RecordType& record);
+
+  //! Write a record of the given values
+  void write(const Type& value, const Types&... values);
+
+ private:
+  //! Write a field
+  template <typename FieldT>
+  void writeField(const FieldT& value);
+
+  //! Write the given fields as a record
+  template <typename ...FieldTypes>
+  void writeRecord(const FieldTypes&... values);
+
+  //! Write a quoted string
+  void writeString(const std::string_view value);
+
+
+  WriteBuffer* output_;
+  std::size_t row_size_ = 0;
+};
+
+} // namespace zisc
+
+#include "csv_writer-inl.hpp"
+
+#endif // ZISC_CSV_WRITER_HPP
@@ -0,0 +1,715 @@
+/*!
+  \file json_document-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_JSON_DOCUMENT_INL_HPP
+#define ZISC_JSON_DOCUMENT_INL_HPP
+
+#include "json_document.hpp"
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+// Zisc
+#include "json_parse_error.hpp"
+#include "json_value_parser.hpp"
+#include "zisc/concepts.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/memory/mapped_file.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in,out] mem_resource No description.
+  */
+inline
+JsonDocument::JsonDocument(std::pmr::memory_resource* mem_resource) noexcept :
+    index_list_{typename decltype(index_list_)::allocator_type{mem_resource}},
+    tape_{typename decltype(tape_)::allocator_type{mem_resource}},
+    element_list_{typename decltype(element_list_)::allocator_type{mem_resource}},
+    string_buffer_{typename decltype(string_buffer_)::allocator_type{mem_resource}}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  */
+inline
+JsonDocument::JsonDocument(JsonDocument&& other) noexcept :
+    file_{std::move(other.file_)},
+    text_{other.text_},
+    index_list_{std::move(other.index_list_)},
+    tape_{std::move(other.tape_)},
+    element_list_{std::move(other.element_list_)},
+    string_buffer_{std::move(other.string_buffer_)}
+{
+  other.text_ = std::string_view{};
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  \return No description
+  */
+inline
+auto JsonDocument::operator=(JsonDocument&& other) noexcept -> JsonDocument&
+{
+  file_ = std::move(other.file_);
+  text_ = other.text_;
+  index_list_ = std::move(other.index_list_);
+  tape_ = std::move(other.tape_);
+  element_list_ = std::move(other.element_list_);
+  string_buffer_ = std::move(other.string_buffer_);
+  other.text_ = std::string_view{};
+  return *this;
+}
+
+/*!
+  \details The allocated storage is kept for the next document
+  */
+inline
+void JsonDocument::clear() noexcept
+{
+  file_.close();
+  text_ = std::string_view{};
+  index_list_.clear();
+  tape_.clear();
+  element_list_.clear();
+  string_buffer_.clear();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::isEmpty() const noexcept -> bool
+{
+  return tape_.empty();
+}
+
+/*!
+  \details Positions in the text and the tape are held in 32 bits
+
+  \return No description
+  */
+inline
+constexpr auto JsonDocument::maxTextSize() noexcept -> std::size_t
+{
+  constexpr std::size_t size = (std::size_t{1} << 31) - 1;
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] json No description.
+  \exception JsonParseError The document is malformed
+  */
+inline
+void JsonDocument::parse(const std::string_view json)
+{
+  file_.close();
+  parseImpl(json);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] file_path No description.
+  \exception std::system_error The file can't be mapped
+  \exception JsonParseError The document is malformed
+  */
+inline
+void JsonDocument::parseFile(const std::filesystem::path& file_path)
+{
+  file_.open(file_path);
+  parseImpl(file_.view());
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::root() const noexcept -> Value
+{
+  ZISC_ASSERT(!isEmpty(), "The document is empty.");
+  return Value{this, 0};
+}
+
+/*!
+  \details Each value is encoded into one or two 64-bit words,
+  an 8-bit tag and a 56-bit payload followed by an optional word.
+  '{' and '[' hold the number of the members (saturated in 24 bits) and
+  the tape index past the matching '}' or ']', which hold the index of the opening.
+  '[' is followed by the exact number of the elements and
+  the offset of the tape indices of the elements in the element table.
+  '"' holds the text position followed by the raw length and
+  the offset (+1) of the unescaped string in the buffer, or 0 if it has no escape.
+  'l' (integer) and 'd' (float) hold the text position followed by the length.
+  't', 'f' and 'n' hold the text position.
+  The last word is a null which represents a missing value
+
+  \return No description
+  */
+inline
+auto JsonDocument::tape() const noexcept -> std::span<const uint64b>
+{
+  return {tape_};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::text() const noexcept -> std::string_view
+{
+  return text_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] word No description.
+  \return No description
+  */
+inline
+constexpr auto JsonDocument::getTag(const uint64b word) noexcept -> char
+{
+  const auto tag = cast<char>(word >> 56);
+  return tag;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] word No description.
+  \return No description
+  */
+inline
+constexpr auto JsonDocument::getPayload(const uint64b word) noexcept -> uint64b
+{
+  const uint64b payload = word & kPayloadMask;
+  return payload;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] tag No description.
+  \param [in] payload No description.
+  \return No description
+  */
+inline
+constexpr auto JsonDocument::makeWord(const char tag, const uint64b payload) noexcept
+    -> uint64b
+{
+  const uint64b word = (cast<uint64b>(cast<uint8b>(tag)) << 56) | (payload & kPayloadMask);
+  return word;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+inline
+auto JsonDocument::nextIndex(const std::size_t index) const noexcept -> std::size_t
+{
+  const uint64b word = tape_[index];
+  std::size_t next = index + 1;
+  switch (getTag(word)) {
+   case '{':
+   case '[':
+    next = cast<std::size_t>(getPayload(word) & 0xffff'ffffu);
+    break;
+   case '"':
+   case 'l':
+   case 'd':
+    next = index + 2;
+    break;
+   default:
+    break;
+  }
+  return next;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::nullIndex() const noexcept -> std::size_t
+{
+  return tape_.size() - 1;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] document No description.
+  \param [in] index No description.
+  */
+inline
+JsonDocument::Value::Value(const JsonDocument* document, const std::size_t index) noexcept :
+    document_{document},
+    index_{index}
+{
+}
+
+/*!
+  \details The element is looked up in the element table in constant time
+
+  \param [in] index No description.
+  \return No description
+  */
+inline
+auto JsonDocument::Value::operator[](const std::size_t index) const noexcept -> Value
+{
+  ZISC_ASSERT(isArray(), "The value isn't an array.");
+  const uint64b info = document_->tape_[index_ + 1];
+  const auto n = cast<std::size_t>(info >> 32);
+  const auto offset = cast<std::size_t>(info & 0xffff'ffffu);
+  const std::size_t i = (index < n) ? document_->element_list_[offset + index]
+                                    : document_->nullIndex();
+  return Value{document_, i};
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] key No description.
+  \return No description
+  */
+inline
+auto JsonDocument::Value::operator[](const std::string_view key) const noexcept -> Value
+{
+  const std::optional<Value> value = find(key);
+  ZISC_ASSERT(value.has_value(), "The key '", key, "' isn't found.");
+  return *value;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::begin() const noexcept -> Iterator
+{
+  ZISC_ASSERT(isArray() || isObject(), "The value isn't an array or an object.");
+  // The elements of an array follow the size and the offset
+  const std::size_t index = isArray() ? index_ + 2 : index_ + 1;
+  return Iterator{document_, index, isObject()};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::end() const noexcept -> Iterator
+{
+  ZISC_ASSERT(isArray() || isObject(), "The value isn't an array or an object.");
+  const std::size_t index = document_->nextIndex(index_) - 1;
+  return Iterator{document_, index, isObject()};
+}
+
+/*!
+  \details The members are compared in order and the first match is returned
+
+  \param [in] key No description.
+  \return No description
+  */
+inline
+auto JsonDocument::Value::find(const std::string_view key) const noexcept
+    -> std::optional<Value>
+{
+  ZISC_ASSERT(isObject(), "The value isn't an object.");
+  const Iterator last = end();
+  for (Iterator i = begin(); i != last; ++i) {
+    if (i.key() == key)
+      return *i;
+  }
+  return {};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::isArray() const noexcept -> bool
+{
+  return tag() == '[';
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::isBool() const noexcept -> bool
+{
+  const char t = tag();
+  return (t == 't') || (t == 'f');
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::isFloat() const noexcept -> bool
+{
+  return tag() == 'd';
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::isInteger() const noexcept -> bool
+{
+  return tag() == 'l';
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::isNull() const noexcept -> bool
+{
+  return tag() == 'n';
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::isObject() const noexcept -> bool
+{
+  return tag() == '{';
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::isString() const noexcept -> bool
+{
+  return tag() == '"';
+}
+
+/*!
+  \details The literals aren't read from the text,
+  since the null of a missing value has no text
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::rawText() const noexcept -> std::string_view
+{
+  ZISC_ASSERT(!isArray() && !isObject(), "The value isn't a scalar.");
+  std::string_view raw{};
+  switch (tag()) {
+   case '"':
+   case 'l':
+   case 'd': {
+    const auto position = cast<std::size_t>(getPayload(document_->tape_[index_]));
+    const auto size = cast<std::size_t>(document_->tape_[index_ + 1] & 0xffff'ffffu);
+    raw = document_->text_.substr(position, size);
+    break;
+   }
+   case 't':
+    raw = "true";
+    break;
+   case 'f':
+    raw = "false";
+    break;
+   default:
+    raw = "null";
+    break;
+  }
+  return raw;
+}
+
+/*!
+  \details The size of an object is counted by walking the members
+  only if it exceeds 24 bits
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::size() const noexcept -> std::size_t
+{
+  ZISC_ASSERT(isArray() || isObject(), "The value isn't an array or an object.");
+  if (isArray())
+    return cast<std::size_t>(document_->tape_[index_ + 1] >> 32);
+  const uint64b word = document_->tape_[index_];
+  auto n = cast<std::size_t>(getPayload(word) >> 32);
+  if (n == kMaxCount) {
+    n = 0;
+    const Iterator last = end();
+    for (Iterator i = begin(); i != last; ++i)
+      ++n;
+  }
+  return n;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::tapeIndex() const noexcept -> std::size_t
+{
+  return index_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::toBool() const noexcept -> bool
+{
+  ZISC_ASSERT(isBool(), "The value isn't a boolean.");
+  return tag() == 't';
+}
+
+/*!
+  \details Both integers and floats can be converted
+
+  \tparam Float No description.
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto JsonDocument::Value::toFloat() const noexcept -> Float
+{
+  ZISC_ASSERT(isInteger() || isFloat(), "The value isn't a number.");
+  Float value = cast<Float>(0);
+  [[maybe_unused]] const bool result = JsonValueParser::toCxxFloat(rawText(), &value);
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int No description.
+  \return No description
+  \exception JsonParseError The value is out of range of the Int
+  */
+template <Integer Int> inline
+auto JsonDocument::Value::toInteger() const -> Int
+{
+  ZISC_ASSERT(isInteger(), "The value isn't an integer.");
+  const std::string_view json_value = rawText();
+  Int value = cast<Int>(0);
+  if (!JsonValueParser::toCxxInteger(json_value, &value)) {
+    const auto position = cast<std::size_t>(getPayload(document_->tape_[index_]));
+    raiseParseError(position, "The integer '" + std::string{json_value} + "' is out of range.");
+  }
+  return value;
+}
+
+/*!
+  \details Strings without escapes refer to the text directly
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::toString() const noexcept -> std::string_view
+{
+  ZISC_ASSERT(isString(), "The value isn't a string.");
+  const uint64b info = document_->tape_[index_ + 1];
+  const auto offset = cast<std::size_t>(info >> 32);
+  std::string_view s{};
+  if (offset == 0) {
+    const std::string_view raw = rawText();
+    s = raw.substr(1, raw.size() - 2);
+  }
+  else {
+    const char* data = document_->string_buffer_.data() + (offset - 1);
+    uint32b size = 0;
+    std::memcpy(&size, data, sizeof(size));
+    s = std::string_view{data + sizeof(size), size};
+  }
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::type() const noexcept -> JsonType
+{
+  JsonType t = JsonType::kNull;
+  switch (tag()) {
+   case 't':
+   case 'f':
+    t = JsonType::kBool;
+    break;
+   case 'l':
+    t = JsonType::kInteger;
+    break;
+   case 'd':
+    t = JsonType::kFloat;
+    break;
+   case '"':
+    t = JsonType::kString;
+    break;
+   case '[':
+    t = JsonType::kArray;
+    break;
+   case '{':
+    t = JsonType::kObject;
+    break;
+   default:
+    break;
+  }
+  return t;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Value::tag() const noexcept -> char
+{
+  return getTag(document_->tape_[index_]);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] document No description.
+  \param [in] index No description.
+  \param [in] is_member No description.
+  */
+inline
+JsonDocument::Iterator::Iterator(const JsonDocument* document,
+                                 const std::size_t index,
+                                 const bool is_member) noexcept :
+    document_{document},
+    index_{index},
+    is_member_{is_member}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Iterator::operator*() const noexcept -> reference
+{
+  // The value of a member follows the key
+  const std::size_t index = is_member_ ? index_ + 2 : index_;
+  return Value{document_, index};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Iterator::operator++() noexcept -> Iterator&
+{
+  const std::size_t index = is_member_ ? index_ + 2 : index_;
+  index_ = document_->nextIndex(index);
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Iterator::operator++(int) noexcept -> Iterator
+{
+  Iterator i = *this;
+  ++(*this);
+  return i;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  \return No description
+  */
+inline
+auto JsonDocument::Iterator::operator==(const Iterator& other) const noexcept -> bool
+{
+  return (document_ == other.document_) && (index_ == other.index_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonDocument::Iterator::key() const noexcept -> std::string_view
+{
+  ZISC_ASSERT(is_member_, "The iterator doesn't point a member.");
+  return Value{document_, index_}.toString();
+}
+
+} // namespace zisc
+
+#endif // ZISC_JSON_DOCUMENT_INL_HPP
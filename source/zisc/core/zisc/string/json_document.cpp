@@ -0,0 +1,458 @@
+/*!
+  \file json_document.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#include "json_document.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+// Zisc
+#include "json_parse_error.hpp"
+#include "json_value_parser.hpp"
+#include "string_scan.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace {
+
+/*!
+  \brief The character masks of a 64 byte block
+
+  No detailed description.
+  */
+struct BlockMask
+{
+  zisc::uint64b quote_ = 0; //!< '"'
+  zisc::uint64b backslash_ = 0; //!< '\\'
+  zisc::uint64b operator_ = 0; //!< '{', '}', '[', ']', ':' and ','
+  zisc::uint64b whitespace_ = 0; //!< ' ', '\t', '\n' and '\r'
+  zisc::uint64b control_ = 0; //!< Control characters
+};
+
+/*!
+  \details Control characters are the ones which JsonValueParser rejects in strings
+
+  \param [in] block No description.
+  \return No description
+  */
+zisc::uint64b getControlMask(const char* block) noexcept
+{
+  using zisc::cast;
+  using zisc::reinterp;
+  using zisc::uint64b;
+  uint64b mask = 0;
+#if defined(__AVX2__)
+  constexpr std::size_t n = sizeof(__m256i);
+  for (std::size_t i = 0; i < 64; i += n) {
+    const __m256i v = _mm256_loadu_si256(reinterp<const __m256i*>(block + i));
+    const __m256i limit = _mm256_set1_epi8(0x1f);
+    const __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(v, limit), limit),
+                                      _mm256_cmpeq_epi8(v, _mm256_set1_epi8(0x7f)));
+    mask |= cast<uint64b>(cast<zisc::uint32b>(_mm256_movemask_epi8(m))) << i;
+  }
+#elif defined(__SSE2__)
+  constexpr std::size_t n = sizeof(__m128i);
+  for (std::size_t i = 0; i < 64; i += n) {
+    const __m128i v = _mm_loadu_si128(reinterp<const __m128i*>(block + i));
+    const __m128i limit = _mm_set1_epi8(0x1f);
+    const __m128i m = _mm_or_si128(_mm_cmpeq_epi8(_mm_max_epu8(v, limit), limit),
+                                   _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7f)));
+    mask |= cast<uint64b>(cast<zisc::uint32b>(_mm_movemask_epi8(m))) << i;
+  }
+#else
+  for (std::size_t i = 0; i < 64; ++i) {
+    const auto c = cast<unsigned char>(block[i]);
+    if ((c < 0x20) || (c == 0x7f))
+      mask |= uint64b{1} << i;
+  }
+#endif
+  return mask;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] block No description.
+  \return No description
+  */
+BlockMask getBlockMask(const char* block) noexcept
+{
+  BlockMask mask;
+  mask.quote_ = zisc::getCharMask<'"'>(block);
+  mask.backslash_ = zisc::getCharMask<'\\'>(block);
+  mask.operator_ = zisc::getCharMask<'{', '}', '[', ']', ':', ','>(block);
+  mask.whitespace_ = zisc::getCharMask<' ', '\t', '\n', '\r'>(block);
+  mask.control_ = getControlMask(block);
+  return mask;
+}
+
+/*!
+  \details Each bit becomes the xor of itself and all the lower bits
+
+  \param [in] x No description.
+  \return No description
+  */
+constexpr zisc::uint64b prefixXor(zisc::uint64b x) noexcept
+{
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] c No description.
+  \return No description
+  */
+constexpr bool isWhitespace(const char c) noexcept
+{
+  return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+} // namespace
+
+namespace zisc {
+
+/*!
+  \details The characters escaped by odd runs of backslashes are found with
+  a subtraction across the block, and the insides of strings are found with
+  the prefix xor of the unescaped quotes.
+  A scalar begins at a non whitespace character that isn't
+  a part of a string and follows a whitespace or an operator.
+  The carries between the blocks are kept in three masks
+
+  \param [in] json No description.
+  \exception JsonParseError A string isn't terminated or has a control character
+  */
+void JsonDocument::indexStructurals(const std::string_view json)
+{
+  constexpr std::size_t block_size = 64;
+  constexpr uint64b odd_bits = 0xaaaa'aaaa'aaaa'aaaaull;
+  index_list_.clear();
+
+  uint64b prev_escaped = 0;
+  uint64b prev_in_string = 0;
+  uint64b prev_scalar = 0;
+  std::array<char, block_size> tail{};
+  for (std::size_t pos = 0; pos < json.size(); pos += block_size) {
+    const std::size_t rest = json.size() - pos;
+    const char* block = json.data() + pos;
+    if (rest < block_size) {
+      // The last block is padded with spaces
+      tail.fill(' ');
+      std::memcpy(tail.data(), block, rest);
+      block = tail.data();
+    }
+    const BlockMask mask = getBlockMask(block);
+
+    // Escaped characters
+    const uint64b backslash = mask.backslash_ & ~prev_escaped;
+    const uint64b maybe_escaped = (backslash << 1) | odd_bits;
+    const uint64b escape_and_terminal = (maybe_escaped - backslash) ^ odd_bits;
+    const uint64b escaped = escape_and_terminal ^ (backslash | prev_escaped);
+    prev_escaped = (escape_and_terminal & backslash) >> 63;
+
+    // Strings. A string mask contains the opening quote but not the closing one
+    const uint64b quote = mask.quote_ & ~escaped;
+    const uint64b in_string = prefixXor(quote) ^ prev_in_string;
+    prev_in_string = cast<uint64b>(cast<int64b>(in_string) >> 63);
+    const uint64b string_tail = in_string ^ quote;
+    if ((mask.control_ & in_string) != 0) {
+      const auto p = cast<std::size_t>(std::countr_zero(mask.control_ & in_string));
+      raiseParseError(pos + p, "A string has a control character.");
+    }
+
+    // Scalars
+    const uint64b scalar = ~(mask.operator_ | mask.whitespace_);
+    const uint64b nonquote_scalar = scalar & ~quote;
+    const uint64b follows_nonquote_scalar = (nonquote_scalar << 1) | prev_scalar;
+    prev_scalar = nonquote_scalar >> 63;
+    const uint64b scalar_start = scalar & ~follows_nonquote_scalar;
+
+    uint64b structurals = (mask.operator_ | scalar_start) & ~string_tail;
+    if (rest < block_size)
+      structurals &= (uint64b{1} << rest) - 1;
+
+    // Flatten the bits into the positions
+    const std::size_t n = index_list_.size();
+    index_list_.resize(n + cast<std::size_t>(std::popcount(structurals)));
+    uint32b* out = index_list_.data() + n;
+    for (; structurals != 0; structurals &= structurals - 1)
+      *out++ = cast<uint32b>(pos + cast<std::size_t>(std::countr_zero(structurals)));
+  }
+  if (prev_in_string != 0)
+    raiseParseError(json.size(), "A string isn't terminated.");
+}
+
+/*!
+  \details The grammar is checked with a state machine and
+  a stack of the open objects and arrays
+
+  \param [in] json No description.
+  \exception JsonParseError The document is malformed
+  */
+void JsonDocument::buildTape(const std::string_view json)
+{
+  enum class State
+  {
+    kValue,
+    kFirstValue,
+    kFirstKey,
+    kKey,
+    kColon,
+    kNext
+  };
+
+  //! An open object or array
+  struct Scope
+  {
+    std::size_t index_ = 0; //!< The tape index of the opening
+    std::size_t count_ = 0; //!< The number of the elements or members
+    std::size_t first_element_ = 0; //!< The first element in the element stack
+  };
+
+  tape_.clear();
+  tape_.reserve(index_list_.size() + 2);
+  element_list_.clear();
+  std::pmr::memory_resource* mem_resource = tape_.get_allocator().resource();
+  std::pmr::vector<Scope> scope_list{mem_resource};
+  // The elements of the open arrays. The elements of an array are moved to
+  // the element table when it's closed, so they are contiguous in the table
+  std::pmr::vector<uint32b> element_stack{mem_resource};
+  auto close = [this, &scope_list, &element_stack](const char closer)
+  {
+    const Scope scope = scope_list.back();
+    scope_list.pop_back();
+    const char opener = (closer == '}') ? '{' : '[';
+    const uint64b count = (std::min)(cast<uint64b>(scope.count_), kMaxCount);
+    tape_[scope.index_] = makeWord(opener, (count << 32) | cast<uint64b>(tape_.size() + 1));
+    tape_.push_back(makeWord(closer, scope.index_));
+    if (closer == ']') {
+      const auto first = element_stack.begin() + cast<std::ptrdiff_t>(scope.first_element_);
+      const auto offset = cast<uint64b>(element_list_.size());
+      element_list_.insert(element_list_.end(), first, element_stack.end());
+      element_stack.erase(first, element_stack.end());
+      tape_[scope.index_ + 1] = (cast<uint64b>(scope.count_) << 32) | offset;
+    }
+  };
+  auto is_object = [this, &scope_list]() noexcept
+  {
+    return getTag(tape_[scope_list.back().index_]) == '{';
+  };
+
+  State state = State::kValue;
+  for (std::size_t i = 0; i < index_list_.size(); ++i) {
+    const std::size_t position = index_list_[i];
+    const char c = json[position];
+    switch (state) {
+     case State::kFirstValue: {
+      if (c == ']') {
+        close(']');
+        state = State::kNext;
+        break;
+      }
+      [[fallthrough]];
+     }
+     case State::kValue: {
+      if (!scope_list.empty() && !is_object()) {
+        ++scope_list.back().count_;
+        element_stack.push_back(cast<uint32b>(tape_.size()));
+      }
+      if ((c == '{') || (c == '[')) {
+        scope_list.push_back(Scope{tape_.size(), 0, element_stack.size()});
+        tape_.push_back(makeWord(c, 0));
+        // An array is followed by the size and the offset in the element table
+        if (c == '[')
+          tape_.push_back(0);
+        state = (c == '{') ? State::kFirstKey : State::kFirstValue;
+      }
+      else {
+        writeScalar(json, i);
+        state = State::kNext;
+      }
+      break;
+     }
+     case State::kFirstKey: {
+      if (c == '}') {
+        close('}');
+        state = State::kNext;
+        break;
+      }
+      [[fallthrough]];
+     }
+     case State::kKey: {
+      if (c != '"')
+        raiseParseError(position, "A key of an object must be a string.");
+      ++scope_list.back().count_;
+      writeString(json, i);
+      state = State::kColon;
+      break;
+     }
+     case State::kColon: {
+      if (c != ':')
+        raiseParseError(position, "':' is expected after a key.");
+      state = State::kValue;
+      break;
+     }
+     case State::kNext: {
+      if (scope_list.empty())
+        raiseParseError(position, "Unexpected character after the root value.");
+      const bool is_obj = is_object();
+      if (c == ',')
+        state = is_obj ? State::kKey : State::kValue;
+      else if (c == (is_obj ? '}' : ']'))
+        close(c);
+      else
+        raiseParseError(position, is_obj ? "',' or '}' is expected in an object."
+                                         : "',' or ']' is expected in an array.");
+      break;
+     }
+    }
+  }
+  if ((state != State::kNext) || !scope_list.empty())
+    raiseParseError(json.size(), "Unexpected end of the document.");
+  // The null which represents a missing value
+  tape_.push_back(makeWord('n', 0));
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] json No description.
+  \exception JsonParseError The document is malformed
+  */
+void JsonDocument::parseImpl(const std::string_view json)
+{
+  text_ = std::string_view{};
+  tape_.clear();
+  string_buffer_.clear();
+  if (maxTextSize() < json.size())
+    raiseParseError(0, "The document exceeds the max size " + std::to_string(maxTextSize()) + ".");
+  try {
+    indexStructurals(json);
+    buildTape(json);
+  }
+  catch ([[maybe_unused]] const JsonParseError& error) {
+    tape_.clear();
+    element_list_.clear();
+    string_buffer_.clear();
+    throw;
+  }
+  text_ = json;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] position No description.
+  \param [in] message No description.
+  */
+void JsonDocument::raiseParseError(const std::size_t position,
+                                   const std::string_view message)
+{
+  const std::string what = "Position " + std::to_string(position) + ": " + std::string{message};
+  throw JsonParseError{what, position};
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] json No description.
+  \param [in] index The index of the structural position.
+  \exception JsonParseError The value is malformed
+  */
+void JsonDocument::writeScalar(const std::string_view json, const std::size_t index)
+{
+  const std::size_t position = index_list_[index];
+  if (json[position] == '"') {
+    writeString(json, index);
+    return;
+  }
+
+  // A scalar ends at the next structural position
+  std::size_t end = ((index + 1) < index_list_.size()) ? index_list_[index + 1] : json.size();
+  for (; (position < end) && isWhitespace(json[end - 1]); --end);
+  const std::string_view value = json.substr(position, end - position);
+  if (JsonValueParser::isIntegerValue(value)) {
+    tape_.push_back(makeWord('l', position));
+    tape_.push_back(value.size());
+  }
+  else if (JsonValueParser::isFloatValue(value)) {
+    tape_.push_back(makeWord('d', position));
+    tape_.push_back(value.size());
+  }
+  else if ((value == "true") || (value == "false") || (value == "null")) {
+    tape_.push_back(makeWord(value[0], position));
+  }
+  else {
+    raiseParseError(position, "Invalid value '" + std::string{value} + "'.");
+  }
+}
+
+/*!
+  \details Only a string with escapes is validated and unescaped here.
+  The others were checked for control characters in the first stage
+
+  \param [in] json No description.
+  \param [in] index The index of the structural position.
+  \exception JsonParseError The string is malformed
+  */
+void JsonDocument::writeString(const std::string_view json, const std::size_t index)
+{
+  const std::size_t position = index_list_[index];
+  std::size_t end = ((index + 1) < index_list_.size()) ? index_list_[index + 1] : json.size();
+  for (; (position < end) && isWhitespace(json[end - 1]); --end);
+  const std::string_view value = json.substr(position, end - position);
+
+  uint64b offset = 0;
+  const std::size_t escape = findFirstOf<'\\'>(value, 0);
+  if (escape != value.size()) {
+    if (!JsonValueParser::isStringValue(value))
+      raiseParseError(position, "Invalid string " + std::string{value} + ".");
+    // The unescaped string is stored with the size
+    const std::size_t size = JsonValueParser::getCxxStringSize(value);
+    const std::size_t o = string_buffer_.size();
+    string_buffer_.resize(o + sizeof(uint32b) + size);
+    const auto s = cast<uint32b>(size);
+    std::memcpy(string_buffer_.data() + o, &s, sizeof(s));
+    JsonValueParser::toCxxString(value, string_buffer_.data() + o + sizeof(s));
+    if ((std::numeric_limits<uint32b>::max)() <= o)
+      raiseParseError(position, "The strings exceed the buffer.");
+    offset = o + 1;
+  }
+  else if ((value.size() < 2) || (value.back() != '"')) {
+    raiseParseError(position, "Invalid string " + std::string{value} + ".");
+  }
+  tape_.push_back(makeWord('"', position));
+  tape_.push_back((offset << 32) | value.size());
+}
+
+} // namespace zisc
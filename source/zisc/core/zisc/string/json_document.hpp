@@ -0,0 +1,331 @@
+/*!
+  \file json_document.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_JSON_DOCUMENT_HPP
+#define ZISC_JSON_DOCUMENT_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+// Zisc
+#include "zisc/concepts.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/memory/mapped_file.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief The type of a JSON value
+
+  No detailed description.
+  */
+enum class JsonType : uint8b
+{
+  kNull,
+  kBool,
+  kInteger,
+  kFloat,
+  kString,
+  kArray,
+  kObject
+};
+
+/*!
+  \brief Parse a whole JSON document into a compact tape
+
+  The document is parsed in two stages.
+  The first stage finds the structural characters and the beginnings of
+  the scalar values 64 bytes at a time with SIMD masks,
+  tracking escaped quotes and the insides of strings without branches.
+  The second stage validates the grammar over the found positions and
+  writes a tape of 64-bit words, where an object or an array knows the
+  end of itself so that it can be skipped in constant time.
+  The tape indices of the elements of each array are stored in a table,
+  so an element is accessed by its index in constant time.
+  Numbers and strings without escapes are kept as positions in the text and
+  converted by JsonValueParser only when they are accessed.
+  Strings with escapes are unescaped into a buffer during parsing.
+  The text must outlive the document unless it's parsed by parseFile().
+
+  \note The size of a document is limited to maxTextSize().
+  \attention No attention.
+  */
+class JsonDocument : private NonCopyable<JsonDocument>
+{
+ public:
+  // Forward declaration
+  class Iterator;
+  class Value;
+
+
+  //! Create an empty document
+  explicit JsonDocument(std::pmr::memory_resource* mem_resource) noexcept;
+
+  //! Move a data
+  JsonDocument(JsonDocument&& other) noexcept;
+
+
+  //! Move a data
+  auto operator=(JsonDocument&& other) noexcept -> JsonDocument&;
+
+
+  //! Clear the document
+  void clear() noexcept;
+
+  //! Check if the document has no value
+  [[nodiscard]]
+  auto isEmpty() const noexcept -> bool;
+
+  //! Return the maximum size of a text in bytes
+  static constexpr auto maxTextSize() noexcept -> std::size_t;
+
+  //! Parse the given JSON text. The text must outlive the document
+  void parse(const std::string_view json);
+
+  //! Map and parse the given JSON file. The file is kept mapped by the document
+  void parseFile(const std::filesystem::path& file_path);
+
+  //! Return the root value
+  [[nodiscard]]
+  auto root() const noexcept -> Value;
+
+  //! Return the tape of the document
+  [[nodiscard]]
+  auto tape() const noexcept -> std::span<const uint64b>;
+
+  //! Return the text of the document
+  [[nodiscard]]
+  auto text() const noexcept -> std::string_view;
+
+ private:
+  //! Index the structural characters and the beginnings of the scalars (stage 1)
+  void indexStructurals(const std::string_view json);
+
+  //! Validate the grammar and build the tape (stage 2)
+  void buildTape(const std::string_view json);
+
+  //! Return the tag of the tape word
+  static constexpr auto getTag(const uint64b word) noexcept -> char;
+
+  //! Return the payload of the tape word
+  static constexpr auto getPayload(const uint64b word) noexcept -> uint64b;
+
+  //! Make a tape word
+  static constexpr auto makeWord(const char tag, const uint64b payload) noexcept -> uint64b;
+
+  //! Return the tape index of the value next to the given value
+  [[nodiscard]]
+  auto nextIndex(const std::size_t index) const noexcept -> std::size_t;
+
+  //! Return the tape index of the null value which represents a missing value
+  [[nodiscard]]
+  auto nullIndex() const noexcept -> std::size_t;
+
+  //! Parse the given JSON text
+  void parseImpl(const std::string_view json);
+
+  //! Throw a parse error
+  [[noreturn]]
+  static void raiseParseError(const std::size_t position, const std::string_view message);
+
+  //! Write a scalar value to the tape
+  void writeScalar(const std::string_view json, const std::size_t index);
+
+  //! Write a string value to the tape
+  void writeString(const std::string_view json, const std::size_t index);
+
+
+  static constexpr uint64b kPayloadMask = (uint64b{1} << 56) - 1;
+  static constexpr uint64b kMaxCount = (uint64b{1} << 24) - 1;
+
+
+  MappedFile file_;
+  std::string_view text_;
+  std::pmr::vector<uint32b> index_list_;
+  std::pmr::vector<uint64b> tape_;
+  std::pmr::vector<uint32b> element_list_;
+  std::pmr::vector<char> string_buffer_;
+};
+
+/*!
+  \brief A lazy view of a value in a JsonDocument
+
+  A value is a position in the tape, so it's cheap to copy.
+  Numbers are converted on each access.
+
+  \note No notation.
+  \attention No attention.
+  */
+class JsonDocument::Value
+{
+ public:
+  //! Create a view of the value at the given tape index
+  Value(const JsonDocument* document, const std::size_t index) noexcept;
+
+
+  //! Return the element of the array by the index. Null is returned if it's out of range
+  auto operator[](const std::size_t index) const noexcept -> Value;
+
+  //! Return the member value of the object by the key
+  auto operator[](const std::string_view key) const noexcept -> Value;
+
+
+  //! Return an iterator to the first element or member
+  [[nodiscard]]
+  auto begin() const noexcept -> Iterator;
+
+  //! Return an iterator past the last element or member
+  [[nodiscard]]
+  auto end() const noexcept -> Iterator;
+
+  //! Find the member value of the object by the key
+  [[nodiscard]]
+  auto find(const std::string_view key) const noexcept -> std::optional<Value>;
+
+  //! Check if the value is an array
+  [[nodiscard]]
+  auto isArray() const noexcept -> bool;
+
+  //! Check if the value is a boolean
+  [[nodiscard]]
+  auto isBool() const noexcept -> bool;
+
+  //! Check if the value is a number written with a fraction or an exponent
+  [[nodiscard]]
+  auto isFloat() const noexcept -> bool;
+
+  //! Check if the value is an integer
+  [[nodiscard]]
+  auto isInteger() const noexcept -> bool;
+
+  //! Check if the value is null
+  [[nodiscard]]
+  auto isNull() const noexcept -> bool;
+
+  //! Check if the value is an object
+  [[nodiscard]]
+  auto isObject() const noexcept -> bool;
+
+  //! Check if the value is a string
+  [[nodiscard]]
+  auto isString() const noexcept -> bool;
+
+  //! Return the JSON text of the scalar value
+  [[nodiscard]]
+  auto rawText() const noexcept -> std::string_view;
+
+  //! Return the number of the elements or the members
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+  //! Return the tape index of the value
+  [[nodiscard]]
+  auto tapeIndex() const noexcept -> std::size_t;
+
+  //! Convert the value to C++ boolean
+  [[nodiscard]]
+  auto toBool() const noexcept -> bool;
+
+  //! Convert the number to C++ float
+  template <std::floating_point Float>
+  auto toFloat() const noexcept -> Float;
+
+  //! Convert the integer to C++ integer
+  template <Integer Int>
+  auto toInteger() const -> Int;
+
+  //! Return the string value
+  [[nodiscard]]
+  auto toString() const noexcept -> std::string_view;
+
+  //! Return the type of the value
+  [[nodiscard]]
+  auto type() const noexcept -> JsonType;
+
+ private:
+  //! Return the tag of the value
+  [[nodiscard]]
+  auto tag() const noexcept -> char;
+
+
+  const JsonDocument* document_;
+  std::size_t index_;
+};
+
+/*!
+  \brief The iterator over the elements of an array or the members of an object
+
+  No detailed description.
+
+  \note No notation.
+  \attention No attention.
+  */
+class JsonDocument::Iterator
+{
+ public:
+  // Type aliases for STL
+  using value_type = Value;
+  using difference_type = std::ptrdiff_t;
+  using reference = Value;
+  using pointer = void;
+  using iterator_category = std::input_iterator_tag;
+  using iterator_concept = std::forward_iterator_tag;
+
+
+  //! Create an invalid iterator
+  Iterator() noexcept = default;
+
+  //! Create an iterator at the given tape index
+  Iterator(const JsonDocument* document,
+           const std::size_t index,
+           const bool is_member) noexcept;
+
+
+  //! Return the current element or member value
+  auto operator*() const noexcept -> reference;
+
+  //! Move to the next element or member
+  auto operator++() noexcept -> Iterator&;
+
+  //! Move to the next element or member
+  auto operator++(int) noexcept -> Iterator;
+
+  //! Check if the iterators point the same value
+  auto operator==(const Iterator& other) const noexcept -> bool;
+
+
+  //! Return the key of the current member
+  [[nodiscard]]
+  auto key() const noexcept -> std::string_view;
+
+ private:
+  const JsonDocument* document_ = nullptr;
+  std::size_t index_ = 0;
+  bool is_member_ = false;
+  [[maybe_unused]] Padding<7> pad_{};
+};
+
+} // namespace zisc
+
+#include "json_document-inl.hpp"
+
+#endif // ZISC_JSON_DOCUMENT_HPP
@@ -0,0 +1,82 @@
+/*!
+  \file json_parse_error-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_JSON_PARSE_ERROR_INL_HPP
+#define ZISC_JSON_PARSE_ERROR_INL_HPP
+
+#include "json_parse_error.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <string_view>
+#include <utility>
+// Zisc
+#include "zisc/error.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in] what_arg No description.
+  \param [in] position No description.
+  */
+inline
+JsonParseError::JsonParseError(const std::string_view what_arg,
+                               const std::size_t position) :
+    SystemError(ErrorCode::kJsonInvalidFormat, what_arg),
+    position_{position}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  */
+inline
+JsonParseError::JsonParseError(JsonParseError&& other) noexcept :
+    SystemError(std::move(other)),
+    position_{other.position_}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  \return No description
+  */
+inline
+auto JsonParseError::operator=(JsonParseError&& other) noexcept -> JsonParseError&
+{
+  SystemError::operator=(std::move(other));
+  position_ = other.position_;
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonParseError::position() const noexcept -> std::size_t
+{
+  return position_;
+}
+
+} // namespace zisc
+
+#endif // ZISC_JSON_PARSE_ERROR_INL_HPP
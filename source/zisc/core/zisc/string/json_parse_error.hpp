@@ -0,0 +1,64 @@
+/*!
+  \file json_parse_error.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_JSON_PARSE_ERROR_HPP
+#define ZISC_JSON_PARSE_ERROR_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <string_view>
+// Zisc
+#include "zisc/error.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief The error which is thrown when a JSON document is malformed
+
+  No detailed description.
+
+  \note No notation.
+  \attention No attention.
+  */
+class JsonParseError : public SystemError
+{
+ public:
+  //! Construct the JSON parse error
+  JsonParseError(const std::string_view what_arg, const std::size_t position);
+
+  //! Move data
+  JsonParseError(JsonParseError&& other) noexcept;
+
+  //! Finalize the JSON parse error
+  ~JsonParseError() noexcept override = default;
+
+
+  //! Move data
+  auto operator=(JsonParseError&& other) noexcept -> JsonParseError&;
+
+
+  //! Return the byte offset in the document where the error occurred
+  [[nodiscard]]
+  auto position() const noexcept -> std::size_t;
+
+ private:
+  std::size_t position_;
+};
+
+} // namespace zisc
+
+#include "json_parse_error-inl.hpp"
+
+#endif // ZISC_JSON_PARSE_ERROR_HPP
@@ -17,15 +17,19 @@
 
 #include "json_value_parser.hpp"
 // Standard C++ library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
 #include <concepts>
 #include <cstddef>
-#include <cstdlib>
-#include <regex>
+#include <cstring>
+#include <limits>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 // Zisc
-#include "constant_string.hpp"
 #include "zisc/concepts.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
@@ -34,86 +38,9 @@ namespace zisc {
 
 /*!
   \details No detailed description
-
-  \return No description
-  */
-inline
-constexpr auto JsonValueParser::truePattern() noexcept
-{
-  auto pattern = toString(R"(true)");
-  return pattern;
-}
-
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-constexpr auto JsonValueParser::falsePattern() noexcept
-{
-  auto pattern = toString(R"(false)");
-  return pattern;
-}
-
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-constexpr auto JsonValueParser::booleanPattern() noexcept
-{
-  auto pattern = truePattern() + R"(|)" + falsePattern();
-  return pattern;
-}
-
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-constexpr auto JsonValueParser::integerPattern() noexcept
-{
-  auto pattern = toString(R"(-?(?:[1-9][0-9]*|0))");
-  return pattern;
-}
-
-/*!
-  \details No detailed description
-
-  \return No description
   */
 inline
-constexpr auto JsonValueParser::floatPattern() noexcept
-{
-  auto pattern = integerPattern() + R"((?:\.[0-9]+)?(?:[eE][+-]?[0-9]+)?)";
-  return pattern;
-}
-
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-constexpr auto JsonValueParser::stringPattern() noexcept
-{
-  auto character = toString(R"([^"\\[:cntrl:]])");
-  auto escaped = toString(R"(\\["\\bfnrt])");
-  auto pattern = R"("(?:)" + character + R"(|)" + escaped + R"()*")";
-  return pattern;
-}
-
-/*!
-  \details No detailed description
-  */
-inline
-JsonValueParser::JsonValueParser() noexcept :
-    int_pattern_{integerPattern().toCStr(), regexInsOptions()},
-    float_pattern_{floatPattern().toCStr(), regexInsOptions()},
-    string_pattern_{stringPattern().toCStr(), regexInsOptions()}
+JsonValueParser::JsonValueParser() noexcept
 {
 }
 
@@ -133,55 +60,60 @@ auto JsonValueParser::getCxxStringSize(const std::string_view json_value) noexce
 /*!
   \details No detailed description
 
+  \param [in] json_value No description.
   \return No description
   */
 inline
-constexpr auto JsonValueParser::regexInsOptions() noexcept -> std::regex::flag_type
+auto JsonValueParser::toCxxBool(const std::string_view json_value) noexcept -> bool
 {
-  constexpr std::regex::flag_type flag = std::regex_constants::nosubs |
-                                         std::regex_constants::optimize |
-                                         std::regex_constants::ECMAScript;
-  return flag;
+  const bool result = json_value == "true";
+  return result;
 }
 
 /*!
   \details No detailed description
 
+  \tparam Float No description.
+  \param [in] json_value No description.
   \return No description
   */
-inline
-constexpr auto JsonValueParser::regexTempOptions() noexcept -> std::regex::flag_type
+template <std::floating_point Float> inline
+auto JsonValueParser::toCxxFloat(const std::string_view json_value) noexcept -> Float
 {
-  constexpr std::regex::flag_type flag = std::regex_constants::nosubs |
-                                         std::regex_constants::ECMAScript;
-  return flag;
+  Float result = static_cast<Float>(0);
+  [[maybe_unused]] const bool is_valid = toCxxFloatImpl(json_value, &result);
+  return result;
 }
 
 /*!
   \details No detailed description
 
+  \tparam Float No description.
   \param [in] json_value No description.
+  \param [out] value No description.
   \return No description
   */
-inline
-auto JsonValueParser::toCxxBool(const std::string_view json_value) noexcept -> bool
+template <std::floating_point Float> inline
+auto JsonValueParser::toCxxFloat(const std::string_view json_value, Float* value) noexcept
+    -> bool
 {
-  constexpr auto true_value = truePattern();
-  const bool result = true_value == json_value;
+  // std::from_chars accepts values which aren't JSON float like "1." and "01"
+  const bool result = isFloatValue(json_value) && toCxxFloatImpl(json_value, value);
   return result;
 }
 
 /*!
   \details No detailed description
 
-  \tparam Float No description.
+  \tparam Int No description.
   \param [in] json_value No description.
   \return No description
   */
-template <std::floating_point Float> inline
-auto JsonValueParser::toCxxFloat(const std::string_view json_value) noexcept -> Float
+template <Integer Int> inline
+auto JsonValueParser::toCxxInteger(const std::string_view json_value) noexcept -> Int
 {
-  const Float result = toCxxFloatImpl<Float>(json_value);
+  Int result = 0;
+  [[maybe_unused]] const bool is_valid = toCxxIntegerImpl(json_value, &result);
   return result;
 }
 
@@ -190,12 +122,14 @@ auto JsonValueParser::toCxxFloat(const std::string_view json_value) noexcept ->
 
   \tparam Int No description.
   \param [in] json_value No description.
+  \param [out] value No description.
   \return No description
   */
 template <Integer Int> inline
-auto JsonValueParser::toCxxInteger(const std::string_view json_value) noexcept -> Int
+auto JsonValueParser::toCxxInteger(const std::string_view json_value, Int* value) noexcept
+    -> bool
 {
-  const Int result = toCxxIntegerImpl<Int>(json_value);
+  const bool result = toCxxIntegerImpl(json_value, value);
   return result;
 }
 
@@ -223,9 +157,7 @@ void JsonValueParser::toCxxString(const std::string_view json_value,
 inline
 auto JsonValueParser::isBoolValue(const std::string_view json_value) noexcept -> bool
 {
-  constexpr auto true_value = truePattern();
-  constexpr auto false_value = falsePattern();
-  const bool result = (true_value == json_value) || (false_value == json_value);
+  const bool result = (json_value == "true") || (json_value == "false");
   return result;
 }
 
@@ -238,8 +170,21 @@ auto JsonValueParser::isBoolValue(const std::string_view json_value) noexcept ->
 inline
 auto JsonValueParser::isFloatValue(const std::string_view json_value) noexcept -> bool
 {
-  const std::regex float_pattern{floatPattern().toCStr(), regexTempOptions()};
-  const bool result = isValueOf(float_pattern, json_value);
+  std::size_t pos = skipInteger(json_value, 0);
+  // Fraction
+  if ((pos < json_value.size()) && (json_value[pos] == '.')) {
+    const std::size_t p = skipDigits(json_value, pos + 1);
+    pos = (p != (pos + 1)) ? p : std::string_view::npos;
+  }
+  // Exponent
+  if ((pos < json_value.size()) && ((json_value[pos] == 'e') || (json_value[pos] == 'E'))) {
+    ++pos;
+    if ((pos < json_value.size()) && ((json_value[pos] == '+') || (json_value[pos] == '-')))
+      ++pos;
+    const std::size_t p = skipDigits(json_value, pos);
+    pos = (p != pos) ? p : std::string_view::npos;
+  }
+  const bool result = pos == json_value.size();
   return result;
 }
 
@@ -252,8 +197,7 @@ auto JsonValueParser::isFloatValue(const std::string_view json_value) noexcept -
 inline
 auto JsonValueParser::isIntegerValue(const std::string_view json_value) noexcept -> bool
 {
-  const std::regex int_pattern{integerPattern().toCStr(), regexTempOptions()};
-  const bool result = isValueOf(int_pattern, json_value);
+  const bool result = skipInteger(json_value, 0) == json_value.size();
   return result;
 }
 
@@ -266,35 +210,31 @@ auto JsonValueParser::isIntegerValue(const std::string_view json_value) noexcept
 inline
 auto JsonValueParser::isStringValue(const std::string_view json_value) noexcept -> bool
 {
-  const std::regex string_pattern{stringPattern().toCStr(), regexTempOptions()};
-  const bool result = isValueOf(string_pattern, json_value);
+  bool result = (2 <= json_value.size()) &&
+                 json_value.starts_with('"') && json_value.ends_with('"');
+  for (std::size_t i = 1; result && (i < (json_value.size() - 1)); ++i) {
+    const char c = json_value[i];
+    if (c == '\\') {
+      ++i;
+      if ((i < (json_value.size() - 1)) && (json_value[i] == 'u')) {
+        result = ((i + 4) < (json_value.size() - 1)) &&
+                 (0 <= getUnicodeCodePoint(json_value.substr(i + 1, 4)));
+        i += 4;
+      }
+      else {
+        result = (i < (json_value.size() - 1)) && (getEscapedCharacter(json_value[i]) != '\0');
+      }
+    }
+    else {
+      const bool is_control = (cast<unsigned char>(c) < 0x20) || (c == 0x7f);
+      result = (c != '"') && !is_control;
+    }
+  }
   return result;
 }
 
 // For instance
 
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-auto JsonValueParser::floatRegex() const noexcept -> const std::regex&
-{
-  return float_pattern_;
-}
-
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-auto JsonValueParser::integerRegex() const noexcept -> const std::regex&
-{
-  return int_pattern_;
-}
-
 /*!
   \details No detailed description
 
@@ -317,7 +257,7 @@ auto JsonValueParser::isBool(const std::string_view json_value) noexcept -> bool
 inline
 auto JsonValueParser::isFloat(const std::string_view json_value) const noexcept -> bool
 {
-  const bool result = isValueOf(floatRegex(), json_value);
+  const bool result = isFloatValue(json_value);
   return result;
 }
 
@@ -330,7 +270,7 @@ auto JsonValueParser::isFloat(const std::string_view json_value) const noexcept
 inline
 auto JsonValueParser::isInteger(const std::string_view json_value) const noexcept -> bool
 {
-  const bool result = isValueOf(integerRegex(), json_value);
+  const bool result = isIntegerValue(json_value);
   return result;
 }
 
@@ -343,21 +283,10 @@ auto JsonValueParser::isInteger(const std::string_view json_value) const noexcep
 inline
 auto JsonValueParser::isString(const std::string_view json_value) const noexcept -> bool
 {
-  const bool result = isValueOf(stringRegex(), json_value);
+  const bool result = isStringValue(json_value);
   return result;
 }
 
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-auto JsonValueParser::stringRegex() const noexcept -> const std::regex&
-{
-  return string_pattern_;
-}
-
 /*!
   \details No detailed description
 
@@ -375,6 +304,9 @@ auto JsonValueParser::getEscapedCharacter(const char c) noexcept -> char
    case '\\':
     result = '\\';
     break;
+   case '/':
+    result = '/';
+    break;
    case 'b':
     result = '\b';
     break;
@@ -399,57 +331,195 @@ auto JsonValueParser::getEscapedCharacter(const char c) noexcept -> char
 /*!
   \details No detailed description
 
-  \param [in] pattern No description.
+  \param [in] hex No description.
+  \return No description
+  */
+inline
+constexpr auto JsonValueParser::getUnicodeCodePoint(const std::string_view hex) noexcept
+    -> int32b
+{
+  int32b code_point = (hex.size() == 4) ? 0 : -1;
+  for (std::size_t i = 0; (0 <= code_point) && (i < hex.size()); ++i) {
+    const char c = hex[i];
+    const int32b digit = (('0' <= c) && (c <= '9')) ? (c - '0') :
+                         (('a' <= c) && (c <= 'f')) ? (c - 'a' + 10) :
+                         (('A' <= c) && (c <= 'F')) ? (c - 'A' + 10) : -1;
+    code_point = (0 <= digit) ? ((code_point << 4) | digit) : -1;
+  }
+  return code_point;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] code_point No description.
+  \param [out] value The bytes are written only if it isn't null.
+  \return No description
+  */
+inline
+auto JsonValueParser::encodeUtf8(const uint32b code_point, char* value) noexcept
+    -> std::size_t
+{
+  const std::size_t size = (code_point < 0x80) ? 1 :
+                           (code_point < 0x800) ? 2 :
+                           (code_point < 0x10000) ? 3 : 4;
+  if (value != nullptr) {
+    if (size == 1) {
+      value[0] = cast<char>(code_point);
+    }
+    else {
+      constexpr std::array<uint32b, 5> prefix{{0x00, 0x00, 0xc0, 0xe0, 0xf0}};
+      for (std::size_t i = size - 1; 0 < i; --i)
+        value[i] = cast<char>(0x80 | ((code_point >> (6 * (size - 1 - i))) & 0x3f));
+      value[0] = cast<char>(prefix[size] | (code_point >> (6 * (size - 1))));
+    }
+  }
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] chunk No description.
+  \return No description
+  */
+inline
+constexpr auto JsonValueParser::isEightDigits(const uint64b chunk) noexcept -> bool
+{
+  // The upper nibble of each byte is 3 and the lower one doesn't exceed 9
+  constexpr uint64b mask = 0xf0f0'f0f0'f0f0'f0f0ull;
+  const uint64b high = chunk & mask;
+  const uint64b carry = (chunk + 0x0606'0606'0606'0606ull) & mask;
+  const bool result = (high | (carry >> 4)) == 0x3333'3333'3333'3333ull;
+  return result;
+}
+
+/*!
+  \details The given value must be out of range of the float type
+
   \param [in] json_value No description.
   \return No description
   */
 inline
-auto JsonValueParser::isValueOf(const std::regex& pattern,
-                                const std::string_view json_value) noexcept -> bool
+auto JsonValueParser::isOverflowedFloat(const std::string_view json_value) noexcept -> bool
 {
-  const bool result = std::regex_match(json_value.begin(),
-                                       json_value.end(),
-                                       pattern);
+  auto is_digit = [json_value](const std::size_t p) noexcept
+  {
+    return (p < json_value.size()) && ('0' <= json_value[p]) && (json_value[p] <= '9');
+  };
+  // Compute the decimal exponent of the most significant digit
+  std::size_t pos = ((0 < json_value.size()) && (json_value[0] == '-')) ? 1 : 0;
+  int64b exponent = 0;
+  bool is_found = false;
+  for (; is_digit(pos); ++pos) {
+    if (is_found)
+      ++exponent;
+    else
+      is_found = json_value[pos] != '0';
+  }
+  if ((pos < json_value.size()) && (json_value[pos] == '.')) {
+    for (++pos; is_digit(pos); ++pos) {
+      if (!is_found) {
+        --exponent;
+        is_found = json_value[pos] != '0';
+      }
+    }
+  }
+  if ((pos < json_value.size()) && ((json_value[pos] == 'e') || (json_value[pos] == 'E'))) {
+    ++pos;
+    const bool is_negative = (pos < json_value.size()) && (json_value[pos] == '-');
+    if ((pos < json_value.size()) && ((json_value[pos] == '+') || is_negative))
+      ++pos;
+    constexpr int64b limit = 1'000'000;
+    int64b e = 0;
+    for (; is_digit(pos); ++pos)
+      e = (std::min)(10 * e + cast<int64b>(json_value[pos] - '0'), limit);
+    exponent += is_negative ? -e : e;
+  }
+  const bool result = 0 < exponent;
   return result;
 }
 
 /*!
   \details No detailed description
 
-  \tparam Float No description.
+  \param [in] chunk No description.
+  \return No description
+  */
+inline
+constexpr auto JsonValueParser::parseEightDigits(uint64b chunk) noexcept -> uint32b
+{
+  // Combine adjacent digits into 2, 4 and 8 digit numbers
+  constexpr uint64b mask = 0x0000'00ff'0000'00ffull;
+  constexpr uint64b mul1 = 100 + (1'000'000ull << 32);
+  constexpr uint64b mul2 = 1 + (10'000ull << 32);
+  chunk -= 0x3030'3030'3030'3030ull;
+  chunk = (chunk * 10) + (chunk >> 8);
+  chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+  return cast<uint32b>(chunk);
+}
+
+/*!
+  \details No detailed description
+
   \param [in] json_value No description.
+  \param [in] pos No description.
   \return No description
   */
-template <std::floating_point Float> inline
-auto JsonValueParser::toCxxFloatImpl(const std::string_view json_value) noexcept -> Float
+inline
+auto JsonValueParser::skipDigits(const std::string_view json_value, std::size_t pos) noexcept
+    -> std::size_t
 {
-  using FType = std::remove_cv_t<Float>;
-  Float result;
-  if constexpr (std::is_same_v<float, FType>)
-    result = std::strtof(json_value.data(), nullptr);
-  else if constexpr (std::is_same_v<double, FType>)
-    result = std::strtod(json_value.data(), nullptr);
-  else if constexpr (std::is_same_v<long double, FType>)
-    result = std::strtold(json_value.data(), nullptr);
-  return result;
+  for (; (pos < json_value.size()) && ('0' <= json_value[pos]) && (json_value[pos] <= '9'); ++pos);
+  return pos;
 }
 
 /*!
   \details No detailed description
 
-  \tparam Int No description.
   \param [in] json_value No description.
+  \param [in] pos No description.
   \return No description
   */
-template <SignedInteger Int> inline
-auto JsonValueParser::toCxxIntegerImpl(const std::string_view json_value) noexcept -> Int
+inline
+auto JsonValueParser::skipInteger(const std::string_view json_value, std::size_t pos) noexcept
+    -> std::size_t
 {
-  Int result = 0;
-  if constexpr (Integer64<Int>)
-    result = std::strtoll(json_value.data(), nullptr, 10);
-  else
-    result = cast<Int>(std::strtol(json_value.data(), nullptr, 10));
-  return result;
+  if ((pos < json_value.size()) && (json_value[pos] == '-'))
+    ++pos;
+  if ((pos < json_value.size()) && (json_value[pos] == '0'))
+    return pos + 1;
+  const std::size_t end = skipDigits(json_value, pos);
+  return (end != pos) ? end : std::string_view::npos;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] json_value No description.
+  \param [out] value No description.
+  \return No description
+  */
+template <std::floating_point Float> inline
+auto JsonValueParser::toCxxFloatImpl(const std::string_view json_value, Float* value) noexcept
+    -> bool
+{
+  const char* begin = json_value.data();
+  const char* end = begin + json_value.size();
+  Float result = static_cast<Float>(0);
+  const std::from_chars_result r = std::from_chars(begin, end, result, std::chars_format::general);
+  if (r.ec == std::errc::result_out_of_range) {
+    // Round to infinity or zero like strtod since the result is left unmodified
+    const bool is_negative = (begin != end) && (*begin == '-');
+    result = isOverflowedFloat(json_value) ? std::numeric_limits<Float>::infinity()
+                                           : static_cast<Float>(0);
+    result = is_negative ? -result : result;
+  }
+  *value = result;
+  const bool is_success = (r.ptr == end) &&
+                          ((r.ec == std::errc{}) || (r.ec == std::errc::result_out_of_range));
+  return is_success;
 }
 
 /*!
@@ -457,17 +527,56 @@ auto JsonValueParser::toCxxIntegerImpl(const std::string_view json_value) noexce
 
   \tparam Int No description.
   \param [in] json_value No description.
+  \param [out] value No description.
   \return No description
   */
-template <UnsignedInteger Int> inline
-auto JsonValueParser::toCxxIntegerImpl(const std::string_view json_value) noexcept -> Int
+template <Integer Int> inline
+auto JsonValueParser::toCxxIntegerImpl(const std::string_view json_value, Int* value) noexcept
+    -> bool
 {
-  Int result = 0;
-  if constexpr (Integer64<Int>)
-    result = std::strtoull(json_value.data(), nullptr, 10);
-  else
-    result = cast<Int>(std::strtoul(json_value.data(), nullptr, 10));
-  return result;
+  const char* p = json_value.data();
+  const char* const end = p + json_value.size();
+  const bool is_negative = (p != end) && (*p == '-');
+  if (is_negative)
+    ++p;
+  const char* const digits = p;
+
+  uint64b magnitude = 0;
+  if constexpr (std::endian::native == std::endian::little) {
+    // Up to 16 digits are parsed eight at a time, which never overflow
+    for (std::size_t i = 0; (i < 2) && (8 <= (end - p)); ++i) {
+      uint64b chunk = 0;
+      std::memcpy(&chunk, p, sizeof(chunk));
+      if (!isEightDigits(chunk))
+        break;
+      magnitude = 100'000'000 * magnitude + parseEightDigits(chunk);
+      p += 8;
+    }
+  }
+  bool is_valid = true;
+  for (; (p != end) && ('0' <= *p) && (*p <= '9'); ++p) {
+    constexpr uint64b limit = (std::numeric_limits<uint64b>::max)();
+    const auto d = cast<uint64b>(*p - '0');
+    is_valid = is_valid && (magnitude <= ((limit - d) / 10));
+    magnitude = 10 * magnitude + d;
+  }
+  const auto num_of_digits = cast<std::size_t>(p - digits);
+  is_valid = is_valid && (p == end) && (0 < num_of_digits) &&
+             ((*digits != '0') || (num_of_digits == 1));
+
+  // Check the range of the integer type
+  using UInt = std::make_unsigned_t<Int>;
+  constexpr auto max = cast<uint64b>((std::numeric_limits<Int>::max)());
+  if constexpr (SignedInteger<Int>) {
+    is_valid = is_valid && (magnitude <= (max + (is_negative ? 1 : 0)));
+    const auto m = cast<UInt>(magnitude);
+    *value = cast<Int>(is_negative ? cast<UInt>(UInt{0} - m) : m);
+  }
+  else {
+    is_valid = is_valid && (magnitude <= max) && (!is_negative || (magnitude == 0));
+    *value = cast<Int>(magnitude);
+  }
+  return is_valid;
 }
 
 /*!
@@ -486,15 +595,35 @@ auto JsonValueParser::toCxxStringImpl(std::string_view json_value,
   json_value.remove_suffix(1);
 
   std::size_t size = 0;
-  for (auto i = json_value.begin(); i != json_value.end(); ++i) {
-    char c = *i;
-    if (c == '\\') {
-      ++i;
-      c = getEscapedCharacter(*i);
+  for (std::size_t i = 0; i < json_value.size(); ++i) {
+    char c = json_value[i];
+    if ((c == '\\') && (json_value[i + 1] == 'u')) {
+      // A surrogate pair is combined and a lone surrogate is replaced with U+FFFD
+      auto code_point = cast<uint32b>(getUnicodeCodePoint(json_value.substr(i + 2, 4)));
+      i += 5;
+      const bool is_high = (0xd800 <= code_point) && (code_point < 0xdc00);
+      const int32b low = (is_high && ((i + 6) < json_value.size()) &&
+                          (json_value.substr(i + 1, 2) == "\\u"))
+          ? getUnicodeCodePoint(json_value.substr(i + 3, 4))
+          : -1;
+      if ((0xdc00 <= low) && (low < 0xe000)) {
+        code_point = 0x10000 + ((code_point - 0xd800) << 10) + (cast<uint32b>(low) - 0xdc00);
+        i += 6;
+      }
+      else if ((0xd800 <= code_point) && (code_point < 0xe000)) {
+        code_point = 0xfffd;
+      }
+      size += encodeUtf8(code_point, (value != nullptr) ? value + size : nullptr);
+    }
+    else {
+      if (c == '\\') {
+        ++i;
+        c = getEscapedCharacter(json_value[i]);
+      }
+      if (value != nullptr)
+        value[size] = c;
+      ++size;
     }
-    if (value != nullptr)
-      value[size] = c;
-    ++size;
   }
   return size;
 }
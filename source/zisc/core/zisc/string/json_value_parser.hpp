@@ -18,7 +18,6 @@
 // Standard C++ library
 #include <concepts>
 #include <cstddef>
-#include <regex>
 #include <string_view>
 // Zisc
 #include "zisc/concepts.hpp"
@@ -29,45 +28,28 @@ namespace zisc {
 /*!
   \brief JSON value parser
 
+  Values are validated and converted without regex or the C locale.
+  Floats are converted by std::from_chars and integers are parsed
+  eight digits at a time on little endian targets.
+  The given values don't have to be null-terminated.
   For more detail, please see the following link:
   <a href="https://www.json.org/json-en.html">Introducing JSON</a>.
   */
 class JsonValueParser
 {
  public:
-  //! Initialize a pattern instance
+  //! Initialize a parser instance
   JsonValueParser() noexcept;
 
 
-  // Patterns
-
-  //! Return the true string pattern
-  static constexpr auto truePattern() noexcept;
-
-  //! Return the false string pattern
-  static constexpr auto falsePattern() noexcept;
-
-  //! Return the boolean string pattern
-  static constexpr auto booleanPattern() noexcept;
-
-  //! Return the integer string pattern
-  static constexpr auto integerPattern() noexcept;
-
-  //! Return the float string pattern
-  static constexpr auto floatPattern() noexcept;
-
-  //! Return the string pattern
-  static constexpr auto stringPattern() noexcept;
-
-
   //! Return the required size for converting the given string to a C++ string
   static auto getCxxStringSize(const std::string_view json_value) noexcept -> std::size_t;
 
-  //! Return the regex options for instance
-  static constexpr auto regexInsOptions() noexcept -> std::regex::flag_type;
+  //! Return a escaped character. '\0' is returned if the character can't be escaped
+  static auto getEscapedCharacter(const char c) noexcept -> char;
 
-  //! Return the regex options for temporary use
-  static constexpr auto regexTempOptions() noexcept -> std::regex::flag_type;
+  //! Return the code point of the 4 hex digits of '\\u'. -1 is returned if invalid
+  static constexpr auto getUnicodeCodePoint(const std::string_view hex) noexcept -> int32b;
 
   //! Convert JSON boolean to C++ boolean
   static auto toCxxBool(const std::string_view json_value) noexcept -> bool;
@@ -76,10 +58,18 @@ class JsonValueParser
   template <std::floating_point Float>
   static auto toCxxFloat(const std::string_view json_value) noexcept -> Float;
 
-  //! Convert JSON float to C++ float
+  //! Convert JSON float to C++ float. Return false if the value isn't JSON float
+  template <std::floating_point Float>
+  static auto toCxxFloat(const std::string_view json_value, Float* value) noexcept -> bool;
+
+  //! Convert JSON integer to C++ integer
   template <Integer Int>
   static auto toCxxInteger(const std::string_view json_value) noexcept -> Int;
 
+  //! Convert JSON integer to C++ integer. Return false if the value isn't JSON integer or out of range
+  template <Integer Int>
+  static auto toCxxInteger(const std::string_view json_value, Int* value) noexcept -> bool;
+
   //! Convert JSON string to C++ string
   static void toCxxString(const std::string_view json_value, char* value) noexcept;
 
@@ -99,14 +89,6 @@ class JsonValueParser
 
   // For instance
 
-  //! Return the floating point regex object
-  [[nodiscard]]
-  auto floatRegex() const noexcept -> const std::regex&;
-
-  //! Return the integer regex object
-  [[nodiscard]]
-  auto integerRegex() const noexcept -> const std::regex&;
-
   //! Check whether the 'json_value' is JSON boolean
   [[nodiscard]]
   static auto isBool(const std::string_view json_value) noexcept -> bool;
@@ -123,38 +105,40 @@ class JsonValueParser
   [[nodiscard]]
   auto isString(const std::string_view json_value) const noexcept -> bool;
 
-  //! Return the string regex object
-  [[nodiscard]]
-  auto stringRegex() const noexcept -> const std::regex&;
-
  private:
-  //! Return a escaped character
-  static auto getEscapedCharacter(const char c) noexcept -> char;
+  //! Check whether the given 8 characters are all digits
+  static constexpr auto isEightDigits(const uint64b chunk) noexcept -> bool;
 
-  //! Check whether the 'json_value' is JSON value
-  static auto isValueOf(const std::regex& pattern,
-                        const std::string_view json_value) noexcept -> bool;
+  //! Check whether the out of range float overflows rather than underflows
+  static auto isOverflowedFloat(const std::string_view json_value) noexcept -> bool;
 
-  //! Convert JSON float to C++ float
-  template <std::floating_point Float>
-  static auto toCxxFloatImpl(std::string_view json_value) noexcept -> Float;
+  //! Write the given code point in UTF-8. Return the number of the bytes
+  static auto encodeUtf8(const uint32b code_point, char* value) noexcept -> std::size_t;
 
-  //! Convert JSON integer to C++ integer
-  template <SignedInteger Int>
-  static auto toCxxIntegerImpl(std::string_view json_value) noexcept -> Int;
+  //! Convert the given 8 digits to an integer
+  static constexpr auto parseEightDigits(uint64b chunk) noexcept -> uint32b;
 
-  //! Convert JSON integer to C++ integer
-  template <UnsignedInteger Int>
-  static auto toCxxIntegerImpl(std::string_view json_value) noexcept -> Int;
+  //! Skip digits. Return the position after the digits
+  static auto skipDigits(const std::string_view json_value, std::size_t pos) noexcept
+      -> std::size_t;
+
+  //! Skip a JSON integer. Return the position after the integer or npos if invalid
+  static auto skipInteger(const std::string_view json_value, std::size_t pos) noexcept
+      -> std::size_t;
+
+  //! Convert JSON float to C++ float. Return false if the conversion fails
+  template <std::floating_point Float>
+  static auto toCxxFloatImpl(const std::string_view json_value, Float* value) noexcept
+      -> bool;
+
+  //! Validate and convert JSON integer to C++ integer in a single pass
+  template <Integer Int>
+  static auto toCxxIntegerImpl(const std::string_view json_value, Int* value) noexcept
+      -> bool;
 
   //! Convert JSON string to C++ string
   static auto toCxxStringImpl(std::string_view json_value,
                               char* value) noexcept -> std::size_t;
-
-
-  std::regex int_pattern_;
-  std::regex float_pattern_;
-  std::regex string_pattern_;
 };
 
 } // namespace zisc
@@ -0,0 +1,333 @@
+/*!
+  \file json_writer-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_JSON_WRITER_INL_HPP
+#define ZISC_JSON_WRITER_INL_HPP
+
+#include "json_writer.hpp"
+// Standard C++ library
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+// Zisc
+#include "write_buffer.hpp"
+#include "zisc/concepts.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in,out] output No description.
+  */
+inline
+JsonWriter::JsonWriter(WriteBuffer& output) noexcept :
+    output_{&output},
+    scope_list_{typename decltype(scope_list_)::allocator_type{output.memoryResource()}}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::beginArray()
+{
+  beginValue();
+  output_->append('[');
+  scope_list_.push_back(0);
+}
+
+/*!
+  \details No detailed description
+
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::beginObject()
+{
+  beginValue();
+  output_->append('{');
+  scope_list_.push_back(kObject);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonWriter::depth() const noexcept -> std::size_t
+{
+  return scope_list_.size();
+}
+
+/*!
+  \details No detailed description
+
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::endArray()
+{
+  ZISC_ASSERT(!scope_list_.empty() && ((scope_list_.back() & kObject) == 0),
+              "No array is open.");
+  endScope(']');
+}
+
+/*!
+  \details No detailed description
+
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::endObject()
+{
+  ZISC_ASSERT(!scope_list_.empty() && ((scope_list_.back() & kObject) != 0),
+              "No object is open.");
+  ZISC_ASSERT(!is_after_key_, "The last member has no value.");
+  endScope('}');
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] k No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::key(const std::string_view k)
+{
+  ZISC_ASSERT(!scope_list_.empty() && ((scope_list_.back() & kObject) != 0),
+              "A key is written outside of an object.");
+  ZISC_ASSERT(!is_after_key_, "The last member has no value.");
+  beginValue();
+  writeString(k);
+  output_->append(':');
+  is_after_key_ = true;
+}
+
+/*!
+  \details No detailed description
+
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::null()
+{
+  beginValue();
+  output_->append("null");
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto JsonWriter::output() const noexcept -> WriteBuffer&
+{
+  return *output_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] v No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::value(const bool v)
+{
+  beginValue();
+  output_->append(v ? std::string_view{"true"} : std::string_view{"false"});
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] v No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+template <std::floating_point Float> inline
+void JsonWriter::value(const Float v)
+{
+  if (std::isfinite(v)) {
+    beginValue();
+    output_->appendFloat(v);
+  }
+  else {
+    null();
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int No description.
+  \param [in] v No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+template <Integer Int> inline
+void JsonWriter::value(const Int v)
+{
+  beginValue();
+  output_->appendInteger(v);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] v No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::value(const std::string_view v)
+{
+  beginValue();
+  writeString(v);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] v No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::value(const char* v)
+{
+  value(std::string_view{v});
+}
+
+/*!
+  \details No detailed description
+
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::beginValue()
+{
+  if (is_after_key_) {
+    is_after_key_ = false;
+  }
+  else if (!scope_list_.empty()) {
+    uint8b& scope = scope_list_.back();
+    if ((scope & kHasValue) != 0)
+      output_->append(',');
+    scope = cast<uint8b>(scope | kHasValue);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] closer No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::endScope(const char closer)
+{
+  scope_list_.pop_back();
+  output_->append(closer);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] c No description.
+  \param [out] sequence The buffer of 6 characters at least.
+  \return No description
+  */
+inline
+auto JsonWriter::getEscapeSequence(const char c, char* sequence) noexcept
+    -> std::string_view
+{
+  std::string_view result{};
+  switch (c) {
+   case '"':
+    result = R"(\")";
+    break;
+   case '\\':
+    result = R"(\\)";
+    break;
+   case '\b':
+    result = R"(\b)";
+    break;
+   case '\f':
+    result = R"(\f)";
+    break;
+   case '\n':
+    result = R"(\n)";
+    break;
+   case '\r':
+    result = R"(\r)";
+    break;
+   case '\t':
+    result = R"(\t)";
+    break;
+   default: {
+    constexpr std::string_view digits = "0123456789abcdef";
+    const auto code = cast<uint8b>(c);
+    sequence[0] = '\\';
+    sequence[1] = 'u';
+    sequence[2] = '0';
+    sequence[3] = '0';
+    sequence[4] = digits[code >> 4];
+    sequence[5] = digits[code & 0xf];
+    result = std::string_view{sequence, 6};
+    break;
+   }
+  }
+  return result;
+}
+
+/*!
+  \details The runs without escapes are copied at once
+
+  \param [in] s No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void JsonWriter::writeString(const std::string_view s)
+{
+  std::array<char, 6> sequence{};
+  output_->append('"');
+  std::size_t begin = 0;
+  for (std::size_t i = 0; i < s.size(); ++i) {
+    const auto c = cast<uint8b>(s[i]);
+    const bool needs_escape = (c < 0x20) || (c == '"') || (c == '\\') || (c == 0x7f);
+    if (needs_escape) {
+      output_->append(s.substr(begin, i - begin));
+      output_->append(getEscapeSequence(s[i], sequence.data()));
+      begin = i + 1;
+    }
+  }
+  output_->append(s.substr(begin));
+  output_->append('"');
+}
+
+} // namespace zisc
+
+#endif // ZISC_JSON_WRITER_INL_HPP
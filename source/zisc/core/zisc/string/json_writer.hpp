@@ -0,0 +1,128 @@
+/*!
+  \file json_writer.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_JSON_WRITER_HPP
+#define ZISC_JSON_WRITER_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+// Zisc
+#include "zisc/concepts.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+// Forward declaration
+class WriteBuffer;
+
+/*!
+  \brief Write a JSON document into a WriteBuffer
+
+  Values are written in order, and ',' and ':' are inserted by the writer.
+  The text is compact, without indents.
+  Numbers are formatted without the locale and floats are written
+  in the shortest form which round-trips. NaN and infinity are written as null.
+  Strings are escaped so that JsonValueParser and JsonDocument read them back.
+
+  \note No notation.
+  \attention No attention.
+  */
+class JsonWriter : private NonCopyable<JsonWriter>
+{
+ public:
+  //! Initialize the writer with the given output
+  explicit JsonWriter(WriteBuffer& output) noexcept;
+
+
+  //! Begin an array
+  void beginArray();
+
+  //! Begin an object
+  void beginObject();
+
+  //! Return the number of the open arrays and objects
+  [[nodiscard]]
+  auto depth() const noexcept -> std::size_t;
+
+  //! End the current array
+  void endArray();
+
+  //! End the current object
+  void endObject();
+
+  //! Write a key of a member of the current object
+  void key(const std::string_view k);
+
+  //! Write null
+  void null();
+
+  //! Return the output
+  [[nodiscard]]
+  auto output() const noexcept -> WriteBuffer&;
+
+  //! Write a boolean
+  void value(const bool v);
+
+  //! Write a float
+  template <std::floating_point Float>
+  void value(const Float v);
+
+  //! Write an integer
+  template <Integer Int>
+  void value(const Int v);
+
+  //! Write a string
+  void value(const std::string_view v);
+
+  //! Write a string
+  void value(const char* v);
+
+ private:
+  //! The state of an open array or object
+  enum Scope : uint8b
+  {
+    kObject = 0b01,
+    kHasValue = 0b10
+  };
+
+
+  //! Write ',' if the value isn't the first one in the current scope
+  void beginValue();
+
+  //! End the current scope
+  void endScope(const char closer);
+
+  //! Write the escape sequence of the given character into the sequence
+  static auto getEscapeSequence(const char c, char* sequence) noexcept -> std::string_view;
+
+  //! Write an escaped and quoted string
+  void writeString(const std::string_view s);
+
+
+  WriteBuffer* output_;
+  std::pmr::vector<uint8b> scope_list_;
+  bool is_after_key_ = false;
+  [[maybe_unused]] Padding<7> pad_{};
+};
+
+} // namespace zisc
+
+#include "json_writer-inl.hpp"
+
+#endif // ZISC_JSON_WRITER_HPP
@@ -0,0 +1,102 @@
+/*!
+  \file string_scan-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_STRING_SCAN_INL_HPP
+#define ZISC_STRING_SCAN_INL_HPP
+
+#include "string_scan.hpp"
+// Standard C++ library
+#include <bit>
+#include <cstddef>
+#include <string_view>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+// Zisc
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details The text is searched 64 bytes at a time with getCharMask()
+
+  \tparam kCharacters No description.
+  \param [in] text No description.
+  \param [in] pos No description.
+  \return No description
+  */
+template <char ...kCharacters> inline
+auto findFirstOf(const std::string_view text, std::size_t pos) noexcept -> std::size_t
+{
+  const std::size_t size = text.size();
+  constexpr std::size_t n = 64;
+  for (; pos + n <= size; pos += n) {
+    const uint64b mask = getCharMask<kCharacters...>(text.data() + pos);
+    if (mask != 0)
+      return pos + cast<std::size_t>(std::countr_zero(mask));
+  }
+  // The tail of the text
+  for (; pos < size; ++pos) {
+    const char c = text[pos];
+    if (((c == kCharacters) || ...))
+      return pos;
+  }
+  return size;
+}
+
+/*!
+  \details The block is compared 32 (AVX2) or 16 (SSE2) bytes at a time
+  if the target supports them, otherwise with a scalar loop.
+  The i-th bit of the mask corresponds to the i-th byte of the block
+
+  \tparam kCharacters No description.
+  \param [in] block No description.
+  \return No description
+  */
+template <char ...kCharacters> inline
+auto getCharMask(const char* block) noexcept -> uint64b
+{
+  uint64b mask = 0;
+#if defined(__AVX2__)
+  constexpr std::size_t n = sizeof(__m256i);
+  for (std::size_t i = 0; i < 64; i += n) {
+    const __m256i v = _mm256_loadu_si256(reinterp<const __m256i*>(block + i));
+    __m256i m = _mm256_setzero_si256();
+    ((m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(kCharacters)))), ...);
+    mask |= cast<uint64b>(cast<uint32b>(_mm256_movemask_epi8(m))) << i;
+  }
+#elif defined(__SSE2__)
+  constexpr std::size_t n = sizeof(__m128i);
+  for (std::size_t i = 0; i < 64; i += n) {
+    const __m128i v = _mm_loadu_si128(reinterp<const __m128i*>(block + i));
+    __m128i m = _mm_setzero_si128();
+    ((m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(kCharacters)))), ...);
+    mask |= cast<uint64b>(cast<uint32b>(_mm_movemask_epi8(m))) << i;
+  }
+#else
+  for (std::size_t i = 0; i < 64; ++i) {
+    const char c = block[i];
+    if (((c == kCharacters) || ...))
+      mask |= uint64b{1} << i;
+  }
+#endif
+  return mask;
+}
+
+} // namespace zisc
+
+#endif // ZISC_STRING_SCAN_INL_HPP
@@ -0,0 +1,38 @@
+/*!
+  \file string_scan.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_STRING_SCAN_HPP
+#define ZISC_STRING_SCAN_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <string_view>
+// Zisc
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+//! Find the first position of any of the given characters. Return the text size if not found
+template <char ...kCharacters>
+auto findFirstOf(const std::string_view text, std::size_t pos) noexcept -> std::size_t;
+
+//! Return the bit mask of the positions of any of the given characters in the 64 byte block
+template <char ...kCharacters>
+auto getCharMask(const char* block) noexcept -> uint64b;
+
+} // namespace zisc
+
+#include "string_scan-inl.hpp"
+
+#endif // ZISC_STRING_SCAN_HPP
@@ -0,0 +1,348 @@
+/*!
+  \file write_buffer-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_WRITE_BUFFER_INL_HPP
+#define ZISC_WRITE_BUFFER_INL_HPP
+
+#include "write_buffer.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+// Zisc
+#include "zisc/concepts.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \details No detailed description
+
+  \param [in,out] mem_resource No description.
+  */
+inline
+WriteBuffer::WriteBuffer(std::pmr::memory_resource* mem_resource) noexcept :
+    buffer_{typename decltype(buffer_)::allocator_type{mem_resource}}
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] fd No description.
+  \param [in,out] mem_resource No description.
+  \param [in] flush_size No description.
+  */
+inline
+WriteBuffer::WriteBuffer(const int fd,
+                         std::pmr::memory_resource* mem_resource,
+                         const std::size_t flush_size) :
+    buffer_{typename decltype(buffer_)::allocator_type{mem_resource}},
+    flush_size_{(std::max)(flush_size, std::size_t{1})},
+    fd_{fd}
+{
+  buffer_.resize(flush_size_);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  */
+inline
+WriteBuffer::WriteBuffer(WriteBuffer&& other) noexcept :
+    buffer_{std::move(other.buffer_)},
+    size_{std::exchange(other.size_, 0)},
+    flush_size_{std::exchange(other.flush_size_, 0)},
+    total_flushed_size_{std::exchange(other.total_flushed_size_, 0)},
+    fd_{std::exchange(other.fd_, -1)}
+{
+}
+
+/*!
+  \details An error on the last flush is ignored.
+  Call flush() explicitly to handle it
+  */
+inline
+WriteBuffer::~WriteBuffer() noexcept
+{
+  try {
+    flush();
+  }
+  catch ([[maybe_unused]] const std::system_error& error) {
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] other No description.
+  \return No description
+  */
+inline
+auto WriteBuffer::operator=(WriteBuffer&& other) noexcept -> WriteBuffer&
+{
+  try {
+    flush();
+  }
+  catch ([[maybe_unused]] const std::system_error& error) {
+  }
+  buffer_ = std::move(other.buffer_);
+  size_ = std::exchange(other.size_, 0);
+  flush_size_ = std::exchange(other.flush_size_, 0);
+  total_flushed_size_ = std::exchange(other.total_flushed_size_, 0);
+  fd_ = std::exchange(other.fd_, -1);
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] c No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void WriteBuffer::append(const char c)
+{
+  *makeSpace(1) = c;
+  ++size_;
+  flushIfFull();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] s No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void WriteBuffer::append(const std::string_view s)
+{
+  if (hasFileDescriptor() && (flushSize() <= s.size())) {
+    // A large string is written directly
+    flush();
+    std::string_view bytes = s;
+    writeBytes(fd_, &bytes);
+    total_flushed_size_ += s.size();
+  }
+  else if (!s.empty()) {
+    std::memcpy(makeSpace(s.size()), s.data(), s.size());
+    size_ += s.size();
+    flushIfFull();
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Float No description.
+  \param [in] value No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+template <std::floating_point Float> inline
+void WriteBuffer::appendFloat(const Float value)
+{
+  // The longest shortest form, e.g. -1.7976931348623157e+308
+  constexpr std::size_t max_size = 4 + std::numeric_limits<Float>::max_digits10 +
+                                   std::numeric_limits<Float>::max_exponent10 / 100 + 4;
+  char* first = makeSpace(max_size);
+  const std::to_chars_result result = std::to_chars(first, first + max_size, value);
+  ZISC_ASSERT(result.ec == std::errc{}, "Formatting the float failed.");
+  size_ += cast<std::size_t>(result.ptr - first);
+  flushIfFull();
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Int No description.
+  \param [in] value No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+template <Integer Int> inline
+void WriteBuffer::appendInteger(const Int value)
+{
+  constexpr std::size_t max_size = std::numeric_limits<Int>::digits10 + 2;
+  char* first = makeSpace(max_size);
+  const std::to_chars_result result = std::to_chars(first, first + max_size, value);
+  ZISC_ASSERT(result.ec == std::errc{}, "Formatting the integer failed.");
+  size_ += cast<std::size_t>(result.ptr - first);
+  flushIfFull();
+}
+
+/*!
+  \details The allocated storage is kept
+  */
+inline
+void WriteBuffer::clear() noexcept
+{
+  size_ = 0;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr auto WriteBuffer::defaultFlushSize() noexcept -> std::size_t
+{
+  constexpr std::size_t size = 64 * 1024;
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto WriteBuffer::fileDescriptor() const noexcept -> int
+{
+  return fd_;
+}
+
+/*!
+  \details Nothing is done if the buffer has no file descriptor.
+  If writing fails, the bytes which aren't written are kept in the buffer,
+  so flush() can be retried
+
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void WriteBuffer::flush()
+{
+  if (hasFileDescriptor() && (0 < size_)) {
+    std::string_view bytes{buffer_.data(), size_};
+    try {
+      writeBytes(fd_, &bytes);
+    }
+    catch ([[maybe_unused]] const std::system_error& error) {
+      const std::size_t written = size_ - bytes.size();
+      std::memmove(buffer_.data(), bytes.data(), bytes.size());
+      size_ = bytes.size();
+      total_flushed_size_ += written;
+      throw;
+    }
+    total_flushed_size_ += size_;
+    size_ = 0;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto WriteBuffer::flushSize() const noexcept -> std::size_t
+{
+  return flush_size_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto WriteBuffer::hasFileDescriptor() const noexcept -> bool
+{
+  return 0 <= fd_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto WriteBuffer::memoryResource() const noexcept -> std::pmr::memory_resource*
+{
+  return buffer_.get_allocator().resource();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto WriteBuffer::size() const noexcept -> std::size_t
+{
+  return size_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto WriteBuffer::totalFlushedSize() const noexcept -> std::size_t
+{
+  return total_flushed_size_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto WriteBuffer::view() const noexcept -> std::string_view
+{
+  return {buffer_.data(), size_};
+}
+
+/*!
+  \details No detailed description
+
+  \exception std::system_error Writing to the file descriptor failed
+  */
+inline
+void WriteBuffer::flushIfFull()
+{
+  if (hasFileDescriptor() && (flushSize() <= size_))
+    flush();
+}
+
+/*!
+  \details The buffer grows geometrically, so appending is amortized constant time
+
+  \param [in] n No description.
+  \return No description
+  */
+inline
+auto WriteBuffer::makeSpace(const std::size_t n) -> char*
+{
+  const std::size_t required = size_ + n;
+  if (buffer_.size() < required)
+    buffer_.resize((std::max)(required, 2 * buffer_.size()));
+  return buffer_.data() + size_;
+}
+
+} // namespace zisc
+
+#endif // ZISC_WRITE_BUFFER_INL_HPP
@@ -0,0 +1,63 @@
+/*!
+  \file write_buffer.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#include "write_buffer.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+// Zisc
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+// Platform
+#if defined(Z_WINDOWS)
+#include <io.h>
+#elif defined(Z_LINUX) || defined(Z_MAC)
+#include <unistd.h>
+#endif
+
+namespace zisc {
+
+/*!
+  \details Partial writes are continued and interrupted writes are retried
+
+  \param [in] fd No description.
+  \param [in,out] bytes No description.
+  \exception std::system_error Writing to the file descriptor failed
+  */
+void WriteBuffer::writeBytes(const int fd, std::string_view* bytes)
+{
+  while (!bytes->empty()) {
+#if defined(Z_WINDOWS)
+    constexpr std::size_t max_size = 1u << 30;
+    const std::size_t size = (std::min)(bytes->size(), max_size);
+    const int result = ::_write(fd, bytes->data(), cast<unsigned int>(size));
+#elif defined(Z_LINUX) || defined(Z_MAC)
+    const ssize_t result = ::write(fd, bytes->data(), bytes->size());
+#else
+    const int result = -1;
+    errno = ENOTSUP;
+#endif
+    if (result < 0) {
+      if (errno == EINTR)
+        continue;
+      throw std::system_error{errno, std::generic_category(), "Writing the buffer failed"};
+    }
+    bytes->remove_prefix(cast<std::size_t>(result));
+  }
+}
+
+} // namespace zisc
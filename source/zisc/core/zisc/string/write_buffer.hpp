@@ -0,0 +1,140 @@
+/*!
+  \file write_buffer.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZISC_WRITE_BUFFER_HPP
+#define ZISC_WRITE_BUFFER_HPP
+
+// Standard C++ library
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+// Zisc
+#include "zisc/concepts.hpp"
+#include "zisc/non_copyable.hpp"
+#include "zisc/zisc_config.hpp"
+
+namespace zisc {
+
+/*!
+  \brief A growable byte buffer for formatted text output
+
+  Values are formatted directly into the buffer by std::to_chars,
+  so the formatting doesn't depend on the locale and floats are written
+  in the shortest form which round-trips.
+  If a file descriptor is given, the buffer is written to it in batches
+  when it reaches the flush size and when the buffer is destroyed.
+  Otherwise the buffer grows and keeps the whole text.
+
+  \note No notation.
+  \attention No attention.
+  */
+class WriteBuffer : private NonCopyable<WriteBuffer>
+{
+ public:
+  //! Create a buffer which keeps the whole text
+  explicit WriteBuffer(std::pmr::memory_resource* mem_resource) noexcept;
+
+  //! Create a buffer which is flushed to the given file descriptor
+  WriteBuffer(const int fd,
+              std::pmr::memory_resource* mem_resource,
+              const std::size_t flush_size = defaultFlushSize());
+
+  //! Move a data
+  WriteBuffer(WriteBuffer&& other) noexcept;
+
+  //! Flush the remaining text
+  ~WriteBuffer() noexcept;
+
+
+  //! Move a data
+  auto operator=(WriteBuffer&& other) noexcept -> WriteBuffer&;
+
+
+  //! Append a character
+  void append(const char c);
+
+  //! Append a string
+  void append(const std::string_view s);
+
+  //! Append a float in the shortest form which round-trips
+  template <std::floating_point Float>
+  void appendFloat(const Float value);
+
+  //! Append an integer in decimal
+  template <Integer Int>
+  void appendInteger(const Int value);
+
+  //! Clear the text in the buffer without writing it
+  void clear() noexcept;
+
+  //! Return the default size of a batch
+  static constexpr auto defaultFlushSize() noexcept -> std::size_t;
+
+  //! Return the file descriptor. -1 is returned if the buffer has no file descriptor
+  [[nodiscard]]
+  auto fileDescriptor() const noexcept -> int;
+
+  //! Write the text in the buffer to the file descriptor
+  void flush();
+
+  //! Return the size of the text in bytes which is written to the file descriptor
+  [[nodiscard]]
+  auto flushSize() const noexcept -> std::size_t;
+
+  //! Check if the buffer has a file descriptor
+  [[nodiscard]]
+  auto hasFileDescriptor() const noexcept -> bool;
+
+  //! Return the memory resource of the buffer
+  [[nodiscard]]
+  auto memoryResource() const noexcept -> std::pmr::memory_resource*;
+
+  //! Return the size of the text in the buffer in bytes
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+  //! Return the total size of the text written to the file descriptor in bytes
+  [[nodiscard]]
+  auto totalFlushedSize() const noexcept -> std::size_t;
+
+  //! Return the text in the buffer
+  [[nodiscard]]
+  auto view() const noexcept -> std::string_view;
+
+ private:
+  //! Flush the buffer if it reaches the flush size
+  void flushIfFull();
+
+  //! Return the space for the given number of bytes at the end of the text
+  auto makeSpace(const std::size_t n) -> char*;
+
+  //! Write the given bytes to the file descriptor. The written bytes are removed from the view
+  static void writeBytes(const int fd, std::string_view* bytes);
+
+
+  std::pmr::vector<char> buffer_;
+  std::size_t size_ = 0;
+  std::size_t flush_size_ = 0;
+  std::size_t total_flushed_size_ = 0;
+  int fd_ = -1;
+  [[maybe_unused]] Padding<4> pad_{};
+};
+
+} // namespace zisc
+
+#include "write_buffer-inl.hpp"
+
+#endif // ZISC_WRITE_BUFFER_HPP
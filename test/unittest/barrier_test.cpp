@@ -0,0 +1,85 @@
+/*!
+  \file barrier_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/barrier.hpp"
+
+TEST(BarrierTest, PhaseTest)
+{
+  constexpr std::size_t num_of_threads = 8;
+  constexpr int num_of_phases = 1'000;
+
+  zisc::Barrier barrier{static_cast<int>(num_of_threads)};
+  std::vector<int> value_list(num_of_threads, 0);
+  std::atomic<bool> is_mismatched{false};
+  auto job = [&](const std::size_t thread_id)
+  {
+    for (int phase = 0; phase < num_of_phases; ++phase) {
+      // Write phase
+      value_list[thread_id] = phase;
+      barrier.arriveAndWait();
+      // Read phase. All threads must see the values of the current phase
+      for (const int value : value_list) {
+        if (value != phase)
+          is_mismatched.store(true, std::memory_order::release);
+      }
+      barrier.arriveAndWait();
+    }
+  };
+
+  std::vector<std::thread> worker_list;
+  worker_list.reserve(num_of_threads);
+  for (std::size_t i = 0; i < num_of_threads; ++i)
+    worker_list.emplace_back(job, i);
+  for (std::thread& worker : worker_list)
+    worker.join();
+
+  ASSERT_FALSE(is_mismatched.load()) << "The barrier didn't separate the phases.";
+  ASSERT_EQ(2 * num_of_phases, barrier.phase());
+}
+
+TEST(BarrierTest, ArriveAndDropTest)
+{
+  constexpr std::size_t num_of_threads = 4;
+
+  zisc::Barrier barrier{static_cast<int>(num_of_threads)};
+  auto job = [&barrier](const std::size_t thread_id)
+  {
+    barrier.arriveAndWait();
+    if (thread_id == 0) {
+      barrier.arriveAndDrop();
+      return;
+    }
+    barrier.arriveAndWait();
+    barrier.arriveAndWait();
+  };
+
+  std::vector<std::thread> worker_list;
+  worker_list.reserve(num_of_threads);
+  for (std::size_t i = 0; i < num_of_threads; ++i)
+    worker_list.emplace_back(job, i);
+  for (std::thread& worker : worker_list)
+    worker.join();
+
+  ASSERT_EQ(num_of_threads - 1, static_cast<std::size_t>(barrier.expected()));
+  ASSERT_EQ(3, barrier.phase());
+}
@@ -14,17 +14,27 @@
 
 // Standard C++ library
 #include <array>
+#include <bit>
 #include <cstddef>
+#include <memory_resource>
+#include <numeric>
+#include <span>
 #include <istream>
 #include <memory>
 #include <ostream>
 #include <sstream>
+#include <streambuf>
 #include <string>
 #include <vector>
 // GoogleTest
 #include "googletest.hpp"
 // Zisc
+#include "zisc/binary_reader.hpp"
 #include "zisc/binary_serializer.hpp"
+#include "zisc/binary_writer.hpp"
+#include "zisc/error.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 
 namespace {
@@ -52,6 +62,33 @@ void testDistance(const std::streamsize expected, std::istream* data_stream) noe
   ASSERT_EQ(bad, data_stream->bad());
 }
 
+/*!
+  \details A stream buffer which can't tell the position
+  */
+class UnseekableBuffer : public std::streambuf
+{
+ public:
+  explicit UnseekableBuffer(const std::span<const std::byte> data) noexcept
+  {
+    char* p = const_cast<char*>(zisc::reinterp<const char*>(data.data()));
+    setg(p, p, p + data.size());
+  }
+};
+
+template <std::endian kEndian>
+void testReadFrom(const std::span<const std::byte> expected,
+                  std::istream* data_stream,
+                  std::pmr::memory_resource* mem_resource)
+{
+  std::pmr::vector<std::byte> buffer{mem_resource};
+  zisc::BinaryReader<kEndian> reader = zisc::BinaryReader<kEndian>::readFrom(data_stream, &buffer);
+  ASSERT_EQ(expected.size(), reader.size());
+  ASSERT_EQ(buffer.data(), reader.data().data()) << "The reader doesn't view the buffer.";
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(expected[i], reader.template read<std::byte>()) << "byte[" << i << "] is wrong.";
+  ASSERT_TRUE(reader.isEnd());
+}
+
 } // namespace
 
 TEST(BinarySerializerTest, ReadWriteTest)
@@ -142,3 +179,173 @@ TEST(BinarySerializerTest, StreamToVectorTest)
   for (std::size_t i = 0; i < data.size(); ++i)
     ASSERT_EQ(data[i], result[i]);
 }
+
+TEST(BinarySerializerTest, BufferReadWriteTest)
+{
+  enum class Kind : zisc::uint16b { kA = 1, kB = 0x0102 };
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::BinaryWriter<std::endian::little> writer{&mem_resource};
+    ASSERT_TRUE(writer.isGrowable());
+    writer.write(zisc::uint32b{0});
+    writer.write(zisc::int32b{-10});
+    writer.write(2.5f);
+    writer.write(Kind::kB);
+    const ::TestData data4{{'a', 'b', 'c', 'd'}, 1, 3.14};
+    zisc::BSerializer::write(&data4, &writer);
+    std::vector<double> values(1000);
+    std::iota(values.begin(), values.end(), 0.5);
+    writer.write(std::span{values});
+    const std::size_t size = writer.size();
+    // Patch the header
+    writer.seek(0);
+    writer.write(zisc::cast<zisc::uint32b>(size));
+    ASSERT_EQ(size, writer.size());
+    ASSERT_THROW(writer.seek(size + 1), zisc::SystemError);
+
+    // The wire format is little endian on every platform
+    const std::span<const std::byte> bytes = writer.data();
+    ASSERT_EQ(std::byte{0xf6}, bytes[4]);
+    ASSERT_EQ(std::byte{0x02}, bytes[12]);
+    ASSERT_EQ(std::byte{0x01}, bytes[13]);
+
+    zisc::BinaryReader<std::endian::little> reader{bytes};
+    ASSERT_EQ(size, reader.read<zisc::uint32b>());
+    ASSERT_EQ(-10, reader.read<zisc::int32b>());
+    ASSERT_FLOAT_EQ(2.5f, reader.read<float>());
+    ASSERT_EQ(Kind::kB, reader.read<Kind>());
+    ::TestData result{};
+    zisc::BSerializer::read(&result, &reader);
+    ASSERT_EQ(data4.c_, result.c_);
+    ASSERT_EQ(data4.u_, result.u_);
+    ASSERT_DOUBLE_EQ(data4.d_, result.d_);
+    std::vector<double> results(values.size());
+    reader.read(std::span{results});
+    ASSERT_EQ(values, results);
+    ASSERT_TRUE(reader.isEnd());
+
+    // Bounds check
+    ASSERT_THROW(reader.read<char>(), zisc::SystemError);
+    reader.seek(reader.size() - 4);
+    ASSERT_THROW(reader.read<double>(), zisc::SystemError);
+    ASSERT_EQ(reader.size() - 4, reader.position()) << "The cursor moved on an error.";
+    ASSERT_THROW(reader.skip(5), zisc::SystemError);
+    ASSERT_THROW(reader.seek(reader.size() + 1), zisc::SystemError);
+
+    // Stream adapter
+    std::stringstream data_stream{std::ios_base::in |
+                                  std::ios_base::out |
+                                  std::ios_base::binary};
+    writer.writeTo(&data_stream);
+    ASSERT_EQ(size, zisc::BSerializer::getDistance(&data_stream));
+    {
+      std::pmr::vector<std::byte> buffer{&mem_resource};
+      auto stream_reader = zisc::BinaryReader<std::endian::little>::readFrom(&data_stream, &buffer);
+      ASSERT_EQ(size, stream_reader.size());
+      ASSERT_EQ(size, stream_reader.read<zisc::uint32b>());
+      ASSERT_EQ(-10, stream_reader.read<zisc::int32b>());
+      ASSERT_FLOAT_EQ(2.5f, stream_reader.read<float>());
+      ASSERT_EQ(Kind::kB, stream_reader.read<Kind>());
+      zisc::BSerializer::read(&result, &stream_reader);
+      ASSERT_EQ(data4.u_, result.u_);
+      stream_reader.read(std::span{results});
+      ASSERT_EQ(values, results);
+      ASSERT_TRUE(stream_reader.isEnd());
+    }
+    // The stream is read in chunks if its size is unknown
+    ::UnseekableBuffer stream_buffer{bytes};
+    std::istream unseekable_stream{&stream_buffer};
+    ASSERT_EQ(0, zisc::BSerializer::getDistance(&unseekable_stream));
+    ::testReadFrom<std::endian::little>(bytes, &unseekable_stream, &mem_resource);
+    // An empty stream
+    std::stringstream empty_stream{std::ios_base::in | std::ios_base::binary};
+    ::testReadFrom<std::endian::little>({}, &empty_stream, &mem_resource);
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(BinarySerializerTest, BufferMoveAssignmentTest)
+{
+  zisc::AllocFreeResource mem_resource1;
+  zisc::AllocFreeResource mem_resource2;
+  std::array<std::byte, 8> region{};
+  {
+    std::vector<zisc::uint32b> values(100);
+    std::iota(values.begin(), values.end(), 1u);
+
+    // Growable writers with different resources
+    zisc::BinaryWriter<std::endian::little> writer1{&mem_resource1};
+    writer1.write(std::span{values});
+    zisc::BinaryWriter<std::endian::little> writer2{&mem_resource2};
+    writer2.write(zisc::uint32b{7});
+    writer2 = std::move(writer1);
+    ASSERT_TRUE(writer2.isGrowable());
+    ASSERT_EQ(sizeof(zisc::uint32b) * values.size(), writer2.size());
+    ASSERT_EQ(0, mem_resource2.totalMemoryUsage())
+        << "The buffer isn't taken over from the other.";
+    writer2.write(zisc::uint32b{101});
+    values.push_back(101);
+    {
+      zisc::BinaryReader<std::endian::little> reader{writer2.data()};
+      std::vector<zisc::uint32b> results(values.size());
+      reader.read(std::span{results});
+      ASSERT_EQ(values, results);
+    }
+
+    // A growable writer into a fixed region writer
+    zisc::BinaryWriter<std::endian::little> writer3{std::span{region}};
+    writer3.write(zisc::uint32b{1});
+    writer3 = std::move(writer2);
+    ASSERT_TRUE(writer3.isGrowable());
+    ASSERT_EQ(sizeof(zisc::uint32b) * values.size(), writer3.size());
+    writer3.write(zisc::uint32b{102});
+
+    // A fixed region writer into a growable writer
+    zisc::BinaryWriter<std::endian::little> writer4{std::span{region}};
+    writer4.write(zisc::uint32b{3});
+    writer3 = std::move(writer4);
+    ASSERT_FALSE(writer3.isGrowable());
+    ASSERT_EQ(region.size(), writer3.capacity());
+    writer3.write(zisc::uint32b{4});
+    ASSERT_THROW(writer3.write(zisc::uint32b{5}), zisc::SystemError);
+    zisc::BinaryReader<std::endian::little> reader{writer3.data()};
+    ASSERT_EQ(3, reader.read<zisc::uint32b>());
+    ASSERT_EQ(4, reader.read<zisc::uint32b>());
+  }
+  ASSERT_EQ(0, mem_resource1.totalMemoryUsage())
+      << mem_resource1.totalMemoryUsage() << " bytes isn't deallocated.";
+  ASSERT_EQ(0, mem_resource2.totalMemoryUsage())
+      << mem_resource2.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(BinarySerializerTest, BufferEndianTest)
+{
+  std::array<std::byte, 24> region{};
+  zisc::BinaryWriter<std::endian::big> writer{std::span{region}};
+  ASSERT_FALSE(writer.isGrowable());
+  writer.write(zisc::uint16b{0x0102});
+  const std::array<zisc::uint32b, 2> values{{0x0a0b'0c0du, 0x1121'3141u}};
+  writer.write(std::span{values});
+  writer.write(-0.75);
+  ASSERT_EQ(18, writer.size());
+  const std::array<std::byte, 4> expected{{std::byte{0x0a}, std::byte{0x0b},
+                                           std::byte{0x0c}, std::byte{0x0d}}};
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(expected[i], region[2 + i]);
+  ASSERT_EQ(std::byte{0x01}, region[0]);
+  ASSERT_EQ(std::byte{0xbf}, region[10]) << "The sign of the double isn't first.";
+
+  // The fixed region overflows
+  ASSERT_THROW(writer.write(std::span{values}.subspan(0, 2)), zisc::SystemError);
+  ASSERT_EQ(18, writer.size());
+
+  zisc::BinaryReader<std::endian::big> reader{writer.data()};
+  ASSERT_EQ(0x0102, reader.read<zisc::uint16b>());
+  std::array<zisc::uint32b, 2> results{};
+  reader.read(std::span{results});
+  ASSERT_EQ(values, results);
+  ASSERT_DOUBLE_EQ(-0.75, reader.read<double>());
+  ASSERT_TRUE(reader.isEnd());
+}
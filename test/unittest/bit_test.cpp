@@ -867,3 +867,20 @@ TEST(BitTest, BitwiseRightRotating64Test)
 {
   ::testBitwiseRightRotating<zisc::uint64b>();
 }
+
+TEST(BitTest, ByteswapTest)
+{
+  static_assert(zisc::byteswap(zisc::uint8b{0x12}) == 0x12);
+  static_assert(zisc::byteswap(zisc::uint16b{0x1234}) == 0x3412);
+  static_assert(zisc::byteswap(zisc::uint32b{0x1234'5678u}) == 0x7856'3412u);
+  static_assert(zisc::byteswap(zisc::uint64b{0x0123'4567'89ab'cdefull}) ==
+                0xefcd'ab89'6745'2301ull);
+  static_assert(zisc::byteswap(zisc::int16b{-2}) == zisc::int16b{-257});
+
+  for (const double value : {0.0, -1.5, 3.14159, std::numeric_limits<double>::max()}) {
+    const double swapped = zisc::byteswap(value);
+    const auto expected = zisc::byteswap(zisc::bit_cast<zisc::uint64b>(value));
+    ASSERT_EQ(expected, zisc::bit_cast<zisc::uint64b>(swapped));
+    ASSERT_EQ(value, zisc::byteswap(swapped)) << "zisc::byteswap(" << value << ") failed.";
+  }
+}
@@ -0,0 +1,138 @@
+/*!
+  \file columnar_csv_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// GoogleTest
+#include "googletest.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+// Zisc
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/columnar_csv.hpp"
+#include "zisc/string/csv.hpp"
+#include "zisc/string/csv_parse_error.hpp"
+
+TEST(ColumnarCsvTest, MoveTest)
+{
+  using Csv = zisc::ColumnarCsv<std::string_view, int, double, bool>;
+  zisc::AllocFreeResource mem_resource;
+  {
+    std::unique_ptr<Csv> csv_ptr;
+    {
+      Csv csv{&mem_resource};
+      csv.setCapacity(256);
+      csv.append(R"("a", 1, 1.0, true)");
+      csv_ptr = std::make_unique<Csv>(std::move(csv));
+      ASSERT_EQ(0, csv.rowSize()) << "Moving CSV data failed.";
+    }
+    ASSERT_EQ(256, csv_ptr->capacity()) << "Moving CSV data failed.";
+    ASSERT_EQ(1, csv_ptr->rowSize()) << "Moving CSV data failed.";
+    {
+      Csv csv{&mem_resource};
+      csv.setCapacity(1024);
+      *csv_ptr = std::move(csv);
+    }
+    ASSERT_EQ(1024, csv_ptr->capacity()) << "Moving CSV data failed.";
+    ASSERT_EQ(0, csv_ptr->rowSize()) << "Moving CSV data failed.";
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(ColumnarCsvTest, ParseCsvTest)
+{
+  using Csv = zisc::Csv<int, std::string_view, double, bool, const char*>;
+  using ColumnarCsv = zisc::ColumnarCsv<int, std::string_view, double, bool, const char*>;
+
+  std::string text;
+  for (int i = 0; i < 100; ++i) {
+    text += std::to_string(i) + R"(, "name )" + std::to_string(i) + R"(", )" +
+            std::to_string(0.25 * i) + ", " + (((i % 3) == 0) ? "true" : "false") +
+            R"(, "esc""aped\n)" + std::to_string(i) + "\"\n";
+  }
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    Csv csv{&mem_resource};
+    csv.append(text);
+    ColumnarCsv columnar_csv{&mem_resource};
+    std::istringstream csv_stream{text};
+    columnar_csv.append(csv_stream);
+    ASSERT_EQ(csv.rowSize(), columnar_csv.rowSize()) << "Parsing csv failed.";
+    for (std::size_t row = 0; row < csv.rowSize(); ++row) {
+      ASSERT_EQ(csv.get<0>(row), columnar_csv.get<0>(row)) << "Parsing csv failed.";
+      ASSERT_EQ(csv.get<1>(row), columnar_csv.get<1>(row)) << "Parsing csv failed.";
+      ASSERT_EQ(csv.get<2>(row), columnar_csv.get<2>(row)) << "Parsing csv failed.";
+      ASSERT_EQ(csv.get<3>(row), columnar_csv.get<3>(row)) << "Parsing csv failed.";
+      ASSERT_STREQ(csv.get<4>(row), columnar_csv.get<4>(row)) << "Parsing csv failed.";
+    }
+
+    // Scan columns
+    const std::span<const int> ints = columnar_csv.column<0>();
+    ASSERT_EQ(100, ints.size());
+    ASSERT_EQ(4950, std::accumulate(ints.begin(), ints.end(), 0));
+    const std::span<const double> floats = columnar_csv.column<2>();
+    ASSERT_DOUBLE_EQ(0.25 * 4950.0, std::accumulate(floats.begin(), floats.end(), 0.0));
+    const std::span<const zisc::uint8b> bools = columnar_csv.column<3>();
+    ASSERT_EQ(34, std::accumulate(bools.begin(), bools.end(), 0));
+
+    // Strings are stored as offsets and bytes
+    const std::span<const std::size_t> offsets = columnar_csv.offsets<1>();
+    const std::span<const char> bytes = columnar_csv.column<1>();
+    ASSERT_EQ(100, offsets.size());
+    ASSERT_EQ(0, offsets[0]);
+    ASSERT_EQ("name 0", std::string_view{bytes.data() + offsets[0]});
+    ASSERT_EQ("name 99", std::string_view{bytes.data() + offsets[99]});
+    ASSERT_EQ('\0', bytes.back());
+
+    columnar_csv.clear();
+    ASSERT_EQ(0, columnar_csv.rowSize());
+    ASSERT_TRUE(columnar_csv.column<1>().empty());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(ColumnarCsvTest, MalformedRecordTest)
+{
+  using Csv = zisc::ColumnarCsv<int, std::string_view, double>;
+  zisc::AllocFreeResource mem_resource;
+  {
+    Csv csv{&mem_resource};
+    std::size_t line_number = 0;
+    std::size_t column = 0;
+    try {
+      csv.append("1, \"a\", 1.0\n2, \"b\", x\n");
+    }
+    catch (const zisc::CsvParseError& error) {
+      line_number = error.lineNumber();
+      column = error.column();
+    }
+    ASSERT_EQ(2, line_number);
+    ASSERT_EQ(2, column);
+    // No partial row remains
+    ASSERT_EQ(1, csv.rowSize());
+    ASSERT_EQ(1, csv.column<0>().size());
+    ASSERT_EQ(1, csv.offsets<1>().size());
+    ASSERT_EQ(1, csv.column<2>().size());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
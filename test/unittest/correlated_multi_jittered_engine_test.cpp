@@ -13,9 +13,15 @@
   */
 
 // Standard C++ library
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
+#include <span>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 // GoogleTest
 #include "googletest.hpp"
 // Zisc
@@ -23,6 +29,7 @@
 #include "zisc/zisc_config.hpp"
 #include "zisc/hash/fnv_1a_hash_engine.hpp"
 #include "zisc/random/correlated_multi_jittered_engine.hpp"
+#include "zisc/random/dynamic_correlated_multi_jittered_engine.hpp"
 
 namespace {
 
@@ -84,3 +91,88 @@ void testCmjEngine(const std::string_view reference_file_path)
 
 CMJ_TEST(CmjN64, "resources/cmj_n64_reference.txt")
 CMJ_TEST(CmjN81, "resources/cmj_n81_reference.txt")
+
+namespace {
+
+template <typename Float, typename Engine>
+void testCmjBatch(const Engine& engine)
+{
+  using ValueT = zisc::uint32b;
+  const std::size_t n = engine.getPeriod();
+  const std::array<ValueT, 3> patterns = {{zisc::Fnv1aHash32::hash(ValueT{1}),
+                                           zisc::Fnv1aHash32::hash(ValueT{2}),
+                                           zisc::Fnv1aHash32::hash(ValueT{3})}};
+
+  // Batch samples are identical to scalar samples
+  for (const ValueT first : {ValueT{0}, zisc::cast<ValueT>(n / 3)}) {
+    for (std::size_t size : {std::size_t{1}, std::size_t{63}, std::size_t{200}}) {
+      size = (std::min)(size, n - first);
+      const ValueT p = patterns[0];
+      std::vector<Float> samples1d(size);
+      std::vector<std::array<Float, 2>> samples2d(size);
+      engine.generate1d(first, p, std::span{samples1d});
+      engine.generate2d(first, p, std::span{samples2d});
+      for (std::size_t i = 0; i < size; ++i) {
+        const ValueT s = first + zisc::cast<ValueT>(i);
+        ASSERT_EQ(engine.template generate1d<Float>(s, p), samples1d[i])
+            << "generate1d(" << s << ") is wrong.";
+        ASSERT_EQ(engine.template generate2d<Float>(s, p), samples2d[i])
+            << "generate2d(" << s << ") is wrong.";
+      }
+    }
+  }
+
+  // All N samples of each pattern are identical to scalar samples
+  std::vector<Float> samples1d(patterns.size() * n);
+  std::vector<std::array<Float, 2>> samples2d(patterns.size() * n);
+  engine.generate1d(std::span<const ValueT>{patterns}, std::span{samples1d});
+  engine.generate2d(std::span<const ValueT>{patterns}, std::span{samples2d});
+  for (std::size_t k = 0; k < patterns.size(); ++k) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const std::size_t s = k * n + i;
+      ASSERT_EQ(engine.template generate1d<Float>(zisc::cast<ValueT>(i), patterns[k]), samples1d[s]);
+      ASSERT_EQ(engine.template generate2d<Float>(zisc::cast<ValueT>(i), patterns[k]), samples2d[s]);
+    }
+  }
+
+  // All N samples of each pattern are stratified.
+  // Float samples aren't checked since they can be rounded up to the next stratum
+  if constexpr (std::is_same_v<Float, double>) {
+    for (std::size_t k = 0; k < patterns.size(); ++k) {
+      std::vector<int> strata(3 * n, 0);
+      for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t s = k * n + i;
+        ++strata[zisc::cast<std::size_t>(samples1d[s] * zisc::cast<Float>(n))];
+        ++strata[n + zisc::cast<std::size_t>(samples2d[s][0] * zisc::cast<Float>(n))];
+        ++strata[2 * n + zisc::cast<std::size_t>(samples2d[s][1] * zisc::cast<Float>(n))];
+      }
+      for (std::size_t i = 0; i < strata.size(); ++i)
+        ASSERT_EQ(1, strata[i]) << "The stratum " << i << " of pattern " << k << " is wrong.";
+    }
+  }
+}
+
+} // namespace
+
+TEST(RandomNumberEngine, CmjBatchTest)
+{
+  ::testCmjBatch<double>(zisc::CmjN16{});
+  ::testCmjBatch<double>(zisc::CmjN64{});
+  ::testCmjBatch<double>(zisc::CmjN81{});
+  ::testCmjBatch<float>(zisc::CmjN256{});
+  for (const zisc::uint32b root_n : {1u, 2u, 7u, 9u, 16u, 33u, 100u}) {
+    const zisc::DynamicCmj engine{root_n};
+    ASSERT_EQ(root_n, engine.rootN());
+    ::testCmjBatch<double>(engine);
+    ::testCmjBatch<float>(engine);
+  }
+
+  // The dynamic engine is identical to the engine of the same root N
+  const zisc::DynamicCmj engine{9};
+  for (zisc::uint32b i = 0; i < 1000; ++i) {
+    const zisc::uint32b s = i % 81;
+    const zisc::uint32b p = zisc::Fnv1aHash32::hash(i / 81);
+    ASSERT_EQ(zisc::CmjN81::generate1d<double>(s, p), engine.generate1d<double>(s, p));
+    ASSERT_EQ(zisc::CmjN81::generate2d<double>(s, p), engine.generate2d<double>(s, p));
+  }
+}
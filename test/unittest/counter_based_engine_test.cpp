@@ -0,0 +1,158 @@
+/*!
+  \file counter_based_engine_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <cstddef>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/random/philox_engine.hpp"
+#include "zisc/random/threefry_engine.hpp"
+
+namespace {
+
+template <typename Engine>
+void testCounterBasedEngineBatch(const typename Engine::CounterT& first)
+{
+  using ValueT = typename Engine::ValueT;
+  constexpr std::size_t s = Engine::counterSize();
+  const Engine engine{Engine::makeKey(123456789)};
+
+  // Sizes which aren't a multiple of the counter or the SIMD width are mixed
+  for (const std::size_t size : {std::size_t{0}, std::size_t{3}, std::size_t{4},
+                                 std::size_t{37}, std::size_t{64}, std::size_t{1001}}) {
+    std::vector<ValueT> values(size);
+    engine.generate(first, values);
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto expected = engine(Engine::advanceCounter(first, i / s));
+      ASSERT_EQ(expected[i % s], values[i]) << "generate[" << i << "] is wrong.";
+    }
+
+    std::vector<double> values01(size);
+    engine.template generate01<double>(first, values01);
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto expected = engine.template generate01<double>(Engine::advanceCounter(first, i / s));
+      ASSERT_EQ(expected[i % s], values01[i]) << "generate01[" << i << "] is wrong.";
+      ASSERT_TRUE((0.0 <= values01[i]) && (values01[i] < 1.0));
+    }
+  }
+}
+
+template <typename Engine>
+void testCounterBasedEngineParallel()
+{
+  using ValueT = typename Engine::ValueT;
+  constexpr std::size_t n = 1000;
+  const Engine engine{Engine::makeKey(42)};
+
+  std::vector<ValueT> expected(n * Engine::counterSize());
+  engine.generate(Engine::makeCounter(0, 7), expected);
+
+  // Each iteration generates its own random numbers from its index
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{4, &mem_resource};
+    std::vector<ValueT> values(expected.size());
+    auto task = [&engine, &values](const std::size_t i, const zisc::int64b)
+    {
+      const auto result = engine(Engine::makeCounter(i, 7));
+      for (std::size_t j = 0; j < result.size(); ++j)
+        values[i * result.size() + j] = result[j];
+    };
+    auto result = thread_manager.enqueueLoop(task, std::size_t{0}, n);
+    result.wait();
+    ASSERT_EQ(expected, values) << "The results depend on the scheduling.";
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+} // namespace
+
+TEST(CounterBasedEngineTest, CounterTest)
+{
+  using Engine = zisc::Philox4x32;
+  using CounterT = Engine::CounterT;
+  ASSERT_EQ((CounterT{{0x89abcdefU, 0x01234567U, 3U, 0U}}),
+            Engine::makeCounter(0x0123'4567'89ab'cdefULL, 3));
+  ASSERT_EQ((Engine::KeyT{{0x89abcdefU, 0x01234567U}}),
+            Engine::makeKey(0x0123'4567'89ab'cdefULL));
+  // Carry
+  ASSERT_EQ((CounterT{{1U, 0U, 0U, 1U}}),
+            Engine::advanceCounter(CounterT{{0xffffffffU, 0xffffffffU, 0xffffffffU, 0U}}, 2));
+  ASSERT_EQ((CounterT{{0xfffffffeU, 1U, 0U, 0U}}),
+            Engine::advanceCounter(CounterT{{0xffffffffU, 0U, 0U, 0U}}, 0xffffffffULL));
+
+  using Engine64 = zisc::Threefry4x64;
+  using Counter64T = Engine64::CounterT;
+  ASSERT_EQ((Counter64T{{5U, 9U, 0U, 0U}}), Engine64::makeCounter(5, 9));
+  ASSERT_EQ((Counter64T{{1U, 0U, 1U, 0U}}),
+            Engine64::advanceCounter(Counter64T{{~0ULL, ~0ULL, 0U, 0U}}, 2));
+}
+
+TEST(CounterBasedEngineTest, PhiloxKnownAnswerTest)
+{
+  // The known answers of Random123
+  using Engine = zisc::Philox4x32;
+  ASSERT_EQ((Engine::CounterT{{0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U}}),
+            Engine{}(Engine::CounterT{{0U, 0U, 0U, 0U}}));
+  const Engine engine1{Engine::KeyT{{0xffffffffU, 0xffffffffU}}};
+  ASSERT_EQ((Engine::CounterT{{0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU}}),
+            engine1(Engine::CounterT{{0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU}}));
+  const Engine engine2{Engine::KeyT{{0xa4093822U, 0x299f31d0U}}};
+  ASSERT_EQ((Engine::CounterT{{0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U}}),
+            engine2(Engine::CounterT{{0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U}}));
+}
+
+TEST(CounterBasedEngineTest, ThreefryKnownAnswerTest)
+{
+  // The known answers of Random123
+  using Engine = zisc::Threefry4x64;
+  ASSERT_EQ((Engine::CounterT{{0x09218ebde6c85537ULL, 0x55941f5266d86105ULL,
+                               0x4bd25e16282434dcULL, 0xee29ec846bd2e40bULL}}),
+            Engine{}(Engine::CounterT{{0U, 0U, 0U, 0U}}));
+  constexpr zisc::uint64b f = ~0ULL;
+  const Engine engine1{Engine::KeyT{{f, f, f, f}}};
+  ASSERT_EQ((Engine::CounterT{{0x29c24097942bba1bULL, 0x0371bbfb0f6f4e11ULL,
+                               0x3c231ffa33f83a1cULL, 0xcd29113fde32d168ULL}}),
+            engine1(Engine::CounterT{{f, f, f, f}}));
+  const Engine engine2{Engine::KeyT{{0x452821e638d01377ULL, 0xbe5466cf34e90c6cULL,
+                                     0xbe5466cf34e90c6cULL, 0xc0ac29b7c97c50ddULL}}};
+  ASSERT_EQ((Engine::CounterT{{0xa7e8fde591651bd9ULL, 0xbaafd0c30138319bULL,
+                               0x84a5c1a729e685b9ULL, 0x901d406ccebc1ba4ULL}}),
+            engine2(Engine::CounterT{{0x243f6a8885a308d3ULL, 0x13198a2e03707344ULL,
+                                      0xa4093822299f31d0ULL, 0x082efa98ec4e6c89ULL}}));
+}
+
+TEST(CounterBasedEngineTest, PhiloxBatchTest)
+{
+  ::testCounterBasedEngineBatch<zisc::Philox4x32>(zisc::Philox4x32::makeCounter(1000));
+  // The lower words carry in the middle of the batch
+  ::testCounterBasedEngineBatch<zisc::Philox4x32>({{0xfffffff0U, 0xffffffffU, 3U, 0U}});
+}
+
+TEST(CounterBasedEngineTest, ThreefryBatchTest)
+{
+  ::testCounterBasedEngineBatch<zisc::Threefry4x64>(zisc::Threefry4x64::makeCounter(1000));
+  ::testCounterBasedEngineBatch<zisc::Threefry4x64>({{~0ULL - 5, ~0ULL, 3U, 0U}});
+}
+
+TEST(CounterBasedEngineTest, ParallelTest)
+{
+  ::testCounterBasedEngineParallel<zisc::Philox4x32>();
+  ::testCounterBasedEngineParallel<zisc::Threefry4x64>();
+}
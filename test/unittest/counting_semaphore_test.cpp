@@ -0,0 +1,73 @@
+/*!
+  \file counting_semaphore_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/counting_semaphore.hpp"
+
+TEST(CountingSemaphoreTest, TryAcquireTest)
+{
+  zisc::CountingSemaphore semaphore{2};
+  ASSERT_EQ(2, semaphore.count());
+  ASSERT_TRUE(semaphore.tryAcquire());
+  ASSERT_TRUE(semaphore.tryAcquire());
+  ASSERT_FALSE(semaphore.tryAcquire()) << "The semaphore was acquired over the count.";
+  ASSERT_EQ(0, semaphore.count());
+  semaphore.release(2);
+  ASSERT_EQ(2, semaphore.count());
+}
+
+TEST(CountingSemaphoreTest, ConcurrentAcquireTest)
+{
+  constexpr std::size_t num_of_threads = 8;
+  constexpr int num_of_loops = 10'000;
+  constexpr int max_holders = 3;
+
+  zisc::CountingSemaphore semaphore{max_holders};
+  std::atomic<int> num_of_holders{0};
+  std::atomic<int> max_num_of_holders{0};
+  std::atomic<int> total{0};
+  auto job = [&]()
+  {
+    for (int i = 0; i < num_of_loops; ++i) {
+      semaphore.acquire();
+      const int n = num_of_holders.fetch_add(1, std::memory_order::acq_rel) + 1;
+      int m = max_num_of_holders.load(std::memory_order::acquire);
+      while ((m < n) && !max_num_of_holders.compare_exchange_weak(m, n)) {
+      }
+      total.fetch_add(1, std::memory_order::relaxed);
+      num_of_holders.fetch_sub(1, std::memory_order::acq_rel);
+      semaphore.release();
+    }
+  };
+
+  std::vector<std::thread> worker_list;
+  worker_list.reserve(num_of_threads);
+  for (std::size_t i = 0; i < num_of_threads; ++i)
+    worker_list.emplace_back(job);
+  for (std::thread& worker : worker_list)
+    worker.join();
+
+  ASSERT_EQ(num_of_threads * num_of_loops, static_cast<std::size_t>(total.load()));
+  ASSERT_LE(max_num_of_holders.load(), max_holders)
+      << "Too many threads held the semaphore at once.";
+  ASSERT_EQ(max_holders, semaphore.count());
+}
@@ -0,0 +1,188 @@
+/*!
+  \file csv_reader_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// GoogleTest
+#include "googletest.hpp"
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+// Zisc
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/csv.hpp"
+#include "zisc/string/csv_parse_error.hpp"
+#include "zisc/string/csv_reader.hpp"
+#include "zisc/structure/lock_free_queue.hpp"
+
+namespace {
+
+std::string makeCsvText(const int num_of_records)
+{
+  std::string text;
+  for (int i = 0; i < num_of_records; ++i) {
+    text += std::to_string(i) + ", ";
+    text += ((i % 3) == 0) ? R"("multi
+line, ""quoted"" \"field\"")" : R"("value)" + std::to_string(i) + "\"";
+    text += ", " + std::to_string(0.5 * i) + ", \"copy" + std::to_string(i) + "\"\n";
+    if ((i % 7) == 0)
+      text += "\n  \n";
+  }
+  return text;
+}
+
+} // namespace
+
+TEST(CsvReaderTest, ReadTest)
+{
+  using Csv = zisc::Csv<int, std::string_view, double, const char*>;
+  using CsvReader = zisc::CsvReader<int, std::string_view, double, const char*>;
+
+  const std::string text = ::makeCsvText(500);
+  zisc::AllocFreeResource mem_resource;
+  {
+    Csv csv{&mem_resource};
+    csv.append(text);
+    // Records cross the buffer boundaries
+    for (const std::size_t buffer_size : {std::size_t{80}, std::size_t{100}, std::size_t{4096}}) {
+      std::istringstream csv_stream{text};
+      CsvReader reader{csv_stream, &mem_resource, buffer_size};
+      std::size_t row = 0;
+      for (; reader.next(); ++row) {
+        ASSERT_LT(row, csv.rowSize());
+        ASSERT_EQ(csv.get<0>(row), reader.get<0>()) << "buffer_size=" << buffer_size;
+        ASSERT_EQ(csv.get<1>(row), reader.get<1>()) << "buffer_size=" << buffer_size;
+        ASSERT_EQ(csv.get<2>(row), reader.get<2>()) << "buffer_size=" << buffer_size;
+        ASSERT_STREQ(csv.get<3>(row), reader.get<3>()) << "buffer_size=" << buffer_size;
+      }
+      ASSERT_EQ(csv.rowSize(), row) << "buffer_size=" << buffer_size;
+      ASSERT_FALSE(reader.next());
+    }
+  }
+  {
+    // Input iterator
+    std::istringstream csv_stream{"1, \"a\", 1.0, \"x\"\n2, \"b\", 2.0, \"y\""};
+    CsvReader reader{csv_stream, &mem_resource, 32};
+    int sum = 0;
+    for (const CsvReader::RecordType& record : reader)
+      sum += std::get<0>(record);
+    ASSERT_EQ(3, sum);
+  }
+  {
+    // Visitor which stops reading
+    std::istringstream csv_stream{text};
+    CsvReader reader{csv_stream, &mem_resource, 256};
+    std::size_t line_number = 0;
+    const std::size_t n = reader.forEach([&reader, &line_number](const CsvReader::RecordType& record)
+    {
+      line_number = reader.lineNumber();
+      return std::get<0>(record) < 9;
+    });
+    ASSERT_EQ(10, n);
+    ASSERT_EQ(17, line_number) << "The line number of the record is wrong.";
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(CsvReaderTest, MalformedRecordTest)
+{
+  using CsvReader = zisc::CsvReader<int, std::string_view, double>;
+
+  zisc::AllocFreeResource mem_resource;
+  auto get_error_line = [&mem_resource](const std::string& text,
+                                        const std::size_t buffer_size) -> std::size_t
+  {
+    std::istringstream csv_stream{text};
+    CsvReader reader{csv_stream, &mem_resource, buffer_size};
+    try {
+      while (reader.next());
+    }
+    catch (const zisc::CsvParseError& error) {
+      return error.lineNumber();
+    }
+    return 0;
+  };
+
+  std::string text;
+  for (int i = 0; i < 20; ++i)
+    text += std::to_string(i) + ", \"a\nb\", 1.0\n";
+  ASSERT_EQ(0, get_error_line(text, 32));
+  ASSERT_EQ(41, get_error_line(text + "20, \"c\", x\n", 32));
+  ASSERT_EQ(41, get_error_line(text + "20, \"unterminated, 1.0\n", 32));
+  // A record longer than the buffer
+  ASSERT_EQ(41, get_error_line(text + "20, \"" + std::string(100, 'x') + "\", 1.0\n", 32));
+  ASSERT_EQ(0, get_error_line(text + "20, \"" + std::string(100, 'x') + "\", 1.0\n", 256));
+
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(CsvReaderTest, BackpressureTest)
+{
+  using CsvReader = zisc::CsvReader<int, double>;
+  using Queue = zisc::ScalableCircularQueue<std::tuple<int, double>>;
+
+  constexpr int num_of_records = 10'000;
+  std::string text;
+  for (int i = 0; i < num_of_records; ++i)
+    text += std::to_string(i) + ", " + std::to_string(0.5 * i) + "\n";
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{2, &mem_resource};
+    Queue queue{8, &mem_resource};
+    std::atomic_bool is_finished{false};
+    std::atomic<long long> sum{0};
+
+    // Workers consume the records
+    auto consume = [&queue, &is_finished, &sum]([[maybe_unused]] const zisc::int64b thread_id)
+    {
+      while (true) {
+        const bool is_last = is_finished.load(std::memory_order::acquire);
+        if (const auto record = queue.dequeue(); record.has_value())
+          sum.fetch_add(std::get<0>(*record), std::memory_order::relaxed);
+        else if (is_last)
+          break;
+        else
+          std::this_thread::yield();
+      }
+    };
+    auto result1 = thread_manager.enqueue(consume);
+    auto result2 = thread_manager.enqueue(consume);
+
+    // The reader waits while the queue is full
+    std::istringstream csv_stream{text};
+    CsvReader reader{csv_stream, &mem_resource, 128};
+    const std::size_t n = reader.forEach([&queue](const CsvReader::RecordType& record)
+    {
+      while (queue.capacity() <= queue.size())
+        std::this_thread::yield();
+      [[maybe_unused]] const auto index = queue.enqueue(record);
+    });
+    is_finished.store(true, std::memory_order::release);
+    result1.wait();
+    result2.wait();
+
+    ASSERT_EQ(num_of_records, n);
+    const long long expected = (static_cast<long long>(num_of_records) * (num_of_records - 1)) / 2;
+    ASSERT_EQ(expected, sum.load());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
@@ -15,14 +15,22 @@
 // GoogleTest
 #include "googletest.hpp"
 // Standard C++ library
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <list>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <sstream>
 #include <utility>
 // Zisc
+#include "zisc/concurrency/thread_manager.hpp"
 #include "zisc/memory/alloc_free_resource.hpp"
 #include "zisc/string/csv.hpp"
+#include "zisc/string/csv_parse_error.hpp"
+#include "zisc/string/csv_tokenizer.hpp"
 
 TEST(CsvTest, MoveTest)
 {
@@ -47,10 +55,6 @@ TEST(CsvTest, ParseCsvTest1)
 {
   using Csv = zisc::Csv<std::string_view, int, double, bool>;
 
-  const auto pattern = Csv::csvPattern();
-  std::cout << "CSV<string_view, int, double, bool> pattern: " << pattern.toCStr()
-            << std::endl;
-
   std::istringstream csv_text;
   {
     std::ostringstream csv_output;
@@ -81,10 +85,6 @@ TEST(CsvTest, ParseCsvTest2)
 {
   using Csv = zisc::Csv<char, unsigned long, float, const char*>;
 
-  const auto pattern = Csv::csvPattern();
-  std::cout << "CSV<char, ulong, float, char*> pattern: " << pattern.toCStr()
-            << std::endl;
-
   std::istringstream csv_text;
   {
     std::ostringstream csv_output;
@@ -110,3 +110,176 @@ TEST(CsvTest, ParseCsvTest2)
   EXPECT_FLOAT_EQ(4.56f, csv.get<2>(1)) << "Parsing csv failed.";
   EXPECT_STREQ(" CSVtest2 ", csv.get<3>(1)) << "Parsing csv failed.";
 }
+
+TEST(CsvTest, QuotedFieldTest)
+{
+  using Csv = zisc::Csv<int, std::string_view, double>;
+
+  const std::string_view csv_text =
+      "1, \"comma, in a field\", 1.5\r\n"
+      "\n"
+      "2, \"doubled \"\"quote\"\" and escaped \\\"quote\\\"\", -2.5e3\n"
+      "3, \"line\nfeed\", 0\n"
+      "4, \"\", 0.25";
+
+  zisc::AllocFreeResource mem_resource;
+  Csv csv{&mem_resource};
+  csv.append(csv_text);
+
+  ASSERT_EQ(4, csv.rowSize());
+  EXPECT_EQ(1, csv.get<0>(0)) << "Parsing csv failed.";
+  EXPECT_EQ("comma, in a field", csv.get<1>(0)) << "Parsing csv failed.";
+  EXPECT_DOUBLE_EQ(1.5, csv.get<2>(0)) << "Parsing csv failed.";
+  EXPECT_EQ(R"(doubled "quote" and escaped "quote")", csv.get<1>(1))
+      << "Parsing csv failed.";
+  EXPECT_DOUBLE_EQ(-2.5e3, csv.get<2>(1)) << "Parsing csv failed.";
+  EXPECT_EQ("line\nfeed", csv.get<1>(2)) << "Parsing csv failed.";
+  EXPECT_EQ(4, csv.get<0>(3)) << "Parsing csv failed.";
+  EXPECT_TRUE(csv.get<1>(3).empty()) << "Parsing csv failed.";
+}
+
+TEST(CsvTest, MalformedRecordTest)
+{
+  using Csv = zisc::Csv<int, std::string_view, double>;
+  zisc::AllocFreeResource mem_resource;
+
+  auto get_error_line = [&mem_resource](const std::string_view csv_text,
+                                        std::size_t* column) -> std::size_t
+  {
+    Csv csv{&mem_resource};
+    try {
+      csv.append(csv_text);
+    }
+    catch (const zisc::CsvParseError& error) {
+      *column = error.column();
+      return error.lineNumber();
+    }
+    return 0;
+  };
+
+  std::size_t column = 0;
+  // Too few fields
+  ASSERT_EQ(2, get_error_line("1, \"a\", 1.0\n2, \"b\"\n", &column));
+  ASSERT_EQ(2, column);
+  // Too many fields
+  ASSERT_EQ(1, get_error_line("1, \"a\", 1.0, 4\n", &column));
+  ASSERT_EQ(3, column);
+  // Type mismatch
+  ASSERT_EQ(3, get_error_line("1, \"a\", 1.0\n\n1.5, \"b\", 2.0\n", &column));
+  ASSERT_EQ(0, column);
+  ASSERT_EQ(1, get_error_line("1, b, 2.0\n", &column));
+  ASSERT_EQ(1, column);
+  ASSERT_EQ(1, get_error_line("1, \"b\", 2.\n", &column));
+  ASSERT_EQ(2, column);
+  // Unterminated quote
+  ASSERT_EQ(2, get_error_line("1, \"a\", 1.0\n2, \"b, 2.0\n", &column));
+  ASSERT_EQ(1, column);
+  // Garbage after a quoted field
+  ASSERT_EQ(1, get_error_line("1, \"a\"b, 1.0\n", &column));
+  // Quote in an unquoted field
+  ASSERT_EQ(1, get_error_line("1, a\"b, 1.0\n", &column));
+  // The line number is counted after a quoted line feed
+  ASSERT_EQ(3, get_error_line("1, \"a\nb\", 1.0\n2, \"c\", x\n", &column));
+  ASSERT_EQ(2, column);
+
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(CsvTest, AppendFileTest)
+{
+  using Csv = zisc::Csv<int, std::string_view, const char*>;
+
+  const std::filesystem::path file_path = std::filesystem::temp_directory_path() /
+                                          "zisc_csv_append_file_test.csv";
+  const std::string long_value(1000, 'x');
+  {
+    std::ofstream file{file_path, std::ios_base::binary};
+    file << R"(1, "view", "copy")" << "\n";
+    file << R"(2, "escaped ""quote""", "a")" << "\n";
+    file << "3, \"" << long_value << "\", \"" << long_value << "\"\n";
+  }
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    Csv csv{&mem_resource};
+    csv.appendFile(file_path);
+    ASSERT_EQ(3, csv.rowSize());
+    EXPECT_EQ("view", csv.get<1>(0)) << "Parsing csv failed.";
+    EXPECT_STREQ("copy", csv.get<2>(0)) << "Parsing csv failed.";
+    EXPECT_EQ(R"(escaped "quote")", csv.get<1>(1)) << "Parsing csv failed.";
+    EXPECT_EQ(long_value, csv.get<1>(2)) << "Parsing a long line failed.";
+    EXPECT_STREQ(long_value.c_str(), csv.get<2>(2)) << "Parsing a long line failed.";
+
+    // Views are kept valid by move
+    Csv moved_csv{std::move(csv)};
+    EXPECT_EQ("view", moved_csv.get<1>(0)) << "Moving csv failed.";
+    EXPECT_EQ(R"(escaped "quote")", moved_csv.get<1>(1)) << "Moving csv failed.";
+
+    // Lines of any length can be read from a stream
+    std::ifstream file{file_path, std::ios_base::binary};
+    moved_csv.append(file);
+    ASSERT_EQ(6, moved_csv.rowSize());
+    EXPECT_EQ(long_value, moved_csv.get<1>(5)) << "Parsing a long line failed.";
+  }
+  std::filesystem::remove(file_path);
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(CsvTest, ParallelAppendTest)
+{
+  using Csv = zisc::Csv<int, std::string_view, double>;
+
+  // Quoted line feeds and commas cross chunk boundaries
+  std::string text;
+  for (int i = 0; i < 2000; ++i) {
+    text += std::to_string(i) + ", ";
+    text += ((i % 3) == 0) ? "\"multi\nline,\n\"\"field\"\"\"" : "\"value\"";
+    text += ", " + std::to_string(0.5 * i) + "\n";
+    if ((i % 7) == 0)
+      text += "\n";
+  }
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{4, &mem_resource};
+    Csv expected{&mem_resource};
+    expected.append(text);
+    for (const std::size_t chunk_size : {std::size_t{1}, std::size_t{7}, std::size_t{64}, std::size_t{1000}}) {
+      Csv csv{&mem_resource};
+      csv.appendParallel(text, thread_manager, chunk_size);
+      ASSERT_EQ(expected.rowSize(), csv.rowSize()) << "chunk_size=" << chunk_size;
+      for (std::size_t row = 0; row < csv.rowSize(); ++row) {
+        ASSERT_EQ(expected.get<0>(row), csv.get<0>(row)) << "chunk_size=" << chunk_size;
+        ASSERT_EQ(expected.get<1>(row), csv.get<1>(row)) << "chunk_size=" << chunk_size;
+        ASSERT_EQ(expected.get<2>(row), csv.get<2>(row)) << "chunk_size=" << chunk_size;
+      }
+    }
+
+    // The line number of an error is the same as the sequential one
+    std::string malformed = text;
+    const std::size_t pos = malformed.rfind("value");
+    malformed.replace(pos - 1, 1, "x");
+    std::size_t expected_line = 0;
+    std::size_t line = 1;
+    try {
+      Csv csv{&mem_resource};
+      csv.append(malformed);
+    }
+    catch (const zisc::CsvParseError& error) {
+      expected_line = error.lineNumber();
+    }
+    try {
+      Csv csv{&mem_resource};
+      csv.appendParallel(malformed, thread_manager, 64);
+    }
+    catch (const zisc::CsvParseError& error) {
+      line = error.lineNumber();
+    }
+    ASSERT_NE(0, expected_line);
+    ASSERT_EQ(expected_line, line) << "The line number of the parse error is wrong.";
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
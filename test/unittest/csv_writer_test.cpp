@@ -0,0 +1,60 @@
+/*!
+  \file csv_writer_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// GoogleTest
+#include "googletest.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <string>
+#include <string_view>
+// Zisc
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/csv.hpp"
+#include "zisc/string/csv_writer.hpp"
+#include "zisc/string/write_buffer.hpp"
+
+TEST(CsvWriterTest, WriteTest)
+{
+  using Csv = zisc::Csv<int, std::string_view, double, bool, const char*>;
+  using CsvWriter = zisc::CsvWriter<int, std::string_view, double, bool, const char*>;
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::WriteBuffer buffer{&mem_resource};
+    CsvWriter writer{buffer};
+    writer.write(1, "plain", 0.5, true, "a");
+    writer.write(-2, R"(quote " and backslash \)", 1.0e-300, false, "multi\nline");
+    ASSERT_EQ(2, writer.rowSize());
+    ASSERT_EQ("1,\"plain\",0.5,true,\"a\"\n"
+              "-2,\"quote \"\" and backslash \\\\\",1e-300,false,\"multi\nline\"\n",
+              buffer.view());
+
+    // Round trip
+    Csv csv{&mem_resource};
+    csv.append(buffer.view());
+    ASSERT_EQ(2, csv.rowSize());
+    ASSERT_EQ(R"(quote " and backslash \)", csv.get<1>(1));
+    ASSERT_EQ(1.0e-300, csv.get<2>(1));
+    ASSERT_STREQ("multi\nline", csv.get<4>(1));
+
+    // Records of a Csv are written back
+    zisc::WriteBuffer buffer2{&mem_resource};
+    CsvWriter writer2{buffer2};
+    for (std::size_t row = 0; row < csv.rowSize(); ++row)
+      writer2.write(csv.record(row));
+    ASSERT_EQ(buffer.view(), buffer2.view());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
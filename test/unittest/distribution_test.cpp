@@ -0,0 +1,220 @@
+/*!
+  \file distribution_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/random/alias_table.hpp"
+#include "zisc/random/exponential_distribution.hpp"
+#include "zisc/random/normal_distribution.hpp"
+#include "zisc/random/multi_stream_engine.hpp"
+#include "zisc/random/pcg_engine.hpp"
+#include "zisc/random/poisson_distribution.hpp"
+#include "zisc/random/xoshiro_engine.hpp"
+
+namespace {
+
+//! Compute the mean and the variance of the given samples
+template <typename Type>
+auto computeMoments(const std::span<const Type> samples) -> std::array<double, 2>
+{
+  double mean = 0.0;
+  for (const Type x : samples)
+    mean += zisc::cast<double>(x);
+  mean /= zisc::cast<double>(samples.size());
+  double variance = 0.0;
+  for (const Type x : samples) {
+    const double d = zisc::cast<double>(x) - mean;
+    variance += d * d;
+  }
+  variance /= zisc::cast<double>(samples.size() - 1);
+  return {{mean, variance}};
+}
+
+/*!
+  \details The sample mean and variance are checked with 6 sigma tolerances.
+  Both generate() and fill() are tested
+  */
+template <typename Engine, typename Distribution>
+void testMoments(const Distribution& distribution,
+                 const double mean,
+                 const double variance,
+                 const double kurtosis)
+{
+  using ValueT = typename Distribution::ValueT;
+  using SeedT = typename Engine::ValueT;
+  constexpr std::size_t n = 200'000;
+  const double mean_error = 6.0 * std::sqrt(variance / zisc::cast<double>(n));
+  const double variance_error = 6.0 * variance * std::sqrt((kurtosis - 1.0) / zisc::cast<double>(n));
+
+  Engine engine{zisc::cast<SeedT>(123456789)};
+  std::vector<ValueT> samples(n);
+  for (ValueT& x : samples)
+    x = distribution(engine);
+  {
+    const auto [m, v] = computeMoments<ValueT>(samples);
+    ASSERT_NEAR(mean, m, mean_error) << "The mean of generate() is wrong.";
+    ASSERT_NEAR(variance, v, variance_error) << "The variance of generate() is wrong.";
+  }
+
+  // Sizes which aren't a multiple of the chunk are mixed
+  std::size_t offset = 0;
+  for (const std::size_t size : {std::size_t{1}, std::size_t{63}, std::size_t{65}}) {
+    distribution.fill(engine, std::span{samples}.subspan(offset, size));
+    offset += size;
+  }
+  distribution.fill(engine, std::span{samples}.subspan(offset));
+  {
+    const auto [m, v] = computeMoments<ValueT>(samples);
+    ASSERT_NEAR(mean, m, mean_error) << "The mean of fill() is wrong.";
+    ASSERT_NEAR(variance, v, variance_error) << "The variance of fill() is wrong.";
+  }
+
+  // The samples are reproducible
+  Engine engine1{zisc::cast<SeedT>(987654321)};
+  Engine engine2{zisc::cast<SeedT>(987654321)};
+  std::vector<ValueT> samples1(1000);
+  std::vector<ValueT> samples2(1000);
+  distribution.fill(engine1, samples1);
+  distribution.fill(engine2, samples2);
+  ASSERT_EQ(samples1, samples2) << "fill() isn't reproducible.";
+  for (std::size_t i = 0; i < 1000; ++i)
+    ASSERT_EQ(distribution(engine1), distribution(engine2)) << "generate() isn't reproducible.";
+}
+
+} // namespace
+
+TEST(DistributionTest, NormalTest)
+{
+  {
+    const zisc::NormalDistribution<double> distribution{};
+    ::testMoments<zisc::Xoshiro2Plus256>(distribution, 0.0, 1.0, 3.0);
+    ::testMoments<zisc::PcgLcgRxsMXs32>(distribution, 0.0, 1.0, 3.0);
+    ::testMoments<zisc::PcgLcgRxsMXs64>(distribution, 0.0, 1.0, 3.0);
+    ::testMoments<zisc::MultiStreamEngine<zisc::Xoshiro2Plus128>>(distribution, 0.0, 1.0, 3.0);
+  }
+  {
+    const zisc::NormalDistribution<float> distribution{2.0f, 3.0f};
+    ::testMoments<zisc::Xoshiro2Plus256>(distribution, 2.0, 9.0, 3.0);
+  }
+
+  // The tail is sampled
+  zisc::Xoshiro2Plus256 engine{1};
+  const zisc::NormalDistribution<double> distribution{};
+  std::vector<double> samples(1'000'000);
+  distribution.fill(engine, samples);
+  std::size_t num_of_tails = 0;
+  for (const double x : samples)
+    num_of_tails += (3.6541528853610088 < std::abs(x)) ? 1 : 0;
+  // The probability of the tail is about 2.58e-4
+  ASSERT_LT(150, num_of_tails) << "The tail isn't sampled enough.";
+  ASSERT_GT(370, num_of_tails) << "The tail is sampled too much.";
+}
+
+TEST(DistributionTest, ExponentialTest)
+{
+  {
+    const zisc::ExponentialDistribution<double> distribution{};
+    ::testMoments<zisc::Xoshiro2Plus256>(distribution, 1.0, 1.0, 9.0);
+    ::testMoments<zisc::PcgLcgRxsMXs32>(distribution, 1.0, 1.0, 9.0);
+  }
+  {
+    const zisc::ExponentialDistribution<float> distribution{4.0f};
+    ::testMoments<zisc::Xoshiro2Plus128>(distribution, 0.25, 0.0625, 9.0);
+  }
+
+  zisc::Xoshiro2Plus256 engine{1};
+  const zisc::ExponentialDistribution<double> distribution{};
+  std::vector<double> samples(100'000);
+  distribution.fill(engine, samples);
+  for (const double x : samples)
+    ASSERT_LE(0.0, x) << "The sample is negative.";
+}
+
+TEST(DistributionTest, PoissonTest)
+{
+  for (const double mean : {0.5, 3.0, 9.5, 10.0, 50.0, 1.0e4}) {
+    const zisc::PoissonDistribution<int> distribution{mean};
+    ::testMoments<zisc::Xoshiro2Plus256>(distribution, mean, mean, 3.0 + 1.0 / mean);
+  }
+  ::testMoments<zisc::PcgLcgRxsMXs32>(zisc::PoissonDistribution<zisc::int64b>{100.0},
+                                      100.0, 100.0, 3.01);
+
+  zisc::Xoshiro2Plus256 engine{1};
+  const zisc::PoissonDistribution<int> distribution{0.0};
+  for (std::size_t i = 0; i < 100; ++i)
+    ASSERT_EQ(0, distribution(engine)) << "The sample of mean 0 isn't 0.";
+}
+
+TEST(DistributionTest, AliasTableTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    const std::array<double, 6> weights = {{1.0, 0.0, 4.0, 2.5, 0.5, 2.0}};
+    double sum = 0.0;
+    for (const double w : weights)
+      sum += w;
+
+    const zisc::AliasTable table{std::span<const double>{weights}, &mem_resource};
+    ASSERT_EQ(weights.size(), table.size());
+    ASSERT_EQ(&mem_resource, table.memoryResource());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      ASSERT_DOUBLE_EQ(weights[i] / sum, table.probability(zisc::cast<zisc::uint32b>(i)));
+
+    // The frequencies of generate() and fill()
+    constexpr std::size_t n = 600'000;
+    zisc::Xoshiro2Plus256 engine{123456789};
+    zisc::Xoshiro2Plus256 engine2{123456789};
+    std::vector<zisc::uint32b> indices(n);
+    table.fill(engine, indices);
+    std::array<std::size_t, weights.size()> counts{};
+    for (const zisc::uint32b index : indices) {
+      ASSERT_EQ(table(engine2), index) << "fill() is different from generate().";
+      ++counts[index];
+    }
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      const double p = weights[i] / sum;
+      const double error = 6.0 * std::sqrt(p * (1.0 - p) * zisc::cast<double>(n));
+      ASSERT_NEAR(p * zisc::cast<double>(n), zisc::cast<double>(counts[i]), error)
+          << "The frequency of index " << i << " is wrong.";
+    }
+    ASSERT_EQ(0, counts[1]) << "The index of weight 0 is sampled.";
+
+    // A skewed table is sampled with a 32bit engine
+    zisc::AliasTable table2{&mem_resource};
+    ASSERT_TRUE(table2.isEmpty());
+    std::vector<float> weights2(1000, 1.0f);
+    weights2[999] = 1000.0f;
+    table2.setWeights(std::span<const float>{weights2});
+    zisc::Xoshiro2Plus128 engine3{};
+    std::size_t num_of_last = 0;
+    for (std::size_t i = 0; i < 100'000; ++i)
+      num_of_last += (table2(engine3) == 999) ? 1 : 0;
+    // The probability of the last index is about 0.5
+    ASSERT_NEAR(50'000.0, zisc::cast<double>(num_of_last), 6.0 * std::sqrt(25'000.0));
+
+    // Move
+    zisc::AliasTable table3{std::move(table2)};
+    ASSERT_EQ(weights2.size(), table3.size());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
@@ -13,14 +13,33 @@
   */
 
 // Standard C++ library
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 // GoogleTest
 #include "googletest.hpp"
 // Zisc
 #include "zisc/zisc_config.hpp"
 #include "zisc/hash/fnv_1a_hash_engine.hpp"
 
+namespace {
+
+//! Make a key which is used for the incremental hash
+constexpr auto makeLongKey() noexcept -> std::array<char, 3000>
+{
+  std::array<char, 3000> key{};
+  for (std::size_t i = 0; i < key.size(); ++i)
+    key[i] = static_cast<char>('a' + (i % 26));
+  return key;
+}
+
+} // namespace
+
 TEST(Fnv1aHashEngineTest, 32BitHashTest)
 {
   using Fnv1aHash = zisc::Fnv1aHash32;
@@ -75,3 +94,88 @@ TEST(Fnv1aHashEngineTest, 64BitHashTest)
     ASSERT_EQ(0x85944171f73967e8, result) << "64bit hash test failed.";
   }
 }
+
+TEST(Fnv1aHashEngineTest, IncrementalHashTest)
+{
+  using Hash = zisc::Fnv1aHash64;
+  constexpr std::array<char, 3000> key = ::makeLongKey();
+  // Chunks across the buffer and block boundaries
+  constexpr std::array<std::size_t, 8> chunk_sizes{{1, 3, 16, 47, 64, 255, 1000, 3000}};
+  for (std::size_t n = 0; n <= key.size(); n += (n < 300) ? 1 : 97) {
+    const std::string_view seed{key.data(), n};
+    const zisc::uint64b expected = Hash::hash(seed);
+    for (const std::size_t chunk_size : chunk_sizes) {
+      Hash::Hasher hasher;
+      for (std::size_t i = 0; i < n; i += chunk_size)
+        hasher.update(seed.substr(i, chunk_size));
+      ASSERT_EQ(expected, hasher.finalize())
+          << "Incremental hash of " << n << " bytes by " << chunk_size << " bytes failed.";
+    }
+  }
+  {
+    constexpr zisc::uint64b result = []()
+    {
+      const std::array<char, 3000> k = ::makeLongKey();
+      Hash::Hasher hasher;
+      hasher.update(std::string_view{"abcdefghijklmnopqrstuvwxyz"});
+      hasher.update(std::span{k}.subspan(26, 2000));
+      hasher.update(k.data() + 2026, k.size() - 2026);
+      return hasher.finalize();
+    }();
+    ASSERT_EQ(Hash::hash(key.data(), key.size()), result) << "Incremental hash failed.";
+  }
+  {
+    Hash::Hasher hasher;
+    hasher.update(std::string_view{"garbage"});
+    hasher.reset();
+    hasher.update(std::string_view{"foobar"});
+    ASSERT_EQ(Hash::hash("foobar"), hasher.finalize()) << "Resetting the hasher failed.";
+  }
+}
+
+TEST(Fnv1aHashEngineTest, BatchHashTest)
+{
+  using Hash = zisc::Fnv1aHash64;
+  constexpr std::array<char, 3000> key = ::makeLongKey();
+  // Keys of various lengths, including signed bytes
+  std::vector<std::string> key_list;
+  for (std::size_t i = 0; i < 203; ++i) {
+    std::string k{key.data() + i, (i * 7) % 41};
+    if ((i % 3) == 0)
+      k += static_cast<char>(0x80 + i % 128);
+    key_list.push_back(std::move(k));
+  }
+  const std::vector<std::string_view> keys{key_list.begin(), key_list.end()};
+  std::vector<zisc::uint64b> values(keys.size());
+  Hash::hashBatch(keys, values);
+  for (std::size_t i = 0; i < keys.size(); ++i)
+    ASSERT_EQ(Hash::hash(keys[i]), values[i]) << "Batch hash of key " << i << " failed.";
+
+  // Integer keys
+  std::vector<zisc::uint32b> int_keys(203);
+  for (std::size_t i = 0; i < int_keys.size(); ++i)
+    int_keys[i] = static_cast<zisc::uint32b>(i * 0x9e37'79b1u);
+  Hash::hashBatch(std::span<const zisc::uint32b>{int_keys}, values);
+  for (std::size_t i = 0; i < int_keys.size(); ++i)
+    ASSERT_EQ(Hash::hash(int_keys[i]), values[i]) << "Batch hash of key " << i << " failed.";
+}
+
+TEST(Fnv1aHashEngineTest, Batch32BitHashTest)
+{
+  using Hash = zisc::Fnv1aHash32;
+  constexpr std::array<char, 3000> key = ::makeLongKey();
+  std::vector<std::string_view> keys;
+  for (std::size_t i = 0; i < 100; ++i)
+    keys.emplace_back(key.data() + i, 16 + (i % 5));
+  std::vector<zisc::uint32b> values(keys.size());
+  Hash::hashBatch(keys, values);
+  for (std::size_t i = 0; i < keys.size(); ++i)
+    ASSERT_EQ(Hash::hash(keys[i]), values[i]) << "Batch hash of key " << i << " failed.";
+
+  std::vector<zisc::uint64b> int_keys(100);
+  for (std::size_t i = 0; i < int_keys.size(); ++i)
+    int_keys[i] = i * 0x9e37'79b9'7f4a'7c15ull;
+  Hash::hashBatch(std::span<const zisc::uint64b>{int_keys}, values);
+  for (std::size_t i = 0; i < int_keys.size(); ++i)
+    ASSERT_EQ(Hash::hash(int_keys[i]), values[i]) << "Batch hash of key " << i << " failed.";
+}
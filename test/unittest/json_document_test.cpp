@@ -0,0 +1,268 @@
+/*!
+  \file json_document_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// GoogleTest
+#include "googletest.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+// Zisc
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/json_document.hpp"
+#include "zisc/string/json_parse_error.hpp"
+#include "zisc/string/json_value_parser.hpp"
+
+TEST(JsonDocumentTest, ParseTest)
+{
+  const std::string_view json = R"({
+  "name": "renderer",
+  "version": 3,
+  "scale": -1.25e2,
+  "enabled": true,
+  "output": null,
+  "path": "C:\\data\/scene \"a\"",
+  "unicode": "\u3042\ud83d\ude00",
+  "size": [1920, 1080],
+  "empty_array": [],
+  "empty_object": {},
+  "passes": [{"type": "albedo", "spp": 16}, {"type": "normal", "spp": 4}]
+})";
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::JsonDocument document{&mem_resource};
+    ASSERT_TRUE(document.isEmpty());
+    document.parse(json);
+    ASSERT_FALSE(document.isEmpty());
+
+    const zisc::JsonDocument::Value root = document.root();
+    ASSERT_EQ(zisc::JsonType::kObject, root.type());
+    ASSERT_EQ(11, root.size());
+    ASSERT_EQ("renderer", root["name"].toString());
+    ASSERT_EQ(3, root["version"].toInteger<int>());
+    ASSERT_EQ(zisc::JsonType::kFloat, root["scale"].type());
+    ASSERT_DOUBLE_EQ(-125.0, root["scale"].toFloat<double>());
+    ASSERT_DOUBLE_EQ(3.0, root["version"].toFloat<double>());
+    ASSERT_TRUE(root["enabled"].toBool());
+    ASSERT_TRUE(root["output"].isNull());
+    ASSERT_EQ(R"(C:\data/scene "a")", root["path"].toString());
+    ASSERT_EQ(R"("C:\\data\/scene \"a\"")", root["path"].rawText());
+    ASSERT_EQ("\xe3\x81\x82\xf0\x9f\x98\x80", root["unicode"].toString());
+    ASSERT_FALSE(root.find("missing").has_value());
+
+    const zisc::JsonDocument::Value size = root["size"];
+    ASSERT_TRUE(size.isArray());
+    ASSERT_EQ(2, size.size());
+    ASSERT_EQ(1920, size[0].toInteger<int>());
+    ASSERT_EQ(1080, size[1].toInteger<int>());
+    ASSERT_EQ(0, root["empty_array"].size());
+    ASSERT_EQ(root["empty_array"].begin(), root["empty_array"].end());
+    ASSERT_EQ(0, root["empty_object"].size());
+
+    // Iteration skips nested values
+    int spp = 0;
+    std::string types;
+    for (const zisc::JsonDocument::Value pass : root["passes"]) {
+      spp += pass["spp"].toInteger<int>();
+      types += pass["type"].toString();
+    }
+    ASSERT_EQ(20, spp);
+    ASSERT_EQ("albedonormal", types);
+
+    std::string keys;
+    for (auto i = root.begin(); i != root.end(); ++i)
+      keys += std::string{i.key()} + ",";
+    ASSERT_EQ("name,version,scale,enabled,output,path,unicode,size,"
+              "empty_array,empty_object,passes,", keys);
+
+    // Out of range
+    ASSERT_THROW(root["size"][0].toInteger<zisc::int8b>(), zisc::JsonParseError);
+
+    // Root scalars
+    document.parse("  -42 ");
+    ASSERT_EQ(-42, document.root().toInteger<int>());
+    document.parse(R"("text")");
+    ASSERT_EQ("text", document.root().toString());
+
+    // Move
+    auto moved = std::make_unique<zisc::JsonDocument>(std::move(document));
+    ASSERT_TRUE(document.isEmpty());
+    ASSERT_EQ("text", moved->root().toString());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(JsonDocumentTest, BlockBoundaryTest)
+{
+  // Escapes, quotes and scalars are placed across the 64 byte blocks
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::JsonDocument document{&mem_resource};
+    for (std::size_t padding = 0; padding < 130; ++padding) {
+      for (const std::string_view escape : {R"(\\)", R"(\")", R"(\\\\)", R"(\\\")", R"(\/)"}) {
+        const std::string value = "\"" + std::string(padding, 'x') + std::string{escape} +
+                                  "{[,:]}" + std::string{escape} + "\"";
+        const std::string json = "[" + value + ", " + std::string(padding % 7, ' ') +
+                                 "12345, true,\"" + std::string(padding, 'y') + "\"]";
+        document.parse(json);
+        const zisc::JsonDocument::Value root = document.root();
+        ASSERT_EQ(4, root.size()) << json;
+        std::string expected;
+        expected.resize(zisc::JsonValueParser::getCxxStringSize(value));
+        zisc::JsonValueParser::toCxxString(value, expected.data());
+        ASSERT_EQ(expected, root[0].toString()) << json;
+        ASSERT_EQ(12345, root[1].toInteger<int>()) << json;
+        ASSERT_TRUE(root[2].toBool()) << json;
+        ASSERT_EQ(padding, root[3].toString().size()) << json;
+      }
+    }
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(JsonDocumentTest, ArrayIndexTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::JsonDocument document{&mem_resource};
+    document.parse(R"([[1, [2, 3], {"a": [4]}], [], "x", [[5], 6], null, 7])");
+    const zisc::JsonDocument::Value root = document.root();
+    ASSERT_EQ(6, root.size());
+    ASSERT_EQ(3, root[0].size());
+    ASSERT_EQ(1, root[0][0].toInteger<int>());
+    ASSERT_EQ(3, root[0][1][1].toInteger<int>());
+    ASSERT_EQ(4, root[0][2]["a"][0].toInteger<int>());
+    ASSERT_EQ(0, root[1].size());
+    ASSERT_EQ("x", root[2].toString());
+    ASSERT_EQ(5, root[3][0][0].toInteger<int>());
+    ASSERT_EQ(6, root[3][1].toInteger<int>());
+    ASSERT_TRUE(root[4].isNull());
+    ASSERT_EQ(7, root[5].toInteger<int>());
+
+    // The iteration and the indexing see the same elements
+    std::size_t i = 0;
+    for (const zisc::JsonDocument::Value value : root)
+      ASSERT_EQ(root[i++].tapeIndex(), value.tapeIndex()) << "element[" << (i - 1) << "]";
+    ASSERT_EQ(root.size(), i);
+
+    // Out of range indices give null
+    for (const std::size_t index : {std::size_t{6}, std::size_t{1000}}) {
+      ASSERT_TRUE(root[index].isNull()) << "root[" << index << "] isn't null.";
+      ASSERT_EQ("null", root[index].rawText());
+    }
+    ASSERT_TRUE(root[1][0].isNull());
+    ASSERT_TRUE(root[0][1][2].isNull());
+
+    // Arrays larger than the saturated count of the tag
+    constexpr std::size_t n = (std::size_t{1} << 24) + 3;
+    std::string json = "[";
+    for (std::size_t k = 0; k < n; ++k)
+      json += (k == 0) ? "0" : ",0";
+    json.back() = '9';
+    json += "]";
+    document.parse(json);
+    ASSERT_EQ(n, document.root().size());
+    ASSERT_EQ(9, document.root()[n - 1].toInteger<int>());
+    ASSERT_TRUE(document.root()[n].isNull());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(JsonDocumentTest, MalformedDocumentTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::JsonDocument document{&mem_resource};
+    auto get_error_position = [&document](const std::string_view json) -> std::size_t
+    {
+      try {
+        document.parse(json);
+      }
+      catch (const zisc::JsonParseError& error) {
+        return error.position();
+      }
+      return std::string_view::npos;
+    };
+
+    ASSERT_EQ(std::string_view::npos, get_error_position(R"({"a": [1, 2.5, "x"]})"));
+    ASSERT_EQ(0, get_error_position(""));
+    ASSERT_EQ(3, get_error_position("   "));
+    ASSERT_EQ(8, get_error_position(R"({"a": 1 "b": 2})"));
+    ASSERT_EQ(11, get_error_position(R"({"a": [1, 2})"));
+    ASSERT_EQ(1, get_error_position(R"({1: 2})"));
+    ASSERT_EQ(5, get_error_position(R"({"a" 1})"));
+    ASSERT_EQ(1, get_error_position(R"([01])"));
+    ASSERT_EQ(4, get_error_position(R"([1, ])"));
+    ASSERT_EQ(1, get_error_position(R"([tru])"));
+    ASSERT_EQ(2, get_error_position(R"(1 2)"));
+    ASSERT_EQ(8, get_error_position(R"(["abc\"])"));
+    ASSERT_EQ(3, get_error_position("[\"a\nb\"]"));
+    ASSERT_EQ(1, get_error_position(R"(["\x"])"));
+    ASSERT_EQ(1, get_error_position(R"([1"a"])"));
+    ASSERT_TRUE(document.isEmpty()) << "A malformed document remains.";
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(JsonDocumentTest, ParseFileTest)
+{
+  constexpr int num_of_records = 5000;
+  const std::filesystem::path file_path = std::filesystem::temp_directory_path() /
+                                          "zisc_json_document_test.json";
+  {
+    std::ofstream file{file_path, std::ios_base::binary};
+    file << "{\"records\": [\n";
+    for (int i = 0; i < num_of_records; ++i) {
+      file << "  {\"id\": " << i << ", \"value\": " << (0.5 * i)
+           << ", \"tag\": \"sensor\\t" << (i % 10) << "\", \"ok\": "
+           << (((i % 2) == 0) ? "true" : "false") << "}"
+           << ((i + 1) < num_of_records ? ",\n" : "\n");
+    }
+    file << "]}\n";
+  }
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::JsonDocument document{&mem_resource};
+    document.parseFile(file_path);
+    const zisc::JsonDocument::Value records = document.root()["records"];
+    ASSERT_EQ(num_of_records, records.size());
+    long long id_sum = 0;
+    double value_sum = 0.0;
+    int num_of_ok = 0;
+    for (const zisc::JsonDocument::Value record : records) {
+      id_sum += record["id"].toInteger<long long>();
+      value_sum += record["value"].toFloat<double>();
+      num_of_ok += record["ok"].toBool() ? 1 : 0;
+    }
+    const long long expected = (static_cast<long long>(num_of_records) * (num_of_records - 1)) / 2;
+    ASSERT_EQ(expected, id_sum);
+    ASSERT_DOUBLE_EQ(0.5 * static_cast<double>(expected), value_sum);
+    ASSERT_EQ(num_of_records / 2, num_of_ok);
+    ASSERT_EQ("sensor\t7", records[4997]["tag"].toString());
+  }
+  std::filesystem::remove(file_path);
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
@@ -13,46 +13,17 @@
 #include <string>
 // GoogleTest
 #include "googletest.hpp"
+// Standard C++ library
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
 // Zisc
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
-#include "zisc/string/constant_string.hpp"
 #include "zisc/string/json_value_parser.hpp"
 
-TEST(JsonValueParserTest, PatternTest)
-{
-  // True
-  {
-    constexpr auto pattern = zisc::JsonValueParser::truePattern();
-    std::cout << std::setw(10) << "True: " << pattern.toCStr() << std::endl;
-  }
-  // False
-  {
-    constexpr auto pattern = zisc::JsonValueParser::falsePattern();
-    std::cout << std::setw(10) << "False: " << pattern.toCStr() << std::endl;
-  }
-  // Boolean
-  {
-    constexpr auto pattern = zisc::JsonValueParser::booleanPattern();
-    std::cout << std::setw(10) << "Boolean: " << pattern.toCStr() << std::endl;
-  }
-  // Integer
-  {
-    constexpr auto pattern = zisc::JsonValueParser::integerPattern();
-    std::cout << std::setw(10) << "Integer: " << pattern.toCStr() << std::endl;
-  }
-  // Float 
-  {
-    constexpr auto pattern = zisc::JsonValueParser::floatPattern();
-    std::cout << std::setw(10) << "Float: " << pattern.toCStr() << std::endl;
-  }
-  // String
-  {
-    constexpr auto pattern = zisc::JsonValueParser::stringPattern();
-    std::cout << std::setw(10) << "String: " << pattern.toCStr() << std::endl;
-  }
-}
-
 TEST(JsonValueParserTest, BooleanTest)
 {
   auto success_test = [](const bool expected, const std::string& json_value)
@@ -175,6 +146,80 @@ TEST(JsonValueParserTest, IntegerTest)
   failure_test(R"(1.0)");
 }
 
+TEST(JsonValueParserTest, IntegerConversionTest)
+{
+  using zisc::JsonValueParser;
+  {
+    // Values longer than eight digits are parsed by the SWAR path
+    const std::string_view text = "1234567890123456789,";
+    for (std::size_t size = 1; size < text.size(); ++size) {
+      const std::string_view json_value = text.substr(0, size);
+      std::int64_t value = 0;
+      ASSERT_TRUE(JsonValueParser::toCxxInteger(json_value, &value)) << json_value;
+      ASSERT_EQ(std::stoll(std::string{json_value}), value) << json_value;
+      std::string negative{"-"};
+      negative += json_value;
+      ASSERT_EQ(-value, JsonValueParser::toCxxInteger<std::int64_t>(negative));
+    }
+  }
+  {
+    // Range
+    std::int64_t v64 = 0;
+    ASSERT_TRUE(JsonValueParser::toCxxInteger("9223372036854775807", &v64));
+    ASSERT_EQ((std::numeric_limits<std::int64_t>::max)(), v64);
+    ASSERT_TRUE(JsonValueParser::toCxxInteger("-9223372036854775808", &v64));
+    ASSERT_EQ((std::numeric_limits<std::int64_t>::min)(), v64);
+    ASSERT_FALSE(JsonValueParser::toCxxInteger("9223372036854775808", &v64));
+    std::uint64_t u64 = 0;
+    ASSERT_TRUE(JsonValueParser::toCxxInteger("18446744073709551615", &u64));
+    ASSERT_EQ((std::numeric_limits<std::uint64_t>::max)(), u64);
+    ASSERT_FALSE(JsonValueParser::toCxxInteger("18446744073709551616", &u64));
+    ASSERT_FALSE(JsonValueParser::toCxxInteger("123456789012345678901234", &u64));
+    ASSERT_FALSE(JsonValueParser::toCxxInteger("-1", &u64));
+    std::int8_t v8 = 0;
+    ASSERT_TRUE(JsonValueParser::toCxxInteger("-128", &v8));
+    ASSERT_EQ(-128, v8);
+    ASSERT_FALSE(JsonValueParser::toCxxInteger("128", &v8));
+  }
+  {
+    // Invalid values
+    int value = 0;
+    for (const std::string_view json_value : {"", "-", "01", "-01", "1a", "12345678a", "1.0", "+1", " 1"})
+      ASSERT_FALSE(JsonValueParser::toCxxInteger(json_value, &value)) << json_value;
+  }
+}
+
+TEST(JsonValueParserTest, FloatConversionTest)
+{
+  using zisc::JsonValueParser;
+  {
+    // The value doesn't have to be null-terminated
+    const std::string_view text = "3.14159265358979323846e0,";
+    double value = 0.0;
+    ASSERT_TRUE(JsonValueParser::toCxxFloat(text.substr(0, 4), &value));
+    ASSERT_EQ(3.14, value);
+    ASSERT_TRUE(JsonValueParser::toCxxFloat(text.substr(0, 24), &value));
+    ASSERT_EQ(3.141592653589793, value);
+    ASSERT_EQ(3.1415927f, JsonValueParser::toCxxFloat<float>(text.substr(0, 24)));
+  }
+  {
+    // Out of range values are rounded to infinity or zero
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    ASSERT_EQ(inf, JsonValueParser::toCxxFloat<double>("1e400"));
+    ASSERT_EQ(-inf, JsonValueParser::toCxxFloat<double>("-123456789.0e310"));
+    ASSERT_EQ(0.0, JsonValueParser::toCxxFloat<double>("1e-400"));
+    ASSERT_EQ(0.0, JsonValueParser::toCxxFloat<double>("1000.0e-330"));
+    ASSERT_TRUE(std::signbit(JsonValueParser::toCxxFloat<double>("-0.0001e-330")));
+    ASSERT_EQ(std::numeric_limits<float>::infinity(), JsonValueParser::toCxxFloat<float>("1e39"));
+  }
+  {
+    // Invalid values
+    double value = 0.0;
+    for (const std::string_view json_value : {"", "1.", ".5", "01.0", "inf", "nan", "0x1p3", "1e", "+1.0"})
+      ASSERT_FALSE(JsonValueParser::toCxxFloat(json_value, &value)) << json_value;
+  }
+}
+
 TEST(JsonValueParserTest, FloatTest)
 {
   auto success_test = [](const double expected, const std::string& json_value)
@@ -312,6 +357,10 @@ TEST(JsonValueParserTest, StringTest)
   success_test("test: \" \r \"", R"("test: \" \r \"")");
   success_test("test: \" \t \"", R"("test: \" \t \"")");
   success_test("\"\\\b\f\n\r\t", R"("\"\\\b\f\n\r\t")");
+  success_test("a/b", R"("a\/b")");
+  success_test("A\u00e9\u3042", R"("\u0041\u00E9\u3042")");
+  success_test("\U0001F600", R"("\ud83d\ude00")");
+  success_test("\uFFFD!", R"("\ud83d!")");
   // Failure test
   failure_test(R"()");
   failure_test(R"(test)");
@@ -320,6 +369,8 @@ TEST(JsonValueParserTest, StringTest)
   failure_test(R"(""")");
   failure_test(R"("\")");
   failure_test(R"("\a")");
+  failure_test(R"("\u12")");
+  failure_test(R"("\u12G4")");
   failure_test(R"("\c")");
   failure_test(R"("\d")");
   failure_test(R"(123)");
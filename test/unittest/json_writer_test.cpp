@@ -0,0 +1,78 @@
+/*!
+  \file json_writer_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// GoogleTest
+#include "googletest.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+// Zisc
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/json_document.hpp"
+#include "zisc/string/json_writer.hpp"
+#include "zisc/string/write_buffer.hpp"
+
+TEST(JsonWriterTest, WriteTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::WriteBuffer buffer{&mem_resource};
+    zisc::JsonWriter writer{buffer};
+    writer.beginObject();
+    writer.key("name");
+    writer.value("sensor \"A\"\t\\");
+    writer.key("id");
+    writer.value(std::int64_t{-42});
+    writer.key("scale");
+    writer.value(0.1);
+    writer.key("invalid");
+    writer.value(std::numeric_limits<double>::infinity());
+    writer.key("enabled");
+    writer.value(true);
+    writer.key("samples");
+    writer.beginArray();
+    for (int i = 0; i < 3; ++i)
+      writer.value(i);
+    writer.beginObject();
+    writer.endObject();
+    writer.beginArray();
+    writer.endArray();
+    writer.endArray();
+    writer.key("control");
+    writer.value(std::string_view{"\x01\x7f", 2});
+    writer.key("none");
+    writer.null();
+    writer.endObject();
+    ASSERT_EQ(0, writer.depth());
+    ASSERT_EQ(R"({"name":"sensor \"A\"\t\\","id":-42,"scale":0.1,"invalid":null,)"
+              R"("enabled":true,"samples":[0,1,2,{},[]],"control":"\u0001\u007f","none":null})",
+              buffer.view());
+
+    // Round trip
+    zisc::JsonDocument document{&mem_resource};
+    document.parse(buffer.view());
+    const zisc::JsonDocument::Value root = document.root();
+    ASSERT_EQ("sensor \"A\"\t\\", root["name"].toString());
+    ASSERT_EQ(-42, root["id"].toInteger<int>());
+    ASSERT_EQ(0.1, root["scale"].toFloat<double>());
+    ASSERT_TRUE(root["invalid"].isNull());
+    ASSERT_EQ(5, root["samples"].size());
+    ASSERT_EQ((std::string_view{"\x01\x7f", 2}), root["control"].toString());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
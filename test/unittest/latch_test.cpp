@@ -0,0 +1,78 @@
+/*!
+  \file latch_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/latch.hpp"
+
+TEST(LatchTest, CountDownTest)
+{
+  zisc::Latch latch{3};
+  ASSERT_FALSE(latch.tryWait());
+  latch.countDown();
+  ASSERT_EQ(2, latch.count());
+  latch.countDown(2);
+  ASSERT_TRUE(latch.tryWait());
+  latch.wait();
+}
+
+TEST(LatchTest, ArriveAndWaitTest)
+{
+  constexpr std::size_t num_of_threads = 8;
+
+  zisc::Latch latch{static_cast<int>(num_of_threads)};
+  std::atomic<int> num_of_arrivals{0};
+  std::atomic<bool> is_passed_early{false};
+  auto job = [&]()
+  {
+    num_of_arrivals.fetch_add(1, std::memory_order::acq_rel);
+    latch.arriveAndWait();
+    const bool early = num_of_arrivals.load(std::memory_order::acquire) !=
+                       static_cast<int>(num_of_threads);
+    if (early)
+      is_passed_early.store(true, std::memory_order::release);
+  };
+
+  std::vector<std::thread> worker_list;
+  worker_list.reserve(num_of_threads);
+  for (std::size_t i = 0; i < num_of_threads; ++i)
+    worker_list.emplace_back(job);
+  for (std::thread& worker : worker_list)
+    worker.join();
+
+  ASSERT_TRUE(latch.tryWait());
+  ASSERT_FALSE(is_passed_early.load()) << "A thread passed the latch before all arrivals.";
+}
+
+TEST(LatchTest, LifetimeTest)
+{
+  // A latch on the stack is destroyed as soon as the wait returns
+  constexpr std::size_t num_of_loops = 10'000;
+  for (std::size_t i = 0; i < num_of_loops; ++i) {
+    std::thread worker;
+    {
+      zisc::Latch latch{1};
+      worker = std::thread{[&latch]() noexcept {latch.countDown();}};
+      latch.wait();
+    }
+    worker.join();
+  }
+}
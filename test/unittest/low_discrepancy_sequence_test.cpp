@@ -0,0 +1,280 @@
+/*!
+  \file low_discrepancy_sequence_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/zisc_config.hpp"
+#include "zisc/random/halton_engine.hpp"
+#include "zisc/random/owen_scrambler.hpp"
+#include "zisc/random/r_sequence_engine.hpp"
+#include "zisc/random/sobol_engine.hpp"
+
+namespace {
+
+template <typename Engine, typename Float>
+void testSequenceBatch(const zisc::uint32b first,
+                       const zisc::uint32b dimension,
+                       const zisc::uint32b seed)
+{
+  // Sizes which aren't a multiple of the chunk are mixed
+  for (const std::size_t size : {std::size_t{1}, std::size_t{63}, std::size_t{200}}) {
+    std::vector<Float> values(size);
+    Engine::template generate1d<Float>(first, dimension, seed, values);
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto index = first + static_cast<zisc::uint32b>(i);
+      const Float expected = Engine::template generate1d<Float>(index, dimension, seed);
+      ASSERT_EQ(expected, values[i]) << "generate1d[" << index << "] is wrong.";
+      ASSERT_TRUE((0.0 <= values[i]) && (values[i] < 1.0));
+    }
+
+    std::vector<std::array<Float, 2>> points(size);
+    Engine::template generate2d<Float>(first, dimension, seed, points);
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto index = first + static_cast<zisc::uint32b>(i);
+      const auto expected = Engine::template generate2d<Float>(index, dimension, seed);
+      ASSERT_EQ(expected, points[i]) << "generate2d[" << index << "] is wrong.";
+    }
+  }
+}
+
+template <typename Engine>
+void testBatch(const zisc::uint32b dimension)
+{
+  for (const zisc::uint32b first : {0u, 1000u, 0xffff'ff80u}) {
+    for (const zisc::uint32b seed : {0u, 123456789u}) {
+      ::testSequenceBatch<Engine, float>(first, dimension, seed);
+      ::testSequenceBatch<Engine, double>(first, dimension, seed);
+    }
+  }
+}
+
+//! Check if each of the n intervals of [0, 1) has exactly one sample
+template <typename Engine>
+void testStratification(const zisc::uint32b n, const zisc::uint32b dimension)
+{
+  for (const zisc::uint32b seed : {0u, 1u, 42u}) {
+    std::vector<zisc::uint32b> counts(n, 0);
+    for (zisc::uint32b i = 0; i < n; ++i) {
+      const double x = Engine::template generate1d<double>(i, dimension, seed);
+      ++counts[static_cast<std::size_t>(x * n)];
+    }
+    for (zisc::uint32b k = 0; k < n; ++k)
+      ASSERT_EQ(1, counts[k]) << "The interval " << k << " of the dimension "
+                              << dimension << " isn't stratified.";
+  }
+}
+
+//! Check if each of the 2^m elementary intervals of any shape has exactly one sample
+template <typename Engine>
+void testSobol2dStratification(const zisc::uint32b dimension)
+{
+  constexpr zisc::uint32b m = 8;
+  constexpr zisc::uint32b n = 1u << m;
+  for (const zisc::uint32b seed : {0u, 7u}) {
+    for (zisc::uint32b a = 0; a <= m; ++a) {
+      std::vector<zisc::uint32b> counts(n, 0);
+      for (zisc::uint32b i = 0; i < n; ++i) {
+        const zisc::uint32b x = (0 < a) ? Engine::sample(i, dimension, seed) >> (32 - a) : 0;
+        const zisc::uint32b y = (a < m) ? Engine::sample(i, dimension + 1, seed) >> (32 - (m - a)) : 0;
+        ++counts[(x << (m - a)) | y];
+      }
+      for (zisc::uint32b k = 0; k < n; ++k)
+        ASSERT_EQ(1, counts[k]) << "The elementary interval " << k << " of the shape "
+                                << a << " isn't stratified.";
+    }
+  }
+}
+
+} // namespace
+
+TEST(LowDiscrepancySequenceTest, OwenScramblerTest)
+{
+  using zisc::OwenScrambler;
+
+  // The permutation is a bijection
+  for (const zisc::uint32b l : {1u, 2u, 3u, 7u, 16u, 100u}) {
+    for (const zisc::uint32b seed : {0u, 1u, 0xdeadbeefu}) {
+      std::vector<bool> used(l, false);
+      for (zisc::uint32b i = 0; i < l; ++i) {
+        const zisc::uint32b j = OwenScrambler::permute(i, l, seed);
+        ASSERT_LT(j, l);
+        ASSERT_FALSE(used[j]) << "The permutation of " << l << " isn't a bijection.";
+        used[j] = true;
+      }
+    }
+  }
+
+  // A bit of the scrambled value depends only on the higher bits
+  constexpr zisc::uint32b seed = 12345;
+  for (zisc::uint32b x = 0; x < 1000; ++x) {
+    const zisc::uint32b v = x * 0x9e3779b9u;
+    const zisc::uint32b y = OwenScrambler::scramble(v, seed);
+    const zisc::uint32b z = OwenScrambler::scramble(v ^ 1u, seed);
+    ASSERT_EQ(y >> 1, z >> 1) << "The higher bits depend on the lower bit.";
+    ASSERT_NE(y, z);
+  }
+
+  // The batch scrambling is identical to the scalar scrambling
+  std::vector<zisc::uint32b> values(77);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    values[i] = static_cast<zisc::uint32b>(i) * 0x9e3779b9u;
+  std::vector<zisc::uint32b> expected = values;
+  for (zisc::uint32b& v : expected)
+    v = OwenScrambler::scramble(v, seed);
+  OwenScrambler::scramble(values, seed);
+  ASSERT_EQ(expected, values);
+}
+
+TEST(LowDiscrepancySequenceTest, SobolReferenceTest)
+{
+  using zisc::Sobol;
+  static_assert(Sobol::maxDimension() == 256);
+  static_assert(Sobol::sample(1, 255) == 0x8000'0000u);
+
+  // The reference values are the sequence in the Gray code order
+  auto gray = [](const zisc::uint32b i) noexcept { return i ^ (i >> 1); };
+  constexpr std::array<zisc::uint32b, 5> dimensions = {{0, 1, 5, 100, 255}};
+  constexpr std::array<zisc::uint32b, 4> indices = {{2, 1000, 2047, 654321}};
+  constexpr std::array<std::array<zisc::uint32b, 5>, 4> references = {{
+    {{3221225472u, 1073741824u, 3221225472u, 1073741824u, 3221225472u}},
+    {{943718400u, 415236096u, 3896508416u, 3300917248u, 1069547520u}},
+    {{2097152u, 2694840320u, 2824863744u, 2418016256u, 2061500416u}},
+    {{2422255616u, 3227570176u, 3709915136u, 2461552640u, 888705024u}}}};
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    for (std::size_t d = 0; d < dimensions.size(); ++d) {
+      ASSERT_EQ(references[i][d], Sobol::sample(gray(indices[i]), dimensions[d]))
+          << "Sobol[" << indices[i] << "][" << dimensions[d] << "] is wrong.";
+    }
+  }
+  ASSERT_EQ(0.75, Sobol::generate1d<double>(gray(2), 0));
+  ASSERT_EQ(0.75f, (Sobol::generate2d<float>(gray(2), 0)[0]));
+}
+
+TEST(LowDiscrepancySequenceTest, SobolScramblingTest)
+{
+  for (const zisc::uint32b dimension : {0u, 1u, 9u, 254u}) {
+    ::testStratification<zisc::Sobol>(256, dimension);
+    ::testStratification<zisc::XorScrambledSobol>(256, dimension);
+    ::testStratification<zisc::OwenScrambledSobol>(1024, dimension);
+  }
+  ::testSobol2dStratification<zisc::Sobol>(0);
+  ::testSobol2dStratification<zisc::OwenScrambledSobol>(0);
+
+  // The seed changes the sequence
+  using zisc::OwenScrambledSobol;
+  ASSERT_NE(OwenScrambledSobol::sample(5, 3, 0), OwenScrambledSobol::sample(5, 3, 1));
+  ASSERT_NE(OwenScrambledSobol::sample(5, 3, 0), OwenScrambledSobol::sample(5, 4, 0));
+}
+
+TEST(LowDiscrepancySequenceTest, SobolBatchTest)
+{
+  for (const zisc::uint32b dimension : {0u, 3u, 254u}) {
+    ::testBatch<zisc::Sobol>(dimension);
+    ::testBatch<zisc::XorScrambledSobol>(dimension);
+    ::testBatch<zisc::OwenScrambledSobol>(dimension);
+  }
+}
+
+TEST(LowDiscrepancySequenceTest, HaltonReferenceTest)
+{
+  using zisc::Halton;
+  static_assert(Halton::maxDimension() == 256);
+  static_assert(Halton::base(0) == 2);
+  static_assert(Halton::base(255) == 1619);
+
+  constexpr std::array<zisc::uint32b, 5> dimensions = {{0, 1, 2, 100, 255}};
+  constexpr std::array<zisc::uint32b, 3> indices = {{2, 1000, 1024}};
+  constexpr std::array<std::array<double, 5>, 3> references = {{
+    {{0.25, 0.6666666666666666, 0.4, 0.003656307129798903, 0.0012353304508956147}},
+    {{0.0927734375, 0.3475080018289895, 0.00512, 0.8281569070449084, 0.6176652254478073}},
+    {{0.00048828125, 0.6438042981252857, 0.9651200000000001, 0.8720325926024952, 0.6324891908585547}}}};
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    for (std::size_t d = 0; d < dimensions.size(); ++d) {
+      ASSERT_DOUBLE_EQ(references[i][d], Halton::generate1d<double>(indices[i], dimensions[d]))
+          << "Halton[" << indices[i] << "][" << dimensions[d] << "] is wrong.";
+    }
+  }
+  const auto xy = Halton::generate2d<double>(1, 0);
+  ASSERT_EQ(0.5, xy[0]);
+  ASSERT_DOUBLE_EQ(1.0 / 3.0, xy[1]);
+}
+
+TEST(LowDiscrepancySequenceTest, HaltonScramblingTest)
+{
+  // The first b^k samples of the base b are stratified
+  ::testStratification<zisc::PermutedHalton>(256, 0);
+  ::testStratification<zisc::PermutedHalton>(243, 1);
+  ::testStratification<zisc::PermutedHalton>(343, 3);
+  ::testStratification<zisc::OwenScrambledHalton>(256, 0);
+  ::testStratification<zisc::OwenScrambledHalton>(243, 1);
+  ::testStratification<zisc::OwenScrambledHalton>(343, 3);
+
+  using zisc::OwenScrambledHalton;
+  ASSERT_NE(OwenScrambledHalton::generate1d<double>(5, 3, 0),
+            OwenScrambledHalton::generate1d<double>(5, 3, 1));
+}
+
+TEST(LowDiscrepancySequenceTest, HaltonBatchTest)
+{
+  for (const zisc::uint32b dimension : {0u, 1u, 6u, 254u}) {
+    ::testBatch<zisc::Halton>(dimension);
+    ::testBatch<zisc::PermutedHalton>(dimension);
+    ::testBatch<zisc::OwenScrambledHalton>(dimension);
+  }
+}
+
+TEST(LowDiscrepancySequenceTest, RSequenceTest)
+{
+  using zisc::RSequenceEngine;
+
+  constexpr std::array<zisc::uint32b, 5> indices = {{0, 1, 2, 1000, 123456789}};
+  constexpr std::array<std::array<double, 3>, 5> references = {{
+    {{0.5, 0.5, 0.5}},
+    {{0.11803398874989485, 0.2548776662466928, 0.06984029099805326}},
+    {{0.7360679774997897, 0.00975533249338552, 0.6396805819961066}},
+    {{0.5339887498948482, 0.37766624669276005, 0.3402909980532659}},
+    {{0.2439241420469807, 0.26263037002525985, 0.0694452614603846}}}};
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    const double x = RSequenceEngine::generate1d<double>(indices[i]);
+    const auto xy = RSequenceEngine::generate2d<double>(indices[i]);
+    ASSERT_NEAR(references[i][0], x, 1.0e-10) << "R1[" << indices[i] << "] is wrong.";
+    ASSERT_NEAR(references[i][1], xy[0], 1.0e-10) << "R2[" << indices[i] << "] is wrong.";
+    ASSERT_NEAR(references[i][2], xy[1], 1.0e-10) << "R2[" << indices[i] << "] is wrong.";
+  }
+
+  // The seed shifts the sequence
+  ASSERT_NE(RSequenceEngine::generate1d<double>(3, 0), RSequenceEngine::generate1d<double>(3, 1));
+  ASSERT_NE(RSequenceEngine::shift(1, 0), RSequenceEngine::shift(1, 1));
+
+  // The batch generation is identical to the scalar generation
+  for (const zisc::uint32b first : {0u, 1000u, 0xffff'ff80u}) {
+    for (const zisc::uint32b seed : {0u, 99u}) {
+      std::vector<float> values(200);
+      RSequenceEngine::generate1d<float>(first, seed, values);
+      std::vector<std::array<double, 2>> points(200);
+      RSequenceEngine::generate2d<double>(first, seed, points);
+      for (std::size_t i = 0; i < values.size(); ++i) {
+        const auto index = first + static_cast<zisc::uint32b>(i);
+        ASSERT_EQ(RSequenceEngine::generate1d<float>(index, seed), values[i]);
+        ASSERT_EQ(RSequenceEngine::generate2d<double>(index, seed), points[i]);
+        ASSERT_TRUE((0.0f <= values[i]) && (values[i] < 1.0f));
+      }
+    }
+  }
+}
@@ -0,0 +1,72 @@
+/*!
+  \file mapped_file_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/memory/mapped_file.hpp"
+
+TEST(MappedFileTest, MapTest)
+{
+  const std::filesystem::path file_path = std::filesystem::temp_directory_path() /
+                                          "zisc_mapped_file_test.txt";
+  const std::string text = "Mapped file test\nsecond line";
+  {
+    std::ofstream file{file_path, std::ios_base::binary};
+    file << text;
+  }
+
+  zisc::MappedFile file{file_path};
+  ASSERT_TRUE(file.isOpen());
+  ASSERT_EQ(text.size(), file.size());
+  ASSERT_EQ(text, file.view()) << "Mapping the file failed.";
+
+  // The mapping is kept by move
+  const char* data = file.data();
+  zisc::MappedFile moved_file{std::move(file)};
+  ASSERT_FALSE(file.isOpen());
+  ASSERT_EQ(data, moved_file.data());
+  ASSERT_EQ(text, moved_file.view()) << "Moving the mapped file failed.";
+
+  moved_file.close();
+  ASSERT_FALSE(moved_file.isOpen());
+  ASSERT_TRUE(moved_file.view().empty());
+  std::filesystem::remove(file_path);
+}
+
+TEST(MappedFileTest, EmptyFileTest)
+{
+  const std::filesystem::path file_path = std::filesystem::temp_directory_path() /
+                                          "zisc_mapped_file_empty_test.txt";
+  {
+    std::ofstream file{file_path, std::ios_base::binary};
+  }
+
+  zisc::MappedFile file{file_path};
+  ASSERT_TRUE(file.isOpen());
+  ASSERT_EQ(0, file.size());
+  ASSERT_TRUE(file.view().empty());
+  std::filesystem::remove(file_path);
+
+  ASSERT_THROW(file.open(file_path), std::system_error)
+      << "Mapping a nonexistent file should fail.";
+  ASSERT_FALSE(file.isOpen());
+}
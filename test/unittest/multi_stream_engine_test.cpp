@@ -0,0 +1,191 @@
+/*!
+  \file multi_stream_engine_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/random/multi_stream_engine.hpp"
+#include "zisc/random/pcg_engine.hpp"
+#include "zisc/random/xoshiro_engine.hpp"
+#include "zisc/utility.hpp"
+
+namespace {
+
+template <typename Engine>
+void testFill()
+{
+  using ValueT = typename Engine::ValueT;
+  Engine expected_engine{};
+  Engine engine{};
+
+  // Sizes which aren't a multiple of the chunk are mixed
+  for (const std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{63},
+                                 std::size_t{64}, std::size_t{65}, std::size_t{1000}}) {
+    std::vector<ValueT> values(size);
+    engine.fill(values);
+    for (std::size_t i = 0; i < size; ++i)
+      ASSERT_EQ(expected_engine(), values[i]) << "fill[" << i << "] is wrong.";
+    ASSERT_EQ(expected_engine(), engine()) << "The state after fill is wrong.";
+  }
+
+  std::vector<double> values(777);
+  engine.template fill01<double>(values);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const double expected = expected_engine.template generate01<double>();
+    ASSERT_EQ(expected, values[i]) << "fill01[" << i << "] is wrong.";
+    ASSERT_TRUE((0.0 <= values[i]) && (values[i] < 1.0));
+  }
+}
+
+template <typename Engine>
+void testMultiStreamEngine()
+{
+  using StreamT = typename Engine::StreamT;
+  using ValueT = typename Engine::ValueT;
+  constexpr std::size_t n = Engine::numOfStreams();
+  constexpr ValueT seed = 12345;
+
+  std::array<StreamT, n> stream_list;
+  for (std::size_t i = 0; i < n; ++i)
+    stream_list[i].setSeed(Engine::streamSeed(seed, i));
+  std::size_t index = 0;
+  auto expected_value = [&stream_list, &index]() noexcept
+  {
+    const ValueT value = stream_list[index % n]();
+    ++index;
+    return value;
+  };
+
+  // Single generation and bulk generation are mixed
+  Engine engine{seed};
+  for (const std::size_t size : {std::size_t{3}, std::size_t{0}, std::size_t{2 * n},
+                                 std::size_t{1}, std::size_t{1001}, std::size_t{n - 1}}) {
+    for (std::size_t i = 0; i < 5; ++i)
+      ASSERT_EQ(expected_value(), engine()) << "generate[" << index << "] is wrong.";
+    std::vector<ValueT> values(size);
+    engine.fill(values);
+    for (std::size_t i = 0; i < size; ++i)
+      ASSERT_EQ(expected_value(), values[i]) << "fill[" << index << "] is wrong.";
+  }
+
+  // Reseed
+  engine.setSeed(seed);
+  for (std::size_t i = 0; i < n; ++i)
+    stream_list[i].setSeed(Engine::streamSeed(seed, i));
+  index = 0;
+  std::vector<ValueT> values(4 * n + 3);
+  engine.fill(values);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    ASSERT_EQ(expected_value(), values[i]) << "fill[" << i << "] after reseed is wrong.";
+
+  // Streams are different
+  ASSERT_NE(Engine::streamSeed(seed, 0), Engine::streamSeed(seed, 1));
+  ASSERT_NE(Engine::streamSeed(seed, 0), Engine::streamSeed(seed + 1, 0));
+}
+
+template <typename Engine>
+void testPcgFillStreams(const std::size_t num_of_engines)
+{
+  using ValueT = typename Engine::ValueT;
+  constexpr std::size_t num_of_rows = 100;
+
+  // Each engine has its own increment, so the lanes don't share the increment
+  std::vector<Engine> engine_list;
+  std::vector<Engine> expected_list;
+  for (std::size_t i = 0; i < num_of_engines; ++i) {
+    Engine engine{};
+    if constexpr (requires {engine.setSeed(ValueT{}, ValueT{});})
+      engine.setSeed(zisc::cast<ValueT>(12345 + i), zisc::cast<ValueT>(3 * i));
+    else
+      engine.setSeed(zisc::cast<ValueT>(12345 + i));
+    engine_list.push_back(engine);
+    expected_list.push_back(engine);
+  }
+
+  // SIMD lanes and scalar engines generate the same sequences
+  for (std::size_t r = 0; r < 2; ++r) {
+    std::vector<ValueT> values(num_of_rows * num_of_engines);
+    Engine::fillStreams(engine_list, values);
+    for (std::size_t k = 0; k < num_of_rows; ++k) {
+      for (std::size_t i = 0; i < num_of_engines; ++i) {
+        ASSERT_EQ(expected_list[i](), values[k * num_of_engines + i])
+            << "engine[" << i << "][" << k << "] is wrong.";
+      }
+    }
+  }
+  for (std::size_t i = 0; i < num_of_engines; ++i)
+    ASSERT_EQ(expected_list[i](), engine_list[i]()) << "The state of engine[" << i << "] is wrong.";
+}
+
+} // namespace
+
+TEST(RandomNumberEngine, XoshiroFillTest)
+{
+  ::testFill<zisc::XoshiroPlus128>();
+  ::testFill<zisc::Xoshiro2Plus256>();
+  ::testFill<zisc::Xoshiro2Star256>();
+}
+
+TEST(RandomNumberEngine, PcgFillTest)
+{
+  ::testFill<zisc::PcgLcgRxsMXs32>();
+  ::testFill<zisc::PcgLcgRxsMXs64>();
+}
+
+TEST(RandomNumberEngine, MultiStreamFillTest)
+{
+  ::testFill<zisc::MultiStreamEngine<zisc::Xoshiro2Plus256>>();
+  ::testFill<zisc::MultiStreamEngine<zisc::PcgLcgRxsMXs64, 4>>();
+}
+
+TEST(RandomNumberEngine, MultiStreamXoshiroTest)
+{
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::XoshiroPlus256, 8>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::Xoshiro2Plus256, 16>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::Xoshiro2Star256, 7>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::Xoshiro2Plus128, 8>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::Xoshiro2Star128, 16>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::XoshiroPlus128, 19>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::Xoshiro2Plus256, 1>>();
+}
+
+TEST(RandomNumberEngine, PcgFillStreamsTest)
+{
+  for (const std::size_t n : {std::size_t{1}, std::size_t{8}, std::size_t{16}, std::size_t{19}}) {
+    ::testPcgFillStreams<zisc::PcgLcgRxsMXs8>(n);
+    ::testPcgFillStreams<zisc::PcgLcgRxsMXs16>(n);
+    ::testPcgFillStreams<zisc::PcgLcgRxsMXs32>(n);
+    ::testPcgFillStreams<zisc::PcgMcgEngine<zisc::uint32b>>(n);
+  }
+}
+
+TEST(RandomNumberEngine, MultiStreamPcgTest)
+{
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::PcgLcgRxsMXs32, 8>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::PcgLcgRxsMXs32, 19>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::PcgLcgRxsMXs16, 16>>();
+  ::testMultiStreamEngine<zisc::MultiStreamEngine<zisc::PcgLcgRxsMXs64, 5>>();
+}
+
+TEST(RandomNumberEngine, MultiStreamPeriodTest)
+{
+  using Engine = zisc::MultiStreamEngine<zisc::Xoshiro2Plus256, 4>;
+  ASSERT_EQ(zisc::Xoshiro2Plus256::getPeriodPow2(), Engine::getPeriodPow2());
+  ASSERT_FALSE(Engine::isEndOfPeriod(0u));
+  ASSERT_EQ(4, Engine::numOfStreams());
+}
@@ -13,6 +13,8 @@
   */
 
 // Standard C++ library
+#include <array>
+#include <cstddef>
 #include <fstream>
 #include <string_view>
 // GoogleTest
@@ -39,6 +41,64 @@ void testPcgEngine(const std::string_view reference_path)
   }
 }
 
+template <typename PcgEngine>
+void testPcgAdvance()
+{
+  using ValueType = typename PcgEngine::ValueT;
+  constexpr ValueType seed = 42;
+
+  for (const ValueType delta : {ValueType{0}, ValueType{1}, ValueType{2},
+                                ValueType{100}, ValueType{255}}) {
+    PcgEngine expected{seed};
+    for (ValueType i = 0; i < delta; ++i)
+      expected();
+    PcgEngine sampler{seed};
+    sampler.advance(delta);
+    for (int i = 0; i < 8; ++i)
+      ASSERT_EQ(expected(), sampler()) << "pcg advance(" << delta << ") is wrong.";
+  }
+
+  // Move the state backward
+  PcgEngine expected{seed};
+  PcgEngine sampler{seed};
+  for (int i = 0; i < 10; ++i)
+    sampler();
+  sampler.advance(static_cast<ValueType>(0 - ValueType{10}));
+  for (int i = 0; i < 8; ++i)
+    ASSERT_EQ(expected(), sampler()) << "pcg backward advance is wrong.";
+}
+
+template <typename PcgEngine>
+void testPcgStream()
+{
+  using ValueType = typename PcgEngine::ValueT;
+  constexpr ValueType seed = 42;
+
+  // The default stream
+  const PcgEngine default_sampler{seed};
+  PcgEngine sampler{seed, default_sampler.stream()};
+  PcgEngine expected{seed};
+  for (int i = 0; i < 8; ++i)
+    ASSERT_EQ(expected(), sampler()) << "pcg default stream is wrong.";
+
+  // Different streams generate different sequences
+  constexpr std::size_t n = 8;
+  std::array<ValueType, n> first_values{};
+  for (std::size_t s = 0; s < n; ++s) {
+    PcgEngine stream_sampler{seed, static_cast<ValueType>(s)};
+    ASSERT_EQ(s, stream_sampler.stream());
+    first_values[s] = stream_sampler();
+    for (std::size_t t = 0; t < s; ++t)
+      ASSERT_NE(first_values[t], first_values[s]) << "pcg streams are overlapped.";
+  }
+
+  // Reseed keeps the stream
+  sampler.setSeed(seed, 3);
+  sampler.setSeed(seed);
+  ASSERT_EQ(3, sampler.stream());
+  ASSERT_EQ(first_values[3], sampler());
+}
+
 #define PCG_TEST(engine_type, reference_path) \
     TEST(RandomNumberEngine, engine_type ## Test) \
     { \
@@ -47,3 +107,18 @@ void testPcgEngine(const std::string_view reference_path)
 
 PCG_TEST(PcgLcgRxsMXs32, "resources/pcg_lcg_rxs_m_xs_32_reference.txt")
 PCG_TEST(PcgLcgRxsMXs64, "resources/pcg_lcg_rxs_m_xs_64_reference.txt")
+
+TEST(RandomNumberEngine, PcgAdvanceTest)
+{
+  ::testPcgAdvance<zisc::PcgLcgRxsMXs8>();
+  ::testPcgAdvance<zisc::PcgLcgRxsMXs16>();
+  ::testPcgAdvance<zisc::PcgLcgRxsMXs32>();
+  ::testPcgAdvance<zisc::PcgLcgRxsMXs64>();
+  ::testPcgAdvance<zisc::PcgMcgEngine<zisc::uint32b>>();
+}
+
+TEST(RandomNumberEngine, PcgStreamTest)
+{
+  ::testPcgStream<zisc::PcgLcgRxsMXs32>();
+  ::testPcgStream<zisc::PcgLcgRxsMXs64>();
+}
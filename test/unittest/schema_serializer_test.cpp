@@ -0,0 +1,219 @@
+/*!
+  \file schema_serializer_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <tuple>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/binary_reader.hpp"
+#include "zisc/binary_writer.hpp"
+#include "zisc/error.hpp"
+#include "zisc/ieee_754_binary.hpp"
+#include "zisc/schema_serializer.hpp"
+#include "zisc/zisc_config.hpp"
+#include "zisc/math/fraction.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+
+namespace {
+
+enum class Channel : zisc::uint8b
+{
+  kRed = 1,
+  kGreen,
+  kBlue
+};
+
+struct Pixel
+{
+  float r_;
+  float g_;
+  float b_;
+  zisc::uint32b id_;
+};
+
+struct Padded
+{
+  zisc::uint8b c_;
+  double d_;
+};
+
+struct Record
+{
+  zisc::int32b index_;
+  Channel channel_;
+  std::pmr::string name_;
+  std::pmr::vector<Pixel> pixels_;
+  std::pmr::vector<std::pmr::string> tags_;
+  zisc::Fraction32 ratio_;
+  zisc::Binary16 half_;
+  std::array<double, 3> position_;
+  std::tuple<int, std::pmr::string, double> csv_record_;
+  Padded padded_;
+};
+
+template <std::endian kEndian>
+void testRecord(std::pmr::memory_resource* mem_resource)
+{
+  using Allocator = std::pmr::polymorphic_allocator<std::byte>;
+  const Allocator alloc{mem_resource};
+  Record record{1,
+                Channel::kBlue,
+                std::pmr::string{"long record name which isn't in the small buffer", alloc},
+                std::pmr::vector<Pixel>{alloc},
+                std::pmr::vector<std::pmr::string>{alloc},
+                zisc::Fraction32{3, 4},
+                zisc::Binary16{0.5f},
+                {{1.0, -2.0, 3.5}},
+                {42, std::pmr::string{"value", alloc}, 0.25},
+                {7, 1.5}};
+  for (zisc::uint32b i = 0; i < 100; ++i)
+    record.pixels_.push_back({0.5f * i, 0.25f * i, 1.0f, i});
+  record.tags_.emplace_back("a");
+  record.tags_.emplace_back("bc");
+
+  zisc::BinaryWriter<kEndian> writer{mem_resource};
+  zisc::SchemaSerializer::write(record, &writer);
+
+  Record result{0,
+                Channel::kRed,
+                std::pmr::string{alloc},
+                std::pmr::vector<Pixel>{alloc},
+                std::pmr::vector<std::pmr::string>{alloc},
+                zisc::Fraction32{},
+                zisc::Binary16{},
+                {},
+                {0, std::pmr::string{alloc}, 0.0},
+                {}};
+  zisc::BinaryReader<kEndian> reader{writer.data()};
+  zisc::SchemaSerializer::read(&result, &reader);
+  ASSERT_TRUE(reader.isEnd());
+  ASSERT_EQ(record.index_, result.index_);
+  ASSERT_EQ(record.channel_, result.channel_);
+  ASSERT_EQ(record.name_, result.name_);
+  ASSERT_EQ(record.pixels_.size(), result.pixels_.size());
+  for (std::size_t i = 0; i < record.pixels_.size(); ++i) {
+    ASSERT_EQ(record.pixels_[i].r_, result.pixels_[i].r_);
+    ASSERT_EQ(record.pixels_[i].g_, result.pixels_[i].g_);
+    ASSERT_EQ(record.pixels_[i].b_, result.pixels_[i].b_);
+    ASSERT_EQ(record.pixels_[i].id_, result.pixels_[i].id_);
+  }
+  ASSERT_EQ(record.tags_, result.tags_);
+  ASSERT_EQ(record.ratio_.numer(), result.ratio_.numer());
+  ASSERT_EQ(record.ratio_.denom(), result.ratio_.denom());
+  ASSERT_EQ(record.half_.bits(), result.half_.bits());
+  ASSERT_EQ(record.position_, result.position_);
+  ASSERT_EQ(record.csv_record_, result.csv_record_);
+  ASSERT_EQ(record.padded_.c_, result.padded_.c_);
+  ASSERT_EQ(record.padded_.d_, result.padded_.d_);
+  ASSERT_EQ(mem_resource, result.pixels_.get_allocator().resource());
+}
+
+} // namespace
+
+TEST(SchemaSerializerTest, FieldCountTest)
+{
+  static_assert(zisc::SchemaSerializer::fieldCount<::Pixel>() == 4);
+  static_assert(zisc::SchemaSerializer::fieldCount<::Padded>() == 2);
+  static_assert(zisc::SchemaSerializer::fieldCount<::Record>() == 10);
+
+  static_assert(zisc::SchemaSerializer::isBlock<::Pixel>());
+  static_assert(zisc::SchemaSerializer::isBlock<std::array<::Pixel, 2>>());
+  static_assert(zisc::SchemaSerializer::isBlock<zisc::Fraction32>());
+  static_assert(zisc::SchemaSerializer::isBlock<zisc::Binary64>());
+  static_assert(!zisc::SchemaSerializer::isBlock<::Padded>());
+  static_assert(!zisc::SchemaSerializer::isBlock<::Record>());
+}
+
+TEST(SchemaSerializerTest, ReadWriteTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  ::testRecord<std::endian::native>(&mem_resource);
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(SchemaSerializerTest, ReadWriteSwappedTest)
+{
+  constexpr std::endian swapped = (std::endian::native == std::endian::little)
+      ? std::endian::big
+      : std::endian::little;
+  zisc::AllocFreeResource mem_resource;
+  ::testRecord<swapped>(&mem_resource);
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(SchemaSerializerTest, BlockLayoutTest)
+{
+  // Padding isn't written
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::BinaryWriter<std::endian::little> writer{&mem_resource};
+    zisc::SchemaSerializer::write(::Padded{1, 2.0}, &writer);
+    ASSERT_EQ(sizeof(zisc::uint8b) + sizeof(double), writer.size());
+
+    // A vector of blocks is the size followed by the elements
+    std::pmr::vector<::Pixel> pixels{{{1.0f, 2.0f, 3.0f, 4}, {5.0f, 6.0f, 7.0f, 8}},
+                                     &mem_resource};
+    writer.clear();
+    zisc::SchemaSerializer::write(pixels, &writer);
+    ASSERT_EQ(sizeof(zisc::uint64b) + 2 * sizeof(::Pixel), writer.size());
+
+    // A truncated snapshot
+    zisc::BinaryReader<std::endian::little> reader{writer.data().first(writer.size() - 1)};
+    std::pmr::vector<::Pixel> result{&mem_resource};
+    ASSERT_THROW(zisc::SchemaSerializer::read(&result, &reader), zisc::SystemError);
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(SchemaSerializerTest, VersionedTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::BinaryWriter<std::endian::little> writer{&mem_resource};
+    const std::pmr::vector<::Pixel> pixels{{{1.0f, 2.0f, 3.0f, 4}}, &mem_resource};
+    zisc::SchemaSerializer::writeVersioned(pixels, 1, &writer);
+    zisc::SchemaSerializer::writeVersioned(::Pixel{5.0f, 6.0f, 7.0f, 8}, 2, &writer);
+
+    zisc::BinaryReader<std::endian::little> reader{writer.data()};
+    std::pmr::vector<::Pixel> result{&mem_resource};
+    // Another version is skipped
+    ASSERT_FALSE(zisc::SchemaSerializer::readVersioned(&result, 2, &reader));
+    ASSERT_TRUE(result.empty());
+    ::Pixel pixel{};
+    ASSERT_TRUE(zisc::SchemaSerializer::readVersioned(&pixel, 2, &reader));
+    ASSERT_EQ(8, pixel.id_);
+    ASSERT_TRUE(reader.isEnd());
+
+    reader.seek(0);
+    const zisc::SchemaHeader header = zisc::SchemaSerializer::readHeader(&reader);
+    ASSERT_EQ(1, header.version_);
+    ASSERT_EQ(sizeof(zisc::uint64b) + sizeof(::Pixel), header.size_);
+
+    // Not a snapshot
+    reader.seek(sizeof(zisc::uint32b));
+    ASSERT_THROW(zisc::SchemaSerializer::readHeader(&reader), zisc::SystemError);
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
@@ -0,0 +1,136 @@
+/*!
+  \file stream_splitter_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <cstddef>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/random/pcg_engine.hpp"
+#include "zisc/random/stream_splitter.hpp"
+#include "zisc/random/xoshiro_engine.hpp"
+
+namespace {
+
+template <typename Engine>
+void testStreamSplitter()
+{
+  using ValueT = typename Engine::ValueT;
+  constexpr ValueT seed = 123456789;
+  constexpr std::size_t num_of_values = 1000;
+  const zisc::StreamSplitter<Engine> splitter{seed};
+  ASSERT_EQ(seed, splitter.seed());
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    constexpr zisc::int64b num_of_threads = 4;
+    zisc::ThreadManager thread_manager{num_of_threads, &mem_resource};
+    auto engine_list = splitter.createWorkerLocal(thread_manager);
+    ASSERT_EQ(zisc::cast<std::size_t>(num_of_threads + 1), engine_list.size());
+
+    // Each worker generates the values of its own stream
+    std::vector<std::vector<ValueT>> value_list(engine_list.size());
+    auto task = [&engine_list, &value_list](const zisc::int64b thread_id)
+    {
+      const std::size_t index = engine_list.getIndex(thread_id);
+      value_list[index].resize(num_of_values);
+      engine_list[thread_id].fill(value_list[index]);
+    };
+    for (zisc::int64b i = 0; i < num_of_threads; ++i) {
+      auto result = thread_manager.enqueue([&task, i]() { task(i); });
+      result.wait();
+    }
+    task(zisc::ThreadManager::unmanagedThreadId());
+
+    // The streams are reproducible and don't overlap
+    for (std::size_t s = 0; s < value_list.size(); ++s) {
+      Engine expected = splitter.makeStream(s);
+      for (std::size_t i = 0; i < num_of_values; ++i)
+        ASSERT_EQ(expected(), value_list[s][i]) << "stream[" << s << "][" << i << "] is wrong.";
+      for (std::size_t t = 0; t < s; ++t)
+        ASSERT_NE(value_list[t], value_list[s]) << "stream " << t << " and " << s << " are same.";
+    }
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+} // namespace
+
+TEST(StreamSplitterTest, XoshiroTest)
+{
+  ::testStreamSplitter<zisc::Xoshiro2Plus128>();
+  ::testStreamSplitter<zisc::Xoshiro2Plus256>();
+
+  // The stream i is the engine jumped i times
+  const zisc::StreamSplitter<zisc::Xoshiro2Plus256> splitter{42};
+  zisc::Xoshiro2Plus256 expected{42};
+  for (std::size_t s = 0; s < 4; ++s) {
+    zisc::Xoshiro2Plus256 engine = splitter.makeStream(s);
+    zisc::Xoshiro2Plus256 e = expected;
+    ASSERT_EQ(e(), engine()) << "The stream " << s << " isn't the jumped engine.";
+    expected.jump();
+  }
+}
+
+TEST(StreamSplitterTest, PcgTest)
+{
+  ::testStreamSplitter<zisc::PcgLcgRxsMXs32>();
+  ::testStreamSplitter<zisc::PcgLcgRxsMXs64>();
+  ::testStreamSplitter<zisc::PcgMcgEngine<zisc::uint32b>>();
+
+  // The stream i of LCG engines has the same seed and the stream ID i
+  const zisc::StreamSplitter<zisc::PcgLcgRxsMXs64> splitter{42};
+  for (std::size_t s = 0; s < 4; ++s) {
+    zisc::PcgLcgRxsMXs64 engine = splitter.makeStream(s);
+    ASSERT_EQ(s, engine.stream()) << "The stream " << s << " has a wrong stream ID.";
+    zisc::PcgLcgRxsMXs64 expected{42};
+    expected.setSeed(42, zisc::cast<zisc::uint64b>(s));
+    ASSERT_EQ(expected(), engine()) << "The stream " << s << " isn't the seeded engine.";
+  }
+
+  // Large stream indices don't wrap around to the stream 0
+  using Lcg16 = zisc::PcgLcgRxsMXs16;
+  using LcgSplitter16 = zisc::StreamSplitter<Lcg16>;
+  ASSERT_EQ(std::size_t{1} << 15, LcgSplitter16::maxNumOfStreams());
+  const LcgSplitter16 splitter16{42};
+  auto get_values = [](auto engine)
+  {
+    std::vector<typename decltype(engine)::ValueT> values(16);
+    engine.fill(values);
+    return values;
+  };
+  const auto values0 = get_values(splitter16.makeStream(0));
+  for (const std::size_t s : {std::size_t{1} << 8, LcgSplitter16::maxNumOfStreams() - 1}) {
+    ASSERT_NE(values0, get_values(splitter16.makeStream(s)))
+        << "The stream " << s << " is same as the stream 0.";
+  }
+
+  // The stream i of MCG engines is the engine advanced by i * 2^(n/2) steps
+  using Mcg16 = zisc::PcgMcgEngine<zisc::uint16b>;
+  using McgSplitter16 = zisc::StreamSplitter<Mcg16>;
+  ASSERT_EQ(std::size_t{1} << 7, McgSplitter16::maxNumOfStreams());
+  const McgSplitter16 mcg_splitter16{42};
+  Mcg16 engine = mcg_splitter16.makeStream(0);
+  for (std::size_t i = 0; i < (std::size_t{1} << 7); ++i)
+    engine();
+  ASSERT_EQ(mcg_splitter16.makeStream(1)(), engine()) << "The streams aren't contiguous.";
+  const auto mcg_values0 = get_values(mcg_splitter16.makeStream(0));
+  const std::size_t last = McgSplitter16::maxNumOfStreams() - 1;
+  ASSERT_NE(mcg_values0, get_values(mcg_splitter16.makeStream(last)))
+      << "The stream " << last << " is same as the stream 0.";
+}
@@ -13,6 +13,9 @@
   */
 
 // Standard C++ library
+#include <algorithm>
+#include <cstddef>
+#include <string>
 #include <string_view>
 // GoogleTest
 #include "googletest.hpp"
@@ -20,6 +23,7 @@
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 #include "zisc/string/constant_string.hpp"
+#include "zisc/string/string_scan.hpp"
 
 TEST(ConstantStringTest, ConstructionTest)
 {
@@ -62,3 +66,33 @@ TEST(ConstantStringTest, ConstructionTest)
     EXPECT_STREQ("test", data);
   }
 }
+
+TEST(StringScanTest, FindFirstOfTest)
+{
+  // Compare with std::string_view::find_first_of at every position and length
+  std::string text;
+  for (std::size_t i = 0; i < 200; ++i)
+    text.push_back(((i % 37) == 5) ? ',' : ((i % 53) == 7) ? '"' : 'a');
+  for (std::size_t size = 0; size <= text.size(); ++size) {
+    const std::string_view t{text.data(), size};
+    for (std::size_t pos = 0; pos <= size; ++pos) {
+      const std::size_t expected = (std::min)(t.find_first_of(",\"", pos), size);
+      const std::size_t result = zisc::findFirstOf<',', '"'>(t, pos);
+      ASSERT_EQ(expected, result) << "size=" << size << ", pos=" << pos;
+    }
+  }
+}
+
+TEST(StringScanTest, CharMaskTest)
+{
+  std::string block(64, 'a');
+  zisc::uint64b expected = 0;
+  for (std::size_t i = 0; i < block.size(); i += 7) {
+    block[i] = ((i % 2) == 0) ? '{' : '}';
+    expected |= zisc::uint64b{1} << i;
+  }
+  block[63] = '}';
+  expected |= zisc::uint64b{1} << 63;
+  ASSERT_EQ(expected, (zisc::getCharMask<'{', '}'>(block.data())));
+  ASSERT_EQ(0, zisc::getCharMask<'"'>(block.data()));
+}
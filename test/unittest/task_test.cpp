@@ -0,0 +1,266 @@
+/*!
+  \file task_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/task.hpp"
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+
+namespace {
+
+zisc::Task<int> getValue([[maybe_unused]] std::pmr::memory_resource* mem_resource,
+                         const int value)
+{
+  co_return value;
+}
+
+zisc::Task<int> addValues(std::pmr::memory_resource* mem_resource, const int lhs, const int rhs)
+{
+  const int l = co_await getValue(mem_resource, lhs);
+  const int r = co_await getValue(mem_resource, rhs);
+  co_return l + r;
+}
+
+zisc::Task<zisc::int64b> getThreadId([[maybe_unused]] std::pmr::memory_resource* mem_resource,
+                                     zisc::ThreadManager& thread_manager)
+{
+  const zisc::int64b thread_id = co_await thread_manager.schedule();
+  co_return thread_id;
+}
+
+zisc::Task<int> square([[maybe_unused]] std::pmr::memory_resource* mem_resource,
+                       zisc::ThreadManager& thread_manager,
+                       const int value)
+{
+  [[maybe_unused]] const zisc::int64b thread_id = co_await thread_manager.schedule();
+  co_return value * value;
+}
+
+zisc::Task<void> increment([[maybe_unused]] std::pmr::memory_resource* mem_resource,
+                           zisc::ThreadManager& thread_manager,
+                           std::atomic<int>& counter)
+{
+  [[maybe_unused]] const zisc::int64b thread_id = co_await thread_manager.schedule();
+  counter.fetch_add(1, std::memory_order::acq_rel);
+}
+
+zisc::Task<int> throwError([[maybe_unused]] std::pmr::memory_resource* mem_resource,
+                           zisc::ThreadManager& thread_manager)
+{
+  [[maybe_unused]] const zisc::int64b thread_id = co_await thread_manager.schedule();
+  throw std::runtime_error{"Task error."};
+  co_return 0;
+}
+
+/*!
+  \brief A memory resource which fails after the given number of allocations
+  */
+class LimitedResource : public std::pmr::memory_resource
+{
+ public:
+  LimitedResource(std::pmr::memory_resource* upstream, const std::size_t limit) noexcept :
+      upstream_{upstream},
+      limit_{limit}
+  {
+  }
+
+ private:
+  auto do_allocate(const std::size_t size, const std::size_t alignment) -> void* override
+  {
+    if (limit_ == 0)
+      throw std::bad_alloc{};
+    --limit_;
+    return upstream_->allocate(size, alignment);
+  }
+
+  void do_deallocate(void* data, const std::size_t size, const std::size_t alignment) override
+  {
+    upstream_->deallocate(data, size, alignment);
+  }
+
+  auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+  {
+    return this == &other;
+  }
+
+
+  std::pmr::memory_resource* upstream_;
+  std::size_t limit_;
+};
+
+} // namespace
+
+TEST(TaskTest, SyncWaitTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    const int result = zisc::syncWait(&mem_resource, ::addValues(&mem_resource, 1, 2));
+    ASSERT_EQ(3, result);
+
+    zisc::Task<int> task = ::getValue(&mem_resource, 10);
+    ASSERT_TRUE(task.isValid());
+    ASSERT_FALSE(task.isReady()) << "The task isn't started lazily.";
+    ASSERT_EQ(10, zisc::syncWait(&mem_resource, std::move(task)));
+    ASSERT_FALSE(task.isValid());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(TaskTest, SyncWaitStressTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    // The callback on a worker thread finishes before syncWait returns
+    zisc::ThreadManager thread_manager{4, &mem_resource};
+    for (int i = 0; i < 10'000; ++i) {
+      const int result = zisc::syncWait(&mem_resource, ::square(&mem_resource, thread_manager, i % 100));
+      ASSERT_EQ((i % 100) * (i % 100), result);
+    }
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(TaskTest, ScheduleTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    constexpr zisc::int64b num_of_threads = 4;
+    zisc::ThreadManager thread_manager{num_of_threads, &mem_resource};
+    const zisc::int64b thread_id = zisc::syncWait(&mem_resource,
+                                                  ::getThreadId(&mem_resource, thread_manager));
+    ASSERT_TRUE((0 <= thread_id) && (thread_id < num_of_threads))
+        << "The coroutine wasn't resumed on a worker thread.";
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(TaskTest, WhenAllTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{4, &mem_resource};
+
+    // Variadic
+    std::atomic<int> counter{0};
+    auto task = zisc::whenAll(&mem_resource,
+                              ::square(&mem_resource, thread_manager, 2),
+                              ::square(&mem_resource, thread_manager, 3),
+                              ::increment(&mem_resource, thread_manager, counter));
+    const auto [v0, v1, v2] = zisc::syncWait(&mem_resource, std::move(task));
+    ASSERT_EQ(4, v0);
+    ASSERT_EQ(9, v1);
+    ASSERT_EQ(std::monostate{}, v2);
+    ASSERT_EQ(1, counter.load(std::memory_order::acquire));
+
+    // Thousands of in-flight tasks
+    constexpr int n = 1000;
+    std::pmr::vector<zisc::Task<int>> task_list{&mem_resource};
+    task_list.reserve(n);
+    for (int i = 0; i < n; ++i)
+      task_list.emplace_back(::square(&mem_resource, thread_manager, i));
+    const std::pmr::vector<int> value_list = zisc::syncWait(
+        &mem_resource,
+        zisc::whenAll(&mem_resource, std::move(task_list)));
+    ASSERT_EQ(static_cast<std::size_t>(n), value_list.size());
+    for (int i = 0; i < n; ++i)
+      ASSERT_EQ(i * i, value_list[static_cast<std::size_t>(i)]);
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(TaskTest, WhenAnyTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{4, &mem_resource};
+    for (int trial = 0; trial < 100; ++trial) {
+      auto task = zisc::whenAny(&mem_resource,
+                                ::square(&mem_resource, thread_manager, 2),
+                                ::square(&mem_resource, thread_manager, 3),
+                                ::square(&mem_resource, thread_manager, 4));
+      const auto [index, value] = zisc::syncWait(&mem_resource, std::move(task));
+      ASSERT_LT(index, 3u);
+      const int expected = static_cast<int>((index + 2) * (index + 2));
+      ASSERT_EQ(expected, value);
+    }
+    // Wait for the rest tasks
+    thread_manager.waitForCompletion();
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(TaskTest, ExceptionTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{2, &mem_resource};
+    ASSERT_THROW(zisc::syncWait(&mem_resource, ::throwError(&mem_resource, thread_manager)),
+                 std::runtime_error);
+
+    auto task = zisc::whenAll(&mem_resource,
+                              ::square(&mem_resource, thread_manager, 2),
+                              ::throwError(&mem_resource, thread_manager));
+    ASSERT_THROW(zisc::syncWait(&mem_resource, std::move(task)), std::runtime_error);
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(TaskTest, LaunchFailureTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{4, &mem_resource};
+    for (std::size_t limit = 2; limit < 6; ++limit) {
+      // The frame of whenAll, the state and some of the tasks are allocated
+      ::LimitedResource limited_resource{&mem_resource, limit};
+      std::pmr::vector<zisc::Task<int>> task_list{&mem_resource};
+      for (int i = 0; i < 8; ++i)
+        task_list.emplace_back(::square(&mem_resource, thread_manager, i));
+      ASSERT_THROW(zisc::syncWait(&mem_resource,
+                                  zisc::whenAll(&limited_resource, std::move(task_list))),
+                   std::bad_alloc);
+
+      ::LimitedResource limited_resource2{&mem_resource, limit};
+      auto task = zisc::whenAll(&limited_resource2,
+                                ::square(&mem_resource, thread_manager, 2),
+                                ::square(&mem_resource, thread_manager, 3),
+                                ::square(&mem_resource, thread_manager, 4),
+                                ::square(&mem_resource, thread_manager, 5));
+      ASSERT_THROW(zisc::syncWait(&mem_resource, std::move(task)), std::bad_alloc);
+      // The launched tasks complete after the failure
+      thread_manager.waitForCompletion();
+    }
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
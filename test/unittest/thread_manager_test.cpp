@@ -17,6 +17,7 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <list>
@@ -31,6 +32,7 @@
 #include "googletest.hpp"
 // Zisc
 #include "zisc/algorithm.hpp"
+#include "zisc/error.hpp"
 #include "zisc/non_copyable.hpp"
 #include "zisc/concurrency/thread_manager.hpp"
 #include "zisc/math/math.hpp"
@@ -1288,3 +1290,162 @@ TEST(ThreadManagerTest, ConcurrentThroughputTest2)
                                 true,
                                 thread_manager.get());
 }
+
+TEST(ThreadManagerTest, WorkerLocalTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    constexpr zisc::int64b num_of_threads = 8;
+    zisc::ThreadManager thread_manager{num_of_threads, &mem_resource};
+
+    auto local = thread_manager.createWorkerLocal<zisc::uint64b>(0u);
+    ASSERT_EQ(zisc::cast<std::size_t>(num_of_threads + 1), local.size())
+        << "The worker local storage doesn't have the unmanaged thread slot.";
+    // Check the alignment of instances
+    local.forEach([](zisc::uint64b& value)
+    {
+      const auto address = reinterpret_cast<std::uintptr_t>(&value);
+      ASSERT_EQ(0, address % decltype(local)::slotAlignment())
+          << "The worker local instance isn't aligned.";
+    });
+
+    // Per-thread reduction
+    constexpr zisc::uint64b n = 1000;
+    auto task = [&local](const zisc::uint64b i, const zisc::int64b thread_id)
+    {
+      local[thread_id] += i;
+    };
+    auto result = thread_manager.enqueueLoop(task, zisc::uint64b{0}, n);
+    result.wait();
+    // The unmanaged thread
+    local[zisc::ThreadManager::unmanagedThreadId()] += n;
+
+    const zisc::uint64b sum = local.combine(0u, [](const zisc::uint64b lhs,
+                                                   const zisc::uint64b rhs)
+    {
+      return lhs + rhs;
+    });
+    constexpr zisc::uint64b expected = (n * (n - 1)) / 2 + n;
+    ASSERT_EQ(expected, sum) << "The worker local reduction failed.";
+    ASSERT_EQ(n, local[zisc::ThreadManager::unmanagedThreadId()]);
+
+    // A thread ID out of the instances is rejected
+    ASSERT_THROW(static_cast<void>(local[num_of_threads]), zisc::SystemError);
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(ThreadManagerTest, WorkerLocalResizeTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{2, &mem_resource};
+    auto local = thread_manager.createWorkerLocal<zisc::uint64b>(0u);
+
+    // The worker local storage isn't resized with the thread pool
+    thread_manager.setNumOfThreads(4);
+    ASSERT_EQ(3, local.size());
+    local[1] += 1;
+    ASSERT_THROW(static_cast<void>(local[2]), zisc::SystemError);
+    ASSERT_THROW(static_cast<void>(local[3]), zisc::SystemError);
+
+    // The storage created after growing has the instances of the new workers
+    local = thread_manager.createWorkerLocal<zisc::uint64b>(0u);
+    ASSERT_EQ(5, local.size());
+    local[3] += 1;
+    ASSERT_EQ(1, local[3]);
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(ThreadManagerTest, LazyWorkerSpawnTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    constexpr zisc::int64b num_of_threads = 4;
+    zisc::ThreadManager thread_manager{num_of_threads, &mem_resource};
+    ASSERT_EQ(num_of_threads, thread_manager.numOfThreads());
+    ASSERT_EQ(0, thread_manager.numOfRunningThreads())
+        << "Worker threads are spawned before the first enqueue.";
+
+    auto result = thread_manager.enqueue([](const zisc::int64b thread_id)
+    {
+      return thread_id;
+    });
+    const zisc::int64b thread_id = result.get();
+    ASSERT_TRUE((0 <= thread_id) && (thread_id < num_of_threads));
+    ASSERT_EQ(num_of_threads, thread_manager.numOfRunningThreads());
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(ThreadManagerTest, SetNumOfThreadsTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::ThreadManager thread_manager{2, &mem_resource};
+    auto test = [&thread_manager](const zisc::int64b num_of_threads)
+    {
+      thread_manager.setNumOfThreads(num_of_threads);
+      ASSERT_EQ(num_of_threads, thread_manager.numOfThreads());
+      ASSERT_EQ(0, thread_manager.numOfRunningThreads());
+
+      constexpr int n = 256;
+      std::array<std::atomic<zisc::int64b>, n> id_list{};
+      auto task = [&id_list](const int i, const zisc::int64b thread_id)
+      {
+        id_list[i].store(thread_id, std::memory_order::release);
+      };
+      auto result = thread_manager.enqueueLoop(task, 0, n);
+      result.wait();
+      for (const std::atomic<zisc::int64b>& id : id_list) {
+        const zisc::int64b thread_id = id.load(std::memory_order::acquire);
+        ASSERT_TRUE((0 <= thread_id) && (thread_id < num_of_threads))
+            << "The thread ID " << thread_id << " is out of range.";
+      }
+      ASSERT_EQ(num_of_threads, thread_manager.numOfRunningThreads());
+    };
+    // Grow
+    test(8);
+    // Shrink
+    test(3);
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(ThreadManagerTest, IdleTimeoutTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    constexpr zisc::int64b num_of_threads = 4;
+    zisc::ThreadManager thread_manager{num_of_threads, &mem_resource};
+    ASSERT_EQ(zisc::ThreadManager::noIdleTimeout(), thread_manager.idleTimeout());
+    const std::chrono::milliseconds timeout{10};
+    thread_manager.setIdleTimeout(timeout);
+    ASSERT_EQ(timeout, thread_manager.idleTimeout());
+
+    for (int trial = 0; trial < 3; ++trial) {
+      std::atomic<int> counter{0};
+      auto task = [&counter]([[maybe_unused]] const int i)
+      {
+        counter.fetch_add(1, std::memory_order::acq_rel);
+      };
+      constexpr int n = 100;
+      auto result = thread_manager.enqueueLoop(task, 0, n);
+      result.wait();
+      ASSERT_EQ(n, counter.load(std::memory_order::acquire));
+
+      // Wait until all parked workers retire
+      for (int i = 0; (i < 1000) && (0 < thread_manager.numOfRunningThreads()); ++i)
+        std::this_thread::sleep_for(timeout);
+      ASSERT_EQ(0, thread_manager.numOfRunningThreads())
+          << "The parked workers didn't retire.";
+    }
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
@@ -0,0 +1,125 @@
+/*!
+  \file tree_hash_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/zisc_config.hpp"
+#include "zisc/concurrency/thread_manager.hpp"
+#include "zisc/hash/tree_hash.hpp"
+#include "zisc/hash/wy_hash_engine.hpp"
+#include "zisc/hash/xxh3_hash_engine.hpp"
+#include "zisc/memory/alloc_free_resource.hpp"
+
+namespace {
+
+//! Make data which is hashed by the tree hash
+std::vector<zisc::uint8b> makeData(const std::size_t n)
+{
+  std::vector<zisc::uint8b> data(n);
+  zisc::uint64b x = 0x9e3779b97f4a7c15;
+  for (zisc::uint8b& d : data) {
+    x = 6364136223846793005ull * x + 1442695040888963407ull;
+    d = static_cast<zisc::uint8b>(x >> 56);
+  }
+  return data;
+}
+
+//! Compute a tree hash by combining each level in pairs
+template <typename Hash>
+zisc::uint64b computeReference(const std::vector<zisc::uint8b>& data,
+                               const std::size_t leaf_size)
+{
+  std::vector<zisc::uint64b> level;
+  for (std::size_t offset = 0; (offset < data.size()) || level.empty(); offset += leaf_size) {
+    const std::size_t size = (std::min)(leaf_size, data.size() - offset);
+    level.push_back(Hash::hash(data.data() + offset, size));
+  }
+  auto to_bytes = [](std::vector<zisc::uint8b>& node, const zisc::uint64b value)
+  {
+    for (std::size_t i = 0; i < sizeof(zisc::uint64b); ++i)
+      node.push_back(static_cast<zisc::uint8b>(value >> (8 * i)));
+  };
+  while (1 < level.size()) {
+    std::vector<zisc::uint64b> next;
+    for (std::size_t i = 0; i < level.size(); i += 2) {
+      if ((i + 1) == level.size()) {
+        next.push_back(level[i]);
+        continue;
+      }
+      std::vector<zisc::uint8b> node{0x01};
+      to_bytes(node, level[i]);
+      to_bytes(node, level[i + 1]);
+      next.push_back(Hash::hash(node.data(), node.size()));
+    }
+    level = std::move(next);
+  }
+  std::vector<zisc::uint8b> root{0x02};
+  to_bytes(root, level[0]);
+  to_bytes(root, data.size());
+  return Hash::hash(root.data(), root.size());
+}
+
+} // namespace
+
+TEST(TreeHashTest, SequentialHashTest)
+{
+  using TreeHash = zisc::TreeHash<zisc::Xxh3Hash64>;
+  for (const std::size_t n : {0, 1, 63, 64, 65, 1000, 4096, 10000}) {
+    const std::vector<zisc::uint8b> data = ::makeData(n);
+    for (const std::size_t leaf_size : {1, 7, 64, 1024}) {
+      const zisc::uint64b expected = ::computeReference<zisc::Xxh3Hash64>(data, leaf_size);
+      const zisc::uint64b result = TreeHash::hash(std::span{data}, leaf_size);
+      ASSERT_EQ(expected, result)
+          << "Tree hash of " << n << " bytes with " << leaf_size << " bytes leaves failed.";
+    }
+  }
+  {
+    constexpr std::array<char, 6> data{{'f', 'o', 'o', 'b', 'a', 'r'}};
+    constexpr zisc::uint64b result = TreeHash::hash(std::span{data}, 2);
+    ASSERT_EQ(TreeHash::hash(std::span{data.data(), data.size()}, 2), result);
+    ASSERT_NE(TreeHash::hash(std::span{data}, 3), result)
+        << "The leaf size doesn't affect the tree hash.";
+  }
+  ASSERT_EQ(1, TreeHash::numOfLeaves(0, 16));
+  ASSERT_EQ(1, TreeHash::numOfLeaves(16, 16));
+  ASSERT_EQ(2, TreeHash::numOfLeaves(17, 16));
+}
+
+TEST(TreeHashTest, ParallelHashTest)
+{
+  using TreeHash = zisc::TreeHash<zisc::WyHash64>;
+  zisc::AllocFreeResource mem_resource;
+  const std::vector<zisc::uint8b> data = ::makeData(1 << 20);
+  for (const zisc::int64b num_of_threads : {1, 2, 3, 8}) {
+    zisc::ThreadManager thread_manager{num_of_threads, &mem_resource};
+    for (const std::size_t leaf_size : {1000, 4096, 1 << 20, 1 << 21}) {
+      const zisc::uint64b expected = TreeHash::hash(std::span{data}, leaf_size);
+      const zisc::uint64b result = TreeHash::hash(std::span{data},
+                                                  thread_manager,
+                                                  &mem_resource,
+                                                  leaf_size);
+      ASSERT_EQ(expected, result) << "Tree hash with " << num_of_threads
+                                  << " threads and " << leaf_size << " bytes leaves failed.";
+    }
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
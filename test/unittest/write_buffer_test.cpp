@@ -0,0 +1,136 @@
+/*!
+  \file write_buffer_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// GoogleTest
+#include "googletest.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+// Zisc
+#include "zisc/memory/alloc_free_resource.hpp"
+#include "zisc/string/json_value_parser.hpp"
+#include "zisc/string/write_buffer.hpp"
+// Platform
+#if defined(Z_LINUX) || defined(Z_MAC)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+TEST(WriteBufferTest, FormatTest)
+{
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::WriteBuffer buffer{&mem_resource};
+    ASSERT_FALSE(buffer.hasFileDescriptor());
+    buffer.appendInteger(0);
+    buffer.append(',');
+    buffer.appendInteger((std::numeric_limits<std::int64_t>::min)());
+    buffer.append(',');
+    buffer.appendInteger((std::numeric_limits<std::uint64_t>::max)());
+    buffer.append(std::string_view{","});
+    buffer.appendFloat(0.1);
+    buffer.append(',');
+    buffer.appendFloat(-1.0e300);
+    buffer.append(',');
+    buffer.appendFloat(0.1f);
+    ASSERT_EQ("0,-9223372036854775808,18446744073709551615,0.1,-1e+300,0.1", buffer.view());
+
+    // Floats round-trip
+    for (int i = 1; i < 1000; ++i) {
+      const double expected = 1.0 / static_cast<double>(i * 7);
+      buffer.clear();
+      buffer.appendFloat(expected);
+      ASSERT_EQ(expected, zisc::JsonValueParser::toCxxFloat<double>(buffer.view()));
+    }
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+}
+
+TEST(WriteBufferTest, FlushTest)
+{
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(nullptr, file);
+
+  zisc::AllocFreeResource mem_resource;
+  std::string expected;
+  {
+    zisc::WriteBuffer buffer{fileno(file), &mem_resource, 100};
+    ASSERT_TRUE(buffer.hasFileDescriptor());
+    for (int i = 0; i < 1000; ++i) {
+      buffer.appendInteger(i);
+      buffer.append('\n');
+      expected += std::to_string(i) + "\n";
+      ASSERT_GT(buffer.flushSize(), buffer.size()) << "The buffer isn't flushed.";
+    }
+    // A large string is written directly
+    const std::string large(300, 'x');
+    buffer.append(large);
+    expected += large;
+    ASSERT_EQ(0, buffer.size());
+    buffer.append("tail");
+    expected += "tail";
+    // The rest is flushed on destruction
+  }
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+
+  std::string text(expected.size() + 1, '\0');
+  std::rewind(file);
+  text.resize(std::fread(text.data(), 1, text.size(), file));
+  std::fclose(file);
+  ASSERT_EQ(expected, text);
+}
+
+#if defined(Z_LINUX) || defined(Z_MAC)
+
+TEST(WriteBufferTest, FlushRetryTest)
+{
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  // Writing to a read-only descriptor fails
+  const int fd = ::open("/dev/null", O_RDONLY);
+  ASSERT_LE(0, fd);
+
+  zisc::AllocFreeResource mem_resource;
+  {
+    zisc::WriteBuffer buffer{fd, &mem_resource, 100};
+    buffer.append("retry");
+    ASSERT_THROW(buffer.flush(), std::system_error);
+    ASSERT_EQ("retry", buffer.view()) << "The bytes are lost on the failed flush.";
+    ASSERT_EQ(0, buffer.totalFlushedSize());
+
+    // Retry after the descriptor becomes writable
+    ASSERT_LE(0, ::dup2(fileno(file), fd));
+    buffer.flush();
+    ASSERT_EQ(0, buffer.size());
+    ASSERT_EQ(5, buffer.totalFlushedSize());
+  }
+  ::close(fd);
+  ASSERT_EQ(0, mem_resource.totalMemoryUsage())
+      << mem_resource.totalMemoryUsage() << " bytes isn't deallocated.";
+
+  std::string text(6, '\0');
+  std::rewind(file);
+  text.resize(std::fread(text.data(), 1, text.size(), file));
+  std::fclose(file);
+  ASSERT_EQ("retry", text);
+}
+
+#endif // Z_LINUX || Z_MAC
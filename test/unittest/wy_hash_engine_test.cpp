@@ -0,0 +1,218 @@
+/*!
+  \file wy_hash_engine_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/zisc_config.hpp"
+#include "zisc/hash/wy_hash_engine.hpp"
+
+namespace {
+
+//! Make a key which is long enough to use the bulk loop
+constexpr auto makeLongKey() noexcept -> std::array<char, 3000>
+{
+  std::array<char, 3000> key{};
+  for (std::size_t i = 0; i < key.size(); ++i)
+    key[i] = static_cast<char>('a' + (i % 26));
+  return key;
+}
+
+} // namespace
+
+TEST(WyHashEngineTest, 32BitHashTest)
+{
+  using Hash = zisc::WyHash32;
+  {
+    constexpr char seed[] = "";
+    constexpr zisc::uint32b result = Hash::hash(seed);
+    ASSERT_EQ(0xe0eec5a2, result) << "32bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "a";
+    constexpr zisc::uint32b result = Hash::hash(seed);
+    ASSERT_EQ(0x7fe5bff8, result) << "32bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "foobar";
+    constexpr zisc::uint32b result = Hash::hash(seed);
+    ASSERT_EQ(0x140588a1, result) << "32bit hash test failed.";
+  }
+  {
+    constexpr std::array<char, 3000> seed = ::makeLongKey();
+    constexpr zisc::uint32b result = Hash::hash(seed.data(), seed.size());
+    ASSERT_EQ(0x24e12c28, result) << "32bit hash test failed.";
+    const zisc::uint32b runtime_result = Hash::hash(std::string_view{seed.data(), seed.size()});
+    ASSERT_EQ(result, runtime_result) << "32bit hash test failed.";
+  }
+}
+
+TEST(WyHashEngineTest, 64BitHashTest)
+{
+  using Hash = zisc::WyHash64;
+  {
+    constexpr char seed[] = "";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x93228a4de0eec5a2, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "a";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0xaced12527fe5bff8, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "abc";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x989b4a209c1011c9, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "foobar";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x3ab768b7140588a1, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "message digest";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x309ab4c045215e8f, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "abcdefghijklmnopqrstuvwxyz";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0xccaeadc12a061176, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x1fdd130ecb5b4709, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr std::array<char, 200> seed = [](){
+      std::array<char, 200> s{};
+      s.fill('x');
+      return s;
+    }();
+    constexpr zisc::uint64b result = Hash::hash(seed.data(), seed.size());
+    ASSERT_EQ(0x977d2a97e48fe6ab, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr std::array<char, 3000> seed = ::makeLongKey();
+    constexpr zisc::uint64b result = Hash::hash(seed.data(), seed.size());
+    ASSERT_EQ(0x305f168924e12c28, result) << "64bit hash test failed.";
+    const zisc::uint64b runtime_result = Hash::hash(std::string_view{seed.data(), seed.size()});
+    ASSERT_EQ(result, runtime_result) << "64bit hash test failed.";
+  }
+}
+
+TEST(WyHashEngineTest, SeededHashTest)
+{
+  using Hash = zisc::WyHash64;
+  // The test vectors of the upstream, of which the seed is the index
+  constexpr std::array<std::string_view, 7> keys{{
+      "",
+      "a",
+      "abc",
+      "message digest",
+      "abcdefghijklmnopqrstuvwxyz",
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+      "12345678901234567890123456789012345678901234567890123456789012345678901234567890"}};
+  constexpr std::array<zisc::uint64b, 7> expected{{0x93228a4de0eec5a2,
+                                                   0xc5bac3db178713c4,
+                                                   0xa97f2f7b1d9b3314,
+                                                   0x786d1f1df3801df4,
+                                                   0xdca5a8138ad37c87,
+                                                   0xb9e734f117cfaf70,
+                                                   0x6cc5eab49a92d617}};
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    const zisc::uint64b result = Hash::hashWithSeed(keys[i].data(), keys[i].size(), i);
+    ASSERT_EQ(expected[i], result) << "Seeded hash of key " << i << " failed.";
+  }
+  {
+    constexpr zisc::uint64b result = Hash::hashWithSeed("a", 1, 1);
+    ASSERT_EQ(expected[1], result) << "Seeded hash failed in constant evaluation.";
+  }
+}
+
+TEST(WyHashEngineTest, IncrementalHashTest)
+{
+  using Hash = zisc::WyHash64;
+  constexpr std::array<char, 3000> key = ::makeLongKey();
+  // Chunks across the buffer and block boundaries
+  constexpr std::array<std::size_t, 8> chunk_sizes{{1, 3, 16, 47, 64, 255, 1000, 3000}};
+  for (std::size_t n = 0; n <= key.size(); n += (n < 300) ? 1 : 97) {
+    const std::string_view seed{key.data(), n};
+    const zisc::uint64b expected = Hash::hash(seed);
+    for (const std::size_t chunk_size : chunk_sizes) {
+      Hash::Hasher hasher;
+      for (std::size_t i = 0; i < n; i += chunk_size)
+        hasher.update(seed.substr(i, chunk_size));
+      ASSERT_EQ(expected, hasher.finalize())
+          << "Incremental hash of " << n << " bytes by " << chunk_size << " bytes failed.";
+    }
+  }
+  {
+    constexpr zisc::uint64b result = []()
+    {
+      const std::array<char, 3000> k = ::makeLongKey();
+      Hash::Hasher hasher;
+      hasher.update(std::string_view{"abcdefghijklmnopqrstuvwxyz"});
+      hasher.update(std::span{k}.subspan(26, 2000));
+      hasher.update(k.data() + 2026, k.size() - 2026);
+      return hasher.finalize();
+    }();
+    ASSERT_EQ(Hash::hash(key.data(), key.size()), result) << "Incremental hash failed.";
+  }
+  {
+    Hash::Hasher hasher;
+    hasher.update(std::string_view{"garbage"});
+    hasher.reset();
+    hasher.update(std::string_view{"foobar"});
+    ASSERT_EQ(Hash::hash("foobar"), hasher.finalize()) << "Resetting the hasher failed.";
+  }
+}
+
+TEST(WyHashEngineTest, BatchHashTest)
+{
+  using Hash = zisc::WyHash64;
+  constexpr std::array<char, 3000> key = ::makeLongKey();
+  // Keys of various lengths, including signed bytes
+  std::vector<std::string> key_list;
+  for (std::size_t i = 0; i < 203; ++i) {
+    std::string k{key.data() + i, (i * 7) % 41};
+    if ((i % 3) == 0)
+      k += static_cast<char>(0x80 + i % 128);
+    key_list.push_back(std::move(k));
+  }
+  const std::vector<std::string_view> keys{key_list.begin(), key_list.end()};
+  std::vector<zisc::uint64b> values(keys.size());
+  Hash::hashBatch(keys, values);
+  for (std::size_t i = 0; i < keys.size(); ++i)
+    ASSERT_EQ(Hash::hash(keys[i]), values[i]) << "Batch hash of key " << i << " failed.";
+
+  // Integer keys
+  std::vector<zisc::uint32b> int_keys(203);
+  for (std::size_t i = 0; i < int_keys.size(); ++i)
+    int_keys[i] = static_cast<zisc::uint32b>(i * 0x9e37'79b1u);
+  Hash::hashBatch(std::span<const zisc::uint32b>{int_keys}, values);
+  for (std::size_t i = 0; i < int_keys.size(); ++i)
+    ASSERT_EQ(Hash::hash(int_keys[i]), values[i]) << "Batch hash of key " << i << " failed.";
+}
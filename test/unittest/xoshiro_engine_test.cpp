@@ -13,6 +13,7 @@
   */
 
 // Standard C++ library
+#include <array>
 #include <fstream>
 #include <string_view>
 // GoogleTest
@@ -40,6 +41,25 @@ void testXoshiroEngine(const std::string_view reference_path)
   }
 }
 
+template <typename XoshiroEngine>
+void testXoshiroJump(const std::array<typename XoshiroEngine::ValueT, 4>& jump_reference,
+                     const std::array<typename XoshiroEngine::ValueT, 4>& long_jump_reference)
+{
+  using ValueType = typename XoshiroEngine::ValueT;
+  XoshiroEngine sampler{123456789};
+
+  sampler.jump();
+  for (std::size_t i = 0; i < jump_reference.size(); ++i) {
+    const ValueType r = sampler();
+    ASSERT_EQ(jump_reference[i], r) << "xoshiro jump[" << i << "] is wrong.";
+  }
+  sampler.longJump();
+  for (std::size_t i = 0; i < long_jump_reference.size(); ++i) {
+    const ValueType r = sampler();
+    ASSERT_EQ(long_jump_reference[i], r) << "xoshiro long jump[" << i << "] is wrong.";
+  }
+}
+
 } // namespace
 
 #define XOSHIRO_TEST(engine_type, reference_path) \
@@ -54,3 +74,19 @@ XOSHIRO_TEST(Xoshiro2Star128, "resources/xoshiro128_2star_reference.txt")
 XOSHIRO_TEST(XoshiroPlus256, "resources/xoshiro256_plus_reference.txt")
 XOSHIRO_TEST(Xoshiro2Plus256, "resources/xoshiro256_2plus_reference.txt")
 XOSHIRO_TEST(Xoshiro2Star256, "resources/xoshiro256_2star_reference.txt")
+
+TEST(RandomNumberEngine, Xoshiro2Plus128JumpTest)
+{
+  ::testXoshiroJump<zisc::Xoshiro2Plus128>(
+      {{4014342491U, 3517874309U, 896834643U, 2044285769U}},
+      {{1323759661U, 2738443241U, 716063684U, 1476483623U}});
+}
+
+TEST(RandomNumberEngine, Xoshiro2Plus256JumpTest)
+{
+  ::testXoshiroJump<zisc::Xoshiro2Plus256>(
+      {{16180574903789456889ULL, 14287251362630903769ULL,
+        9565116949723864598ULL, 7725203269884970423ULL}},
+      {{17301562788560543766ULL, 14574946065636448124ULL,
+        4138808983181220635ULL, 3769511567995451226ULL}});
+}
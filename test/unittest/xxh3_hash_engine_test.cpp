@@ -0,0 +1,170 @@
+/*!
+  \file xxh3_hash_engine_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2023 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+// GoogleTest
+#include "googletest.hpp"
+// Zisc
+#include "zisc/zisc_config.hpp"
+#include "zisc/hash/xxh3_hash_engine.hpp"
+
+namespace {
+
+//! Make a key which is long enough to use the bulk loop
+constexpr auto makeLongKey() noexcept -> std::array<char, 3000>
+{
+  std::array<char, 3000> key{};
+  for (std::size_t i = 0; i < key.size(); ++i)
+    key[i] = static_cast<char>('a' + (i % 26));
+  return key;
+}
+
+} // namespace
+
+TEST(Xxh3HashEngineTest, 32BitHashTest)
+{
+  using Hash = zisc::Xxh3Hash32;
+  {
+    constexpr char seed[] = "";
+    constexpr zisc::uint32b result = Hash::hash(seed);
+    ASSERT_EQ(0x38d394c2, result) << "32bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "a";
+    constexpr zisc::uint32b result = Hash::hash(seed);
+    ASSERT_EQ(0x1e964e1f, result) << "32bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "foobar";
+    constexpr zisc::uint32b result = Hash::hash(seed);
+    ASSERT_EQ(0x144c5c84, result) << "32bit hash test failed.";
+  }
+  {
+    constexpr std::array<char, 200> seed = [](){
+      std::array<char, 200> s{};
+      s.fill('x');
+      return s;
+    }();
+    constexpr zisc::uint32b result = Hash::hash(seed.data(), seed.size());
+    ASSERT_EQ(0xb1e4de53, result) << "32bit hash test failed.";
+  }
+  {
+    constexpr std::array<char, 3000> seed = ::makeLongKey();
+    constexpr zisc::uint32b result = Hash::hash(seed.data(), seed.size());
+    ASSERT_EQ(0x9577de82, result) << "32bit hash test failed.";
+    // The runtime path uses SIMD and unaligned loads
+    const zisc::uint32b runtime_result = Hash::hash(std::string_view{seed.data(), seed.size()});
+    ASSERT_EQ(result, runtime_result) << "32bit hash test failed.";
+  }
+}
+
+TEST(Xxh3HashEngineTest, 64BitHashTest)
+{
+  using Hash = zisc::Xxh3Hash64;
+  {
+    constexpr char seed[] = "";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x2d06800538d394c2, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "a";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0xe6c632b61e964e1f, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "abc";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x78af5f94892f3950, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "foobar";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0xd78fda63144c5c84, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "message digest";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x160d8e9329be94f9, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "abcdefghijklmnopqrstuvwxyz";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x810f9ca067fbb90c, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr char seed[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    constexpr zisc::uint64b result = Hash::hash(seed);
+    ASSERT_EQ(0x643542bb51639cb2, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr std::array<char, 200> seed = [](){
+      std::array<char, 200> s{};
+      s.fill('x');
+      return s;
+    }();
+    constexpr zisc::uint64b result = Hash::hash(seed.data(), seed.size());
+    ASSERT_EQ(0x50ef124fb1e4de53, result) << "64bit hash test failed.";
+  }
+  {
+    constexpr std::array<char, 3000> seed = ::makeLongKey();
+    constexpr zisc::uint64b result = Hash::hash(seed.data(), seed.size());
+    ASSERT_EQ(0x2543c13b9577de82, result) << "64bit hash test failed.";
+    // The runtime path uses SIMD and unaligned loads
+    const zisc::uint64b runtime_result = Hash::hash(std::string_view{seed.data(), seed.size()});
+    ASSERT_EQ(result, runtime_result) << "64bit hash test failed.";
+  }
+}
+
+TEST(Xxh3HashEngineTest, IncrementalHashTest)
+{
+  using Hash = zisc::Xxh3Hash64;
+  constexpr std::array<char, 3000> key = ::makeLongKey();
+  // Chunks across the buffer and block boundaries
+  constexpr std::array<std::size_t, 8> chunk_sizes{{1, 3, 16, 47, 64, 255, 1000, 3000}};
+  for (std::size_t n = 0; n <= key.size(); n += (n < 300) ? 1 : 97) {
+    const std::string_view seed{key.data(), n};
+    const zisc::uint64b expected = Hash::hash(seed);
+    for (const std::size_t chunk_size : chunk_sizes) {
+      Hash::Hasher hasher;
+      for (std::size_t i = 0; i < n; i += chunk_size)
+        hasher.update(seed.substr(i, chunk_size));
+      ASSERT_EQ(expected, hasher.finalize())
+          << "Incremental hash of " << n << " bytes by " << chunk_size << " bytes failed.";
+    }
+  }
+  {
+    constexpr zisc::uint64b result = []()
+    {
+      const std::array<char, 3000> k = ::makeLongKey();
+      Hash::Hasher hasher;
+      hasher.update(std::string_view{"abcdefghijklmnopqrstuvwxyz"});
+      hasher.update(std::span{k}.subspan(26, 2000));
+      hasher.update(k.data() + 2026, k.size() - 2026);
+      return hasher.finalize();
+    }();
+    ASSERT_EQ(Hash::hash(key.data(), key.size()), result) << "Incremental hash failed.";
+  }
+  {
+    Hash::Hasher hasher;
+    hasher.update(std::string_view{"garbage"});
+    hasher.reset();
+    hasher.update(std::string_view{"foobar"});
+    ASSERT_EQ(Hash::hash("foobar"), hasher.finalize()) << "Resetting the hasher failed.";
+  }
+}